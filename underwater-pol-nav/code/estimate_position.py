@@ -29,7 +29,7 @@ from simulate import oceanstokes, oceanaop
 from polarization import *
 from plot_utils import *
 from stats_utils import *
-from geomag.emm import EMMMesh
+from geomag.emm import EMMMesh, DeclinationRaster
 
 from datetime import datetime, timedelta, timezone
 import scipy.stats as stats
@@ -323,11 +323,14 @@ sun_pos_error = sun_pos_error_l1
 residuals_name = 'residuals-L1.h5'
 
 def declination(lat,lon,elev,t,gm,radians=True):
-    b = broadcast(lat,lon,elev,t)
-    res = empty(b.shape)
-    for i,x in enumerate(b):
-        la,lo,el,tt = x
-        res.flat[i] = gm.declination(la,lo,el,gm.decimal_year(tt))
+    if isinstance(gm,DeclinationRaster):
+        #precomputed for a single date and height
+        res = gm.declination(lat,lon)
+    elif ndim(lat) == 0 and ndim(lon) == 0 and ndim(elev) == 0:
+        #fixed site (one video): evaluate the field once per epoch, not once per frame
+        res = gm.declination_series(lat,lon,elev,t,timestamps=True)
+    else:
+        res = gm.compute_field_array(lat,lon,elev,t,timestamps=True)['Decl']
     if radians:
         res = deg2rad(res)
     return res
@@ -391,6 +394,21 @@ def fit_sun_to_aop(aop,head,pitch,sun_head_guess=None,ridx=1.33,verbose=False,vl
     _p(v,0,'DONE',flush=True)
     return sun_hz
 
+DECL_RASTER_RMS = 0.05 #deg, rms error allowed for the declination raster of the position search
+DECL_RASTER_FINEST = 0.125 #deg, finest spacing it is refined to
+
+def declination_raster(gm,year,lat_range,max_rms=DECL_RASTER_RMS):
+    """DeclinationRaster of gm at year over lat_range (clipped to +-90 deg). The spacing starts at the
+    latitude spacing of an EMMMesh, or 0.5 deg if that is coarser or gm is an EMMSph, and is halved down to
+    DECL_RASTER_FINEST while the rms error against the model (interpolation_error) is above max_rms deg."""
+    lat_range = (max(min(lat_range),-90),min(max(lat_range),90))
+    res = min(0.5,gm.lat_resolution()) if isinstance(gm,EMMMesh) else 0.5
+    raster = DeclinationRaster(gm,year,lat_range,resolution=res)
+    while res/2 >= DECL_RASTER_FINEST and raster.interpolation_error()[1] > max_rms:
+        res /= 2
+        raster = DeclinationRaster(gm,year,lat_range,resolution=res)
+    return raster
+
 def fit_gps_to_sun(t,sun_pos,gm,lat_range=(-70,70),verbose=False,vl=0):
     v = verbose
     _p(v,vl,'Fitting gps to sun position... ',end='',flush=True)
@@ -399,13 +417,15 @@ def fit_gps_to_sun(t,sun_pos,gm,lat_range=(-70,70),verbose=False,vl=0):
     err_lat = linspace(lat_min,lat_max,(lat_max-lat_min)/5 + 1)
     err_lon = linspace(0,355,355/5+1)
     err_lon,err_lat = meshgrid(err_lon,err_lat)
-    #minimum error over grid:
+    #declination at the date of the video, interpolated instead of evaluating the model at each trial position
+    gm = declination_raster(gm,gm.decimal_year(t),(lat_min-10,lat_max+10))
+    #minimum error over grid (sunpos and the raster take the whole grid at once):
     sun_h,sun_z = sun_pos
-    min_idx = argmin(gps_error_vec(err_lat,err_lon,t,sun_h,sun_z,gm))
+    min_idx = argmin(gps_error(err_lat,err_lon,t,sun_h,sun_z,gm))
     x0 = (err_lat.flat[min_idx], err_lon.flat[min_idx])
     #search around that point now:
     minfun = lambda x, *args: gps_error(x[0],x[1],*args) #also log(gps_error(...))
-    fit = minimize(minfun,x0=x0,args=(t,sun_h,sun_z,gm),bounds=[(lat_min-5,lat_max+5),(-360,360)])
+    fit = minimize(minfun,x0=x0,args=(t,sun_h,sun_z,gm),bounds=[(max(lat_min-5,-90),min(lat_max+5,90)),(-360,360)])
     fit_gps = fit.x
     _p(v,0,'DONE',flush=True)
     return fit_gps
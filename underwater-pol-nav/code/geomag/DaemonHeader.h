@@ -0,0 +1,56 @@
+#ifndef DAEMONHEADER_H
+#define DAEMONHEADER_H
+
+#include <stddef.h>
+
+/*Query daemon protocol*/
+/*emm_daemon keeps the models and meshes loaded and answers batched queries over a Unix domain socket.
+A client sends a request header followed by n latitudes, n longitudes, n heights (km) and n decimal years,
+each as an array of doubles. The daemon answers with a response header followed by EMM_DAEMON_NELEMENTS
+arrays of n doubles, in the order of the members of MAGtype_GeoMagneticElements (Decl, Incl, F, H, X, Y, Z,
+GV, Decldot, Incldot, Fdot, Hdot, Xdot, Ydot, Zdot, GVdot). All numbers are in native byte order. A
+connection may carry any number of requests.*/
+
+#define EMM_DAEMON_REQUEST_MAGIC "EMMQ"
+#define EMM_DAEMON_RESPONSE_MAGIC "EMMR"
+#define EMM_DAEMON_NELEMENTS 16         /* Arrays in a response */
+#define EMM_DAEMON_MAXPOINTS (1 << 22)  /* Most points in one request */
+
+#define EMM_DAEMON_SPH 0                /* method: spherical harmonic models, as emm_sph_file */
+#define EMM_DAEMON_MESH 1               /* method: static and secular variation meshes, as EMMMesh */
+
+#define EMM_DAEMON_GEOID 1              /* flags: heights are above MSL instead of the WGS-84 ellipsoid */
+
+typedef struct {
+    char magic[4]; /* EMM_DAEMON_REQUEST_MAGIC */
+    int method;
+    int flags;
+    int n; /* number of points */
+} EMM_daemon_request;
+
+typedef struct {
+    char magic[4]; /* EMM_DAEMON_RESPONSE_MAGIC */
+    int status; /* EMM_DAEMON_OK or an error code, no arrays follow an error */
+    int n;
+    int nelements; /* EMM_DAEMON_NELEMENTS */
+} EMM_daemon_response;
+
+/* status codes */
+
+#define EMM_DAEMON_OK                   0
+#define EMM_DAEMON_IO_ERROR             -1 /* Connection failed or closed (client side only) */
+#define EMM_DAEMON_PROTOCOL_ERROR       1  /* Bad request header, the daemon closes the connection */
+#define EMM_DAEMON_TOO_MANY_POINTS      2  /* n above EMM_DAEMON_MAXPOINTS */
+#define EMM_DAEMON_NO_MESH              3  /* Mesh method requested from a daemon started without meshes */
+#define EMM_DAEMON_MEM_ALLOC_ERROR      4  /* Daemon ran out of memory */
+
+int EMM_daemon_connect(const char *path);
+int EMM_daemon_query(int fd, int method, int flags, int n, const double lat[], const double lon[], const double alt[],
+        const double year[], double elements[]);
+void EMM_daemon_close(int fd);
+int EMM_daemon_read(int fd, void *buffer, size_t size);
+int EMM_daemon_write(int fd, const void *buffer, size_t size);
+
+/*End of query daemon protocol*/
+
+#endif /*DAEMONHEADER_H*/
@@ -0,0 +1,116 @@
+
+/* Client side of the emm_daemon protocol (see DaemonHeader.h), also used by the daemon for its socket I/O.
+POSIX only. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "DaemonHeader.h"
+
+int EMM_daemon_connect(const char *path)
+/* Connects to the daemon listening on the socket path; the descriptor for EMM_daemon_query, or -1 */
+{
+    struct sockaddr_un addr;
+    int fd;
+
+    if(strlen(path) >= sizeof (addr.sun_path))
+        return -1;
+    memset(&addr, 0, sizeof (addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd < 0)
+        return -1;
+    if(connect(fd, (struct sockaddr *) &addr, sizeof (addr)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+} /*EMM_daemon_connect*/
+
+int EMM_daemon_query(int fd, int method, int flags, int n, const double lat[], const double lon[], const double alt[],
+        const double year[], double elements[])
+
+/* Evaluates n points on the daemon.
+INPUT   fd              From EMM_daemon_connect
+        method          EMM_DAEMON_SPH or EMM_DAEMON_MESH
+        flags           EMM_DAEMON_GEOID for heights above MSL, otherwise 0
+        n               Number of points, at most EMM_DAEMON_MAXPOINTS
+        lat, lon        Geodetic latitudes and longitudes in degrees
+        alt             Heights in km
+        year            Decimal years
+OUTPUT  elements        EMM_DAEMON_NELEMENTS arrays of n values, in the order of MAGtype_GeoMagneticElements
+                        (elements[3 * n + i] is H of point i)
+Returns EMM_DAEMON_OK, a status code of the daemon or EMM_DAEMON_IO_ERROR
+ */
+{
+    EMM_daemon_request request;
+    EMM_daemon_response response;
+
+    memcpy(request.magic, EMM_DAEMON_REQUEST_MAGIC, 4);
+    request.method = method;
+    request.flags = flags;
+    request.n = n;
+    if(!EMM_daemon_write(fd, &request, sizeof (request)) ||
+            !EMM_daemon_write(fd, lat, n * sizeof (double)) || !EMM_daemon_write(fd, lon, n * sizeof (double)) ||
+            !EMM_daemon_write(fd, alt, n * sizeof (double)) || !EMM_daemon_write(fd, year, n * sizeof (double)) ||
+            !EMM_daemon_read(fd, &response, sizeof (response)) || memcmp(response.magic, EMM_DAEMON_RESPONSE_MAGIC, 4) != 0)
+        return EMM_DAEMON_IO_ERROR;
+    if(response.status != EMM_DAEMON_OK)
+        return response.status;
+    if(response.n != n || response.nelements != EMM_DAEMON_NELEMENTS ||
+            !EMM_daemon_read(fd, elements, (size_t) n * EMM_DAEMON_NELEMENTS * sizeof (double)))
+        return EMM_DAEMON_IO_ERROR;
+    return EMM_DAEMON_OK;
+} /*EMM_daemon_query*/
+
+void EMM_daemon_close(int fd)
+{
+    if(fd >= 0)
+        close(fd);
+} /*EMM_daemon_close*/
+
+int EMM_daemon_read(int fd, void *buffer, size_t size)
+/* Reads exactly size bytes; FALSE (0) on error or end of file */
+{
+    ssize_t got;
+    char *p = buffer;
+
+    while(size > 0)
+    {
+        got = read(fd, p, size);
+        if(got < 0 && errno == EINTR)
+            continue;
+        if(got <= 0)
+            return 0;
+        p += got;
+        size -= got;
+    }
+    return 1;
+} /*EMM_daemon_read*/
+
+int EMM_daemon_write(int fd, const void *buffer, size_t size)
+/* Writes exactly size bytes; FALSE (0) on error */
+{
+    ssize_t put;
+    const char *p = buffer;
+
+    while(size > 0)
+    {
+        put = write(fd, p, size);
+        if(put < 0 && errno == EINTR)
+            continue;
+        if(put <= 0)
+            return 0;
+        p += put;
+        size -= put;
+    }
+    return 1;
+} /*EMM_daemon_write*/
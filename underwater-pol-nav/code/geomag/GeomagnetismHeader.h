@@ -26,6 +26,8 @@
 #ifndef GEOMAGHEADER_H
 #define GEOMAGHEADER_H
 
+#include <stdio.h>
+
 #define READONLYMODE "r"
 #define MAXLINELENGTH (1024)
 #define NOOFPARAMS (15)
@@ -203,6 +205,28 @@ typedef struct {
     double PointScale;
 } MAGtype_UTMParameters;
 
+#define MAG_COLUMN_MAGIC "MAGCOLS1"     /* First 8 bytes of a columnar binary file, see MAG_ColumnFileCreate */
+#define MAG_COLUMN_NAME_LENGTH 32       /* Bytes per column name, NUL padded */
+#define MAG_COLUMN_ALIGN 64             /* Alignment of the data */
+#define MAG_COLUMN_BLOCK_ROWS 65536     /* Rows per block written */
+#define MAG_COLUMN_BLOCK_ROWS_MAX (1 << 24) /* Largest block accepted when reading */
+#define MAG_COLUMN_MAX_COLUMNS 4096
+
+typedef struct {
+    FILE *File;
+    int Writing; /* TRUE if created by MAG_ColumnFileCreate */
+    int NumColumns;
+    int ItemSize; /* 8 for float64 columns, 4 for float32 columns */
+    long long NumRows; /* rows written so far, or rows in the file being read */
+    long long BlockRows; /* rows per block */
+    long long DataOffset; /* file offset of the first block */
+    long long RowsRead;
+    long long BlockFill; /* rows in the current block */
+    long long BlockNext; /* next row of the current block to read */
+    char (*Names)[MAG_COLUMN_NAME_LENGTH]; /* column names of a file being read */
+    void *Block; /* one block: BlockRows values of each column in turn */
+} MAGtype_ColumnFile;
+
 enum PARAMS {
     SHDF,
     MODELNAME,
@@ -352,6 +376,20 @@ int MAG_readMagneticModel_SHDF(char *filename, MAGtype_MagneticModel *(*magnetic
 
 char *MAG_Trim(char *str);
 
+char *MAG_GridElementName(int ElementOption);
+
+int MAG_ColumnFileCreate(char *filename, int NumColumns, char *Names[], int ItemSize, MAGtype_ColumnFile *ColumnFile);
+
+int MAG_ColumnFileWriteRow(MAGtype_ColumnFile *ColumnFile, double *Values);
+
+int MAG_ColumnFileOpen(char *filename, MAGtype_ColumnFile *ColumnFile);
+
+int MAG_ColumnFileFind(MAGtype_ColumnFile *ColumnFile, char *Name);
+
+int MAG_ColumnFileReadRow(MAGtype_ColumnFile *ColumnFile, double *Values);
+
+int MAG_ColumnFileClose(MAGtype_ColumnFile *ColumnFile);
+
 /*Conversions, Transformations, and other Calculations*/
 void MAG_BaseErrors(double DeclCoef, double DeclBaseline, double InclOffset, double FOffset, double Multiplier, double H, double* DeclErr, double* InclErr, double* FErr);
 
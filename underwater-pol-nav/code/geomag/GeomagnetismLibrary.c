@@ -269,7 +269,8 @@ INPUT: minimum :Data structure with the following elements (minimum limits of th
                         double re; mean radius of  ellipsoid
           ElementOption : int : Geomagnetic Element to print
  *        UncertaintyOption: int: 1-Append uncertainties.  Otherwise do not append uncertainties.
-          PrintOption : int : 1 Print to File, Otherwise, print to screen
+          PrintOption : int : 1 Print to File, 3 (4) Write float64 (float32) columns to a binary file, see
+                        MAG_ColumnFileCreate, Otherwise, print to screen
 
    OUTPUT: none (prints the output to a file )
 
@@ -297,6 +298,11 @@ INPUT: minimum :Data structure with the following elements (minimum limits of th
     MAGtype_Gradient Gradient;
     
     FILE *fileout = NULL;
+    MAGtype_ColumnFile ColumnFile;
+    char *ColumnNames[6];
+    double ColumnValues[6];
+    int NumColumns = 5;
+    int ColumnsOK = TRUE; /* FALSE once a row of the binary columns could not be written */
 
     if(PrintOption == 1)
     {
@@ -306,6 +312,21 @@ INPUT: minimum :Data structure with the following elements (minimum limits of th
             printf("Error opening %s to write", OutputFile);
             return FALSE;
         }
+    } else if(PrintOption == 3 || PrintOption == 4)
+    {
+        ColumnNames[0] = "Latitude";
+        ColumnNames[1] = "Longitude";
+        ColumnNames[2] = (Geoid->UseGeoid == 1) ? "HeightAboveGeoid" : "HeightAboveEllipsoid";
+        ColumnNames[3] = "DecimalYear";
+        ColumnNames[4] = MAG_GridElementName(ElementOption);
+        ColumnNames[5] = "Uncertainty";
+        if(UncertaintyOption == 1 && (ElementOption < 9 || ElementOption > 25))
+            NumColumns = 6;
+        if(!MAG_ColumnFileCreate(OutputFile, NumColumns, ColumnNames, (PrintOption == 3) ? 8 : 4, &ColumnFile))
+        {
+            printf("Error opening %s to write", OutputFile);
+            return FALSE;
+        }
     }
 
 
@@ -465,6 +486,19 @@ INPUT: minimum :Data structure with the following elements (minimum limits of th
                             ErrorElement = Errors.Decl;
                     }
 
+                    if(PrintOption == 3 || PrintOption == 4)
+                    {
+                        ColumnValues[0] = minimum.phi;
+                        ColumnValues[1] = minimum.lambda;
+                        ColumnValues[2] = (Geoid->UseGeoid == 1) ? minimum.HeightAboveGeoid : minimum.HeightAboveEllipsoid;
+                        ColumnValues[3] = StartDate.DecimalYear;
+                        ColumnValues[4] = PrintElement;
+                        ColumnValues[5] = ErrorElement;
+                        if(ColumnsOK && !MAG_ColumnFileWriteRow(&ColumnFile, ColumnValues))
+                            ColumnsOK = FALSE;
+                        continue;
+                    }
+
                     if(Geoid->UseGeoid == 1)
                     {
                         if(PrintOption == 1) fprintf(fileout, "%5.2f %6.2f %8.4f %7.2f %10.2f", minimum.phi, minimum.lambda, minimum.HeightAboveGeoid, StartDate.DecimalYear, PrintElement);
@@ -492,13 +526,17 @@ INPUT: minimum :Data structure with the following elements (minimum limits of th
 
     } /* Altitude Loop */
     if(PrintOption == 1) fclose(fileout);
+    if((PrintOption == 3 || PrintOption == 4) && !MAG_ColumnFileClose(&ColumnFile))
+        ColumnsOK = FALSE;
+    if(!ColumnsOK)
+        printf("Error writing %s\n", OutputFile);
 
 
     MAG_FreeMagneticModelMemory(TimedMagneticModel);
     MAG_FreeLegendreMemory(LegendreFunction);
     MAG_FreeSphVarMemory(SphVariables);
 
-    return TRUE;
+    return ColumnsOK;
 } /*MAG_Grid*/
 
 int MAG_SetDefaults(MAGtype_Ellipsoid *Ellip, MAGtype_Geoid *Geoid)
@@ -983,12 +1021,22 @@ CALLS : none
         *ElementOption+=16;
     }
     printf("Select output :\n");
-    printf(" 1. Print to a file \n 2. Print to Screen\n");
+    printf(" 1. Print to a file \n 2. Print to Screen\n 3. Binary columns, float64\n 4. Binary columns, float32\n");
     fgets(buffer, 20, stdin);
     sscanf(buffer, "%d", PrintOption);
     strcpy(buffer, "");
     fileout = fopen(filename, "a");
-    if(*PrintOption == 1)
+    if(*PrintOption == 3 || *PrintOption == 4)
+    {
+        printf("Please enter output filename\nfor default ('GridResults.bin') press enter:\n");
+        fgets(buffer, 20, stdin);
+        if(strlen(buffer) <= 1)
+            strcpy(OutputFile, "GridResults.bin");
+        else
+            sscanf(buffer, "%s", OutputFile);
+        fprintf(fileout, "\nResults written in binary columns to: %s\n", OutputFile);
+        strcpy(buffer, "");
+    } else if(*PrintOption == 1)
     {
         printf("Please enter output filename\nfor default ('GridResults.txt') press enter:\n");
         fgets(buffer, 20, stdin);
@@ -2474,6 +2522,237 @@ char *MAG_Trim(char *str)
     return str;
 }
 
+/*Columnar binary files*/
+
+char *MAG_GridElementName(int ElementOption)
+
+/* Name of the geomagnetic element selected by ElementOption in MAG_GetUserGrid, used as its column name.
+INPUT   ElementOption   1 to 25, anything else selects the declination as in MAG_Grid
+OUTPUT  none
+CALLS : none
+ */
+{
+    static char *Names[] = {"Decl", "Incl", "F", "H", "X", "Y", "Z", "GV",
+        "Ddot", "Idot", "Fdot", "Hdot", "Xdot", "Ydot", "Zdot", "GVdot",
+        "dX/dphi", "dY/dphi", "dZ/dphi", "dX/dlambda", "dY/dlambda", "dZ/dlambda", "dX/dz", "dY/dz", "dZ/dz"};
+
+    if(ElementOption < 1 || ElementOption > 25)
+        ElementOption = 1;
+    return Names[ElementOption - 1];
+} /*MAG_GridElementName*/
+
+int MAG_ColumnFileCreate(char *filename, int NumColumns, char *Names[], int ItemSize, MAGtype_ColumnFile *ColumnFile)
+
+/* Creates a columnar binary file and writes its header. Rows are then added with MAG_ColumnFileWriteRow
+and the file is completed by MAG_ColumnFileClose.
+
+The file starts with the 8 characters MAG_COLUMN_MAGIC, then the int32 number of columns, the int32 item
+size (8 for float64 or 4 for float32 values), the int64 number of rows, the int64 rows per block and the
+int64 offset of the data, followed by the column names in MAG_COLUMN_NAME_LENGTH characters each, NUL
+padded. From the data offset, a multiple of MAG_COLUMN_ALIGN, the rows are stored in blocks of
+MAG_COLUMN_BLOCK_ROWS rows, each block holding the values of the first column, then those of the
+second column, and so on. The last block is padded with zeros. All numbers are in native byte order.
+
+INPUT   filename        File to create
+        NumColumns      Number of columns
+        Names           Array of NumColumns column names
+        ItemSize        8 for float64 columns, 4 for float32 columns
+OUTPUT  ColumnFile      Open file, to be closed with MAG_ColumnFileClose
+CALLS : none
+ */
+{
+    int i, header[2];
+    long long lheader[3];
+    char name[MAG_COLUMN_NAME_LENGTH];
+    static const char zeros[MAG_COLUMN_ALIGN];
+
+    memset(ColumnFile, 0, sizeof (MAGtype_ColumnFile));
+    if(NumColumns < 1 || (ItemSize != 8 && ItemSize != 4))
+        return FALSE;
+    ColumnFile->Writing = TRUE;
+    ColumnFile->NumColumns = NumColumns;
+    ColumnFile->ItemSize = ItemSize;
+    ColumnFile->BlockRows = MAG_COLUMN_BLOCK_ROWS;
+    ColumnFile->DataOffset = 40 + (long long) NumColumns * MAG_COLUMN_NAME_LENGTH;
+    ColumnFile->DataOffset = (ColumnFile->DataOffset + MAG_COLUMN_ALIGN - 1) / MAG_COLUMN_ALIGN * MAG_COLUMN_ALIGN;
+    ColumnFile->Block = calloc(ColumnFile->BlockRows * NumColumns, ItemSize);
+    ColumnFile->File = fopen(filename, "wb");
+    if(ColumnFile->Block == NULL || ColumnFile->File == NULL)
+    {
+        free(ColumnFile->Block);
+        if(ColumnFile->File != NULL)
+            fclose(ColumnFile->File);
+        memset(ColumnFile, 0, sizeof (MAGtype_ColumnFile));
+        return FALSE;
+    }
+
+    fwrite(MAG_COLUMN_MAGIC, 1, 8, ColumnFile->File);
+    header[0] = NumColumns;
+    header[1] = ItemSize;
+    fwrite(header, sizeof (int), 2, ColumnFile->File);
+    lheader[0] = 0; /* number of rows, written by MAG_ColumnFileClose */
+    lheader[1] = ColumnFile->BlockRows;
+    lheader[2] = ColumnFile->DataOffset;
+    fwrite(lheader, sizeof (long long), 3, ColumnFile->File);
+    for(i = 0; i < NumColumns; i++)
+    {
+        memset(name, 0, sizeof (name));
+        strncpy(name, Names[i], MAG_COLUMN_NAME_LENGTH - 1);
+        fwrite(name, 1, MAG_COLUMN_NAME_LENGTH, ColumnFile->File);
+    }
+    fwrite(zeros, 1, (size_t) (ColumnFile->DataOffset - 40 - (long long) NumColumns * MAG_COLUMN_NAME_LENGTH), ColumnFile->File);
+    return !ferror(ColumnFile->File);
+} /*MAG_ColumnFileCreate*/
+
+int MAG_ColumnFileWriteRow(MAGtype_ColumnFile *ColumnFile, double *Values)
+
+/* Adds a row to a file from MAG_ColumnFileCreate. Full blocks are written at once.
+INPUT   ColumnFile      File from MAG_ColumnFileCreate
+        Values          One value per column
+OUTPUT  ColumnFile      Updated
+CALLS : none
+ */
+{
+    int i;
+    long long row = ColumnFile->BlockFill;
+
+    if(ColumnFile->ItemSize == 8)
+        for(i = 0; i < ColumnFile->NumColumns; i++)
+            ((double *) ColumnFile->Block)[i * ColumnFile->BlockRows + row] = Values[i];
+    else
+        for(i = 0; i < ColumnFile->NumColumns; i++)
+            ((float *) ColumnFile->Block)[i * ColumnFile->BlockRows + row] = (float) Values[i];
+    ColumnFile->NumRows++;
+    if(++ColumnFile->BlockFill == ColumnFile->BlockRows)
+    {
+        ColumnFile->BlockFill = 0;
+        if(fwrite(ColumnFile->Block, ColumnFile->ItemSize, ColumnFile->BlockRows * ColumnFile->NumColumns, ColumnFile->File) !=
+                (size_t) (ColumnFile->BlockRows * ColumnFile->NumColumns))
+            return FALSE;
+    }
+    return TRUE;
+} /*MAG_ColumnFileWriteRow*/
+
+int MAG_ColumnFileOpen(char *filename, MAGtype_ColumnFile *ColumnFile)
+
+/* Opens a columnar binary file written by MAG_ColumnFileCreate (see there for the format) for reading
+with MAG_ColumnFileReadRow.
+INPUT   filename        File to read
+OUTPUT  ColumnFile      Open file, to be closed with MAG_ColumnFileClose. FALSE if the file could not be
+                        opened or is not a columnar file.
+CALLS : none
+ */
+{
+    int header[2];
+    long long lheader[3];
+    char magic[8];
+
+    memset(ColumnFile, 0, sizeof (MAGtype_ColumnFile));
+    ColumnFile->File = fopen(filename, "rb");
+    if(ColumnFile->File == NULL)
+        return FALSE;
+    if(fread(magic, 1, 8, ColumnFile->File) != 8 || memcmp(magic, MAG_COLUMN_MAGIC, 8) != 0 ||
+            fread(header, sizeof (int), 2, ColumnFile->File) != 2 || fread(lheader, sizeof (long long), 3, ColumnFile->File) != 3 ||
+            header[0] < 1 || header[0] > MAG_COLUMN_MAX_COLUMNS || (header[1] != 8 && header[1] != 4) ||
+            lheader[0] < 0 || lheader[1] < 1 || lheader[1] > MAG_COLUMN_BLOCK_ROWS_MAX || lheader[2] < 40 + (long long) header[0] * MAG_COLUMN_NAME_LENGTH)
+    {
+        MAG_ColumnFileClose(ColumnFile);
+        return FALSE;
+    }
+    ColumnFile->NumColumns = header[0];
+    ColumnFile->ItemSize = header[1];
+    ColumnFile->NumRows = lheader[0];
+    ColumnFile->BlockRows = lheader[1];
+    ColumnFile->DataOffset = lheader[2];
+
+    ColumnFile->Names = calloc(ColumnFile->NumColumns, MAG_COLUMN_NAME_LENGTH);
+    ColumnFile->Block = malloc(ColumnFile->BlockRows * ColumnFile->NumColumns * ColumnFile->ItemSize);
+    if(ColumnFile->Names == NULL || ColumnFile->Block == NULL ||
+            fread(ColumnFile->Names, MAG_COLUMN_NAME_LENGTH, ColumnFile->NumColumns, ColumnFile->File) != (size_t) ColumnFile->NumColumns ||
+            fseek(ColumnFile->File, (long) ColumnFile->DataOffset, SEEK_SET) != 0)
+    {
+        MAG_ColumnFileClose(ColumnFile);
+        return FALSE;
+    }
+    ColumnFile->Names[ColumnFile->NumColumns - 1][MAG_COLUMN_NAME_LENGTH - 1] = '\0';
+    return TRUE;
+} /*MAG_ColumnFileOpen*/
+
+int MAG_ColumnFileFind(MAGtype_ColumnFile *ColumnFile, char *Name)
+
+/* Index of the column called Name in a file from MAG_ColumnFileOpen, -1 if there is none */
+{
+    int i;
+
+    for(i = 0; i < ColumnFile->NumColumns; i++)
+        if(strncmp(ColumnFile->Names[i], Name, MAG_COLUMN_NAME_LENGTH) == 0)
+            return i;
+    return -1;
+} /*MAG_ColumnFileFind*/
+
+int MAG_ColumnFileReadRow(MAGtype_ColumnFile *ColumnFile, double *Values)
+
+/* Reads the next row of a file from MAG_ColumnFileOpen, one block at a time.
+INPUT   ColumnFile      File from MAG_ColumnFileOpen
+OUTPUT  Values          One value per column. FALSE after the last row or on a read error.
+CALLS : none
+ */
+{
+    int i;
+    long long row;
+
+    if(ColumnFile->RowsRead >= ColumnFile->NumRows)
+        return FALSE;
+    if(ColumnFile->BlockNext == ColumnFile->BlockFill)
+    {
+        if(fread(ColumnFile->Block, ColumnFile->ItemSize, ColumnFile->BlockRows * ColumnFile->NumColumns, ColumnFile->File) !=
+                (size_t) (ColumnFile->BlockRows * ColumnFile->NumColumns))
+            return FALSE;
+        ColumnFile->BlockFill = ColumnFile->NumRows - ColumnFile->RowsRead;
+        if(ColumnFile->BlockFill > ColumnFile->BlockRows)
+            ColumnFile->BlockFill = ColumnFile->BlockRows;
+        ColumnFile->BlockNext = 0;
+    }
+    row = ColumnFile->BlockNext++;
+    if(ColumnFile->ItemSize == 8)
+        for(i = 0; i < ColumnFile->NumColumns; i++)
+            Values[i] = ((double *) ColumnFile->Block)[i * ColumnFile->BlockRows + row];
+    else
+        for(i = 0; i < ColumnFile->NumColumns; i++)
+            Values[i] = ((float *) ColumnFile->Block)[i * ColumnFile->BlockRows + row];
+    ColumnFile->RowsRead++;
+    return TRUE;
+} /*MAG_ColumnFileReadRow*/
+
+int MAG_ColumnFileClose(MAGtype_ColumnFile *ColumnFile)
+
+/* Closes a file from MAG_ColumnFileCreate or MAG_ColumnFileOpen. A file being written gets its last,
+zero padded block and its number of rows. FALSE if writing failed.
+ */
+{
+    int i, ok = TRUE;
+
+    if(ColumnFile->File != NULL && ColumnFile->Writing)
+    {
+        if(ColumnFile->BlockFill > 0)
+        {
+            for(i = 0; i < ColumnFile->NumColumns; i++)
+                memset((char *) ColumnFile->Block + (i * ColumnFile->BlockRows + ColumnFile->BlockFill) * ColumnFile->ItemSize, 0,
+                    (size_t) ((ColumnFile->BlockRows - ColumnFile->BlockFill) * ColumnFile->ItemSize));
+            fwrite(ColumnFile->Block, ColumnFile->ItemSize, ColumnFile->BlockRows * ColumnFile->NumColumns, ColumnFile->File);
+        }
+        fseek(ColumnFile->File, 16, SEEK_SET);
+        fwrite(&ColumnFile->NumRows, sizeof (long long), 1, ColumnFile->File);
+        ok = !ferror(ColumnFile->File);
+    }
+    if(ColumnFile->File != NULL && fclose(ColumnFile->File) != 0)
+        ok = FALSE;
+    free(ColumnFile->Names);
+    free(ColumnFile->Block);
+    memset(ColumnFile, 0, sizeof (MAGtype_ColumnFile));
+    return ok;
+} /*MAG_ColumnFileClose*/
+
 /*End of Memory and File Processing functions*/
 
 
@@ -17,16 +17,70 @@ typedef struct {
     double **lonres; /* array[nalt][nlat] containing the longitudinal resolution in each row */
 
     double ****comp; /* variable array[nalt][nlat][nlon] containing data for x, y, and z vector components and derivatives */
+    double **cells; /* array[nalt] of the contiguous block holding the 12 values of every cell in a layer, comp points into it */
+
+    double ***coef; /* optional array[nalt][nlat] of EMM_COEF_PER_EDGE longitude polynomial coefficients per cell edge, NULL if not precomputed */
+
+    /* cell locator built by EMM_mesh_build_locator, pointers are NULL if absent */
+    int naltbin; /* number of altitude bins */
+    double inv_altbin; /* inverse of the altitude bin width */
+    int *altbin; /* array[naltbin] of the highest layer at or below the start of each bin */
+    double *inv_latres; /* array[nalt] of inverse latitudinal resolution */
+    int *row0; /* array[nalt] of the index of the first row of each layer in the row arrays */
+    int *row_nlon; /* array[total rows] of number of cells in each row */
+    double *row_lonres; /* array[total rows] of longitudinal resolution */
+    double *row_inv_lonres; /* array[total rows] of inverse longitudinal resolution */
+
+    /* 16-bit cells from EMM_mesh_quantize, which replace comp and cells; NULL if absent */
+    unsigned short **qcells; /* array[nalt] of the 12 quantized channels of every cell in a layer, without the duplicated first longitude */
+    int **qrow; /* array[nalt][nlat] of the index in qcells of the first cell of each row */
+    double **qscale; /* array[nalt] of 24 doubles per row: the scale of each channel, then its offset; value = offset + scale * q */
+
+    void *shm; /* read-only mapping holding the cells of a mesh from EMM_mesh_attach, NULL if the cells are owned */
+    size_t shm_size;
 
 } EMM_tmesh;
 
+typedef struct {
+    double lon, lat, alt; /* query point, lon wrapped into [0,360) */
+
+    int ialt0, ialt1; /* altitude layers below and above */
+    double alt0, alt1, altfac0, altfac1;
+
+    int ilat00, ilat01, ilat10, ilat11; /* rows [layer][lower/upper] */
+    double lat00, lat01, lat10, lat11, latfac00, latfac01, latfac10, latfac11;
+
+    int ilon000, ilon001, ilon010, ilon011, ilon100, ilon101, ilon110, ilon111; /* cells [layer][row][lower/upper] */
+    double lon000, lon001, lon010, lon011, lon100, lon101, lon110, lon111;
+    double lonfac000, lonfac001, lonfac010, lonfac011, lonfac100, lonfac101, lonfac110, lonfac111;
+
+} EMM_tcell; /* location of a point in the mesh, shared by meshes of the same geometry */
+
+#define EMM_SNAPSHOT_CACHE 2    /* Number of timed meshes kept by a snapshot cache */
+
+typedef struct {
+    int n; /* number of slots in use */
+    int next; /* slot replaced when a new year is requested */
+    double year[EMM_SNAPSHOT_CACHE]; /* decimal year of each snapshot, -1 if empty */
+    EMM_tmesh snapshot[EMM_SNAPSHOT_CACHE];
+} EMM_tsnapshot_cache;
+
 
 #define MIN_POLE_DIST   (0.001 * M_PI/180.0) /* Sperical coordinates not defined closer to poles */
 #define USE_DERIVATIVES 1       /* Turn off only for testing */
 #define INTERPOLATE_CUBIC 1     /* Turn off only for testing */
+#ifndef USE_SIMD
+#define USE_SIMD 1              /* Turn off only for testing; scalar and vector kernels agree bit for bit when built with -ffp-contract=off */
+#endif
 #define MESH_REAL_TYPE float    /* use 'float' to save space in binary file */
 
 #define MESH_MAXLAT 1440            /* To check consistency of nlat parameter read from mesh file */
+#define EMM_MAX_ALT_BINS 4096       /* Upper limit on the altitude bins of the cell locator */
+#define EMM_GEN_MINLON 36            /* Fewest cells in a row of EMM_mesh_generate */
+#define EMM_GEN_DLON 1.0e-3          /* Longitude step (deg) of the central differences of EMM_mesh_generate */
+#define EMM_GEN_DLAT 1.0e-3          /* Latitude step (deg) */
+#define EMM_GEN_DALT 1.0e-3          /* Altitude step (km) */
+#define EMM_COEF_PER_EDGE 24        /* (4 cubic value + 2 linear dlat + 2 linear dalt coefficients) x 3 components, component index fastest */
 
 /* gridint return error codes */
 
@@ -42,6 +96,11 @@ typedef struct {
 #define EXIT_MESH_FILE_NLAT_ERROR       22 /* Number of rows at this altitude is out of range */
 #define EXIT_MESH_FILE_ALT_ERROR        23 /* Altitude out of range */
 #define EXIT_MESH_FILE_NLON_ERROR       24 /* Number cells at this latitude and altitude is out of range */
+#define EXIT_MESH_GEOMETRY_ERROR        25 /* Main field and secular variation meshes do not share a grid geometry */
+#define EXIT_MESH_FILE_LAT_ERROR        26 /* Latitude out of range */
+#define EXIT_MESH_SHM_ERROR             27 /* Shared memory mesh could not be created, opened or mapped */
+#define EXIT_MESH_SHM_UNSUPPORTED       28 /* Shared memory meshes need POSIX shared memory */
+#define EXIT_MESH_QUANTIZED_ERROR       29 /* Operation needs the full precision cells of a quantized mesh */
 
 #define WGS84_A 6378.1370       /* in km */
 #define WGS84_B 6356.752314     /* in km */
@@ -61,10 +120,33 @@ extern void EMM_cart2sphere_vec(double phi_rad, double lat_rad, double vx, doubl
 
 int EMM_mesh_convert(int verbose, char infname[], char outfname[]);
 int EMM_mesh_read(int verbose, char meshfname[], EMM_tmesh *mesh);
+int EMM_mesh_write(int verbose, EMM_tmesh mesh, char meshfname[]);
+int EMM_mesh_generate(int verbose, MAGtype_MagneticModel *model, MAGtype_Ellipsoid Ellip, int secvar,
+        int nalt, const double alt[], const int nlat[], EMM_tmesh *mesh);
+void EMM_mesh_free(EMM_tmesh *mesh);
+int EMM_mesh_precompute(int verbose, EMM_tmesh *mesh);
+int EMM_mesh_build_locator(int verbose, EMM_tmesh *mesh);
+int EMM_mesh_quantize(int verbose, EMM_tmesh *mesh, double maxerr[12]);
+int EMM_mesh_publish(int verbose, EMM_tmesh mesh, const char *name);
+int EMM_mesh_attach(int verbose, const char *name, EMM_tmesh *mesh);
+int EMM_mesh_unpublish(int verbose, const char *name);
+int EMM_mesh_same_geometry(EMM_tmesh mesh, EMM_tmesh other);
+int EMM_mesh_snapshot(int verbose, EMM_tmesh mesh, EMM_tmesh mesh_SV, double year, EMM_tmesh *snapshot);
+void EMM_snapshot_cache_init(EMM_tsnapshot_cache *cache);
+EMM_tmesh *EMM_snapshot_cache_find(EMM_tsnapshot_cache *cache, double year);
+int EMM_snapshot_cache_get(int verbose, EMM_tsnapshot_cache *cache, EMM_tmesh mesh, EMM_tmesh mesh_SV, double year, EMM_tmesh **snapshot);
+void EMM_snapshot_cache_free(EMM_tsnapshot_cache *cache);
 int EMM_Grid(MAGtype_CoordGeodetic minimum, MAGtype_CoordGeodetic maximum, double cord_step_size, double altitude_step_size, double time_step, MAGtype_Geoid *Geoid, MAGtype_Ellipsoid Ellip, MAGtype_Date StartDate, MAGtype_Date EndDate, int ElementOption, int PrintOption, char *OutputFile, EMM_tmesh mesh, EMM_tmesh meshSV);
 int EMM_mesh_interpolate(int verbose, EMM_tmesh mesh, double lon, double lat, double alt,
         double geoc_lat, double *geoc_Bx, double *geoc_By, double *geoc_Bz);
+int EMM_mesh_interpolate_sv(int verbose, EMM_tmesh mesh, EMM_tmesh mesh_SV, double lon, double lat, double alt, double geoc_lat,
+        double *geoc_Bx, double *geoc_By, double *geoc_Bz, double *geoc_Bxs, double *geoc_Bys, double *geoc_Bzs);
+int EMM_mesh_interpolate_batch(int verbose, EMM_tmesh mesh, int n, const double lon[], const double lat[], const double alt[],
+        const double geoc_lat[], double geoc_Bx[], double geoc_By[], double geoc_Bz[]);
+int EMM_mesh_interpolate_sv_batch(int verbose, EMM_tmesh mesh, EMM_tmesh mesh_SV, int n, const double lon[], const double lat[], const double alt[],
+        const double geoc_lat[], double geoc_Bx[], double geoc_By[], double geoc_Bz[], double geoc_Bxs[], double geoc_Bys[], double geoc_Bzs[]);
 int EMM_PointCalcFromMesh(MAGtype_CoordGeodetic CordGeo, MAGtype_CoordSpherical CordSph, MAGtype_Date UserDate, MAGtype_MagneticResults *MagResults, EMM_tmesh mesh, EMM_tmesh mesh_SV);
+int EMM_PointCalcFromSnapshot(MAGtype_CoordGeodetic CordGeo, MAGtype_CoordSpherical CordSph, MAGtype_MagneticResults *MagResults, EMM_tmesh snapshot);
 
 /*End of EMM specific constants, structures, and functions*/
 
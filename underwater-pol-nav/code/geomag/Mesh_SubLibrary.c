@@ -8,14 +8,34 @@
 #include "GeomagnetismHeader.h"
 #include "MeshHeader.h"
 
+#if USE_SIMD && (defined(__GNUC__) || defined(__clang__)) && defined(__AVX__) /* e.g. gcc -mavx2 or -march=native */
+#define EMM_VECTOR 1
+#define EMM_VINLINE static inline __attribute__ ((always_inline))
+typedef double EMM_v4d __attribute__ ((vector_size (4 * sizeof (double)))); /* lanes x, y, z and one unused lane */
+#define EMM_LANES(c, ideriv) ((EMM_v4d) {(c)[(ideriv)], (c)[4 + (ideriv)], (c)[8 + (ideriv)], 0.0})
+#else
+#define EMM_VECTOR 0
+#endif
+
+#if defined(__unix__) || defined(__APPLE__) /* POSIX shared memory, see EMM_mesh_publish */
+#define EMM_SHM 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define EMM_SHM 0
+#endif
+
 /*MESH STATIC DECLARATIONS*/
 
 static int EMM_find_alt_index(int verbose, EMM_tmesh mesh, double alt, int *ialt0, int *ialt1,
         double *alt0, double *alt1, double *altfac0, double *altfac1);
-static void EMM_find_lat_index(EMM_tmesh mesh, int ialt, double lat, int *ilat0, int *ilat1,
+static int EMM_find_lat_index(int verbose, EMM_tmesh mesh, int ialt, double lat, int *ilat0, int *ilat1,
         double *lat0, double *lat1, double *latfac0, double *latfac1);
 static void EMM_find_lon_index(EMM_tmesh mesh, int ialt, int ilat, double lon, int *ilon0, int *ilon1,
         double *lon0, double *lon1, double *lonfac0, double *lonfac1);
+#if !(EMM_VECTOR && USE_DERIVATIVES && INTERPOLATE_CUBIC)
 static double EMM_cell(EMM_tmesh mesh, int ialt, int ilat, int ilon, int icomp);
 static double EMM_dlon_cell(EMM_tmesh mesh, int ialt, int ilat, int ilon, int icomp);
 static double EMM_dlat_cell(EMM_tmesh mesh, int ialt, int ilat, int ilon, int icomp);
@@ -26,6 +46,40 @@ static double EMM_interpolate_cubic(double x1, double y1, double dx_y1, double x
         double y2, double dx_y2, double x);
 static double EMM_interpolate(double x1, double y1, double dx_y1, double x2, double y2,
         double dx_y2, double x);
+#endif
+static int EMM_mesh_locate(int verbose, EMM_tmesh mesh, double lon, double lat, double alt, EMM_tcell *cell);
+static int EMM_cell_shared(EMM_tmesh mesh, EMM_tmesh other, const EMM_tcell *cell);
+static void EMM_mesh_interpolate_cell(EMM_tmesh mesh, const EMM_tcell *cell, double h[3]);
+#if !(EMM_VECTOR && USE_DERIVATIVES && INTERPOLATE_CUBIC)
+static void EMM_mesh_interpolate_cell_s(EMM_tmesh mesh, const EMM_tcell *cell, double h[3]);
+#endif
+#if !EMM_VECTOR
+static double EMM_hermite(double dx, double y1, double dx_y1, double y2, double dx_y2, double t);
+#endif
+static void EMM_mesh_interpolate_coef(EMM_tmesh mesh, const EMM_tcell *cell, double h[3]);
+static void EMM_mesh_free_coef(EMM_tmesh *mesh);
+static void EMM_snapshot_cache_drop(EMM_tsnapshot_cache *cache, int slot);
+static int EMM_batch_compare(const void *a, const void *b);
+static void EMM_mesh_free_locator(EMM_tmesh *mesh);
+static void EMM_mesh_free_cells(EMM_tmesh *mesh);
+static void EMM_mesh_free_quantized(EMM_tmesh *mesh);
+static void EMM_mesh_decode_cell(EMM_tmesh mesh, int ialt, int ilat, int ilon, double value[12]);
+static void EMM_mesh_interpolate_quantized(EMM_tmesh mesh, const EMM_tcell *cell, double h[3]);
+static int EMM_buf_int(const unsigned char *buf, long nbytes, long *pos, int *value);
+static int EMM_buf_real(const unsigned char *buf, long nbytes, long *pos, double *value);
+static int EMM_mesh_alloc_layer(EMM_tmesh *mesh, int ialt, double *cells);
+static void EMM_mesh_generate_row(MAGtype_MagneticModel *model, MAGtype_Ellipsoid Ellip, int secvar, int nmax,
+        EMM_tmesh mesh, int ialt, int ilat, MAGtype_LegendreFunction *legendre[5], MAGtype_SphericalHarmonicVariables *sphvar);
+static void EMM_mesh_generate_point(MAGtype_MagneticModel *model, MAGtype_Ellipsoid Ellip, int secvar, int nmax,
+        MAGtype_CoordSpherical spherical, double lon, MAGtype_LegendreFunction *legendre, MAGtype_SphericalHarmonicVariables *sphvar, double h[3]);
+static size_t EMM_shm_layout(int nalt, long nrow, long ncell, size_t *off_alt, size_t *off_nlat, size_t *off_nlon, size_t *off_cells);
+#if EMM_VECTOR
+EMM_VINLINE EMM_v4d EMM_load_v(const double *p);
+EMM_VINLINE EMM_v4d EMM_interpolate_cubic_v(double x1, EMM_v4d y1, EMM_v4d dx_y1, double x2, EMM_v4d y2, EMM_v4d dx_y2, double x);
+EMM_VINLINE EMM_v4d EMM_hermite_v(double dx, EMM_v4d y1, EMM_v4d dx_y1, EMM_v4d y2, EMM_v4d dx_y2, double t);
+static void EMM_mesh_interpolate_cell_v(EMM_tmesh mesh, const EMM_tcell *cell, double h[3]);
+static void EMM_mesh_interpolate_coef_v(EMM_tmesh mesh, const EMM_tcell *cell, double h[3]);
+#endif
 /*EMM-Mesh interpolation program functions*/
 
 void EMM_cart2sphere(double x, double y, double z, double *phi_rad, double *lat_rad, double *r)
@@ -132,6 +186,7 @@ void EMM_geocentric2geodetic_vec(double theta, double delta, double bx, double b
 
 static int EMM_find_alt_index(int verbose, EMM_tmesh mesh, double alt, int *ialt0, int *ialt1, double *alt0, double *alt1, double *altfac0, double *altfac1)
 {
+    int ibin;
 
     if(alt <= (mesh.alt)[0]) /* below mesh */
     {
@@ -145,7 +200,17 @@ static int EMM_find_alt_index(int verbose, EMM_tmesh mesh, double alt, int *ialt
             *ialt1 = mesh.nalt - 1;
         } else /* normal case */
         {
-            *ialt1 = 1;
+            if(alt != alt) /* NaN, which fails both tests above: the interpolated field is NaN as well */
+                *ialt1 = 1;
+            else if(mesh.altbin != NULL) /* start from the layer below the altitude bin, then settle the layer boundary */
+            {
+                ibin = (int) ((alt - (mesh.alt)[0]) * mesh.inv_altbin);
+                if(ibin < 0) ibin = 0;
+                if(ibin >= mesh.naltbin) ibin = mesh.naltbin - 1;
+                *ialt1 = (mesh.altbin)[ibin] < 1 ? 1 : (mesh.altbin)[ibin];
+                while(*ialt1 > 1 && alt <= (mesh.alt)[*ialt1 - 1]) (*ialt1)--;
+            } else
+                *ialt1 = 1;
             while(alt > (mesh.alt)[*ialt1] && *ialt1 < mesh.nalt - 1) (*ialt1)++;
             *ialt0 = *ialt1 - 1;
         }
@@ -169,7 +234,7 @@ static int EMM_find_alt_index(int verbose, EMM_tmesh mesh, double alt, int *ialt
     return 0;
 }
 
-static void EMM_find_lat_index(EMM_tmesh mesh, int ialt, double lat, int *ilat0, int *ilat1, double *lat0, double *lat1, double *latfac0, double *latfac1)
+static int EMM_find_lat_index(int verbose, EMM_tmesh mesh, int ialt, double lat, int *ilat0, int *ilat1, double *lat0, double *lat1, double *latfac0, double *latfac1)
 {
 
     if(lat <= -90.0 + 0.5 * (mesh.latres)[ialt]) /* South Pole */
@@ -184,7 +249,10 @@ static void EMM_find_lat_index(EMM_tmesh mesh, int ialt, double lat, int *ilat0,
             *ilat1 = (mesh.nlat)[ialt] - 1;
         } else /* normal case */
         {
-            *ilat0 = (int) floor((90 + lat) / (mesh.latres)[ialt] - 0.5);
+            if(mesh.inv_latres != NULL)
+                *ilat0 = (int) floor((90 + lat) * (mesh.inv_latres)[ialt] - 0.5);
+            else
+                *ilat0 = (int) floor((90 + lat) / (mesh.latres)[ialt] - 0.5);
             *ilat1 = *ilat0 + 1;
         }
     } /* not South Pole */
@@ -194,23 +262,41 @@ static void EMM_find_lat_index(EMM_tmesh mesh, int ialt, double lat, int *ilat0,
     *latfac0 = (*lat1 - lat) / (*lat1 - *lat0);
     *latfac1 = 1.0 - *latfac0;
 
-    if(*latfac0 < -0.5 || *latfac0 > 1.5 || *latfac1 < -0.5 || *latfac1 > 1.5) /* allow extrapolation at poles */
+    if(!(*latfac0 >= -0.5 && *latfac0 <= 1.5 && *latfac1 >= -0.5 && *latfac1 <= 1.5)) /* allow extrapolation at poles */
     {
-        printf("ERROR: latfac0=%.4f, latfac1=%.4f\n", *latfac0, *latfac1);
-        exit(EXIT_FAILURE);
+        if(verbose)
+        {
+            printf("ERROR: latfac0=%.4f, latfac1=%.4f\n", *latfac0, *latfac1);
+            fflush(stdout);
+        }
+        return EXIT_MESH_FILE_LAT_ERROR;
     }
 
-    return;
+    return 0;
 }
 
 static void EMM_find_lon_index(EMM_tmesh mesh, int ialt, int ilat, double lon, int *ilon0, int *ilon1, double *lon0, double *lon1, double *lonfac0, double *lonfac1)
 {
 
-    *ilon0 = (int) floor(lon / ((mesh.lonres)[ialt])[ilat]);
-    *ilon1 = *ilon0 + 1;
+    int row;
+
+    if(mesh.row_lonres != NULL) /* lon is already in [0,360) */
+    {
+        row = (mesh.row0)[ialt] + ilat;
+        *ilon0 = (int) (lon * (mesh.row_inv_lonres)[row]);
+        if(*ilon0 >= (mesh.row_nlon)[row]) *ilon0 = (mesh.row_nlon)[row] - 1; /* lon rounded up to 360 */
+        *ilon1 = *ilon0 + 1;
+
+        *lon0 = (*ilon0 * (mesh.row_lonres)[row]);
+        *lon1 = (*ilon1 * (mesh.row_lonres)[row]);
+    } else
+    {
+        *ilon0 = (int) floor(lon / ((mesh.lonres)[ialt])[ilat]);
+        *ilon1 = *ilon0 + 1;
 
-    *lon0 = (*ilon0 * ((mesh.lonres)[ialt])[ilat]);
-    *lon1 = (*ilon1 * ((mesh.lonres)[ialt])[ilat]);
+        *lon0 = (*ilon0 * ((mesh.lonres)[ialt])[ilat]);
+        *lon1 = (*ilon1 * ((mesh.lonres)[ialt])[ilat]);
+    }
 
     *lonfac0 = (*lon1 - lon) / (*lon1 - *lon0);
     *lonfac1 = 1.0 - *lonfac0;
@@ -364,13 +450,21 @@ int EMM_mesh_convert(int verbose, char infname[], char outfname[]) /* convert a
 } /* mesh_convert */
 
 int EMM_mesh_read(int verbose, char meshfname[], EMM_tmesh *mesh) /* read binary mesh file, allocate memory and fill mesh */
+/* the file is read with a single fread and validated in one pass over the row headers, */
+/* then the altitude layers are converted in parallel when compiled with OpenMP */
 {
-    int ialt, ilat, ilon;
-    int icomp, ideriv, check;
+    int ialt, ilat, nlon, i, check, status;
+    long nbytes, pos, *layer_pos;
+    unsigned char *buf;
+    const unsigned char *p;
+    double *cell, value;
     MESH_REAL_TYPE oneval;
     FILE *meshfile;
 
 
+    memset(mesh, 0, sizeof (EMM_tmesh)); /* coef and the locator are added later, see EMM_mesh_precompute and EMM_mesh_build_locator */
+    layer_pos = NULL;
+
     /* open meshfile */
 
     if(verbose)
@@ -386,271 +480,1371 @@ int EMM_mesh_read(int verbose, char meshfname[], EMM_tmesh *mesh) /* read binary
         return EXIT_MESH_BIN_FILE_NOT_FOUND;
     }
 
-    /* read version and epoch */
+    /* read the whole file */
 
-    fread(&oneval, sizeof (MESH_REAL_TYPE), 1, meshfile);
-    ((*mesh).version) = oneval;
-    fread(&oneval, sizeof (MESH_REAL_TYPE), 1, meshfile);
-    ((*mesh).epoch) = oneval;
-    if((*mesh).epoch < 1900 || (*mesh).epoch > 2100)
+    buf = NULL;
+    nbytes = -1;
+    if(fseek(meshfile, 0, SEEK_END) == 0)
+        nbytes = ftell(meshfile);
+    if(nbytes >= 0)
     {
-        if(verbose)
+        rewind(meshfile);
+        buf = malloc(nbytes > 0 ? nbytes : 1);
+        if(buf == NULL)
         {
-            printf("Error - Epoch out of range: %.1f \n", (*mesh).epoch);
-            fflush(stdout);
+            fclose(meshfile);
+            status = EXIT_MESH_MEM_ALLOC_ERROR;
+            goto error;
         }
-        return EXIT_MESH_FILE_EPOCH_ERROR;
+        if(fread(buf, 1, nbytes, meshfile) != (size_t) nbytes)
+            nbytes = -1;
     }
-
-    /* read number of altitude layers */
-
-    fread(&((*mesh).nalt), sizeof (int), 1, meshfile);
-    if((*mesh).nalt < 1 || (*mesh).nalt > 1000)
+    fclose(meshfile);
+    if(nbytes < 0)
     {
         if(verbose)
         {
-            printf("Error - Number of altitude layers out of range: %d \n", (*mesh).nalt);
+            printf("Error - Binary mesh file %s could not be read\n", meshfname);
             fflush(stdout);
         }
-        return EXIT_MESH_FILE_NALT_ERROR;
+        free(buf);
+        return EXIT_MESH_BIN_FILE_NOT_FOUND;
     }
 
-    /* allocate space for altitudes */
+    /* read version and epoch */
 
-    (*mesh).alt = malloc((*mesh).nalt * sizeof (double));
-    if((*mesh).alt == NULL)
+    pos = 0;
+    if(EMM_buf_real(buf, nbytes, &pos, &value))
+        goto truncated;
+    (*mesh).version = value;
+    if(EMM_buf_real(buf, nbytes, &pos, &value))
+        goto truncated;
+    (*mesh).epoch = value;
+    if((*mesh).epoch < 1900 || (*mesh).epoch > 2100)
     {
         if(verbose)
         {
-            printf("Error - out of memory\n");
+            printf("Error - Epoch out of range: %.1f \n", (*mesh).epoch);
             fflush(stdout);
         }
-        return EXIT_MESH_MEM_ALLOC_ERROR;
+        status = EXIT_MESH_FILE_EPOCH_ERROR;
+        goto error;
     }
 
-    /* allocate space for number of latitudes and latitude resolution in each layer */
+    /* read number of altitude layers */
 
-    (*mesh).nlat = malloc((*mesh).nalt * sizeof (int));
-    if((*mesh).nlat == NULL)
+    if(EMM_buf_int(buf, nbytes, &pos, &check))
+        goto truncated;
+    if(check < 1 || check > 1000)
     {
         if(verbose)
         {
-            printf("Error - out of memory\n");
+            printf("Error - Number of altitude layers out of range: %d \n", check);
             fflush(stdout);
         }
-        return EXIT_MESH_MEM_ALLOC_ERROR;
+        status = EXIT_MESH_FILE_NALT_ERROR;
+        goto error;
     }
+    (*mesh).nalt = check;
 
+    /* allocate the per-layer arrays */
+
+    (*mesh).alt = malloc((*mesh).nalt * sizeof (double));
+    (*mesh).nlat = calloc((*mesh).nalt, sizeof (int));
     (*mesh).latres = malloc((*mesh).nalt * sizeof (double));
-    if((*mesh).latres == NULL)
+    (*mesh).nlon = calloc((*mesh).nalt, sizeof (int*));
+    (*mesh).lonres = calloc((*mesh).nalt, sizeof (double*));
+    (*mesh).comp = calloc((*mesh).nalt, sizeof (double***));
+    (*mesh).cells = calloc((*mesh).nalt, sizeof (double*));
+    layer_pos = malloc((*mesh).nalt * sizeof (long));
+    if((*mesh).alt == NULL || (*mesh).nlat == NULL || (*mesh).latres == NULL || (*mesh).nlon == NULL ||
+            (*mesh).lonres == NULL || (*mesh).comp == NULL || (*mesh).cells == NULL || layer_pos == NULL)
     {
-        if(verbose)
+        status = EXIT_MESH_MEM_ALLOC_ERROR;
+        goto error;
+    }
+
+    /* scan and validate the layer and row headers, skipping the cell data */
+
+    for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+    {
+        if(EMM_buf_real(buf, nbytes, &pos, &value))
+            goto truncated;
+        ((*mesh).alt)[ialt] = value;
+
+        /* get number of latitudes for this layer */
+        /* different altitudes can have different resolution */
+
+        if(EMM_buf_int(buf, nbytes, &pos, &check))
+            goto truncated;
+        if(check < 1 || check > MESH_MAXLAT)
         {
-            printf("Error - out of memory\n");
-            fflush(stdout);
+            if(verbose)
+            {
+                printf("Error - Number of rows in latitude out of range: %d \n", check);
+                fflush(stdout);
+            }
+            status = EXIT_MESH_FILE_NLAT_ERROR;
+            goto error;
         }
-        return EXIT_MESH_MEM_ALLOC_ERROR;
-    }
+        ((*mesh).nlat)[ialt] = check;
+        ((*mesh).latres)[ialt] = 180.0 / ((*mesh).nlat)[ialt];
+
+        ((*mesh).nlon)[ialt] = malloc(((*mesh).nlat)[ialt] * sizeof (int));
+        ((*mesh).lonres)[ialt] = malloc(((*mesh).nlat)[ialt] * sizeof (double));
+        if(((*mesh).nlon)[ialt] == NULL || ((*mesh).lonres)[ialt] == NULL)
+        {
+            status = EXIT_MESH_MEM_ALLOC_ERROR;
+            goto error;
+        }
+
+        layer_pos[ialt] = pos;
+        for(ilat = 0; ilat < ((*mesh).nlat)[ialt]; ilat++)
+        {
+            if(EMM_buf_int(buf, nbytes, &pos, &nlon))
+                goto truncated;
+            if(nlon < 1 || nlon > 2 * ((*mesh).nlat)[ialt])
+            {
+                if(verbose)
+                {
+                    printf("Error - Number of cells at altitude %1d in row %1d is out of range: nlon[%1d][%1d]=%1d \n", ialt, ilat, ialt, ilat, nlon);
+                    fflush(stdout);
+                }
+                status = EXIT_MESH_FILE_NLON_ERROR;
+                goto error;
+            }
+            (((*mesh).nlon)[ialt])[ilat] = nlon;
+            (((*mesh).lonres)[ialt])[ilat] = 360.0 / nlon;
 
-    /* allocate space for pointer to number of longitudes and longitude resolution for each latitude in each layer */
+            if(nbytes - pos < (long) (nlon * 12 * sizeof (MESH_REAL_TYPE)))
+                goto truncated;
+            pos += nlon * 12 * sizeof (MESH_REAL_TYPE);
+        } /* for ilat */
+    } /* for ialt */
 
-    (*mesh).nlon = malloc((*mesh).nalt * sizeof (int*));
-    if((*mesh).nlon == NULL)
+    if(EMM_buf_int(buf, nbytes, &pos, &check))
+        goto truncated;
+    if(check != 4711)
     {
         if(verbose)
         {
-            printf("Error - out of memory\n");
+            printf("Mesh file format error. Last integer in binary file should be 4711, but is = %1d\n", check);
             fflush(stdout);
         }
-        return EXIT_MESH_MEM_ALLOC_ERROR;
+        status = EXIT_MESH_FILE_FORMAT_ERROR;
+        goto error;
     }
 
-    (*mesh).lonres = malloc((*mesh).nalt * sizeof (double**));
-    if((*mesh).lonres == NULL)
+    /* convert the cell data, one altitude layer per task */
+
+    status = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) private(ilat, nlon, i, p, cell, oneval)
+#endif
+    for(ialt = 0; ialt < (*mesh).nalt; ialt++)
     {
-        if(verbose)
+        if(EMM_mesh_alloc_layer(mesh, ialt, NULL))
         {
-            printf("Error - out of memory\n");
-            fflush(stdout);
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+            status = EXIT_MESH_MEM_ALLOC_ERROR;
+            continue;
         }
-        return EXIT_MESH_MEM_ALLOC_ERROR;
-    }
+        p = buf + layer_pos[ialt];
+        for(ilat = 0; ilat < ((*mesh).nlat)[ialt]; ilat++)
+        {
+            nlon = (((*mesh).nlon)[ialt])[ilat];
+            p += sizeof (int);
+            cell = ((((*mesh).comp)[ialt])[ilat])[0];
+            for(i = 0; i < nlon * 12; i++, p += sizeof (MESH_REAL_TYPE))
+            {
+                memcpy(&oneval, p, sizeof (MESH_REAL_TYPE));
+                cell[i] = oneval;
+            }
 
-    /* allocate data pointers for each altitude layer */
+            /* duplicate the first longitude at the end */
+
+            memcpy(cell + nlon * 12, cell, 12 * sizeof (double));
+        } /* for ilat */
+    } /* for ialt */
 
-    (*mesh).comp = malloc((*mesh).nalt * sizeof (double***));
-    if((*mesh).comp == NULL)
+    free(layer_pos);
+    free(buf);
+    if(status)
     {
         if(verbose)
         {
             printf("Error - out of memory\n");
             fflush(stdout);
         }
-        return EXIT_MESH_MEM_ALLOC_ERROR;
+        EMM_mesh_free(mesh);
+        return status;
     }
 
-    for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+    if(verbose) printf("Mesh has %1d altitude layers\n", (*mesh).nalt);
+
+    check = EMM_mesh_build_locator(verbose, mesh);
+    if(check)
+        return check;
+
+    if(verbose)
     {
+        printf("Completed reading mesh file\n");
+        fflush(stdout);
+    }
 
-        /* get layer altitude */
+    return 0;
 
-        fread(&oneval, sizeof (MESH_REAL_TYPE), 1, meshfile);
-        ((*mesh).alt)[ialt] = oneval;
+truncated:
+    status = EXIT_MESH_FILE_FORMAT_ERROR;
+    if(verbose)
+    {
+        printf("Mesh file format error. File %s ends early\n", meshfname);
+        fflush(stdout);
+    }
+error:
+    if(verbose && status == EXIT_MESH_MEM_ALLOC_ERROR)
+    {
+        printf("Error - out of memory\n");
+        fflush(stdout);
+    }
+    free(layer_pos);
+    free(buf);
+    EMM_mesh_free(mesh);
+    return status;
+} /* mesh_read */
 
-        /* get number of latitudes for this layer */
-        /* different altitudes can have different resolution */
+static int EMM_buf_int(const unsigned char *buf, long nbytes, long *pos, int *value) /* next int of a file buffer, nonzero past the end */
+{
+    if(nbytes - *pos < (long) sizeof (int))
+        return EXIT_MESH_FILE_FORMAT_ERROR;
+    memcpy(value, buf + *pos, sizeof (int));
+    *pos += sizeof (int);
+    return 0;
+} /* buf_int */
 
-        fread(&((*mesh).nlat)[ialt], sizeof (int), 1, meshfile);
-        if(((*mesh).nlat)[ialt] < 1 || ((*mesh).nlat)[ialt] > MESH_MAXLAT)
-        {
-            if(verbose)
-            {
-                printf("Error - Number of rows in latitude out of range: %d \n", ((*mesh).nlat)[ialt]);
-                fflush(stdout);
-            }
-            return EXIT_MESH_FILE_NLAT_ERROR;
-        }
+static int EMM_buf_real(const unsigned char *buf, long nbytes, long *pos, double *value) /* next MESH_REAL_TYPE of a file buffer, nonzero past the end */
+{
+    MESH_REAL_TYPE oneval;
 
-        ((*mesh).latres)[ialt] = 180.0 / ((*mesh).nlat)[ialt];
+    if(nbytes - *pos < (long) sizeof (MESH_REAL_TYPE))
+        return EXIT_MESH_FILE_FORMAT_ERROR;
+    memcpy(&oneval, buf + *pos, sizeof (MESH_REAL_TYPE));
+    *pos += sizeof (MESH_REAL_TYPE);
+    *value = oneval;
+    return 0;
+} /* buf_real */
+
+static int EMM_mesh_alloc_layer(EMM_tmesh *mesh, int ialt, double *cells)
+/* one block for the cells of a layer and one for its cell pointers, each row followed by a copy of its first cell; */
+/* nlat and nlon of the layer must be set. If cells is not NULL, the pointers refer to that block instead of a new one */
+{
+    int ilat, icell, ncell;
+    double **cellp;
+
+    ncell = 0;
+    for(ilat = 0; ilat < ((*mesh).nlat)[ialt]; ilat++)
+        ncell += (((*mesh).nlon)[ialt])[ilat] + 1;
+
+    ((*mesh).comp)[ialt] = calloc(((*mesh).nlat)[ialt], sizeof (double**));
+    if(((*mesh).comp)[ialt] == NULL)
+        return EXIT_MESH_MEM_ALLOC_ERROR;
+    cellp = malloc(ncell * sizeof (double*));
+    ((*mesh).cells)[ialt] = cells != NULL ? cells : malloc(ncell * 12 * sizeof (double));
+    if(cellp == NULL || ((*mesh).cells)[ialt] == NULL)
+    {
+        free(cellp);
+        return EXIT_MESH_MEM_ALLOC_ERROR;
+    }
+
+    ncell = 0;
+    for(ilat = 0; ilat < ((*mesh).nlat)[ialt]; ilat++) /* row pointers into the block, so the first row owns cellp */
+    {
+        (((*mesh).comp)[ialt])[ilat] = cellp + ncell;
+        ncell += (((*mesh).nlon)[ialt])[ilat] + 1;
+    }
+    for(icell = 0; icell < ncell; icell++)
+        cellp[icell] = ((*mesh).cells)[ialt] + icell * 12;
+
+    return 0;
+} /* mesh_alloc_layer */
+
+int EMM_mesh_generate(int verbose, MAGtype_MagneticModel *model, MAGtype_Ellipsoid Ellip, int secvar,
+        int nalt, const double alt[], const int nlat[], EMM_tmesh *mesh)
+/* evaluate a spherical harmonic model on a new mesh of nalt layers at the increasing heights alt[] (km above the ellipsoid), */
+/* layer ialt having nlat[ialt] rows. Rows away from the equator get fewer cells, about 2 nlat cos(lat) but at least */
+/* EMM_GEN_MINLON, since the polar caps beyond the last rows are extrapolated along them. */
+/* secvar selects the secular variation coefficients of the model instead of the main field. */
+/* Rows are computed in parallel when compiled with OpenMP. */
+{
+    int ialt, ilat, irow, nrow, status;
+    int *row_alt, *row_lat;
+    double lat;
+    MAGtype_LegendreFunction *legendre[5];
+    MAGtype_SphericalHarmonicVariables *sphvar;
 
-        /* allocate space for number of longitudes and resolution for each latitude in each layer */
+    memset(mesh, 0, sizeof (EMM_tmesh));
 
-        ((*mesh).nlon)[ialt] = malloc(((*mesh).nlat)[ialt] * sizeof (int*));
-        if(((*mesh).nlon)[ialt] == NULL)
+    if(nalt < 2 || nalt > 1000)
+    {
+        if(verbose)
+        {
+            printf("Error - Number of altitude layers out of range: %d \n", nalt);
+            fflush(stdout);
+        }
+        return EXIT_MESH_FILE_NALT_ERROR;
+    }
+    for(ialt = 0; ialt < nalt; ialt++)
+    {
+        if(ialt > 0 && !(alt[ialt] > alt[ialt - 1]))
         {
             if(verbose)
             {
-                printf("Error - out of memory\n");
+                printf("Error - Altitude layers must increase: %f after %f \n", alt[ialt], alt[ialt - 1]);
                 fflush(stdout);
             }
-            return EXIT_MESH_MEM_ALLOC_ERROR;
+            return EXIT_MESH_FILE_ALT_ERROR;
         }
-
-        ((*mesh).lonres)[ialt] = malloc(((*mesh).nlat)[ialt] * sizeof (double*));
-        if(((*mesh).lonres)[ialt] == NULL)
+        if(nlat[ialt] < 2 || nlat[ialt] > MESH_MAXLAT)
         {
             if(verbose)
             {
-                printf("Error - out of memory\n");
+                printf("Error - Number of rows in latitude out of range: %d \n", nlat[ialt]);
                 fflush(stdout);
             }
-            return EXIT_MESH_MEM_ALLOC_ERROR;
+            return EXIT_MESH_FILE_NLAT_ERROR;
         }
+    }
 
+    (*mesh).version = 0; /* not a released mesh */
+    (*mesh).epoch = model->epoch;
+    (*mesh).nalt = nalt;
+
+    row_alt = row_lat = NULL;
+    status = EXIT_MESH_MEM_ALLOC_ERROR;
+    (*mesh).alt = malloc(nalt * sizeof (double));
+    (*mesh).nlat = malloc(nalt * sizeof (int));
+    (*mesh).latres = malloc(nalt * sizeof (double));
+    (*mesh).nlon = calloc(nalt, sizeof (int*));
+    (*mesh).lonres = calloc(nalt, sizeof (double*));
+    (*mesh).comp = calloc(nalt, sizeof (double***));
+    (*mesh).cells = calloc(nalt, sizeof (double*));
+    if((*mesh).alt == NULL || (*mesh).nlat == NULL || (*mesh).latres == NULL || (*mesh).nlon == NULL ||
+            (*mesh).lonres == NULL || (*mesh).comp == NULL || (*mesh).cells == NULL)
+        goto error;
+
+    nrow = 0;
+    for(ialt = 0; ialt < nalt; ialt++)
+    {
+        ((*mesh).alt)[ialt] = alt[ialt];
+        ((*mesh).nlat)[ialt] = nlat[ialt];
+        ((*mesh).latres)[ialt] = 180.0 / nlat[ialt];
+        ((*mesh).nlon)[ialt] = malloc(nlat[ialt] * sizeof (int));
+        ((*mesh).lonres)[ialt] = malloc(nlat[ialt] * sizeof (double));
+        if(((*mesh).nlon)[ialt] == NULL || ((*mesh).lonres)[ialt] == NULL)
+            goto error;
+
+        for(ilat = 0; ilat < nlat[ialt]; ilat++)
+        {
+            lat = (ilat + 0.5) * ((*mesh).latres)[ialt] - 90.0;
+            (((*mesh).nlon)[ialt])[ilat] = (int) ceil(2 * nlat[ialt] * cos(lat * M_PI / 180.0));
+            if((((*mesh).nlon)[ialt])[ilat] < EMM_GEN_MINLON)
+                (((*mesh).nlon)[ialt])[ilat] = EMM_GEN_MINLON;
+            if((((*mesh).nlon)[ialt])[ilat] > 2 * nlat[ialt])
+                (((*mesh).nlon)[ialt])[ilat] = 2 * nlat[ialt];
+            (((*mesh).lonres)[ialt])[ilat] = 360.0 / (((*mesh).nlon)[ialt])[ilat];
+        }
+        if(EMM_mesh_alloc_layer(mesh, ialt, NULL))
+            goto error;
+        nrow += nlat[ialt];
+    }
 
-        /* allocate data pointer for each latitude at this altitude */
-
-        ((*mesh).comp)[ialt] = malloc(((*mesh).nlat)[ialt] * sizeof (double**));
-        if(((*mesh).comp)[ialt] == NULL)
+    row_alt = malloc(nrow * sizeof (int));
+    row_lat = malloc(nrow * sizeof (int));
+    if(row_alt == NULL || row_lat == NULL)
+        goto error;
+    irow = 0;
+    for(ialt = 0; ialt < nalt; ialt++)
+        for(ilat = 0; ilat < nlat[ialt]; ilat++, irow++)
         {
-            if(verbose)
-            {
-                printf("Error - out of memory\n");
-                fflush(stdout);
-            }
-            return EXIT_MESH_MEM_ALLOC_ERROR;
+            row_alt[irow] = ialt;
+            row_lat[irow] = ilat;
         }
 
-        for(ilat = 0; ilat < ((*mesh).nlat)[ialt]; ilat++)
+    if(verbose)
+    {
+        printf("Evaluating %s on %d rows...\n", secvar ? "secular variation" : "main field", nrow);
+        fflush(stdout);
+    }
+
+    /* one task per row; each thread has its own Legendre functions and spherical harmonic variables */
+
+    status = 0;
+#ifdef _OPENMP
+#pragma omp parallel private(irow, legendre, sphvar)
+#endif
+    {
+        int k, nmax = secvar ? model->nMaxSecVar : model->nMax, ok = TRUE;
+
+        for(k = 0; k < 5; k++)
         {
-            fread(&(((*mesh).nlon)[ialt])[ilat], sizeof (int), 1, meshfile);
-            if((((*mesh).nlon)[ialt])[ilat] < 1 || (((*mesh).nlon)[ialt])[ilat] > 2 * ((*mesh).nlat)[ialt])
-            {
-                if(verbose)
-                {
-                    printf("Error - Number of cells at altitude %1d in row %1d is out of range: nlon[%1d][%1d]=%1d \n", ialt, ilat, ialt, ilat, (((*mesh).nlon)[ialt])[ilat]);
-                    fflush(stdout);
-                }
-                return EXIT_MESH_FILE_NLON_ERROR;
-            }
-            (((*mesh).lonres)[ialt])[ilat] = 360.0 / (((*mesh).nlon)[ialt])[ilat];
+            legendre[k] = MAG_AllocateLegendreFunctionMemory((nmax + 1) * (nmax + 2) / 2);
+            ok = ok && legendre[k] != NULL;
+        }
+        sphvar = MAG_AllocateSphVarMemory(nmax);
+        if(!ok || sphvar == NULL)
+        {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+            status = EXIT_MESH_MEM_ALLOC_ERROR;
+        }
 
-            /* allocate data pointer for each latitude at this altitude */
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(irow = 0; irow < nrow; irow++)
+            if(ok && sphvar != NULL)
+                EMM_mesh_generate_row(model, Ellip, secvar, nmax, *mesh, row_alt[irow], row_lat[irow], legendre, sphvar);
+
+        for(k = 0; k < 5; k++)
+            if(legendre[k] != NULL)
+                MAG_FreeLegendreMemory(legendre[k]);
+        if(sphvar != NULL)
+            MAG_FreeSphVarMemory(sphvar);
+    }
+    if(status)
+        goto error;
 
-            (((*mesh).comp)[ialt])[ilat] = malloc(((((*mesh).nlon)[ialt])[ilat] + 1) * sizeof (double*)); /* add one to duplicate the first longitude at the end */
+    free(row_alt);
+    free(row_lat);
+    return EMM_mesh_build_locator(verbose, mesh);
 
-            if((((*mesh).comp)[ialt])[ilat] == NULL)
-            {
-                if(verbose)
-                {
-                    printf("Error - out of memory\n");
-                    fflush(stdout);
-                }
-                return EXIT_MESH_MEM_ALLOC_ERROR;
-            } /* if NULL */
+error:
+    if(verbose)
+    {
+        printf("Error - out of memory\n");
+        fflush(stdout);
+    }
+    free(row_alt);
+    free(row_lat);
+    EMM_mesh_free(mesh);
+    return status;
+} /* mesh_generate */
+
+static void EMM_mesh_generate_row(MAGtype_MagneticModel *model, MAGtype_Ellipsoid Ellip, int secvar, int nmax,
+        EMM_tmesh mesh, int ialt, int ilat, MAGtype_LegendreFunction *legendre[5], MAGtype_SphericalHarmonicVariables *sphvar)
+/* values and central difference derivatives of the cartesian field components at every cell of a row */
+{
+    int k, ilon, nlon, c;
+    double lon, lonres, h[3], hp[3], hm[3], *cell;
+    MAGtype_CoordGeodetic geodetic;
+    MAGtype_CoordSpherical spherical[5];
 
-            for(ilon = 0; ilon < (((*mesh).nlon)[ialt])[ilat]; ilon++)
-            {
-                ((((*mesh).comp)[ialt])[ilat])[ilon] = malloc(12 * sizeof (double));
-                if(((((*mesh).comp)[ialt])[ilat])[ilon] == NULL)
-                {
-                    if(verbose)
-                    {
-                        printf("Error - out of memory\n");
-                        fflush(stdout);
-                    }
-                    return EXIT_MESH_MEM_ALLOC_ERROR;
-                } /* if NULL */
+    /* geocentric latitude and radius do not depend on longitude, neither do the Legendre functions: */
+    /* the row itself, one step north and south, one step up and down */
 
+    geodetic.lambda = 0;
+    for(k = 0; k < 5; k++)
+    {
+        geodetic.phi = (ilat + 0.5) * (mesh.latres)[ialt] - 90.0 + (k == 1 ? EMM_GEN_DLAT : k == 2 ? -EMM_GEN_DLAT : 0.0);
+        geodetic.HeightAboveEllipsoid = (mesh.alt)[ialt] + (k == 3 ? EMM_GEN_DALT : k == 4 ? -EMM_GEN_DALT : 0.0);
+        MAG_GeodeticToSpherical(Ellip, geodetic, &spherical[k]);
+        MAG_AssociatedLegendreFunction(spherical[k], nmax, legendre[k]);
+    }
 
-                for(icomp = 0; icomp < 3; icomp++)
-                    for(ideriv = 0; ideriv < 4; ideriv++)
-                    {
-                        fread(&oneval, sizeof (MESH_REAL_TYPE), 1, meshfile);
-                        (((((*mesh).comp)[ialt])[ilat])[ilon])[icomp * 4 + ideriv] = oneval;
-                    }
-            } /* for ilon */
+    nlon = ((mesh.nlon)[ialt])[ilat];
+    lonres = ((mesh.lonres)[ialt])[ilat];
+    for(ilon = 0; ilon < nlon; ilon++)
+    {
+        cell = (((mesh.comp)[ialt])[ilat])[ilon];
+        lon = ilon * lonres;
 
-            /* duplicate the first longitude at the end */
+        EMM_mesh_generate_point(model, Ellip, secvar, nmax, spherical[0], lon, legendre[0], sphvar, h);
+        for(c = 0; c < 3; c++)
+            cell[c * 4] = h[c];
 
-            ilon = (((*mesh).nlon)[ialt])[ilat]; /* now ilon = nlon for that row */
-            ((((*mesh).comp)[ialt])[ilat])[ilon] = malloc(12 * sizeof (double)); /* add one to duplicate the first longitude at the end */
-            if(((((*mesh).comp)[ialt])[ilat])[ilon] == NULL)
-            {
-                if(verbose)
-                {
-                    printf("Error - out of memory\n");
-                    fflush(stdout);
-                }
-                return EXIT_MESH_MEM_ALLOC_ERROR;
-            } /* if NULL */
+        EMM_mesh_generate_point(model, Ellip, secvar, nmax, spherical[0], lon + EMM_GEN_DLON, legendre[0], sphvar, hp);
+        EMM_mesh_generate_point(model, Ellip, secvar, nmax, spherical[0], lon - EMM_GEN_DLON, legendre[0], sphvar, hm);
+        for(c = 0; c < 3; c++)
+            cell[c * 4 + 1] = (hp[c] - hm[c]) / (2 * EMM_GEN_DLON);
 
-            for(icomp = 0; icomp < 3; icomp++)
-                for(ideriv = 0; ideriv < 4; ideriv++)
-                    (((((*mesh).comp)[ialt])[ilat])[ilon])[icomp * 4 + ideriv] = (((((*mesh).comp)[ialt])[ilat])[0])[icomp * 4 + ideriv];
+        EMM_mesh_generate_point(model, Ellip, secvar, nmax, spherical[1], lon, legendre[1], sphvar, hp);
+        EMM_mesh_generate_point(model, Ellip, secvar, nmax, spherical[2], lon, legendre[2], sphvar, hm);
+        for(c = 0; c < 3; c++)
+            cell[c * 4 + 2] = (hp[c] - hm[c]) / (2 * EMM_GEN_DLAT);
 
-        } /* for ilat */
-    } /* for ialt */
+        EMM_mesh_generate_point(model, Ellip, secvar, nmax, spherical[3], lon, legendre[3], sphvar, hp);
+        EMM_mesh_generate_point(model, Ellip, secvar, nmax, spherical[4], lon, legendre[4], sphvar, hm);
+        for(c = 0; c < 3; c++)
+            cell[c * 4 + 3] = (hp[c] - hm[c]) / (2 * EMM_GEN_DALT);
+    } /* for ilon */
 
-    fread(&check, sizeof (int), 1, meshfile);
-    if(check != 4711)
+    /* duplicate the first longitude at the end */
+
+    memcpy((((mesh.comp)[ialt])[ilat])[nlon], (((mesh.comp)[ialt])[ilat])[0], 12 * sizeof (double));
+} /* mesh_generate_row */
+
+static void EMM_mesh_generate_point(MAGtype_MagneticModel *model, MAGtype_Ellipsoid Ellip, int secvar, int nmax,
+        MAGtype_CoordSpherical spherical, double lon, MAGtype_LegendreFunction *legendre, MAGtype_SphericalHarmonicVariables *sphvar, double h[3])
+/* cartesian field components at a longitude, the Legendre functions of the latitude and radius already computed */
+{
+    MAGtype_MagneticResults B;
+
+    spherical.lambda = lon;
+    MAG_ComputeSphericalHarmonicVariables(Ellip, spherical, nmax, sphvar);
+    if(secvar)
+        MAG_SecVarSummation(legendre, model, *sphvar, spherical, &B);
+    else
+        MAG_Summation(legendre, model, *sphvar, spherical, &B);
+    EMM_sphere2cart_vec(lon * M_PI / 180.0, spherical.phig * M_PI / 180.0, B.Bx, B.By, B.Bz, &h[0], &h[1], &h[2]);
+} /* mesh_generate_point */
+
+int EMM_mesh_write(int verbose, EMM_tmesh mesh, char meshfname[]) /* write a mesh in the binary format read by EMM_mesh_read */
+{
+    int ialt, ilat, ilon, i, nlon, check;
+    MESH_REAL_TYPE oneval;
+    FILE *outfile;
+
+    if(mesh.qcells != NULL)
+        return EXIT_MESH_QUANTIZED_ERROR;
+
+    outfile = fopen(meshfname, "wb");
+    if(outfile == NULL)
     {
         if(verbose)
         {
-            printf("Mesh file format error. Last integer in binary file should be 4711, but is = %1d\n", check);
+            printf("Binary mesh file %s could not be opened for writing\n", meshfname);
             fflush(stdout);
         }
-        return EXIT_MESH_FILE_FORMAT_ERROR;
+        return EXIT_MESH_BIN_FILE_WRITE_ERROR;
     }
 
+    oneval = mesh.version;
+    fwrite(&oneval, sizeof (MESH_REAL_TYPE), 1, outfile);
+    oneval = mesh.epoch;
+    fwrite(&oneval, sizeof (MESH_REAL_TYPE), 1, outfile);
+    fwrite(&mesh.nalt, sizeof (int), 1, outfile);
 
-    if(verbose) printf("Mesh has %1d altitude layers\n", (*mesh).nalt);
+    for(ialt = 0; ialt < mesh.nalt; ialt++)
+    {
+        oneval = (mesh.alt)[ialt];
+        fwrite(&oneval, sizeof (MESH_REAL_TYPE), 1, outfile);
+        fwrite(&(mesh.nlat)[ialt], sizeof (int), 1, outfile);
+        for(ilat = 0; ilat < (mesh.nlat)[ialt]; ilat++)
+        {
+            nlon = ((mesh.nlon)[ialt])[ilat];
+            fwrite(&nlon, sizeof (int), 1, outfile);
+            for(ilon = 0; ilon < nlon; ilon++)
+                for(i = 0; i < 12; i++)
+                {
+                    oneval = ((((mesh.comp)[ialt])[ilat])[ilon])[i];
+                    fwrite(&oneval, sizeof (MESH_REAL_TYPE), 1, outfile);
+                }
+        }
+    }
 
-    fclose(meshfile);
+    check = 4711;
+    fwrite(&check, sizeof (int), 1, outfile);
 
+    if(ferror(outfile) | fclose(outfile))
+    {
+        if(verbose)
+        {
+            printf("Error - Binary mesh file %s could not be written\n", meshfname);
+            fflush(stdout);
+        }
+        return EXIT_MESH_BIN_FILE_WRITE_ERROR;
+    }
     if(verbose)
     {
-        printf("Completed reading mesh file\n");
+        printf("Wrote binary mesh file %s\n", meshfname);
         fflush(stdout);
     }
-
     return 0;
-} /* mesh_read */
+} /* mesh_write */
 
-static double EMM_cell(EMM_tmesh mesh, int ialt, int ilat, int ilon, int icomp)
+int EMM_mesh_build_locator(int verbose, EMM_tmesh *mesh)
+/* tables that turn the cell lookup into a few multiply-adds: altitude bins no wider than the thinnest layer, */
+/* and the resolutions of every row in flat arrays */
 {
-    return ((((mesh.comp)[ialt])[ilat])[ilon])[icomp * 4];
-}
+    int ialt, ilat, ibin, row, nrow;
+    double width, span;
+
+    EMM_mesh_free_locator(mesh);
+
+    (*mesh).inv_latres = malloc((*mesh).nalt * sizeof (double));
+    (*mesh).row0 = malloc((*mesh).nalt * sizeof (int));
+    if((*mesh).inv_latres == NULL || (*mesh).row0 == NULL)
+        goto out_of_memory;
+
+    nrow = 0;
+    for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+    {
+        ((*mesh).inv_latres)[ialt] = ((*mesh).nlat)[ialt] / 180.0;
+        ((*mesh).row0)[ialt] = nrow;
+        nrow += ((*mesh).nlat)[ialt];
+    }
+
+    (*mesh).row_nlon = malloc(nrow * sizeof (int));
+    (*mesh).row_lonres = malloc(nrow * sizeof (double));
+    (*mesh).row_inv_lonres = malloc(nrow * sizeof (double));
+    if((*mesh).row_nlon == NULL || (*mesh).row_lonres == NULL || (*mesh).row_inv_lonres == NULL)
+        goto out_of_memory;
+
+    for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+        for(ilat = 0; ilat < ((*mesh).nlat)[ialt]; ilat++)
+        {
+            row = ((*mesh).row0)[ialt] + ilat;
+            ((*mesh).row_nlon)[row] = (((*mesh).nlon)[ialt])[ilat];
+            ((*mesh).row_lonres)[row] = (((*mesh).lonres)[ialt])[ilat];
+            ((*mesh).row_inv_lonres)[row] = (((*mesh).nlon)[ialt])[ilat] / 360.0;
+        }
+
+    if((*mesh).nalt < 2)
+        return 0; /* nothing to bin */
+
+    width = span = ((*mesh).alt)[(*mesh).nalt - 1] - ((*mesh).alt)[0];
+    for(ialt = 1; ialt < (*mesh).nalt; ialt++)
+        if(((*mesh).alt)[ialt] - ((*mesh).alt)[ialt - 1] < width)
+            width = ((*mesh).alt)[ialt] - ((*mesh).alt)[ialt - 1];
+    if(!(width > 0))
+        return 0; /* layers not increasing, keep the linear scan */
+    if(span / width > EMM_MAX_ALT_BINS - 1)
+        width = span / (EMM_MAX_ALT_BINS - 1);
+
+    (*mesh).naltbin = (int) ceil(span / width) + 1;
+    (*mesh).inv_altbin = 1.0 / width;
+    (*mesh).altbin = malloc((*mesh).naltbin * sizeof (int));
+    if((*mesh).altbin == NULL)
+        goto out_of_memory;
+
+    ialt = 0;
+    for(ibin = 0; ibin < (*mesh).naltbin; ibin++) /* highest layer at or below the start of the bin */
+    {
+        while(ialt < (*mesh).nalt - 1 && ((*mesh).alt)[ialt + 1] <= ((*mesh).alt)[0] + ibin * width)
+            ialt++;
+        ((*mesh).altbin)[ibin] = ialt;
+    }
+
+    return 0;
+
+out_of_memory:
+    if(verbose)
+    {
+        printf("Error - out of memory\n");
+        fflush(stdout);
+    }
+    EMM_mesh_free_locator(mesh);
+    return EXIT_MESH_MEM_ALLOC_ERROR;
+} /* mesh_build_locator */
+
+static void EMM_mesh_free_locator(EMM_tmesh *mesh)
+{
+    free((*mesh).altbin);
+    free((*mesh).inv_latres);
+    free((*mesh).row0);
+    free((*mesh).row_nlon);
+    free((*mesh).row_lonres);
+    free((*mesh).row_inv_lonres);
+    (*mesh).altbin = NULL;
+    (*mesh).inv_latres = NULL;
+    (*mesh).row0 = NULL;
+    (*mesh).row_nlon = NULL;
+    (*mesh).row_lonres = NULL;
+    (*mesh).row_inv_lonres = NULL;
+    (*mesh).naltbin = 0;
+} /* mesh_free_locator */
+
+static void EMM_mesh_free_cells(EMM_tmesh *mesh) /* the full precision cells and their pointers */
+{
+    int ialt;
+
+    if((*mesh).comp != NULL)
+    {
+        for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+        {
+            if(((*mesh).comp)[ialt] == NULL)
+                continue;
+            free((((*mesh).comp)[ialt])[0]); /* the cell pointers of the layer, see EMM_mesh_alloc_layer */
+            free(((*mesh).comp)[ialt]);
+        }
+        free((*mesh).comp);
+    }
+    if((*mesh).cells != NULL)
+    {
+        for(ialt = 0; ialt < (*mesh).nalt && (*mesh).shm == NULL; ialt++)
+            free(((*mesh).cells)[ialt]);
+        free((*mesh).cells);
+    }
+#if EMM_SHM
+    if((*mesh).shm != NULL)
+        munmap((*mesh).shm, (*mesh).shm_size);
+#endif
+    (*mesh).comp = NULL;
+    (*mesh).cells = NULL;
+    (*mesh).shm = NULL;
+} /* mesh_free_cells */
+
+void EMM_mesh_free(EMM_tmesh *mesh) /* release everything allocated by EMM_mesh_read, EMM_mesh_generate, EMM_mesh_snapshot or EMM_mesh_attach */
+{
+    int ialt;
+
+    EMM_mesh_free_cells(mesh);
+    EMM_mesh_free_quantized(mesh);
+    if((*mesh).nlon != NULL)
+    {
+        for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+            free(((*mesh).nlon)[ialt]);
+        free((*mesh).nlon);
+    }
+    if((*mesh).lonres != NULL)
+    {
+        for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+            free(((*mesh).lonres)[ialt]);
+        free((*mesh).lonres);
+    }
+    EMM_mesh_free_coef(mesh);
+    EMM_mesh_free_locator(mesh);
+    free((*mesh).alt);
+    free((*mesh).nlat);
+    free((*mesh).latres);
+    memset(mesh, 0, sizeof (EMM_tmesh));
+} /* mesh_free */
+
+int EMM_mesh_same_geometry(EMM_tmesh mesh, EMM_tmesh other) /* TRUE if both meshes have identical layers, rows and cells */
+{
+    int ialt, ilat;
+
+    if(mesh.nalt != other.nalt)
+        return FALSE;
+    for(ialt = 0; ialt < mesh.nalt; ialt++)
+    {
+        if((mesh.alt)[ialt] != (other.alt)[ialt] || (mesh.nlat)[ialt] != (other.nlat)[ialt])
+            return FALSE;
+        for(ilat = 0; ilat < (mesh.nlat)[ialt]; ilat++)
+            if(((mesh.nlon)[ialt])[ilat] != ((other.nlon)[ialt])[ilat])
+                return FALSE;
+    }
+    return TRUE;
+} /* mesh_same_geometry */
+
+int EMM_mesh_snapshot(int verbose, EMM_tmesh mesh, EMM_tmesh mesh_SV, double year, EMM_tmesh *snapshot)
+/* materialize the main field at a given decimal year, so that queries for that year interpolate a single mesh */
+{
+    int ialt, ilat;
+    long ncell, i;
+    double dt, *cell, *cell_SV, *snap;
+
+    if(!EMM_mesh_same_geometry(mesh, mesh_SV))
+    {
+        if(verbose)
+        {
+            printf("Error - Main field and secular variation meshes do not share a grid geometry\n");
+            fflush(stdout);
+        }
+        return EXIT_MESH_GEOMETRY_ERROR;
+    }
+    if(mesh.qcells != NULL || mesh_SV.qcells != NULL)
+        return EXIT_MESH_QUANTIZED_ERROR;
+
+    memset(snapshot, 0, sizeof (EMM_tmesh));
+    (*snapshot).version = mesh.version;
+    (*snapshot).epoch = year;
+    (*snapshot).nalt = mesh.nalt;
+
+    (*snapshot).alt = malloc(mesh.nalt * sizeof (double));
+    (*snapshot).nlat = malloc(mesh.nalt * sizeof (int));
+    (*snapshot).latres = malloc(mesh.nalt * sizeof (double));
+    (*snapshot).nlon = calloc(mesh.nalt, sizeof (int*));
+    (*snapshot).lonres = calloc(mesh.nalt, sizeof (double*));
+    (*snapshot).comp = calloc(mesh.nalt, sizeof (double***));
+    (*snapshot).cells = calloc(mesh.nalt, sizeof (double*));
+    if((*snapshot).alt == NULL || (*snapshot).nlat == NULL || (*snapshot).latres == NULL || (*snapshot).nlon == NULL ||
+            (*snapshot).lonres == NULL || (*snapshot).comp == NULL || (*snapshot).cells == NULL)
+        goto out_of_memory;
+
+    memcpy((*snapshot).alt, mesh.alt, mesh.nalt * sizeof (double));
+    memcpy((*snapshot).nlat, mesh.nlat, mesh.nalt * sizeof (int));
+    memcpy((*snapshot).latres, mesh.latres, mesh.nalt * sizeof (double));
+
+    dt = year - mesh.epoch;
+
+    for(ialt = 0; ialt < mesh.nalt; ialt++)
+    {
+        ((*snapshot).nlon)[ialt] = malloc((mesh.nlat)[ialt] * sizeof (int));
+        ((*snapshot).lonres)[ialt] = malloc((mesh.nlat)[ialt] * sizeof (double));
+        if(((*snapshot).nlon)[ialt] == NULL || ((*snapshot).lonres)[ialt] == NULL)
+            goto out_of_memory;
+
+        memcpy(((*snapshot).nlon)[ialt], (mesh.nlon)[ialt], (mesh.nlat)[ialt] * sizeof (int));
+        memcpy(((*snapshot).lonres)[ialt], (mesh.lonres)[ialt], (mesh.nlat)[ialt] * sizeof (double));
+        if(EMM_mesh_alloc_layer(snapshot, ialt, NULL))
+            goto out_of_memory;
+
+        ncell = 0;
+        for(ilat = 0; ilat < (mesh.nlat)[ialt]; ilat++) /* includes the duplicated first longitudes */
+            ncell += ((mesh.nlon)[ialt])[ilat] + 1;
+
+        cell = (((mesh.comp)[ialt])[0])[0]; /* the layers of all three meshes are contiguous blocks with the same layout */
+        cell_SV = (((mesh_SV.comp)[ialt])[0])[0];
+        snap = ((*snapshot).cells)[ialt];
+        for(i = 0; i < ncell * 12; i++) /* values and derivatives are both linear in time */
+            snap[i] = cell[i] + dt * cell_SV[i];
+    } /* for ialt */
+
+    return EMM_mesh_build_locator(verbose, snapshot);
+
+out_of_memory:
+    if(verbose)
+    {
+        printf("Error - out of memory\n");
+        fflush(stdout);
+    }
+    EMM_mesh_free(snapshot);
+    return EXIT_MESH_MEM_ALLOC_ERROR;
+} /* mesh_snapshot */
+
+void EMM_snapshot_cache_init(EMM_tsnapshot_cache *cache)
+{
+    memset(cache, 0, sizeof (EMM_tsnapshot_cache));
+} /* snapshot_cache_init */
+
+EMM_tmesh *EMM_snapshot_cache_find(EMM_tsnapshot_cache *cache, double year) /* NULL if no snapshot exists for this year */
+{
+    int i;
+
+    for(i = 0; i < cache->n; i++)
+        if(cache->year[i] == year)
+            return &(cache->snapshot[i]);
+    return NULL;
+} /* snapshot_cache_find */
+
+static void EMM_snapshot_cache_drop(EMM_tsnapshot_cache *cache, int slot)
+/* remove the newest slot, after its snapshot failed, keeping the others from the oldest to the newest */
+{
+    EMM_tmesh snapshot[EMM_SNAPSHOT_CACHE];
+    double year[EMM_SNAPSHOT_CACHE];
+    int i, j;
+
+    EMM_mesh_free(&(cache->snapshot[slot]));
+    for(i = 1; i < cache->n; i++) /* the oldest slot follows the newest one */
+    {
+        j = (slot + i) % cache->n;
+        snapshot[i - 1] = cache->snapshot[j];
+        year[i - 1] = cache->year[j];
+    }
+    cache->n--;
+    for(i = 0; i < cache->n; i++)
+    {
+        cache->snapshot[i] = snapshot[i];
+        cache->year[i] = year[i];
+    }
+    memset(&(cache->snapshot[cache->n]), 0, sizeof (EMM_tmesh));
+    cache->next = cache->n;
+} /* snapshot_cache_drop */
+
+int EMM_snapshot_cache_get(int verbose, EMM_tsnapshot_cache *cache, EMM_tmesh mesh, EMM_tmesh mesh_SV, double year, EMM_tmesh **snapshot)
+/* return the snapshot for a year, materializing it (and dropping the oldest one) if it is not cached yet */
+{
+    int slot, status;
+
+    *snapshot = EMM_snapshot_cache_find(cache, year);
+    if(*snapshot != NULL)
+        return 0;
+
+    if(cache->n < EMM_SNAPSHOT_CACHE)
+        slot = cache->n++;
+    else
+    {
+        slot = cache->next; /* replace the oldest snapshot */
+        EMM_mesh_free(&(cache->snapshot[slot]));
+    }
+    cache->next = (slot + 1) % EMM_SNAPSHOT_CACHE;
+    cache->year[slot] = -1.0; /* empty until the snapshot is complete */
+
+    status = EMM_mesh_snapshot(verbose, mesh, mesh_SV, year, &(cache->snapshot[slot]));
+    if(status)
+    {
+        EMM_snapshot_cache_drop(cache, slot);
+        return status;
+    }
+
+    cache->year[slot] = year;
+    *snapshot = &(cache->snapshot[slot]);
+    return 0;
+} /* snapshot_cache_get */
+
+void EMM_snapshot_cache_free(EMM_tsnapshot_cache *cache)
+{
+    int i;
+
+    for(i = 0; i < cache->n; i++)
+        EMM_mesh_free(&(cache->snapshot[i]));
+    EMM_snapshot_cache_init(cache);
+} /* snapshot_cache_free */
+
+typedef struct {
+    int magic; /* EMM_SHM_MAGIC once the image is complete */
+    int nalt;
+    long nrow; /* rows of all layers */
+    long ncell; /* cells of all layers, including the duplicated first longitude of each row */
+    double version, epoch;
+} EMM_tshm_header; /* start of a shared memory mesh image, followed by alt[nalt], nlat[nalt], nlon[nrow] and the cells */
+
+#define EMM_SHM_MAGIC 0x314d4d45 /* "EMM1" */
+#define EMM_SHM_ALIGN(n) (((n) + 63) & ~((size_t) 63)) /* sections start on a cache line */
+
+static size_t EMM_shm_layout(int nalt, long nrow, long ncell, size_t *off_alt, size_t *off_nlat, size_t *off_nlon, size_t *off_cells)
+/* offsets of the sections of a shared memory image, returns its size */
+{
+    *off_alt = EMM_SHM_ALIGN(sizeof (EMM_tshm_header));
+    *off_nlat = EMM_SHM_ALIGN(*off_alt + nalt * sizeof (double));
+    *off_nlon = EMM_SHM_ALIGN(*off_nlat + nalt * sizeof (int));
+    *off_cells = EMM_SHM_ALIGN(*off_nlon + nrow * sizeof (int));
+    return *off_cells + ncell * 12 * sizeof (double);
+} /* shm_layout */
+
+int EMM_mesh_publish(int verbose, EMM_tmesh mesh, const char *name)
+/* copy a mesh into the POSIX shared memory object name (e.g. "/emm_static"), so that other processes can use it through EMM_mesh_attach. */
+/* Publishing again replaces the object, processes already attached keep the previous one. The object remains until EMM_mesh_unpublish. */
+{
+#if EMM_SHM
+    int fd, ialt, ilat;
+    long nrow, ncell, row, cell;
+    size_t size, off_alt, off_nlat, off_nlon, off_cells;
+    unsigned char *image;
+    EMM_tshm_header *header;
+    int *nlon;
+    double *cells;
+
+    if(mesh.qcells != NULL)
+        return EXIT_MESH_QUANTIZED_ERROR;
+
+    nrow = 0;
+    ncell = 0;
+    for(ialt = 0; ialt < mesh.nalt; ialt++)
+        for(ilat = 0; ilat < (mesh.nlat)[ialt]; ilat++, nrow++)
+            ncell += ((mesh.nlon)[ialt])[ilat] + 1;
+    size = EMM_shm_layout(mesh.nalt, nrow, ncell, &off_alt, &off_nlat, &off_nlon, &off_cells);
+
+    shm_unlink(name);
+    fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if(fd < 0)
+    {
+        if(verbose)
+        {
+            printf("Error - Shared memory object %s could not be created\n", name);
+            fflush(stdout);
+        }
+        return EXIT_MESH_SHM_ERROR;
+    }
+    image = MAP_FAILED;
+    if(ftruncate(fd, size) == 0)
+        image = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if(image == MAP_FAILED)
+    {
+        if(verbose)
+        {
+            printf("Error - Shared memory object %s could not be mapped\n", name);
+            fflush(stdout);
+        }
+        shm_unlink(name);
+        return EXIT_MESH_SHM_ERROR;
+    }
+
+    header = (EMM_tshm_header *) image;
+    header->nalt = mesh.nalt;
+    header->nrow = nrow;
+    header->ncell = ncell;
+    header->version = mesh.version;
+    header->epoch = mesh.epoch;
+    memcpy(image + off_alt, mesh.alt, mesh.nalt * sizeof (double));
+    memcpy(image + off_nlat, mesh.nlat, mesh.nalt * sizeof (int));
+
+    nlon = (int *) (image + off_nlon);
+    cells = (double *) (image + off_cells);
+    row = 0;
+    cell = 0;
+    for(ialt = 0; ialt < mesh.nalt; ialt++)
+        for(ilat = 0; ilat < (mesh.nlat)[ialt]; ilat++, row++)
+        {
+            nlon[row] = ((mesh.nlon)[ialt])[ilat];
+            memcpy(cells + cell * 12, (((mesh.comp)[ialt])[ilat])[0], (nlon[row] + 1) * 12 * sizeof (double)); /* rows are contiguous */
+            cell += nlon[row] + 1;
+        }
+    header->magic = EMM_SHM_MAGIC; /* written last, a process that attaches early sees an incomplete image */
+
+    munmap(image, size);
+    return 0;
+#else
+    if(verbose)
+    {
+        printf("Error - Shared memory meshes need POSIX shared memory\n");
+        fflush(stdout);
+    }
+    return EXIT_MESH_SHM_UNSUPPORTED;
+#endif
+} /* mesh_publish */
+
+int EMM_mesh_attach(int verbose, const char *name, EMM_tmesh *mesh)
+/* map a mesh published by EMM_mesh_publish read-only. The cells stay in shared memory, */
+/* only the small per-row tables and the cell pointers are allocated. Release with EMM_mesh_free. */
+{
+#if EMM_SHM
+    int fd, ialt, ilat, status;
+    long row, cell;
+    size_t size, off_alt, off_nlat, off_nlon, off_cells;
+    struct stat st;
+    unsigned char *image;
+    const EMM_tshm_header *header;
+    const int *nlon;
+
+    memset(mesh, 0, sizeof (EMM_tmesh));
+    fd = shm_open(name, O_RDONLY, 0);
+    if(fd < 0)
+    {
+        if(verbose)
+        {
+            printf("Error - Shared memory object %s could not be opened\n", name);
+            fflush(stdout);
+        }
+        return EXIT_MESH_SHM_ERROR;
+    }
+    image = MAP_FAILED;
+    if(fstat(fd, &st) == 0 && st.st_size >= (off_t) sizeof (EMM_tshm_header))
+        image = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(image == MAP_FAILED)
+    {
+        if(verbose)
+        {
+            printf("Error - Shared memory object %s could not be mapped\n", name);
+            fflush(stdout);
+        }
+        return EXIT_MESH_SHM_ERROR;
+    }
+    (*mesh).shm = image;
+    (*mesh).shm_size = st.st_size;
+
+    status = EXIT_MESH_SHM_ERROR;
+    header = (const EMM_tshm_header *) image;
+    if(header->magic != EMM_SHM_MAGIC || header->nalt < 1 || header->nalt > 1000 || header->nrow < 0 || header->ncell < 0)
+        goto error;
+    size = EMM_shm_layout(header->nalt, header->nrow, header->ncell, &off_alt, &off_nlat, &off_nlon, &off_cells);
+    if(size != (size_t) st.st_size)
+        goto error;
+
+    (*mesh).version = header->version;
+    (*mesh).epoch = header->epoch;
+    (*mesh).nalt = header->nalt;
+
+    status = EXIT_MESH_MEM_ALLOC_ERROR;
+    (*mesh).alt = malloc((*mesh).nalt * sizeof (double));
+    (*mesh).nlat = calloc((*mesh).nalt, sizeof (int));
+    (*mesh).latres = malloc((*mesh).nalt * sizeof (double));
+    (*mesh).nlon = calloc((*mesh).nalt, sizeof (int*));
+    (*mesh).lonres = calloc((*mesh).nalt, sizeof (double*));
+    (*mesh).comp = calloc((*mesh).nalt, sizeof (double***));
+    (*mesh).cells = calloc((*mesh).nalt, sizeof (double*));
+    if((*mesh).alt == NULL || (*mesh).nlat == NULL || (*mesh).latres == NULL || (*mesh).nlon == NULL ||
+            (*mesh).lonres == NULL || (*mesh).comp == NULL || (*mesh).cells == NULL)
+        goto error;
+    memcpy((*mesh).alt, image + off_alt, (*mesh).nalt * sizeof (double));
+    memcpy((*mesh).nlat, image + off_nlat, (*mesh).nalt * sizeof (int));
+
+    nlon = (const int *) (image + off_nlon);
+    row = 0;
+    cell = 0;
+    for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+    {
+        status = EXIT_MESH_SHM_ERROR; /* the image was checked when published, this only guards against a foreign object */
+        if(((*mesh).nlat)[ialt] < 1 || ((*mesh).nlat)[ialt] > MESH_MAXLAT || row + ((*mesh).nlat)[ialt] > header->nrow)
+            goto error;
+        ((*mesh).latres)[ialt] = 180.0 / ((*mesh).nlat)[ialt];
+
+        status = EXIT_MESH_MEM_ALLOC_ERROR;
+        ((*mesh).nlon)[ialt] = malloc(((*mesh).nlat)[ialt] * sizeof (int));
+        ((*mesh).lonres)[ialt] = malloc(((*mesh).nlat)[ialt] * sizeof (double));
+        if(((*mesh).nlon)[ialt] == NULL || ((*mesh).lonres)[ialt] == NULL)
+            goto error;
+
+        status = EXIT_MESH_SHM_ERROR;
+        ((*mesh).cells)[ialt] = (double *) (image + off_cells) + cell * 12;
+        for(ilat = 0; ilat < ((*mesh).nlat)[ialt]; ilat++, row++)
+        {
+            if(nlon[row] < 1 || nlon[row] > 2 * ((*mesh).nlat)[ialt]) /* same range as EMM_mesh_read */
+                goto error;
+            (((*mesh).nlon)[ialt])[ilat] = nlon[row];
+            (((*mesh).lonres)[ialt])[ilat] = 360.0 / nlon[row];
+            cell += nlon[row] + 1;
+        }
+
+        if(cell > header->ncell)
+            goto error;
+        if(EMM_mesh_alloc_layer(mesh, ialt, ((*mesh).cells)[ialt]))
+        {
+            status = EXIT_MESH_MEM_ALLOC_ERROR;
+            goto error;
+        }
+    } /* for ialt */
+
+    return EMM_mesh_build_locator(verbose, mesh);
+
+error:
+    if(verbose)
+    {
+        if(status == EXIT_MESH_MEM_ALLOC_ERROR)
+            printf("Error - out of memory\n");
+        else
+            printf("Error - Shared memory object %s does not hold a complete mesh\n", name);
+        fflush(stdout);
+    }
+    EMM_mesh_free(mesh);
+    return status;
+#else
+    memset(mesh, 0, sizeof (EMM_tmesh));
+    if(verbose)
+    {
+        printf("Error - Shared memory meshes need POSIX shared memory\n");
+        fflush(stdout);
+    }
+    return EXIT_MESH_SHM_UNSUPPORTED;
+#endif
+} /* mesh_attach */
+
+int EMM_mesh_unpublish(int verbose, const char *name) /* remove a shared memory mesh, processes still attached keep their mapping */
+{
+#if EMM_SHM
+    if(shm_unlink(name) != 0)
+    {
+        if(verbose)
+        {
+            printf("Error - Shared memory object %s could not be removed\n", name);
+            fflush(stdout);
+        }
+        return EXIT_MESH_SHM_ERROR;
+    }
+    return 0;
+#else
+    if(verbose)
+    {
+        printf("Error - Shared memory meshes need POSIX shared memory\n");
+        fflush(stdout);
+    }
+    return EXIT_MESH_SHM_UNSUPPORTED;
+#endif
+} /* mesh_unpublish */
+
+int EMM_mesh_precompute(int verbose, EMM_tmesh *mesh)
+/* store the longitude polynomials of every cell edge, so that interpolation only evaluates them */
+{
+    int ialt, ilat, ilon, icomp, nlon;
+    double dx, m, *cell0, *cell1, *p;
+
+    if((*mesh).qcells != NULL)
+        return EXIT_MESH_QUANTIZED_ERROR;
+    if(!USE_DERIVATIVES || !INTERPOLATE_CUBIC || (*mesh).coef != NULL)
+        return 0; /* only the cubic Hermite scheme is precomputed */
+
+    (*mesh).coef = calloc((*mesh).nalt, sizeof (double**));
+    if((*mesh).coef == NULL)
+        goto out_of_memory;
+
+    for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+    {
+        ((*mesh).coef)[ialt] = calloc(((*mesh).nlat)[ialt], sizeof (double*));
+        if(((*mesh).coef)[ialt] == NULL)
+            goto out_of_memory;
+
+        for(ilat = 0; ilat < ((*mesh).nlat)[ialt]; ilat++)
+        {
+            nlon = (((*mesh).nlon)[ialt])[ilat];
+            dx = (((*mesh).lonres)[ialt])[ilat];
+            (((*mesh).coef)[ialt])[ilat] = calloc(nlon * EMM_COEF_PER_EDGE + 1, sizeof (double)); /* one spare for the last vector load */
+            if((((*mesh).coef)[ialt])[ilat] == NULL)
+                goto out_of_memory;
+
+            for(ilon = 0; ilon < nlon; ilon++) /* edge from cell ilon to ilon + 1 */
+            {
+                cell0 = ((((*mesh).comp)[ialt])[ilat])[ilon];
+                cell1 = ((((*mesh).comp)[ialt])[ilat])[ilon + 1];
+                for(icomp = 0; icomp < 3; icomp++) /* coefficient k of component icomp is p[3 * k] */
+                {
+                    p = (((*mesh).coef)[ialt])[ilat] + ilon * EMM_COEF_PER_EDGE + icomp;
+                    m = (cell1[icomp * 4] - cell0[icomp * 4]) / dx;
+
+                    /* value: ((p0*t + p1)*t + p2)*t + p3 with t = lon - lon0 */
+                    p[0] = (cell0[icomp * 4 + 1] + cell1[icomp * 4 + 1] - 2.0 * m) / (dx * dx);
+                    p[3] = (3.0 * m - 2.0 * cell0[icomp * 4 + 1] - cell1[icomp * 4 + 1]) / dx;
+                    p[6] = cell0[icomp * 4 + 1];
+                    p[9] = cell0[icomp * 4];
+
+                    /* latitude and altitude derivatives vary linearly along the edge */
+                    p[12] = cell0[icomp * 4 + 2];
+                    p[15] = (cell1[icomp * 4 + 2] - cell0[icomp * 4 + 2]) / dx;
+                    p[18] = cell0[icomp * 4 + 3];
+                    p[21] = (cell1[icomp * 4 + 3] - cell0[icomp * 4 + 3]) / dx;
+                } /* for icomp */
+            } /* for ilon */
+        } /* for ilat */
+    } /* for ialt */
+
+    return 0;
+
+out_of_memory:
+    if(verbose)
+    {
+        printf("Error - out of memory\n");
+        fflush(stdout);
+    }
+    EMM_mesh_free_coef(mesh);
+    return EXIT_MESH_MEM_ALLOC_ERROR;
+} /* mesh_precompute */
+
+static void EMM_mesh_free_coef(EMM_tmesh *mesh)
+{
+    int ialt, ilat;
+
+    if((*mesh).coef == NULL)
+        return;
+    for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+    {
+        if(((*mesh).coef)[ialt] == NULL)
+            continue;
+        for(ilat = 0; ilat < ((*mesh).nlat)[ialt]; ilat++)
+            free((((*mesh).coef)[ialt])[ilat]);
+        free(((*mesh).coef)[ialt]);
+    }
+    free((*mesh).coef);
+    (*mesh).coef = NULL;
+} /* mesh_free_coef */
+
+int EMM_mesh_quantize(int verbose, EMM_tmesh *mesh, double maxerr[12])
+/* replace the cells by 16-bit values with a scale and offset per row and channel, about a quarter of the memory. */
+/* maxerr, if not NULL, receives the largest difference to the original cells of each of the 12 channels. */
+{
+    int ialt, ilat, ilon, nlon, c, ncell;
+    double *cell, *s, lo, hi, q, err[12];
+    unsigned short *qc;
+
+    if((*mesh).qcells != NULL)
+        return EXIT_MESH_QUANTIZED_ERROR;
+
+    (*mesh).qcells = calloc((*mesh).nalt, sizeof (unsigned short*));
+    (*mesh).qrow = calloc((*mesh).nalt, sizeof (int*));
+    (*mesh).qscale = calloc((*mesh).nalt, sizeof (double*));
+    if((*mesh).qcells == NULL || (*mesh).qrow == NULL || (*mesh).qscale == NULL)
+        goto out_of_memory;
+
+    for(c = 0; c < 12; c++)
+        err[c] = 0;
+
+    for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+    {
+        ncell = 0;
+        for(ilat = 0; ilat < ((*mesh).nlat)[ialt]; ilat++)
+            ncell += (((*mesh).nlon)[ialt])[ilat]; /* the duplicated first longitude is not stored */
+
+        ((*mesh).qcells)[ialt] = malloc(ncell * 12 * sizeof (unsigned short));
+        ((*mesh).qrow)[ialt] = malloc(((*mesh).nlat)[ialt] * sizeof (int));
+        ((*mesh).qscale)[ialt] = malloc(((*mesh).nlat)[ialt] * 24 * sizeof (double));
+        if(((*mesh).qcells)[ialt] == NULL || ((*mesh).qrow)[ialt] == NULL || ((*mesh).qscale)[ialt] == NULL)
+            goto out_of_memory;
+
+        ncell = 0;
+        for(ilat = 0; ilat < ((*mesh).nlat)[ialt]; ilat++)
+        {
+            nlon = (((*mesh).nlon)[ialt])[ilat];
+            (((*mesh).qrow)[ialt])[ilat] = ncell;
+            cell = ((((*mesh).comp)[ialt])[ilat])[0]; /* rows are contiguous, see EMM_mesh_alloc_layer */
+            qc = ((*mesh).qcells)[ialt] + ncell * 12;
+            s = ((*mesh).qscale)[ialt] + ilat * 24;
+
+            for(c = 0; c < 12; c++) /* the range of each channel over the row */
+            {
+                lo = hi = cell[c];
+                for(ilon = 1; ilon < nlon; ilon++)
+                {
+                    if(cell[ilon * 12 + c] < lo)
+                        lo = cell[ilon * 12 + c];
+                    if(cell[ilon * 12 + c] > hi)
+                        hi = cell[ilon * 12 + c];
+                }
+                s[c] = (hi - lo) / 65535.0;
+                s[12 + c] = lo;
+            }
+
+            for(ilon = 0; ilon < nlon; ilon++)
+                for(c = 0; c < 12; c++)
+                {
+                    q = s[c] > 0 ? floor((cell[ilon * 12 + c] - s[12 + c]) / s[c] + 0.5) : 0;
+                    if(q > 65535)
+                        q = 65535;
+                    qc[ilon * 12 + c] = (unsigned short) q;
+                    q = fabs(s[12 + c] + s[c] * qc[ilon * 12 + c] - cell[ilon * 12 + c]);
+                    if(q > err[c])
+                        err[c] = q;
+                }
+            ncell += nlon;
+        } /* for ilat */
+    } /* for ialt */
+
+    /* the full precision cells are no longer needed */
+
+    EMM_mesh_free_coef(mesh);
+    EMM_mesh_free_cells(mesh);
+
+    if(verbose)
+    {
+        printf("Largest quantization error of x, y and z (value, d/dlon, d/dlat, d/dalt):\n");
+        for(c = 0; c < 12; c += 4)
+            printf("%c: %g %g %g %g\n", 'x' + c / 4, err[c], err[c + 1], err[c + 2], err[c + 3]);
+        fflush(stdout);
+    }
+    if(maxerr != NULL)
+        for(c = 0; c < 12; c++)
+            maxerr[c] = err[c];
+    return 0;
+
+out_of_memory:
+    if(verbose)
+    {
+        printf("Error - out of memory\n");
+        fflush(stdout);
+    }
+    EMM_mesh_free_quantized(mesh);
+    return EXIT_MESH_MEM_ALLOC_ERROR;
+} /* mesh_quantize */
+
+static void EMM_mesh_free_quantized(EMM_tmesh *mesh)
+{
+    int ialt;
+
+    for(ialt = 0; ialt < (*mesh).nalt; ialt++)
+    {
+        if((*mesh).qcells != NULL)
+            free(((*mesh).qcells)[ialt]);
+        if((*mesh).qrow != NULL)
+            free(((*mesh).qrow)[ialt]);
+        if((*mesh).qscale != NULL)
+            free(((*mesh).qscale)[ialt]);
+    }
+    free((*mesh).qcells);
+    free((*mesh).qrow);
+    free((*mesh).qscale);
+    (*mesh).qcells = NULL;
+    (*mesh).qrow = NULL;
+    (*mesh).qscale = NULL;
+} /* mesh_free_quantized */
+
+#if !(EMM_VECTOR && USE_DERIVATIVES && INTERPOLATE_CUBIC)
+static double EMM_cell(EMM_tmesh mesh, int ialt, int ilat, int ilon, int icomp)
+{
+    return ((((mesh.comp)[ialt])[ilat])[ilon])[icomp * 4];
+}
 
 static double EMM_dlon_cell(EMM_tmesh mesh, int ialt, int ilat, int ilon, int icomp)
 {
@@ -710,58 +1904,380 @@ static double EMM_interpolate(double x1, double y1, double dx_y1, double x2, dou
     else
         return EMM_interpolate_quadratic(x1, y1, dx_y1, x2, y2, dx_y2, x);
 } /* interpolate */
+#endif /* !(EMM_VECTOR && USE_DERIVATIVES && INTERPOLATE_CUBIC) */
 
-int EMM_mesh_interpolate(int verbose, EMM_tmesh mesh, double lon, double lat, double alt, double geoc_lat, double *geoc_Bx, double *geoc_By, double *geoc_Bz)
+#if !EMM_VECTOR
+static double EMM_hermite(double dx, double y1, double dx_y1, double y2, double dx_y2, double t)
+/* same cubic as EMM_interpolate_cubic, written in the local coordinate t = x - x1 */
 {
+    double m, a, b;
+
+    m = (y2 - y1) / dx;
+    a = (dx_y1 + dx_y2 - 2.0 * m) / (dx * dx);
+    b = (3.0 * m - 2.0 * dx_y1 - dx_y2) / dx;
+    return ((a * t + b) * t + dx_y1) * t + y1;
+} /* hermite */
+#endif /* !EMM_VECTOR */
+
+static void EMM_mesh_interpolate_coef(EMM_tmesh mesh, const EMM_tcell *cell, double h[3])
+/* EMM_mesh_interpolate_cell for meshes prepared by EMM_mesh_precompute */
+{
+#if EMM_VECTOR
+    EMM_mesh_interpolate_coef_v(mesh, cell, h);
+#else
     int icomp;
-    int ialt0, ialt1;
-    int ilat00, ilat01, ilat10, ilat11;
-    int ilon000, ilon001, ilon010, ilon011, ilon100, ilon101, ilon110, ilon111;
+    const double *p000, *p010, *p100, *p110;
+    double t000, t010, t100, t110;
+    double f0, f1, g0, g1, dlat_cell0, dlat_cell1, dalt_cell0, dalt_cell1;
 
-    double alt0, alt1;
-    double lat00, lat01, lat10, lat11;
-    double lon000, lon001, lon010, lon011, lon100, lon101, lon110, lon111;
+    p000 = ((mesh.coef)[cell->ialt0])[cell->ilat00] + cell->ilon000 * EMM_COEF_PER_EDGE;
+    p010 = ((mesh.coef)[cell->ialt0])[cell->ilat01] + cell->ilon010 * EMM_COEF_PER_EDGE;
+    p100 = ((mesh.coef)[cell->ialt1])[cell->ilat10] + cell->ilon100 * EMM_COEF_PER_EDGE;
+    p110 = ((mesh.coef)[cell->ialt1])[cell->ilat11] + cell->ilon110 * EMM_COEF_PER_EDGE;
 
-    double altfac0, altfac1;
-    double latfac00, latfac01, latfac10, latfac11;
-    double lonfac000, lonfac001, lonfac010, lonfac011, lonfac100, lonfac101, lonfac110, lonfac111;
+    t000 = cell->lon - cell->lon000;
+    t010 = cell->lon - cell->lon010;
+    t100 = cell->lon - cell->lon100;
+    t110 = cell->lon - cell->lon110;
 
-    double dlat_cell0, dlat_cell1;
-    double dalt_cell00, dalt_cell01, dalt_cell10, dalt_cell11, dalt_cell0, dalt_cell1;
+    for(icomp = 0; icomp < 3; icomp++, p000++, p010++, p100++, p110++)
+    {
+        /* lower altitude */
 
-    double f0, f1, g0, g1, h[3];
-    double lon_rad, geoc_lat_rad;
+        f0 = ((p000[0] * t000 + p000[3]) * t000 + p000[6]) * t000 + p000[9];
+        f1 = ((p010[0] * t010 + p010[3]) * t010 + p010[6]) * t010 + p010[9];
+        dlat_cell0 = p000[12] + p000[15] * t000;
+        dlat_cell1 = p010[12] + p010[15] * t010;
+        g0 = EMM_hermite(cell->lat01 - cell->lat00, f0, dlat_cell0, f1, dlat_cell1, cell->lat - cell->lat00);
+        dalt_cell0 = cell->latfac00 * (p000[18] + p000[21] * t000) + cell->latfac01 * (p010[18] + p010[21] * t010);
+
+        /* upper altitude */
+
+        f0 = ((p100[0] * t100 + p100[3]) * t100 + p100[6]) * t100 + p100[9];
+        f1 = ((p110[0] * t110 + p110[3]) * t110 + p110[6]) * t110 + p110[9];
+        dlat_cell0 = p100[12] + p100[15] * t100;
+        dlat_cell1 = p110[12] + p110[15] * t110;
+        g1 = EMM_hermite(cell->lat11 - cell->lat10, f0, dlat_cell0, f1, dlat_cell1, cell->lat - cell->lat10);
+        dalt_cell1 = cell->latfac10 * (p100[18] + p100[21] * t100) + cell->latfac11 * (p110[18] + p110[21] * t110);
+
+        /* final value */
+
+        h[icomp] = EMM_hermite(cell->alt1 - cell->alt0, g0, dalt_cell0, g1, dalt_cell1, cell->alt - cell->alt0);
+    } /* for icomp */
+#endif /* EMM_VECTOR */
+} /* mesh_interpolate_coef */
+
+#if EMM_VECTOR
+
+/* The vector kernels below perform, lane by lane, exactly the operations of their scalar */
+/* counterparts, so both give identical results unless the compiler contracts them into FMAs */
+
+EMM_VINLINE EMM_v4d EMM_load_v(const double *p) /* unaligned load of four doubles */
+{
+    EMM_v4d v;
+
+    memcpy(&v, p, sizeof (EMM_v4d));
+    return v;
+} /* load_v */
+
+EMM_VINLINE EMM_v4d EMM_interpolate_cubic_v(double x1, EMM_v4d y1, EMM_v4d dx_y1, double x2, EMM_v4d y2, EMM_v4d dx_y2, double x)
+/* EMM_interpolate_cubic for the three components at once */
+{
+    double dx, x1s, x1c, x2s, x2c;
+    EMM_v4d a, b, c, d, dy, dydx;
+
+    dx = x2 - x1;
+    dy = y2 - y1;
+    dydx = dy / dx;
+    x1s = x1*x1;
+    x1c = x1s*x1;
+    x2s = x2*x2;
+    x2c = x2s*x2;
+
+    a = (dx_y1 + dx_y2 - 2.0 * dydx) / (dx * dx);
+
+    b = (dx_y1 - dydx - (2.0 * x1s - x1 * x2 - x2s) * a) / (-dx);
+
+    c = (dy - (x2c - x1c) * a - (x2s - x1s) * b) / dx;
+
+    d = y1 - x1c * a - x1s * b - x1*c;
+
+    return (a * x * x * x + b * x * x + c * x + d);
+} /* interpolate_cubic_v */
+
+EMM_VINLINE EMM_v4d EMM_hermite_v(double dx, EMM_v4d y1, EMM_v4d dx_y1, EMM_v4d y2, EMM_v4d dx_y2, double t)
+/* EMM_hermite for the three components at once */
+{
+    EMM_v4d m, a, b;
+
+    m = (y2 - y1) / dx;
+    a = (dx_y1 + dx_y2 - 2.0 * m) / (dx * dx);
+    b = (3.0 * m - 2.0 * dx_y1 - dx_y2) / dx;
+    return ((a * t + b) * t + dx_y1) * t + y1;
+} /* hermite_v */
+
+static void EMM_mesh_interpolate_cell_v(EMM_tmesh mesh, const EMM_tcell *cell, double h[3])
+/* EMM_mesh_interpolate_cell with the x, y and z components in the lanes of one vector */
+{
+    const double *c000, *c001, *c010, *c011, *c100, *c101, *c110, *c111;
+    double lon = cell->lon, lat = cell->lat, alt = cell->alt;
+    EMM_v4d f0, f1, g0, g1, hv;
+    EMM_v4d dlat_cell0, dlat_cell1;
+    EMM_v4d dalt_cell00, dalt_cell01, dalt_cell10, dalt_cell11, dalt_cell0, dalt_cell1;
+
+    c000 = (((mesh.comp)[cell->ialt0])[cell->ilat00])[cell->ilon000];
+    c001 = (((mesh.comp)[cell->ialt0])[cell->ilat00])[cell->ilon001];
+    c010 = (((mesh.comp)[cell->ialt0])[cell->ilat01])[cell->ilon010];
+    c011 = (((mesh.comp)[cell->ialt0])[cell->ilat01])[cell->ilon011];
+    c100 = (((mesh.comp)[cell->ialt1])[cell->ilat10])[cell->ilon100];
+    c101 = (((mesh.comp)[cell->ialt1])[cell->ilat10])[cell->ilon101];
+    c110 = (((mesh.comp)[cell->ialt1])[cell->ilat11])[cell->ilon110];
+    c111 = (((mesh.comp)[cell->ialt1])[cell->ilat11])[cell->ilon111];
+
+    /* lower altitude */
+
+    f0 = EMM_interpolate_cubic_v(cell->lon000, EMM_LANES(c000, 0), EMM_LANES(c000, 1), cell->lon001, EMM_LANES(c001, 0), EMM_LANES(c001, 1), lon);
+    f1 = EMM_interpolate_cubic_v(cell->lon010, EMM_LANES(c010, 0), EMM_LANES(c010, 1), cell->lon011, EMM_LANES(c011, 0), EMM_LANES(c011, 1), lon);
+
+    dlat_cell0 = cell->lonfac000 * EMM_LANES(c000, 2) + cell->lonfac001 * EMM_LANES(c001, 2);
+    dlat_cell1 = cell->lonfac010 * EMM_LANES(c010, 2) + cell->lonfac011 * EMM_LANES(c011, 2);
+
+    g0 = EMM_interpolate_cubic_v(cell->lat00, f0, dlat_cell0, cell->lat01, f1, dlat_cell1, lat);
+
+    dalt_cell00 = cell->lonfac000 * EMM_LANES(c000, 3) + cell->lonfac001 * EMM_LANES(c001, 3);
+    dalt_cell01 = cell->lonfac010 * EMM_LANES(c010, 3) + cell->lonfac011 * EMM_LANES(c011, 3);
+    dalt_cell0 = cell->latfac00 * dalt_cell00 + cell->latfac01*dalt_cell01;
+
+    /* upper altitude */
+
+    f0 = EMM_interpolate_cubic_v(cell->lon100, EMM_LANES(c100, 0), EMM_LANES(c100, 1), cell->lon101, EMM_LANES(c101, 0), EMM_LANES(c101, 1), lon);
+    f1 = EMM_interpolate_cubic_v(cell->lon110, EMM_LANES(c110, 0), EMM_LANES(c110, 1), cell->lon111, EMM_LANES(c111, 0), EMM_LANES(c111, 1), lon);
+
+    dlat_cell0 = cell->lonfac100 * EMM_LANES(c100, 2) + cell->lonfac101 * EMM_LANES(c101, 2);
+    dlat_cell1 = cell->lonfac110 * EMM_LANES(c110, 2) + cell->lonfac111 * EMM_LANES(c111, 2);
+
+    g1 = EMM_interpolate_cubic_v(cell->lat10, f0, dlat_cell0, cell->lat11, f1, dlat_cell1, lat);
+
+    dalt_cell10 = cell->lonfac100 * EMM_LANES(c100, 3) + cell->lonfac101 * EMM_LANES(c101, 3);
+    dalt_cell11 = cell->lonfac110 * EMM_LANES(c110, 3) + cell->lonfac111 * EMM_LANES(c111, 3);
+    dalt_cell1 = cell->latfac10 * dalt_cell10 + cell->latfac11*dalt_cell11;
+
+    /* final value */
+
+    hv = EMM_interpolate_cubic_v(cell->alt0, g0, dalt_cell0, cell->alt1, g1, dalt_cell1, alt);
+
+    h[0] = hv[0];
+    h[1] = hv[1];
+    h[2] = hv[2];
+} /* mesh_interpolate_cell_v */
+
+static void EMM_mesh_interpolate_coef_v(EMM_tmesh mesh, const EMM_tcell *cell, double h[3])
+/* EMM_mesh_interpolate_coef with the x, y and z components in the lanes of one vector */
+{
+    const double *p000, *p010, *p100, *p110;
+    double t000, t010, t100, t110;
+    EMM_v4d f0, f1, g0, g1, hv, dlat_cell0, dlat_cell1, dalt_cell0, dalt_cell1;
+
+    p000 = ((mesh.coef)[cell->ialt0])[cell->ilat00] + cell->ilon000 * EMM_COEF_PER_EDGE;
+    p010 = ((mesh.coef)[cell->ialt0])[cell->ilat01] + cell->ilon010 * EMM_COEF_PER_EDGE;
+    p100 = ((mesh.coef)[cell->ialt1])[cell->ilat10] + cell->ilon100 * EMM_COEF_PER_EDGE;
+    p110 = ((mesh.coef)[cell->ialt1])[cell->ilat11] + cell->ilon110 * EMM_COEF_PER_EDGE;
+
+    t000 = cell->lon - cell->lon000;
+    t010 = cell->lon - cell->lon010;
+    t100 = cell->lon - cell->lon100;
+    t110 = cell->lon - cell->lon110;
+
+    /* lower altitude */
+
+    f0 = ((EMM_load_v(p000) * t000 + EMM_load_v(p000 + 3)) * t000 + EMM_load_v(p000 + 6)) * t000 + EMM_load_v(p000 + 9);
+    f1 = ((EMM_load_v(p010) * t010 + EMM_load_v(p010 + 3)) * t010 + EMM_load_v(p010 + 6)) * t010 + EMM_load_v(p010 + 9);
+    dlat_cell0 = EMM_load_v(p000 + 12) + EMM_load_v(p000 + 15) * t000;
+    dlat_cell1 = EMM_load_v(p010 + 12) + EMM_load_v(p010 + 15) * t010;
+    g0 = EMM_hermite_v(cell->lat01 - cell->lat00, f0, dlat_cell0, f1, dlat_cell1, cell->lat - cell->lat00);
+    dalt_cell0 = cell->latfac00 * (EMM_load_v(p000 + 18) + EMM_load_v(p000 + 21) * t000) + cell->latfac01 * (EMM_load_v(p010 + 18) + EMM_load_v(p010 + 21) * t010);
+
+    /* upper altitude */
+
+    f0 = ((EMM_load_v(p100) * t100 + EMM_load_v(p100 + 3)) * t100 + EMM_load_v(p100 + 6)) * t100 + EMM_load_v(p100 + 9);
+    f1 = ((EMM_load_v(p110) * t110 + EMM_load_v(p110 + 3)) * t110 + EMM_load_v(p110 + 6)) * t110 + EMM_load_v(p110 + 9);
+    dlat_cell0 = EMM_load_v(p100 + 12) + EMM_load_v(p100 + 15) * t100;
+    dlat_cell1 = EMM_load_v(p110 + 12) + EMM_load_v(p110 + 15) * t110;
+    g1 = EMM_hermite_v(cell->lat11 - cell->lat10, f0, dlat_cell0, f1, dlat_cell1, cell->lat - cell->lat10);
+    dalt_cell1 = cell->latfac10 * (EMM_load_v(p100 + 18) + EMM_load_v(p100 + 21) * t100) + cell->latfac11 * (EMM_load_v(p110 + 18) + EMM_load_v(p110 + 21) * t110);
+
+    /* final value */
+
+    hv = EMM_hermite_v(cell->alt1 - cell->alt0, g0, dalt_cell0, g1, dalt_cell1, cell->alt - cell->alt0);
+
+    h[0] = hv[0];
+    h[1] = hv[1];
+    h[2] = hv[2];
+} /* mesh_interpolate_coef_v */
+
+#endif /* EMM_VECTOR */
+
+static int EMM_mesh_locate(int verbose, EMM_tmesh mesh, double lon, double lat, double alt, EMM_tcell *cell)
+/* find the eight mesh nodes surrounding a point; valid for every mesh with the same grid geometry */
+{
+    int status, lat_status;
 
     while(lon < 0) lon += 360;
     while(lon >= 360) lon -= 360;
 
-    EMM_find_alt_index(verbose, mesh, alt, &ialt0, &ialt1, &alt0, &alt1, &altfac0, &altfac1);
+    cell->lon = lon;
+    cell->lat = lat;
+    cell->alt = alt;
+
+    status = EMM_find_alt_index(verbose, mesh, alt, &cell->ialt0, &cell->ialt1, &cell->alt0, &cell->alt1, &cell->altfac0, &cell->altfac1);
 
     /* lower altitude */
 
-    EMM_find_lat_index(mesh, ialt0, lat, &ilat00, &ilat01, &lat00, &lat01, &latfac00, &latfac01);
+    lat_status = EMM_find_lat_index(verbose, mesh, cell->ialt0, lat, &cell->ilat00, &cell->ilat01, &cell->lat00, &cell->lat01, &cell->latfac00, &cell->latfac01);
+    if(lat_status)
+    {
+        cell->ilon000 = 0;
+        return lat_status; /* no valid rows, the cells are not located */
+    }
 
     /* lower altitude, lower lat */
 
-    EMM_find_lon_index(mesh, ialt0, ilat00, lon, &ilon000, &ilon001, &lon000, &lon001, &lonfac000, &lonfac001);
+    EMM_find_lon_index(mesh, cell->ialt0, cell->ilat00, lon, &cell->ilon000, &cell->ilon001, &cell->lon000, &cell->lon001, &cell->lonfac000, &cell->lonfac001);
 
     /* lower altitude, upper lat */
 
-    EMM_find_lon_index(mesh, ialt0, ilat01, lon, &ilon010, &ilon011, &lon010, &lon011, &lonfac010, &lonfac011);
+    EMM_find_lon_index(mesh, cell->ialt0, cell->ilat01, lon, &cell->ilon010, &cell->ilon011, &cell->lon010, &cell->lon011, &cell->lonfac010, &cell->lonfac011);
 
     /* upper altitude */
 
-    EMM_find_lat_index(mesh, ialt1, lat, &ilat10, &ilat11, &lat10, &lat11, &latfac10, &latfac11);
+    lat_status = EMM_find_lat_index(verbose, mesh, cell->ialt1, lat, &cell->ilat10, &cell->ilat11, &cell->lat10, &cell->lat11, &cell->latfac10, &cell->latfac11);
+    if(lat_status)
+        return lat_status;
 
     /* upper altitude, lower lat */
 
-    EMM_find_lon_index(mesh, ialt1, ilat10, lon, &ilon100, &ilon101, &lon100, &lon101, &lonfac100, &lonfac101);
+    EMM_find_lon_index(mesh, cell->ialt1, cell->ilat10, lon, &cell->ilon100, &cell->ilon101, &cell->lon100, &cell->lon101, &cell->lonfac100, &cell->lonfac101);
 
     /* upper altitude, upper lat */
 
-    EMM_find_lon_index(mesh, ialt1, ilat11, lon, &ilon110, &ilon111, &lon110, &lon111, &lonfac110, &lonfac111);
+    EMM_find_lon_index(mesh, cell->ialt1, cell->ilat11, lon, &cell->ilon110, &cell->ilon111, &cell->lon110, &cell->lon111, &cell->lonfac110, &cell->lonfac111);
+
+    return status;
+} /* mesh_locate */
+
+static int EMM_cell_shared(EMM_tmesh mesh, EMM_tmesh other, const EMM_tcell *cell)
+/* TRUE if the nodes located in mesh are the same nodes in other, so one lookup serves both */
+{
+    if(mesh.nalt != other.nalt)
+        return FALSE;
+    if((mesh.alt)[cell->ialt0] != (other.alt)[cell->ialt0] || (mesh.alt)[cell->ialt1] != (other.alt)[cell->ialt1])
+        return FALSE;
+    if((mesh.nlat)[cell->ialt0] != (other.nlat)[cell->ialt0] || (mesh.nlat)[cell->ialt1] != (other.nlat)[cell->ialt1])
+        return FALSE;
+    if(((mesh.nlon)[cell->ialt0])[cell->ilat00] != ((other.nlon)[cell->ialt0])[cell->ilat00] ||
+            ((mesh.nlon)[cell->ialt0])[cell->ilat01] != ((other.nlon)[cell->ialt0])[cell->ilat01] ||
+            ((mesh.nlon)[cell->ialt1])[cell->ilat10] != ((other.nlon)[cell->ialt1])[cell->ilat10] ||
+            ((mesh.nlon)[cell->ialt1])[cell->ilat11] != ((other.nlon)[cell->ialt1])[cell->ilat11])
+        return FALSE;
+    return TRUE;
+} /* cell_shared */
+
+static void EMM_mesh_decode_cell(EMM_tmesh mesh, int ialt, int ilat, int ilon, double value[12]) /* one cell of a quantized mesh */
+{
+    int c;
+    const unsigned short *q;
+    const double *s;
+
+    if(ilon == ((mesh.nlon)[ialt])[ilat])
+        ilon = 0; /* the duplicated first longitude */
+    q = (mesh.qcells)[ialt] + ((long) ((mesh.qrow)[ialt])[ilat] + ilon) * 12;
+    s = (mesh.qscale)[ialt] + ilat * 24;
+    for(c = 0; c < 12; c++)
+        value[c] = s[12 + c] + s[c] * q[c];
+} /* mesh_decode_cell */
+
+static void EMM_mesh_interpolate_quantized(EMM_tmesh mesh, const EMM_tcell *cell, double h[3])
+/* decode the eight cells around a located point into a small full precision mesh and interpolate that */
+{
+    double value[8][12];
+    double *lon_ptr[2][2][2];
+    double **lat_ptr[2][2];
+    double ***alt_ptr[2];
+    int ialt, ilat, ilon;
+    EMM_tmesh local;
+    EMM_tcell local_cell;
+
+    EMM_mesh_decode_cell(mesh, cell->ialt0, cell->ilat00, cell->ilon000, value[0]);
+    EMM_mesh_decode_cell(mesh, cell->ialt0, cell->ilat00, cell->ilon001, value[1]);
+    EMM_mesh_decode_cell(mesh, cell->ialt0, cell->ilat01, cell->ilon010, value[2]);
+    EMM_mesh_decode_cell(mesh, cell->ialt0, cell->ilat01, cell->ilon011, value[3]);
+    EMM_mesh_decode_cell(mesh, cell->ialt1, cell->ilat10, cell->ilon100, value[4]);
+    EMM_mesh_decode_cell(mesh, cell->ialt1, cell->ilat10, cell->ilon101, value[5]);
+    EMM_mesh_decode_cell(mesh, cell->ialt1, cell->ilat11, cell->ilon110, value[6]);
+    EMM_mesh_decode_cell(mesh, cell->ialt1, cell->ilat11, cell->ilon111, value[7]);
+
+    for(ialt = 0; ialt < 2; ialt++)
+    {
+        alt_ptr[ialt] = lat_ptr[ialt];
+        for(ilat = 0; ilat < 2; ilat++)
+        {
+            lat_ptr[ialt][ilat] = lon_ptr[ialt][ilat];
+            for(ilon = 0; ilon < 2; ilon++)
+                lon_ptr[ialt][ilat][ilon] = value[ialt * 4 + ilat * 2 + ilon];
+        }
+    }
+
+    memset(&local, 0, sizeof (EMM_tmesh));
+    local.comp = alt_ptr;
+
+    local_cell = *cell; /* same position and weights, indices into the small mesh */
+    local_cell.ialt0 = 0;
+    local_cell.ialt1 = 1;
+    local_cell.ilat00 = local_cell.ilat10 = 0;
+    local_cell.ilat01 = local_cell.ilat11 = 1;
+    local_cell.ilon000 = local_cell.ilon010 = local_cell.ilon100 = local_cell.ilon110 = 0;
+    local_cell.ilon001 = local_cell.ilon011 = local_cell.ilon101 = local_cell.ilon111 = 1;
+
+    EMM_mesh_interpolate_cell(local, &local_cell, h);
+} /* mesh_interpolate_quantized */
+
+static void EMM_mesh_interpolate_cell(EMM_tmesh mesh, const EMM_tcell *cell, double h[3])
+/* interpolate the cartesian vector components of one mesh at a located point */
+{
+    if(mesh.qcells != NULL)
+    {
+        EMM_mesh_interpolate_quantized(mesh, cell, h);
+        return;
+    }
+
+    if(mesh.coef != NULL)
+    {
+        EMM_mesh_interpolate_coef(mesh, cell, h);
+        return;
+    }
+
+#if EMM_VECTOR && USE_DERIVATIVES && INTERPOLATE_CUBIC
+    EMM_mesh_interpolate_cell_v(mesh, cell, h);
+#else
+    EMM_mesh_interpolate_cell_s(mesh, cell, h);
+#endif
+} /* mesh_interpolate_cell */
+
+#if !(EMM_VECTOR && USE_DERIVATIVES && INTERPOLATE_CUBIC)
+static void EMM_mesh_interpolate_cell_s(EMM_tmesh mesh, const EMM_tcell *cell, double h[3])
+/* scalar EMM_mesh_interpolate_cell of a full precision mesh, one component at a time */
+{
+    int icomp;
+    int ialt0 = cell->ialt0, ialt1 = cell->ialt1;
+    int ilat00 = cell->ilat00, ilat01 = cell->ilat01, ilat10 = cell->ilat10, ilat11 = cell->ilat11;
+    int ilon000 = cell->ilon000, ilon001 = cell->ilon001, ilon010 = cell->ilon010, ilon011 = cell->ilon011;
+    int ilon100 = cell->ilon100, ilon101 = cell->ilon101, ilon110 = cell->ilon110, ilon111 = cell->ilon111;
+    double lon = cell->lon, lat = cell->lat, alt = cell->alt;
 
-    /* interpolate */
+    double dlat_cell0, dlat_cell1;
+    double dalt_cell00, dalt_cell01, dalt_cell10, dalt_cell11, dalt_cell0, dalt_cell1;
+
+    double f0, f1, g0, g1;
 
     for(icomp = 0; icomp < 3; icomp++)
     {
@@ -770,74 +2286,257 @@ int EMM_mesh_interpolate(int verbose, EMM_tmesh mesh, double lon, double lat, do
 
         /* lower altitude */
 
-        f0 = EMM_interpolate(lon000, EMM_cell(mesh, ialt0, ilat00, ilon000, icomp), EMM_dlon_cell(mesh, ialt0, ilat00, ilon000, icomp),
-                lon001, EMM_cell(mesh, ialt0, ilat00, ilon001, icomp), EMM_dlon_cell(mesh, ialt0, ilat00, ilon001, icomp), lon);
+        f0 = EMM_interpolate(cell->lon000, EMM_cell(mesh, ialt0, ilat00, ilon000, icomp), EMM_dlon_cell(mesh, ialt0, ilat00, ilon000, icomp),
+                cell->lon001, EMM_cell(mesh, ialt0, ilat00, ilon001, icomp), EMM_dlon_cell(mesh, ialt0, ilat00, ilon001, icomp), lon);
 
-        f1 = EMM_interpolate(lon010, EMM_cell(mesh, ialt0, ilat01, ilon010, icomp), EMM_dlon_cell(mesh, ialt0, ilat01, ilon010, icomp),
-                lon011, EMM_cell(mesh, ialt0, ilat01, ilon011, icomp), EMM_dlon_cell(mesh, ialt0, ilat01, ilon011, icomp), lon);
+        f1 = EMM_interpolate(cell->lon010, EMM_cell(mesh, ialt0, ilat01, ilon010, icomp), EMM_dlon_cell(mesh, ialt0, ilat01, ilon010, icomp),
+                cell->lon011, EMM_cell(mesh, ialt0, ilat01, ilon011, icomp), EMM_dlon_cell(mesh, ialt0, ilat01, ilon011, icomp), lon);
 
-        dlat_cell0 = lonfac000 * EMM_dlat_cell(mesh, ialt0, ilat00, ilon000, icomp) + lonfac001 * EMM_dlat_cell(mesh, ialt0, ilat00, ilon001, icomp);
-        dlat_cell1 = lonfac010 * EMM_dlat_cell(mesh, ialt0, ilat01, ilon010, icomp) + lonfac011 * EMM_dlat_cell(mesh, ialt0, ilat01, ilon011, icomp);
+        dlat_cell0 = cell->lonfac000 * EMM_dlat_cell(mesh, ialt0, ilat00, ilon000, icomp) + cell->lonfac001 * EMM_dlat_cell(mesh, ialt0, ilat00, ilon001, icomp);
+        dlat_cell1 = cell->lonfac010 * EMM_dlat_cell(mesh, ialt0, ilat01, ilon010, icomp) + cell->lonfac011 * EMM_dlat_cell(mesh, ialt0, ilat01, ilon011, icomp);
 
-        g0 = EMM_interpolate(lat00, f0, dlat_cell0, lat01, f1, dlat_cell1, lat);
+        g0 = EMM_interpolate(cell->lat00, f0, dlat_cell0, cell->lat01, f1, dlat_cell1, lat);
 
-        dalt_cell00 = lonfac000 * EMM_dalt_cell(mesh, ialt0, ilat00, ilon000, icomp) + lonfac001 * EMM_dalt_cell(mesh, ialt0, ilat00, ilon001, icomp);
-        dalt_cell01 = lonfac010 * EMM_dalt_cell(mesh, ialt0, ilat01, ilon010, icomp) + lonfac011 * EMM_dalt_cell(mesh, ialt0, ilat01, ilon011, icomp);
-        dalt_cell0 = latfac00 * dalt_cell00 + latfac01*dalt_cell01;
+        dalt_cell00 = cell->lonfac000 * EMM_dalt_cell(mesh, ialt0, ilat00, ilon000, icomp) + cell->lonfac001 * EMM_dalt_cell(mesh, ialt0, ilat00, ilon001, icomp);
+        dalt_cell01 = cell->lonfac010 * EMM_dalt_cell(mesh, ialt0, ilat01, ilon010, icomp) + cell->lonfac011 * EMM_dalt_cell(mesh, ialt0, ilat01, ilon011, icomp);
+        dalt_cell0 = cell->latfac00 * dalt_cell00 + cell->latfac01*dalt_cell01;
 
         /* upper altitude */
 
-        f0 = EMM_interpolate(lon100, EMM_cell(mesh, ialt1, ilat10, ilon100, icomp), EMM_dlon_cell(mesh, ialt1, ilat10, ilon100, icomp),
-                lon101, EMM_cell(mesh, ialt1, ilat10, ilon101, icomp), EMM_dlon_cell(mesh, ialt1, ilat10, ilon101, icomp), lon);
+        f0 = EMM_interpolate(cell->lon100, EMM_cell(mesh, ialt1, ilat10, ilon100, icomp), EMM_dlon_cell(mesh, ialt1, ilat10, ilon100, icomp),
+                cell->lon101, EMM_cell(mesh, ialt1, ilat10, ilon101, icomp), EMM_dlon_cell(mesh, ialt1, ilat10, ilon101, icomp), lon);
 
-        f1 = EMM_interpolate(lon110, EMM_cell(mesh, ialt1, ilat11, ilon110, icomp), EMM_dlon_cell(mesh, ialt1, ilat11, ilon110, icomp),
-                lon111, EMM_cell(mesh, ialt1, ilat11, ilon111, icomp), EMM_dlon_cell(mesh, ialt1, ilat11, ilon111, icomp), lon);
+        f1 = EMM_interpolate(cell->lon110, EMM_cell(mesh, ialt1, ilat11, ilon110, icomp), EMM_dlon_cell(mesh, ialt1, ilat11, ilon110, icomp),
+                cell->lon111, EMM_cell(mesh, ialt1, ilat11, ilon111, icomp), EMM_dlon_cell(mesh, ialt1, ilat11, ilon111, icomp), lon);
 
-        dlat_cell0 = lonfac100 * EMM_dlat_cell(mesh, ialt1, ilat10, ilon100, icomp) + lonfac101 * EMM_dlat_cell(mesh, ialt1, ilat10, ilon101, icomp);
-        dlat_cell1 = lonfac110 * EMM_dlat_cell(mesh, ialt1, ilat11, ilon110, icomp) + lonfac111 * EMM_dlat_cell(mesh, ialt1, ilat11, ilon111, icomp);
+        dlat_cell0 = cell->lonfac100 * EMM_dlat_cell(mesh, ialt1, ilat10, ilon100, icomp) + cell->lonfac101 * EMM_dlat_cell(mesh, ialt1, ilat10, ilon101, icomp);
+        dlat_cell1 = cell->lonfac110 * EMM_dlat_cell(mesh, ialt1, ilat11, ilon110, icomp) + cell->lonfac111 * EMM_dlat_cell(mesh, ialt1, ilat11, ilon111, icomp);
 
-        g1 = EMM_interpolate(lat10, f0, dlat_cell0, lat11, f1, dlat_cell1, lat);
+        g1 = EMM_interpolate(cell->lat10, f0, dlat_cell0, cell->lat11, f1, dlat_cell1, lat);
 
-        dalt_cell10 = lonfac100 * EMM_dalt_cell(mesh, ialt1, ilat10, ilon100, icomp) + lonfac101 * EMM_dalt_cell(mesh, ialt1, ilat10, ilon101, icomp);
-        dalt_cell11 = lonfac110 * EMM_dalt_cell(mesh, ialt1, ilat11, ilon110, icomp) + lonfac111 * EMM_dalt_cell(mesh, ialt1, ilat11, ilon111, icomp);
-        dalt_cell1 = latfac10 * dalt_cell10 + latfac11*dalt_cell11;
+        dalt_cell10 = cell->lonfac100 * EMM_dalt_cell(mesh, ialt1, ilat10, ilon100, icomp) + cell->lonfac101 * EMM_dalt_cell(mesh, ialt1, ilat10, ilon101, icomp);
+        dalt_cell11 = cell->lonfac110 * EMM_dalt_cell(mesh, ialt1, ilat11, ilon110, icomp) + cell->lonfac111 * EMM_dalt_cell(mesh, ialt1, ilat11, ilon111, icomp);
+        dalt_cell1 = cell->latfac10 * dalt_cell10 + cell->latfac11*dalt_cell11;
 
         /* final value */
 
-        h[icomp] = EMM_interpolate(alt0, g0, dalt_cell0, alt1, g1, dalt_cell1, alt);
+        h[icomp] = EMM_interpolate(cell->alt0, g0, dalt_cell0, cell->alt1, g1, dalt_cell1, alt);
 
 #else  /* linear interpolation of values without taking curvature into account */
 
-        f0 = lonfac000 * EMM_cell(mesh, ialt0, ilat00, ilon000, icomp) + lonfac001 * EMM_cell(mesh, ialt0, ilat00, ilon001, icomp);
-        f1 = lonfac010 * EMM_cell(mesh, ialt0, ilat01, ilon010, icomp) + lonfac011 * EMM_cell(mesh, ialt0, ilat01, ilon011, icomp);
-        g0 = latfac00 * f0 + latfac01*f1;
+        f0 = cell->lonfac000 * EMM_cell(mesh, ialt0, ilat00, ilon000, icomp) + cell->lonfac001 * EMM_cell(mesh, ialt0, ilat00, ilon001, icomp);
+        f1 = cell->lonfac010 * EMM_cell(mesh, ialt0, ilat01, ilon010, icomp) + cell->lonfac011 * EMM_cell(mesh, ialt0, ilat01, ilon011, icomp);
+        g0 = cell->latfac00 * f0 + cell->latfac01*f1;
 
-        f0 = lonfac100 * EMM_cell(mesh, ialt1, ilat10, ilon100, icomp) + lonfac101 * EMM_cell(mesh, ialt1, ilat10, ilon101, icomp);
-        f1 = lonfac110 * EMM_cell(mesh, ialt1, ilat11, ilon110, icomp) + lonfac111 * EMM_cell(mesh, ialt1, ilat11, ilon111, icomp);
-        g1 = latfac10 * f0 + latfac11*f1;
+        f0 = cell->lonfac100 * EMM_cell(mesh, ialt1, ilat10, ilon100, icomp) + cell->lonfac101 * EMM_cell(mesh, ialt1, ilat10, ilon101, icomp);
+        f1 = cell->lonfac110 * EMM_cell(mesh, ialt1, ilat11, ilon110, icomp) + cell->lonfac111 * EMM_cell(mesh, ialt1, ilat11, ilon111, icomp);
+        g1 = cell->latfac10 * f0 + cell->latfac11*f1;
 
-        h[icomp] = altfac0 * g0 + altfac1*g1;
+        h[icomp] = cell->altfac0 * g0 + cell->altfac1*g1;
 
 #endif   /* if linear interpolation */
 
     } /* for icomp */
 
-
     /* h now contains the interpolated vector components in a global cartesian reference frame */
     /* these components now have to be transformed to the local geocentric frame. Later, the user */
     /* still has to transform them further into the local geographic (WGS84) frame  */
 
+} /* mesh_interpolate_cell_s */
+#endif
+
+int EMM_mesh_interpolate(int verbose, EMM_tmesh mesh, double lon, double lat, double alt, double geoc_lat, double *geoc_Bx, double *geoc_By, double *geoc_Bz)
+{
+    int status;
+    EMM_tcell cell;
+    double h[3];
+    double lon_rad, geoc_lat_rad;
+
+    status = EMM_mesh_locate(verbose, mesh, lon, lat, alt, &cell);
+    if(status == EXIT_MESH_FILE_LAT_ERROR)
+    {
+        *geoc_Bx = *geoc_By = *geoc_Bz = NAN;
+        return status;
+    }
+
+    EMM_mesh_interpolate_cell(mesh, &cell, h);
 
     /* Transform the cartesian vector components into the local geocentric frame */
 
-    lon_rad = lon * M_PI / 180.0;
+    lon_rad = cell.lon * M_PI / 180.0;
     geoc_lat_rad = geoc_lat * M_PI / 180.0;
 
     EMM_cart2sphere_vec(lon_rad, geoc_lat_rad, h[0], h[1], h[2], geoc_Bx, geoc_By, geoc_Bz); /* x=north, y=east, z=down */
 
-    return 0;
+    return status; /* altitude errors are reported, but the values are still extrapolated */
 }
 
+int EMM_mesh_interpolate_sv(int verbose, EMM_tmesh mesh, EMM_tmesh mesh_SV, double lon, double lat, double alt, double geoc_lat,
+        double *geoc_Bx, double *geoc_By, double *geoc_Bz, double *geoc_Bxs, double *geoc_Bys, double *geoc_Bzs)
+/* interpolate the main field and secular variation meshes in a single pass */
+{
+    int status;
+    EMM_tcell cell, cell_SV;
+    double h[3], hs[3];
+    double lon_rad, geoc_lat_rad;
+
+    status = EMM_mesh_locate(verbose, mesh, lon, lat, alt, &cell);
+    if(status == EXIT_MESH_FILE_LAT_ERROR)
+    {
+        *geoc_Bx = *geoc_By = *geoc_Bz = *geoc_Bxs = *geoc_Bys = *geoc_Bzs = NAN;
+        return status;
+    }
+
+    EMM_mesh_interpolate_cell(mesh, &cell, h);
+
+    /* the secular variation mesh normally has the main field geometry; locate again only if it does not */
+
+    if(EMM_cell_shared(mesh, mesh_SV, &cell))
+        EMM_mesh_interpolate_cell(mesh_SV, &cell, hs);
+    else
+    {
+        if(EMM_mesh_locate(verbose, mesh_SV, lon, lat, alt, &cell_SV) == EXIT_MESH_FILE_LAT_ERROR)
+        {
+            *geoc_Bx = *geoc_By = *geoc_Bz = *geoc_Bxs = *geoc_Bys = *geoc_Bzs = NAN;
+            return EXIT_MESH_FILE_LAT_ERROR;
+        }
+        EMM_mesh_interpolate_cell(mesh_SV, &cell_SV, hs);
+    }
+
+    /* Transform the cartesian vector components into the local geocentric frame */
+
+    lon_rad = cell.lon * M_PI / 180.0;
+    geoc_lat_rad = geoc_lat * M_PI / 180.0;
+
+    EMM_cart2sphere_vec(lon_rad, geoc_lat_rad, h[0], h[1], h[2], geoc_Bx, geoc_By, geoc_Bz); /* x=north, y=east, z=down */
+    EMM_cart2sphere_vec(lon_rad, geoc_lat_rad, hs[0], hs[1], hs[2], geoc_Bxs, geoc_Bys, geoc_Bzs);
+
+    return status;
+} /* mesh_interpolate_sv */
+
+#ifndef EMM_BATCH_BLOCK
+#define EMM_BATCH_BLOCK 16384 /* queries sorted together, their located cells take 5 MB */
+#endif
+
+typedef struct {
+    long long key; /* (layer, row, cell) of the lower corner */
+    int index; /* position of the query in the caller's arrays */
+    int err; /* EMM_mesh_locate status */
+} EMM_tbatch_order;
+
+static int EMM_batch_compare(const void *a, const void *b)
+{
+    long long ka = ((const EMM_tbatch_order *) a)->key, kb = ((const EMM_tbatch_order *) b)->key;
+
+    if(ka != kb)
+        return ka < kb ? -1 : 1;
+    return ((const EMM_tbatch_order *) a)->index - ((const EMM_tbatch_order *) b)->index;
+} /* batch_compare */
+
+static int EMM_mesh_batch_block(int verbose, EMM_tmesh mesh, const EMM_tmesh *mesh_SV, int n, const double lon[], const double lat[], const double alt[],
+        const double geoc_lat[], double Bx[], double By[], double Bz[], double Bxs[], double Bys[], double Bzs[], EMM_tbatch_order *order, EMM_tcell *cells)
+/* EMM_mesh_batch for at most EMM_BATCH_BLOCK queries, with the workspace of the caller */
+{
+    int i, k, status = 0;
+    EMM_tcell *cell, cell_SV;
+    double h[3], hs[3], lon_rad, geoc_lat_rad;
+
+    for(i = 0; i < n; i++)
+    {
+        cell = &cells[i];
+        order[i].err = EMM_mesh_locate(verbose, mesh, lon[i], lat[i], alt[i], cell);
+        if(order[i].err && !status)
+            status = order[i].err;
+        order[i].key = ((long long) cell->ialt0 * MESH_MAXLAT + cell->ilat00) * 2 * MESH_MAXLAT + cell->ilon000;
+        order[i].index = i;
+    }
+    qsort(order, n, sizeof (EMM_tbatch_order), EMM_batch_compare);
+
+    for(k = 0; k < n; k++)
+    {
+        i = order[k].index;
+        cell = &cells[i];
+        if(order[k].err == EXIT_MESH_FILE_LAT_ERROR)
+        {
+            Bx[i] = By[i] = Bz[i] = NAN;
+            if(mesh_SV != NULL)
+                Bxs[i] = Bys[i] = Bzs[i] = NAN;
+            continue;
+        }
+
+        EMM_mesh_interpolate_cell(mesh, cell, h);
+
+        lon_rad = cell->lon * M_PI / 180.0;
+        geoc_lat_rad = geoc_lat[i] * M_PI / 180.0;
+        EMM_cart2sphere_vec(lon_rad, geoc_lat_rad, h[0], h[1], h[2], &Bx[i], &By[i], &Bz[i]); /* x=north, y=east, z=down */
+
+        if(mesh_SV != NULL)
+        {
+            if(EMM_cell_shared(mesh, *mesh_SV, cell))
+                EMM_mesh_interpolate_cell(*mesh_SV, cell, hs);
+            else if(EMM_mesh_locate(verbose, *mesh_SV, lon[i], lat[i], alt[i], &cell_SV) != EXIT_MESH_FILE_LAT_ERROR)
+                EMM_mesh_interpolate_cell(*mesh_SV, &cell_SV, hs);
+            else
+                hs[0] = hs[1] = hs[2] = NAN;
+            EMM_cart2sphere_vec(lon_rad, geoc_lat_rad, hs[0], hs[1], hs[2], &Bxs[i], &Bys[i], &Bzs[i]);
+        }
+    } /* for k */
+
+    return status;
+} /* mesh_batch_block */
+
+static int EMM_mesh_batch(int verbose, EMM_tmesh mesh, const EMM_tmesh *mesh_SV, int n, const double lon[], const double lat[], const double alt[],
+        const double geoc_lat[], double Bx[], double By[], double Bz[], double Bxs[], double Bys[], double Bzs[])
+/* visit the queries ordered by mesh cell so that neighbouring queries reuse cached cells, then scatter the results back */
+/* each query is located once; the queries are sorted in blocks, so that the located cells stay in cache until they are used */
+{
+    int start, m, err, status = 0;
+    EMM_tcell *cells;
+    EMM_tbatch_order *order;
+
+    m = n < EMM_BATCH_BLOCK ? n : EMM_BATCH_BLOCK;
+    order = malloc((m > 0 ? m : 1) * sizeof (EMM_tbatch_order));
+    cells = malloc((m > 0 ? m : 1) * sizeof (EMM_tcell));
+    if(order == NULL || cells == NULL)
+    {
+        free(order);
+        free(cells);
+        if(verbose)
+        {
+            printf("Error - out of memory\n");
+            fflush(stdout);
+        }
+        return EXIT_MESH_MEM_ALLOC_ERROR;
+    }
+
+    for(start = 0; start < n; start += EMM_BATCH_BLOCK)
+    {
+        m = n - start < EMM_BATCH_BLOCK ? n - start : EMM_BATCH_BLOCK;
+        err = EMM_mesh_batch_block(verbose, mesh, mesh_SV, m, lon + start, lat + start, alt + start, geoc_lat + start, Bx + start, By + start, Bz + start,
+                mesh_SV != NULL ? Bxs + start : NULL, mesh_SV != NULL ? Bys + start : NULL, mesh_SV != NULL ? Bzs + start : NULL, order, cells);
+        if(err && !status)
+            status = err;
+    }
+
+    free(order);
+    free(cells);
+    return status;
+} /* mesh_batch */
+
+int EMM_mesh_interpolate_batch(int verbose, EMM_tmesh mesh, int n, const double lon[], const double lat[], const double alt[],
+        const double geoc_lat[], double geoc_Bx[], double geoc_By[], double geoc_Bz[])
+/* EMM_mesh_interpolate for n points; returns the first error encountered, points that cannot be located are NaN */
+{
+    return EMM_mesh_batch(verbose, mesh, NULL, n, lon, lat, alt, geoc_lat, geoc_Bx, geoc_By, geoc_Bz, NULL, NULL, NULL);
+} /* mesh_interpolate_batch */
+
+int EMM_mesh_interpolate_sv_batch(int verbose, EMM_tmesh mesh, EMM_tmesh mesh_SV, int n, const double lon[], const double lat[], const double alt[],
+        const double geoc_lat[], double geoc_Bx[], double geoc_By[], double geoc_Bz[], double geoc_Bxs[], double geoc_Bys[], double geoc_Bzs[])
+/* EMM_mesh_interpolate_sv for n points; returns the first error encountered, points that cannot be located are NaN */
+{
+    return EMM_mesh_batch(verbose, mesh, &mesh_SV, n, lon, lat, alt, geoc_lat, geoc_Bx, geoc_By, geoc_Bz, geoc_Bxs, geoc_Bys, geoc_Bzs);
+} /* mesh_interpolate_sv_batch */
+
 int EMM_PointCalcFromMesh(MAGtype_CoordGeodetic CordGeo, MAGtype_CoordSpherical CordSph, MAGtype_Date UserDate, MAGtype_MagneticResults *MagResults, EMM_tmesh mesh, EMM_tmesh mesh_SV)
 {
     int verbose = 1;
@@ -859,8 +2558,11 @@ int EMM_PointCalcFromMesh(MAGtype_CoordGeodetic CordGeo, MAGtype_CoordSpherical
 
 
 
-    EMM_mesh_interpolate(verbose, mesh, lon, geod_lat, alt, geoc_lat, &x, &y, &z);
-    EMM_mesh_interpolate(verbose, mesh_SV, lon, geod_lat, alt, geoc_lat, &xs, &ys, &zs);
+    if(EMM_mesh_interpolate_sv(verbose, mesh, mesh_SV, lon, geod_lat, alt, geoc_lat, &x, &y, &z, &xs, &ys, &zs) == EXIT_MESH_FILE_LAT_ERROR)
+    {
+        MagResults->Bx = MagResults->By = MagResults->Bz = NAN;
+        return FALSE;
+    }
 
     x += (date - mesh.epoch) * xs;
     y += (date - mesh.epoch) * ys;
@@ -877,6 +2579,34 @@ int EMM_PointCalcFromMesh(MAGtype_CoordGeodetic CordGeo, MAGtype_CoordSpherical
     return 1;
 } /*EMM_PointCalcFromMesh*/
 
+int EMM_PointCalcFromSnapshot(MAGtype_CoordGeodetic CordGeo, MAGtype_CoordSpherical CordSph, MAGtype_MagneticResults *MagResults, EMM_tmesh snapshot)
+/* same as EMM_PointCalcFromMesh for the decimal year the snapshot was materialized at */
+{
+    int verbose = 1;
+    double lon, geod_lat, alt, geoc_lat, x, y, z, geod_colat_rad, geoc_colat_rad, geod_x, geod_y, geod_z;
+
+    lon = CordGeo.lambda;
+    geod_lat = CordGeo.phi;
+    alt = CordGeo.HeightAboveEllipsoid;
+    geoc_lat = CordSph.phig;
+
+    if(EMM_mesh_interpolate(verbose, snapshot, lon, geod_lat, alt, geoc_lat, &x, &y, &z) == EXIT_MESH_FILE_LAT_ERROR)
+    {
+        MagResults->Bx = MagResults->By = MagResults->Bz = NAN;
+        return FALSE;
+    }
+
+    geod_colat_rad = (90.0 - geod_lat) * M_PI / 180.0;
+    geoc_colat_rad = (90.0 - geoc_lat) * M_PI / 180.0;
+    EMM_geocentric2geodetic_vec(geoc_colat_rad, geod_colat_rad, x, y, z, &geod_x, &geod_y, &geod_z);
+
+    MagResults->Bx = geod_x;
+    MagResults->By = geod_y;
+    MagResults->Bz = geod_z;
+
+    return 1;
+} /*EMM_PointCalcFromSnapshot*/
+
 int EMM_Grid(MAGtype_CoordGeodetic minimum, MAGtype_CoordGeodetic maximum, double
         cord_step_size, double altitude_step_size, double time_step, MAGtype_Geoid
         *Geoid, MAGtype_Ellipsoid Ellip, MAGtype_Date StartDate, MAGtype_Date EndDate, int ElementOption, int PrintOption, char *OutputFile, EMM_tmesh mesh, EMM_tmesh mesh_SV)
@@ -888,7 +2618,11 @@ int EMM_Grid(MAGtype_CoordGeodetic minimum, MAGtype_CoordGeodetic maximum, doubl
     MAGtype_GeoMagneticElements GeoMagneticElements;
 
 
-    FILE *fileout;
+    FILE *fileout = NULL;
+    MAGtype_ColumnFile ColumnFile;
+    char *ColumnNames[5];
+    double ColumnValues[5];
+    int ColumnsOK = TRUE; /* FALSE once a row of the binary columns could not be written */
 
     if(PrintOption == 1)
     {
@@ -898,6 +2632,18 @@ int EMM_Grid(MAGtype_CoordGeodetic minimum, MAGtype_CoordGeodetic maximum, doubl
             printf("Error opening %s to write", OutputFile);
             return FALSE;
         }
+    } else if(PrintOption == 3 || PrintOption == 4) /* binary columns, float64 or float32 */
+    {
+        ColumnNames[0] = "Latitude";
+        ColumnNames[1] = "Longitude";
+        ColumnNames[2] = (Geoid->UseGeoid == 1) ? "HeightAboveGeoid" : "HeightAboveEllipsoid";
+        ColumnNames[3] = "DecimalYear";
+        ColumnNames[4] = MAG_GridElementName(ElementOption);
+        if(!MAG_ColumnFileCreate(OutputFile, 5, ColumnNames, (PrintOption == 3) ? 8 : 4, &ColumnFile))
+        {
+            printf("Error opening %s to write", OutputFile);
+            return FALSE;
+        }
     }
 
 
@@ -997,7 +2743,16 @@ int EMM_Grid(MAGtype_CoordGeodetic minimum, MAGtype_CoordGeodetic maximum, doubl
                             PrintElement = GeoMagneticElements.Decl; /* 1. Angle between the magnetic field vector and true north, positive east*/
                     }
 
-                    if(Geoid->UseGeoid == 1)
+                    if(PrintOption == 3 || PrintOption == 4)
+                    {
+                        ColumnValues[0] = minimum.phi;
+                        ColumnValues[1] = minimum.lambda;
+                        ColumnValues[2] = (Geoid->UseGeoid == 1) ? minimum.HeightAboveGeoid : minimum.HeightAboveEllipsoid;
+                        ColumnValues[3] = StartDate.DecimalYear;
+                        ColumnValues[4] = PrintElement;
+                        if(ColumnsOK && !MAG_ColumnFileWriteRow(&ColumnFile, ColumnValues))
+                            ColumnsOK = FALSE;
+                    } else if(Geoid->UseGeoid == 1)
                     {
                         if(PrintOption == 1) fprintf(fileout, "%5.2lf %6.2lf %8.4lf %7.2lf %10.2lf\n", minimum.phi, minimum.lambda, minimum.HeightAboveGeoid, StartDate.DecimalYear, PrintElement);
                         else printf("%5.2lf %6.2lf %8.4lf %7.2lf %10.2lf\n", minimum.phi, minimum.lambda, minimum.HeightAboveGeoid, StartDate.DecimalYear, PrintElement);
@@ -1019,8 +2774,12 @@ int EMM_Grid(MAGtype_CoordGeodetic minimum, MAGtype_CoordGeodetic maximum, doubl
 
     } /* Altitude Loop */
     if(PrintOption == 1) fclose(fileout);
+    if((PrintOption == 3 || PrintOption == 4) && !MAG_ColumnFileClose(&ColumnFile))
+        ColumnsOK = FALSE;
+    if(!ColumnsOK)
+        printf("Error writing %s\n", OutputFile);
 
 
 
-    return TRUE;
+    return ColumnsOK;
 } /*EMM_Grid*/
@@ -0,0 +1,90 @@
+# Copyright 2018 Samuel B. Powell, Washinton University in St. Louis
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+"""Columnar binary files of the geomag command line tools.
+
+The layout is described at MAG_ColumnFileCreate in GeomagnetismLibrary.c:
+a header with the column names, then blocks of rows holding each column in
+turn. The tools write them for grid option 3 (float64) or 4 (float32) and for
+emm_sph_file b ... d (or s), which also reads them as coordinate input.
+"""
+import numpy as np
+
+MAGIC = b'MAGCOLS1'
+NAME_LENGTH = 32
+ALIGN = 64
+BLOCK_ROWS = 65536
+
+_header = np.dtype([('magic','S8'),('ncol','=i4'),('itemsize','=i4'),
+                    ('nrows','=i8'),('block_rows','=i8'),('offset','=i8')])
+
+def read_columns(fname):
+    """Map a columnar file; returns a dict of column name -> 1D array.
+
+    The file is memory mapped, so the arrays are read lazily and are views
+    into the file when it holds a single block. Files of several blocks are
+    copied into contiguous arrays a column at a time.
+    """
+    h = np.fromfile(fname, dtype=_header, count=1)
+    if len(h) == 0 or h['magic'][0] != MAGIC:
+        raise ValueError('{} is not a columnar file'.format(fname))
+    h = h[0]
+    ncol, nrows, block_rows, offset = int(h['ncol']), int(h['nrows']), int(h['block_rows']), int(h['offset'])
+    dtype = {8: np.float64, 4: np.float32}[int(h['itemsize'])]
+    names = np.fromfile(fname, dtype='S{}'.format(NAME_LENGTH), count=ncol, offset=_header.itemsize)
+    names = [n.decode('ascii') for n in names]
+    nblocks = -(-nrows // block_rows)
+    if nblocks == 0:
+        return {n: np.zeros(0, dtype) for n in names}
+    data = np.memmap(fname, dtype=dtype, mode='r', offset=offset, shape=(nblocks, ncol, block_rows))
+    if nblocks == 1:
+        return {n: data[0, i, :nrows] for i, n in enumerate(names)}
+    return {n: data[:, i, :].reshape(-1)[:nrows] for i, n in enumerate(names)}
+
+def write_columns(fname, columns, dtype=np.float64, block_rows=BLOCK_ROWS):
+    """Write a dict (or list of pairs) of name -> 1D array as a columnar file.
+
+    For coordinate input to emm_sph_file give DecimalYear, Latitude,
+    Longitude and HeightAboveEllipsoid or HeightAboveGeoid (km).
+    """
+    if isinstance(columns, dict):
+        columns = list(columns.items())
+    names = [n for n, c in columns]
+    data = [np.asarray(c, dtype=dtype).ravel() for n, c in columns]
+    nrows = len(data[0]) if data else 0
+    if any(len(d) != nrows for d in data):
+        raise ValueError('columns differ in length')
+    if any(len(n.encode('ascii')) >= NAME_LENGTH for n in names):
+        raise ValueError('column names must be shorter than {} characters'.format(NAME_LENGTH))
+    ncol = len(names)
+    offset = -(-(_header.itemsize + ncol*NAME_LENGTH) // ALIGN) * ALIGN
+    h = np.zeros(1, _header)
+    h['magic'], h['ncol'], h['itemsize'] = MAGIC, ncol, np.dtype(dtype).itemsize
+    h['nrows'], h['block_rows'], h['offset'] = nrows, block_rows, offset
+    with open(fname, 'wb') as f:
+        f.write(h.tobytes())
+        f.write(np.array(names, dtype='S{}'.format(NAME_LENGTH)).tobytes())
+        f.write(b'\0' * (offset - f.tell()))
+        block = np.zeros((ncol, block_rows), dtype)
+        for start in range(0, nrows, block_rows):
+            n = min(block_rows, nrows - start)
+            block[:, n:] = 0
+            for i, d in enumerate(data):
+                block[i, :n] = d[start:start+n]
+            f.write(block.tobytes())
@@ -0,0 +1,99 @@
+# Copyright 2018 Samuel B. Powell, Washinton University in St. Louis
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+"""Client of emm_daemon, which keeps the EMM models and meshes loaded.
+
+The protocol is described in DaemonHeader.h. Start the daemon with
+    emm_daemon /tmp/emm.sock [static.bin secvar.bin]
+in the directory holding the coefficient files, then
+    with EMMDaemonClient('/tmp/emm.sock') as emm:
+        r = emm.query(lat, lon, height, year)
+        r['Decl']
+"""
+import socket
+import struct
+import numpy as np
+
+SPH, MESH = 0, 1
+ELEMENTS = ('Decl','Incl','F','H','X','Y','Z','GV',
+            'Decldot','Incldot','Fdot','Hdot','Xdot','Ydot','Zdot','GVdot')
+MAXPOINTS = 1 << 22
+_request = struct.Struct('=4siii')
+_response = struct.Struct('=4siii')
+_errors = {1: 'protocol error', 2: 'too many points', 3: 'daemon has no meshes', 4: 'daemon out of memory'}
+
+class EMMDaemonClient:
+    """EMMDaemonClient(path)
+        Connection to an emm_daemon listening on the Unix socket path.
+    """
+    def __init__(self, path):
+        self._sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self._sock.connect(path)
+
+    def close(self):
+        if self._sock is not None:
+            self._sock.close()
+            self._sock = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def _recv(self, nbytes):
+        buf = bytearray(nbytes)
+        view = memoryview(buf)
+        while len(view):
+            got = self._sock.recv_into(view)
+            if got == 0:
+                raise ConnectionError('emm_daemon closed the connection')
+            view = view[got:]
+        return buf
+
+    def query(self, lat, lon, height, year, mesh=False, geoid=False):
+        """query(lat, lon, height, year, mesh=False, geoid=False)
+            Evaluate the geomagnetic elements at many points with one request.
+            Parameters:
+                lat, lon - geodetic latitude and longitude, degrees
+                height - km above the WGS-84 ellipsoid, or above MSL if geoid=True
+                year - decimal year
+                mesh - use the daemon's meshes instead of the spherical harmonic models
+              The arguments are broadcast against each other.
+            Returns a structured array of the shape of the broadcast arguments,
+            with fields Decl, Incl, F, H, X, Y, Z, GV, Decldot, ..., GVdot.
+        """
+        lat, lon, height, year = np.broadcast_arrays(*[np.asarray(a, dtype=np.float64) for a in (lat, lon, height, year)])
+        shape = lat.shape
+        n = lat.size
+        if n > MAXPOINTS:
+            raise ValueError('at most {} points per query'.format(MAXPOINTS))
+        self._sock.sendall(_request.pack(b'EMMQ', MESH if mesh else SPH, 1 if geoid else 0, n))
+        for a in (lat, lon, height, year):
+            self._sock.sendall(np.ascontiguousarray(a).ravel().tobytes())
+        magic, status, rn, nelem = _response.unpack(self._recv(_response.size))
+        if magic != b'EMMR':
+            raise ConnectionError('unexpected response from emm_daemon')
+        if status != 0:
+            raise RuntimeError('emm_daemon: ' + _errors.get(status, 'error {}'.format(status)))
+        data = np.frombuffer(self._recv(8*n*nelem), dtype=np.float64).reshape(nelem, n)
+        result = np.empty(n, dtype=[(e, np.float64) for e in ELEMENTS])
+        for i, e in enumerate(ELEMENTS):
+            result[e] = data[i]
+        return result.reshape(shape)
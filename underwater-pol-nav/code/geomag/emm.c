@@ -1,9125 +0,0 @@
-/* Generated by Cython 0.26.1 */
-
-/* BEGIN: Cython Metadata
-{
-    "distutils": {
-        "define_macros": [
-            [
-                "_CRT_SECURE_NO_WARNINGS",
-                null
-            ]
-        ],
-        "depends": [
-            "C:\\Users\\uqspowe6\\Desktop\\UCam\\position estimation\\code\\geomag\\EGM9615.h",
-            "C:\\Users\\uqspowe6\\Desktop\\UCam\\position estimation\\code\\geomag\\GeomagnetismHeader.h",
-            "C:\\Users\\uqspowe6\\Desktop\\UCam\\position estimation\\code\\geomag\\MeshHeader.h"
-        ],
-        "include_dirs": [
-            "C:\\Users\\uqspowe6\\Desktop\\UCam\\position estimation\\code\\geomag"
-        ],
-        "name": "emm",
-        "sources": [
-            "emm.pyx",
-            "GeomagnetismLibrary.c",
-            "Mesh_SubLibrary.c"
-        ]
-    },
-    "module_name": "emm"
-}
-END: Cython Metadata */
-
-#define PY_SSIZE_T_CLEAN
-#include "Python.h"
-#ifndef Py_PYTHON_H
-    #error Python headers needed to compile C extensions, please install development version of Python.
-#elif PY_VERSION_HEX < 0x02060000 || (0x03000000 <= PY_VERSION_HEX && PY_VERSION_HEX < 0x03020000)
-    #error Cython requires Python 2.6+ or Python 3.2+.
-#else
-#define CYTHON_ABI "0_26_1"
-#include <stddef.h>
-#ifndef offsetof
-  #define offsetof(type, member) ( (size_t) & ((type*)0) -> member )
-#endif
-#if !defined(WIN32) && !defined(MS_WINDOWS)
-  #ifndef __stdcall
-    #define __stdcall
-  #endif
-  #ifndef __cdecl
-    #define __cdecl
-  #endif
-  #ifndef __fastcall
-    #define __fastcall
-  #endif
-#endif
-#ifndef DL_IMPORT
-  #define DL_IMPORT(t) t
-#endif
-#ifndef DL_EXPORT
-  #define DL_EXPORT(t) t
-#endif
-#define __PYX_COMMA ,
-#ifndef HAVE_LONG_LONG
-  #if PY_VERSION_HEX >= 0x03030000 || (PY_MAJOR_VERSION == 2 && PY_VERSION_HEX >= 0x02070000)
-    #define HAVE_LONG_LONG
-  #endif
-#endif
-#ifndef PY_LONG_LONG
-  #define PY_LONG_LONG LONG_LONG
-#endif
-#ifndef Py_HUGE_VAL
-  #define Py_HUGE_VAL HUGE_VAL
-#endif
-#ifdef PYPY_VERSION
-  #define CYTHON_COMPILING_IN_PYPY 1
-  #define CYTHON_COMPILING_IN_PYSTON 0
-  #define CYTHON_COMPILING_IN_CPYTHON 0
-  #undef CYTHON_USE_TYPE_SLOTS
-  #define CYTHON_USE_TYPE_SLOTS 0
-  #undef CYTHON_USE_PYTYPE_LOOKUP
-  #define CYTHON_USE_PYTYPE_LOOKUP 0
-  #undef CYTHON_USE_ASYNC_SLOTS
-  #define CYTHON_USE_ASYNC_SLOTS 0
-  #undef CYTHON_USE_PYLIST_INTERNALS
-  #define CYTHON_USE_PYLIST_INTERNALS 0
-  #undef CYTHON_USE_UNICODE_INTERNALS
-  #define CYTHON_USE_UNICODE_INTERNALS 0
-  #undef CYTHON_USE_UNICODE_WRITER
-  #define CYTHON_USE_UNICODE_WRITER 0
-  #undef CYTHON_USE_PYLONG_INTERNALS
-  #define CYTHON_USE_PYLONG_INTERNALS 0
-  #undef CYTHON_AVOID_BORROWED_REFS
-  #define CYTHON_AVOID_BORROWED_REFS 1
-  #undef CYTHON_ASSUME_SAFE_MACROS
-  #define CYTHON_ASSUME_SAFE_MACROS 0
-  #undef CYTHON_UNPACK_METHODS
-  #define CYTHON_UNPACK_METHODS 0
-  #undef CYTHON_FAST_THREAD_STATE
-  #define CYTHON_FAST_THREAD_STATE 0
-  #undef CYTHON_FAST_PYCALL
-  #define CYTHON_FAST_PYCALL 0
-#elif defined(PYSTON_VERSION)
-  #define CYTHON_COMPILING_IN_PYPY 0
-  #define CYTHON_COMPILING_IN_PYSTON 1
-  #define CYTHON_COMPILING_IN_CPYTHON 0
-  #ifndef CYTHON_USE_TYPE_SLOTS
-    #define CYTHON_USE_TYPE_SLOTS 1
-  #endif
-  #undef CYTHON_USE_PYTYPE_LOOKUP
-  #define CYTHON_USE_PYTYPE_LOOKUP 0
-  #undef CYTHON_USE_ASYNC_SLOTS
-  #define CYTHON_USE_ASYNC_SLOTS 0
-  #undef CYTHON_USE_PYLIST_INTERNALS
-  #define CYTHON_USE_PYLIST_INTERNALS 0
-  #ifndef CYTHON_USE_UNICODE_INTERNALS
-    #define CYTHON_USE_UNICODE_INTERNALS 1
-  #endif
-  #undef CYTHON_USE_UNICODE_WRITER
-  #define CYTHON_USE_UNICODE_WRITER 0
-  #undef CYTHON_USE_PYLONG_INTERNALS
-  #define CYTHON_USE_PYLONG_INTERNALS 0
-  #ifndef CYTHON_AVOID_BORROWED_REFS
-    #define CYTHON_AVOID_BORROWED_REFS 0
-  #endif
-  #ifndef CYTHON_ASSUME_SAFE_MACROS
-    #define CYTHON_ASSUME_SAFE_MACROS 1
-  #endif
-  #ifndef CYTHON_UNPACK_METHODS
-    #define CYTHON_UNPACK_METHODS 1
-  #endif
-  #undef CYTHON_FAST_THREAD_STATE
-  #define CYTHON_FAST_THREAD_STATE 0
-  #undef CYTHON_FAST_PYCALL
-  #define CYTHON_FAST_PYCALL 0
-#else
-  #define CYTHON_COMPILING_IN_PYPY 0
-  #define CYTHON_COMPILING_IN_PYSTON 0
-  #define CYTHON_COMPILING_IN_CPYTHON 1
-  #ifndef CYTHON_USE_TYPE_SLOTS
-    #define CYTHON_USE_TYPE_SLOTS 1
-  #endif
-  #if PY_VERSION_HEX < 0x02070000
-    #undef CYTHON_USE_PYTYPE_LOOKUP
-    #define CYTHON_USE_PYTYPE_LOOKUP 0
-  #elif !defined(CYTHON_USE_PYTYPE_LOOKUP)
-    #define CYTHON_USE_PYTYPE_LOOKUP 1
-  #endif
-  #if PY_MAJOR_VERSION < 3
-    #undef CYTHON_USE_ASYNC_SLOTS
-    #define CYTHON_USE_ASYNC_SLOTS 0
-  #elif !defined(CYTHON_USE_ASYNC_SLOTS)
-    #define CYTHON_USE_ASYNC_SLOTS 1
-  #endif
-  #if PY_VERSION_HEX < 0x02070000
-    #undef CYTHON_USE_PYLONG_INTERNALS
-    #define CYTHON_USE_PYLONG_INTERNALS 0
-  #elif !defined(CYTHON_USE_PYLONG_INTERNALS)
-    #define CYTHON_USE_PYLONG_INTERNALS 1
-  #endif
-  #ifndef CYTHON_USE_PYLIST_INTERNALS
-    #define CYTHON_USE_PYLIST_INTERNALS 1
-  #endif
-  #ifndef CYTHON_USE_UNICODE_INTERNALS
-    #define CYTHON_USE_UNICODE_INTERNALS 1
-  #endif
-  #if PY_VERSION_HEX < 0x030300F0
-    #undef CYTHON_USE_UNICODE_WRITER
-    #define CYTHON_USE_UNICODE_WRITER 0
-  #elif !defined(CYTHON_USE_UNICODE_WRITER)
-    #define CYTHON_USE_UNICODE_WRITER 1
-  #endif
-  #ifndef CYTHON_AVOID_BORROWED_REFS
-    #define CYTHON_AVOID_BORROWED_REFS 0
-  #endif
-  #ifndef CYTHON_ASSUME_SAFE_MACROS
-    #define CYTHON_ASSUME_SAFE_MACROS 1
-  #endif
-  #ifndef CYTHON_UNPACK_METHODS
-    #define CYTHON_UNPACK_METHODS 1
-  #endif
-  #ifndef CYTHON_FAST_THREAD_STATE
-    #define CYTHON_FAST_THREAD_STATE 1
-  #endif
-  #ifndef CYTHON_FAST_PYCALL
-    #define CYTHON_FAST_PYCALL 1
-  #endif
-#endif
-#if !defined(CYTHON_FAST_PYCCALL)
-#define CYTHON_FAST_PYCCALL  (CYTHON_FAST_PYCALL && PY_VERSION_HEX >= 0x030600B1)
-#endif
-#if CYTHON_USE_PYLONG_INTERNALS
-  #include "longintrepr.h"
-  #undef SHIFT
-  #undef BASE
-  #undef MASK
-#endif
-#if CYTHON_COMPILING_IN_PYPY && PY_VERSION_HEX < 0x02070600 && !defined(Py_OptimizeFlag)
-  #define Py_OptimizeFlag 0
-#endif
-#define __PYX_BUILD_PY_SSIZE_T "n"
-#define CYTHON_FORMAT_SSIZE_T "z"
-#if PY_MAJOR_VERSION < 3
-  #define __Pyx_BUILTIN_MODULE_NAME "__builtin__"
-  #define __Pyx_PyCode_New(a, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)\
-          PyCode_New(a+k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)
-  #define __Pyx_DefaultClassType PyClass_Type
-#else
-  #define __Pyx_BUILTIN_MODULE_NAME "builtins"
-  #define __Pyx_PyCode_New(a, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)\
-          PyCode_New(a, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)
-  #define __Pyx_DefaultClassType PyType_Type
-#endif
-#ifndef Py_TPFLAGS_CHECKTYPES
-  #define Py_TPFLAGS_CHECKTYPES 0
-#endif
-#ifndef Py_TPFLAGS_HAVE_INDEX
-  #define Py_TPFLAGS_HAVE_INDEX 0
-#endif
-#ifndef Py_TPFLAGS_HAVE_NEWBUFFER
-  #define Py_TPFLAGS_HAVE_NEWBUFFER 0
-#endif
-#ifndef Py_TPFLAGS_HAVE_FINALIZE
-  #define Py_TPFLAGS_HAVE_FINALIZE 0
-#endif
-#if PY_VERSION_HEX < 0x030700A0 || !defined(METH_FASTCALL)
-  #ifndef METH_FASTCALL
-     #define METH_FASTCALL 0x80
-  #endif
-  typedef PyObject *(*__Pyx_PyCFunctionFast) (PyObject *self, PyObject **args, Py_ssize_t nargs);
-  typedef PyObject *(*__Pyx_PyCFunctionFastWithKeywords) (PyObject *self, PyObject **args,
-                                                          Py_ssize_t nargs, PyObject *kwnames);
-#else
-  #define __Pyx_PyCFunctionFast _PyCFunctionFast
-  #define __Pyx_PyCFunctionFastWithKeywords _PyCFunctionFastWithKeywords
-#endif
-#if CYTHON_FAST_PYCCALL
-#define __Pyx_PyFastCFunction_Check(func)\
-    ((PyCFunction_Check(func) && (METH_FASTCALL == (PyCFunction_GET_FLAGS(func) & ~(METH_CLASS | METH_STATIC | METH_COEXIST | METH_KEYWORDS)))))
-#else
-#define __Pyx_PyFastCFunction_Check(func) 0
-#endif
-#if PY_VERSION_HEX > 0x03030000 && defined(PyUnicode_KIND)
-  #define CYTHON_PEP393_ENABLED 1
-  #define __Pyx_PyUnicode_READY(op)       (likely(PyUnicode_IS_READY(op)) ?\
-                                              0 : _PyUnicode_Ready((PyObject *)(op)))
-  #define __Pyx_PyUnicode_GET_LENGTH(u)   PyUnicode_GET_LENGTH(u)
-  #define __Pyx_PyUnicode_READ_CHAR(u, i) PyUnicode_READ_CHAR(u, i)
-  #define __Pyx_PyUnicode_MAX_CHAR_VALUE(u)   PyUnicode_MAX_CHAR_VALUE(u)
-  #define __Pyx_PyUnicode_KIND(u)         PyUnicode_KIND(u)
-  #define __Pyx_PyUnicode_DATA(u)         PyUnicode_DATA(u)
-  #define __Pyx_PyUnicode_READ(k, d, i)   PyUnicode_READ(k, d, i)
-  #define __Pyx_PyUnicode_WRITE(k, d, i, ch)  PyUnicode_WRITE(k, d, i, ch)
-  #define __Pyx_PyUnicode_IS_TRUE(u)      (0 != (likely(PyUnicode_IS_READY(u)) ? PyUnicode_GET_LENGTH(u) : PyUnicode_GET_SIZE(u)))
-#else
-  #define CYTHON_PEP393_ENABLED 0
-  #define PyUnicode_1BYTE_KIND  1
-  #define PyUnicode_2BYTE_KIND  2
-  #define PyUnicode_4BYTE_KIND  4
-  #define __Pyx_PyUnicode_READY(op)       (0)
-  #define __Pyx_PyUnicode_GET_LENGTH(u)   PyUnicode_GET_SIZE(u)
-  #define __Pyx_PyUnicode_READ_CHAR(u, i) ((Py_UCS4)(PyUnicode_AS_UNICODE(u)[i]))
-  #define __Pyx_PyUnicode_MAX_CHAR_VALUE(u)   ((sizeof(Py_UNICODE) == 2) ? 65535 : 1114111)
-  #define __Pyx_PyUnicode_KIND(u)         (sizeof(Py_UNICODE))
-  #define __Pyx_PyUnicode_DATA(u)         ((void*)PyUnicode_AS_UNICODE(u))
-  #define __Pyx_PyUnicode_READ(k, d, i)   ((void)(k), (Py_UCS4)(((Py_UNICODE*)d)[i]))
-  #define __Pyx_PyUnicode_WRITE(k, d, i, ch)  (((void)(k)), ((Py_UNICODE*)d)[i] = ch)
-  #define __Pyx_PyUnicode_IS_TRUE(u)      (0 != PyUnicode_GET_SIZE(u))
-#endif
-#if CYTHON_COMPILING_IN_PYPY
-  #define __Pyx_PyUnicode_Concat(a, b)      PyNumber_Add(a, b)
-  #define __Pyx_PyUnicode_ConcatSafe(a, b)  PyNumber_Add(a, b)
-#else
-  #define __Pyx_PyUnicode_Concat(a, b)      PyUnicode_Concat(a, b)
-  #define __Pyx_PyUnicode_ConcatSafe(a, b)  ((unlikely((a) == Py_None) || unlikely((b) == Py_None)) ?\
-      PyNumber_Add(a, b) : __Pyx_PyUnicode_Concat(a, b))
-#endif
-#if CYTHON_COMPILING_IN_PYPY && !defined(PyUnicode_Contains)
-  #define PyUnicode_Contains(u, s)  PySequence_Contains(u, s)
-#endif
-#if CYTHON_COMPILING_IN_PYPY && !defined(PyByteArray_Check)
-  #define PyByteArray_Check(obj)  PyObject_TypeCheck(obj, &PyByteArray_Type)
-#endif
-#if CYTHON_COMPILING_IN_PYPY && !defined(PyObject_Format)
-  #define PyObject_Format(obj, fmt)  PyObject_CallMethod(obj, "__format__", "O", fmt)
-#endif
-#if CYTHON_COMPILING_IN_PYPY && !defined(PyObject_Malloc)
-  #define PyObject_Malloc(s)   PyMem_Malloc(s)
-  #define PyObject_Free(p)     PyMem_Free(p)
-  #define PyObject_Realloc(p)  PyMem_Realloc(p)
-#endif
-#if CYTHON_COMPILING_IN_PYSTON
-  #define __Pyx_PyCode_HasFreeVars(co)  PyCode_HasFreeVars(co)
-  #define __Pyx_PyFrame_SetLineNumber(frame, lineno) PyFrame_SetLineNumber(frame, lineno)
-#else
-  #define __Pyx_PyCode_HasFreeVars(co)  (PyCode_GetNumFree(co) > 0)
-  #define __Pyx_PyFrame_SetLineNumber(frame, lineno)  (frame)->f_lineno = (lineno)
-#endif
-#define __Pyx_PyString_FormatSafe(a, b)   ((unlikely((a) == Py_None)) ? PyNumber_Remainder(a, b) : __Pyx_PyString_Format(a, b))
-#define __Pyx_PyUnicode_FormatSafe(a, b)  ((unlikely((a) == Py_None)) ? PyNumber_Remainder(a, b) : PyUnicode_Format(a, b))
-#if PY_MAJOR_VERSION >= 3
-  #define __Pyx_PyString_Format(a, b)  PyUnicode_Format(a, b)
-#else
-  #define __Pyx_PyString_Format(a, b)  PyString_Format(a, b)
-#endif
-#if PY_MAJOR_VERSION < 3 && !defined(PyObject_ASCII)
-  #define PyObject_ASCII(o)            PyObject_Repr(o)
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyBaseString_Type            PyUnicode_Type
-  #define PyStringObject               PyUnicodeObject
-  #define PyString_Type                PyUnicode_Type
-  #define PyString_Check               PyUnicode_Check
-  #define PyString_CheckExact          PyUnicode_CheckExact
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define __Pyx_PyBaseString_Check(obj) PyUnicode_Check(obj)
-  #define __Pyx_PyBaseString_CheckExact(obj) PyUnicode_CheckExact(obj)
-#else
-  #define __Pyx_PyBaseString_Check(obj) (PyString_Check(obj) || PyUnicode_Check(obj))
-  #define __Pyx_PyBaseString_CheckExact(obj) (PyString_CheckExact(obj) || PyUnicode_CheckExact(obj))
-#endif
-#ifndef PySet_CheckExact
-  #define PySet_CheckExact(obj)        (Py_TYPE(obj) == &PySet_Type)
-#endif
-#define __Pyx_TypeCheck(obj, type) PyObject_TypeCheck(obj, (PyTypeObject *)type)
-#define __Pyx_PyException_Check(obj) __Pyx_TypeCheck(obj, PyExc_Exception)
-#if PY_MAJOR_VERSION >= 3
-  #define PyIntObject                  PyLongObject
-  #define PyInt_Type                   PyLong_Type
-  #define PyInt_Check(op)              PyLong_Check(op)
-  #define PyInt_CheckExact(op)         PyLong_CheckExact(op)
-  #define PyInt_FromString             PyLong_FromString
-  #define PyInt_FromUnicode            PyLong_FromUnicode
-  #define PyInt_FromLong               PyLong_FromLong
-  #define PyInt_FromSize_t             PyLong_FromSize_t
-  #define PyInt_FromSsize_t            PyLong_FromSsize_t
-  #define PyInt_AsLong                 PyLong_AsLong
-  #define PyInt_AS_LONG                PyLong_AS_LONG
-  #define PyInt_AsSsize_t              PyLong_AsSsize_t
-  #define PyInt_AsUnsignedLongMask     PyLong_AsUnsignedLongMask
-  #define PyInt_AsUnsignedLongLongMask PyLong_AsUnsignedLongLongMask
-  #define PyNumber_Int                 PyNumber_Long
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyBoolObject                 PyLongObject
-#endif
-#if PY_MAJOR_VERSION >= 3 && CYTHON_COMPILING_IN_PYPY
-  #ifndef PyUnicode_InternFromString
-    #define PyUnicode_InternFromString(s) PyUnicode_FromString(s)
-  #endif
-#endif
-#if PY_VERSION_HEX < 0x030200A4
-  typedef long Py_hash_t;
-  #define __Pyx_PyInt_FromHash_t PyInt_FromLong
-  #define __Pyx_PyInt_AsHash_t   PyInt_AsLong
-#else
-  #define __Pyx_PyInt_FromHash_t PyInt_FromSsize_t
-  #define __Pyx_PyInt_AsHash_t   PyInt_AsSsize_t
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define __Pyx_PyMethod_New(func, self, klass) ((self) ? PyMethod_New(func, self) : PyInstanceMethod_New(func))
-#else
-  #define __Pyx_PyMethod_New(func, self, klass) PyMethod_New(func, self, klass)
-#endif
-#ifndef __has_attribute
-  #define __has_attribute(x) 0
-#endif
-#ifndef __has_cpp_attribute
-  #define __has_cpp_attribute(x) 0
-#endif
-#if CYTHON_USE_ASYNC_SLOTS
-  #if PY_VERSION_HEX >= 0x030500B1
-    #define __Pyx_PyAsyncMethodsStruct PyAsyncMethods
-    #define __Pyx_PyType_AsAsync(obj) (Py_TYPE(obj)->tp_as_async)
-  #else
-    typedef struct {
-        unaryfunc am_await;
-        unaryfunc am_aiter;
-        unaryfunc am_anext;
-    } __Pyx_PyAsyncMethodsStruct;
-    #define __Pyx_PyType_AsAsync(obj) ((__Pyx_PyAsyncMethodsStruct*) (Py_TYPE(obj)->tp_reserved))
-  #endif
-#else
-  #define __Pyx_PyType_AsAsync(obj) NULL
-#endif
-#ifndef CYTHON_RESTRICT
-  #if defined(__GNUC__)
-    #define CYTHON_RESTRICT __restrict__
-  #elif defined(_MSC_VER) && _MSC_VER >= 1400
-    #define CYTHON_RESTRICT __restrict
-  #elif defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
-    #define CYTHON_RESTRICT restrict
-  #else
-    #define CYTHON_RESTRICT
-  #endif
-#endif
-#ifndef CYTHON_UNUSED
-# if defined(__GNUC__)
-#   if !(defined(__cplusplus)) || (__GNUC__ > 3 || (__GNUC__ == 3 && __GNUC_MINOR__ >= 4))
-#     define CYTHON_UNUSED __attribute__ ((__unused__))
-#   else
-#     define CYTHON_UNUSED
-#   endif
-# elif defined(__ICC) || (defined(__INTEL_COMPILER) && !defined(_MSC_VER))
-#   define CYTHON_UNUSED __attribute__ ((__unused__))
-# else
-#   define CYTHON_UNUSED
-# endif
-#endif
-#ifndef CYTHON_MAYBE_UNUSED_VAR
-#  if defined(__cplusplus)
-     template<class T> void CYTHON_MAYBE_UNUSED_VAR( const T& ) { }
-#  else
-#    define CYTHON_MAYBE_UNUSED_VAR(x) (void)(x)
-#  endif
-#endif
-#ifndef CYTHON_NCP_UNUSED
-# if CYTHON_COMPILING_IN_CPYTHON
-#  define CYTHON_NCP_UNUSED
-# else
-#  define CYTHON_NCP_UNUSED CYTHON_UNUSED
-# endif
-#endif
-#define __Pyx_void_to_None(void_result) ((void)(void_result), Py_INCREF(Py_None), Py_None)
-#ifdef _MSC_VER
-    #ifndef _MSC_STDINT_H_
-        #if _MSC_VER < 1300
-           typedef unsigned char     uint8_t;
-           typedef unsigned int      uint32_t;
-        #else
-           typedef unsigned __int8   uint8_t;
-           typedef unsigned __int32  uint32_t;
-        #endif
-    #endif
-#else
-   #include <stdint.h>
-#endif
-#ifndef CYTHON_FALLTHROUGH
-  #ifdef __cplusplus
-    #if __has_cpp_attribute(fallthrough)
-      #define CYTHON_FALLTHROUGH [[fallthrough]]
-    #elif __has_cpp_attribute(clang::fallthrough)
-      #define CYTHON_FALLTHROUGH [[clang::fallthrough]]
-    #endif
-  #endif
-  #ifndef CYTHON_FALLTHROUGH
-    #if __has_attribute(fallthrough) || (defined(__GNUC__) && defined(__attribute__))
-      #define CYTHON_FALLTHROUGH __attribute__((fallthrough))
-    #else
-      #define CYTHON_FALLTHROUGH
-    #endif
-  #endif
-#endif
-
-#ifndef CYTHON_INLINE
-  #if defined(__clang__)
-    #define CYTHON_INLINE __inline__ __attribute__ ((__unused__))
-  #elif defined(__GNUC__)
-    #define CYTHON_INLINE __inline__
-  #elif defined(_MSC_VER)
-    #define CYTHON_INLINE __inline
-  #elif defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
-    #define CYTHON_INLINE inline
-  #else
-    #define CYTHON_INLINE
-  #endif
-#endif
-
-#if defined(WIN32) || defined(MS_WINDOWS)
-  #define _USE_MATH_DEFINES
-#endif
-#include <math.h>
-#ifdef NAN
-#define __PYX_NAN() ((float) NAN)
-#else
-static CYTHON_INLINE float __PYX_NAN() {
-  float value;
-  memset(&value, 0xFF, sizeof(value));
-  return value;
-}
-#endif
-#if defined(__CYGWIN__) && defined(_LDBL_EQ_DBL)
-#define __Pyx_truncl trunc
-#else
-#define __Pyx_truncl truncl
-#endif
-
-
-#define __PYX_ERR(f_index, lineno, Ln_error) \
-{ \
-  __pyx_filename = __pyx_f[f_index]; __pyx_lineno = lineno; __pyx_clineno = __LINE__; goto Ln_error; \
-}
-
-#if PY_MAJOR_VERSION >= 3
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_TrueDivide(x,y)
-  #define __Pyx_PyNumber_InPlaceDivide(x,y)  PyNumber_InPlaceTrueDivide(x,y)
-#else
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_Divide(x,y)
-  #define __Pyx_PyNumber_InPlaceDivide(x,y)  PyNumber_InPlaceDivide(x,y)
-#endif
-
-#ifndef __PYX_EXTERN_C
-  #ifdef __cplusplus
-    #define __PYX_EXTERN_C extern "C"
-  #else
-    #define __PYX_EXTERN_C extern
-  #endif
-#endif
-
-#define __PYX_HAVE__geomag__emm
-#define __PYX_HAVE_API__geomag__emm
-#include "EGM9615.h"
-#include "GeomagnetismHeader.h"
-#include "MeshHeader.h"
-#include <math.h>
-#ifdef _OPENMP
-#include <omp.h>
-#endif /* _OPENMP */
-
-#ifdef PYREX_WITHOUT_ASSERTIONS
-#define CYTHON_WITHOUT_ASSERTIONS
-#endif
-
-typedef struct {PyObject **p; const char *s; const Py_ssize_t n; const char* encoding;
-                const char is_unicode; const char is_str; const char intern; } __Pyx_StringTabEntry;
-
-#define __PYX_DEFAULT_STRING_ENCODING_IS_ASCII 0
-#define __PYX_DEFAULT_STRING_ENCODING_IS_DEFAULT 0
-#define __PYX_DEFAULT_STRING_ENCODING ""
-#define __Pyx_PyObject_FromString __Pyx_PyBytes_FromString
-#define __Pyx_PyObject_FromStringAndSize __Pyx_PyBytes_FromStringAndSize
-#define __Pyx_uchar_cast(c) ((unsigned char)c)
-#define __Pyx_long_cast(x) ((long)x)
-#define __Pyx_fits_Py_ssize_t(v, type, is_signed)  (\
-    (sizeof(type) < sizeof(Py_ssize_t))  ||\
-    (sizeof(type) > sizeof(Py_ssize_t) &&\
-          likely(v < (type)PY_SSIZE_T_MAX ||\
-                 v == (type)PY_SSIZE_T_MAX)  &&\
-          (!is_signed || likely(v > (type)PY_SSIZE_T_MIN ||\
-                                v == (type)PY_SSIZE_T_MIN)))  ||\
-    (sizeof(type) == sizeof(Py_ssize_t) &&\
-          (is_signed || likely(v < (type)PY_SSIZE_T_MAX ||\
-                               v == (type)PY_SSIZE_T_MAX)))  )
-#if defined (__cplusplus) && __cplusplus >= 201103L
-    #include <cstdlib>
-    #define __Pyx_sst_abs(value) std::abs(value)
-#elif SIZEOF_INT >= SIZEOF_SIZE_T
-    #define __Pyx_sst_abs(value) abs(value)
-#elif SIZEOF_LONG >= SIZEOF_SIZE_T
-    #define __Pyx_sst_abs(value) labs(value)
-#elif defined (_MSC_VER) && defined (_M_X64)
-    #define __Pyx_sst_abs(value) _abs64(value)
-#elif defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
-    #define __Pyx_sst_abs(value) llabs(value)
-#elif defined (__GNUC__)
-    #define __Pyx_sst_abs(value) __builtin_llabs(value)
-#else
-    #define __Pyx_sst_abs(value) ((value<0) ? -value : value)
-#endif
-static CYTHON_INLINE const char* __Pyx_PyObject_AsString(PyObject*);
-static CYTHON_INLINE const char* __Pyx_PyObject_AsStringAndSize(PyObject*, Py_ssize_t* length);
-#define __Pyx_PyByteArray_FromString(s) PyByteArray_FromStringAndSize((const char*)s, strlen((const char*)s))
-#define __Pyx_PyByteArray_FromStringAndSize(s, l) PyByteArray_FromStringAndSize((const char*)s, l)
-#define __Pyx_PyBytes_FromString        PyBytes_FromString
-#define __Pyx_PyBytes_FromStringAndSize PyBytes_FromStringAndSize
-static CYTHON_INLINE PyObject* __Pyx_PyUnicode_FromString(const char*);
-#if PY_MAJOR_VERSION < 3
-    #define __Pyx_PyStr_FromString        __Pyx_PyBytes_FromString
-    #define __Pyx_PyStr_FromStringAndSize __Pyx_PyBytes_FromStringAndSize
-#else
-    #define __Pyx_PyStr_FromString        __Pyx_PyUnicode_FromString
-    #define __Pyx_PyStr_FromStringAndSize __Pyx_PyUnicode_FromStringAndSize
-#endif
-#define __Pyx_PyObject_AsWritableString(s)    ((char*) __Pyx_PyObject_AsString(s))
-#define __Pyx_PyObject_AsWritableSString(s)    ((signed char*) __Pyx_PyObject_AsString(s))
-#define __Pyx_PyObject_AsWritableUString(s)    ((unsigned char*) __Pyx_PyObject_AsString(s))
-#define __Pyx_PyObject_AsSString(s)    ((const signed char*) __Pyx_PyObject_AsString(s))
-#define __Pyx_PyObject_AsUString(s)    ((const unsigned char*) __Pyx_PyObject_AsString(s))
-#define __Pyx_PyObject_FromCString(s)  __Pyx_PyObject_FromString((const char*)s)
-#define __Pyx_PyBytes_FromCString(s)   __Pyx_PyBytes_FromString((const char*)s)
-#define __Pyx_PyByteArray_FromCString(s)   __Pyx_PyByteArray_FromString((const char*)s)
-#define __Pyx_PyStr_FromCString(s)     __Pyx_PyStr_FromString((const char*)s)
-#define __Pyx_PyUnicode_FromCString(s) __Pyx_PyUnicode_FromString((const char*)s)
-#if PY_MAJOR_VERSION < 3
-static CYTHON_INLINE size_t __Pyx_Py_UNICODE_strlen(const Py_UNICODE *u)
-{
-    const Py_UNICODE *u_end = u;
-    while (*u_end++) ;
-    return (size_t)(u_end - u - 1);
-}
-#else
-#define __Pyx_Py_UNICODE_strlen Py_UNICODE_strlen
-#endif
-#define __Pyx_PyUnicode_FromUnicode(u)       PyUnicode_FromUnicode(u, __Pyx_Py_UNICODE_strlen(u))
-#define __Pyx_PyUnicode_FromUnicodeAndLength PyUnicode_FromUnicode
-#define __Pyx_PyUnicode_AsUnicode            PyUnicode_AsUnicode
-#define __Pyx_NewRef(obj) (Py_INCREF(obj), obj)
-#define __Pyx_Owned_Py_None(b) __Pyx_NewRef(Py_None)
-#define __Pyx_PyBool_FromLong(b) ((b) ? __Pyx_NewRef(Py_True) : __Pyx_NewRef(Py_False))
-static CYTHON_INLINE int __Pyx_PyObject_IsTrue(PyObject*);
-static CYTHON_INLINE PyObject* __Pyx_PyNumber_IntOrLong(PyObject* x);
-static CYTHON_INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject*);
-static CYTHON_INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t);
-#if CYTHON_ASSUME_SAFE_MACROS
-#define __pyx_PyFloat_AsDouble(x) (PyFloat_CheckExact(x) ? PyFloat_AS_DOUBLE(x) : PyFloat_AsDouble(x))
-#else
-#define __pyx_PyFloat_AsDouble(x) PyFloat_AsDouble(x)
-#endif
-#define __pyx_PyFloat_AsFloat(x) ((float) __pyx_PyFloat_AsDouble(x))
-#if PY_MAJOR_VERSION >= 3
-#define __Pyx_PyNumber_Int(x) (PyLong_CheckExact(x) ? __Pyx_NewRef(x) : PyNumber_Long(x))
-#else
-#define __Pyx_PyNumber_Int(x) (PyInt_CheckExact(x) ? __Pyx_NewRef(x) : PyNumber_Int(x))
-#endif
-#define __Pyx_PyNumber_Float(x) (PyFloat_CheckExact(x) ? __Pyx_NewRef(x) : PyNumber_Float(x))
-#if PY_MAJOR_VERSION < 3 && __PYX_DEFAULT_STRING_ENCODING_IS_ASCII
-static int __Pyx_sys_getdefaultencoding_not_ascii;
-static int __Pyx_init_sys_getdefaultencoding_params(void) {
-    PyObject* sys;
-    PyObject* default_encoding = NULL;
-    PyObject* ascii_chars_u = NULL;
-    PyObject* ascii_chars_b = NULL;
-    const char* default_encoding_c;
-    sys = PyImport_ImportModule("sys");
-    if (!sys) goto bad;
-    default_encoding = PyObject_CallMethod(sys, (char*) "getdefaultencoding", NULL);
-    Py_DECREF(sys);
-    if (!default_encoding) goto bad;
-    default_encoding_c = PyBytes_AsString(default_encoding);
-    if (!default_encoding_c) goto bad;
-    if (strcmp(default_encoding_c, "ascii") == 0) {
-        __Pyx_sys_getdefaultencoding_not_ascii = 0;
-    } else {
-        char ascii_chars[128];
-        int c;
-        for (c = 0; c < 128; c++) {
-            ascii_chars[c] = c;
-        }
-        __Pyx_sys_getdefaultencoding_not_ascii = 1;
-        ascii_chars_u = PyUnicode_DecodeASCII(ascii_chars, 128, NULL);
-        if (!ascii_chars_u) goto bad;
-        ascii_chars_b = PyUnicode_AsEncodedString(ascii_chars_u, default_encoding_c, NULL);
-        if (!ascii_chars_b || !PyBytes_Check(ascii_chars_b) || memcmp(ascii_chars, PyBytes_AS_STRING(ascii_chars_b), 128) != 0) {
-            PyErr_Format(
-                PyExc_ValueError,
-                "This module compiled with c_string_encoding=ascii, but default encoding '%.200s' is not a superset of ascii.",
-                default_encoding_c);
-            goto bad;
-        }
-        Py_DECREF(ascii_chars_u);
-        Py_DECREF(ascii_chars_b);
-    }
-    Py_DECREF(default_encoding);
-    return 0;
-bad:
-    Py_XDECREF(default_encoding);
-    Py_XDECREF(ascii_chars_u);
-    Py_XDECREF(ascii_chars_b);
-    return -1;
-}
-#endif
-#if __PYX_DEFAULT_STRING_ENCODING_IS_DEFAULT && PY_MAJOR_VERSION >= 3
-#define __Pyx_PyUnicode_FromStringAndSize(c_str, size) PyUnicode_DecodeUTF8(c_str, size, NULL)
-#else
-#define __Pyx_PyUnicode_FromStringAndSize(c_str, size) PyUnicode_Decode(c_str, size, __PYX_DEFAULT_STRING_ENCODING, NULL)
-#if __PYX_DEFAULT_STRING_ENCODING_IS_DEFAULT
-static char* __PYX_DEFAULT_STRING_ENCODING;
-static int __Pyx_init_sys_getdefaultencoding_params(void) {
-    PyObject* sys;
-    PyObject* default_encoding = NULL;
-    char* default_encoding_c;
-    sys = PyImport_ImportModule("sys");
-    if (!sys) goto bad;
-    default_encoding = PyObject_CallMethod(sys, (char*) (const char*) "getdefaultencoding", NULL);
-    Py_DECREF(sys);
-    if (!default_encoding) goto bad;
-    default_encoding_c = PyBytes_AsString(default_encoding);
-    if (!default_encoding_c) goto bad;
-    __PYX_DEFAULT_STRING_ENCODING = (char*) malloc(strlen(default_encoding_c));
-    if (!__PYX_DEFAULT_STRING_ENCODING) goto bad;
-    strcpy(__PYX_DEFAULT_STRING_ENCODING, default_encoding_c);
-    Py_DECREF(default_encoding);
-    return 0;
-bad:
-    Py_XDECREF(default_encoding);
-    return -1;
-}
-#endif
-#endif
-
-
-/* Test for GCC > 2.95 */
-#if defined(__GNUC__)     && (__GNUC__ > 2 || (__GNUC__ == 2 && (__GNUC_MINOR__ > 95)))
-  #define likely(x)   __builtin_expect(!!(x), 1)
-  #define unlikely(x) __builtin_expect(!!(x), 0)
-#else /* !__GNUC__ or GCC < 2.95 */
-  #define likely(x)   (x)
-  #define unlikely(x) (x)
-#endif /* __GNUC__ */
-static CYTHON_INLINE void __Pyx_pretend_to_initialize(void* ptr) { (void)ptr; }
-
-static PyObject *__pyx_m;
-static PyObject *__pyx_d;
-static PyObject *__pyx_b;
-static PyObject *__pyx_cython_runtime;
-static PyObject *__pyx_empty_tuple;
-static PyObject *__pyx_empty_bytes;
-static PyObject *__pyx_empty_unicode;
-static int __pyx_lineno;
-static int __pyx_clineno = 0;
-static const char * __pyx_cfilenm= __FILE__;
-static const char *__pyx_filename;
-
-
-static const char *__pyx_f[] = {
-  "emm.pyx",
-  "stringsource",
-};
-
-/*--- Type declarations ---*/
-struct __pyx_obj_6geomag_3emm_GeoMagneticElements;
-struct __pyx_obj_6geomag_3emm_EMMBase;
-struct __pyx_obj_6geomag_3emm_EMMMesh;
-struct __pyx_opt_args_6geomag_3emm_7EMMMesh__compute_field_c;
-struct __pyx_opt_args_6geomag_3emm_7EMMMesh_compute_field_c;
-
-/* "geomag/emm.pyx":247
- *             self._load_c()
- * 
- *     cdef MAGtype_GeoMagneticElements _compute_field_c(self, MAGtype_CoordGeodetic pos, MAGtype_CoordSpherical cs, MAGtype_Date date, bint compute_change = False):             # <<<<<<<<<<<<<<
- *         #local variables:
- *         cdef MAGtype_MagneticResults magResults, magVariation
- */
-struct __pyx_opt_args_6geomag_3emm_7EMMMesh__compute_field_c {
-  int __pyx_n;
-  int compute_change;
-};
-
-/* "geomag/emm.pyx":267
- *         return elements
- * 
- *     cdef MAGtype_GeoMagneticElements compute_field_c(self, double lat, double lon, double height, double year, bint geodetic = True, bint compute_change = False):             # <<<<<<<<<<<<<<
- *         #local variables
- *         cdef MAGtype_Date date
- */
-struct __pyx_opt_args_6geomag_3emm_7EMMMesh_compute_field_c {
-  int __pyx_n;
-  int geodetic;
-  int compute_change;
-};
-
-/* "geomag/emm.pyx":101
- *     int EMM_PointCalcFromMesh(MAGtype_CoordGeodetic CordGeo, MAGtype_CoordSpherical CordSph, MAGtype_Date UserDate, MAGtype_MagneticResults *MagResults, EMM_tmesh mesh, EMM_tmesh mesh_SV)
- * 
- * cdef class GeoMagneticElements:             # <<<<<<<<<<<<<<
- *     """GeoMagneticElements encapsulates the geomagnetic field paramters at a location.
- *     members:
- */
-struct __pyx_obj_6geomag_3emm_GeoMagneticElements {
-  PyObject_HEAD
-  struct __pyx_vtabstruct_6geomag_3emm_GeoMagneticElements *__pyx_vtab;
-  double Decl;
-  double Incl;
-  double F;
-  double H;
-  double X;
-  double Y;
-  double Z;
-  double GV;
-  double Decldot;
-  double Incldot;
-  double Fdot;
-  double Hdot;
-  double Xdot;
-  double Ydot;
-  double Zdot;
-  double GVdot;
-};
-
-
-/* "geomag/emm.pyx":145
- *     return r*57.29577951308232
- * 
- * cdef class EMMBase:             # <<<<<<<<<<<<<<
- *     cdef MAGtype_Geoid _geoid
- *     cdef MAGtype_Ellipsoid _ellip
- */
-struct __pyx_obj_6geomag_3emm_EMMBase {
-  PyObject_HEAD
-  struct __pyx_vtabstruct_6geomag_3emm_EMMBase *__pyx_vtab;
-  MAGtype_Geoid _geoid;
-  MAGtype_Ellipsoid _ellip;
-};
-
-
-/* "geomag/emm.pyx":224
- * 
- * 
- * cdef class EMMMesh(EMMBase):             # <<<<<<<<<<<<<<
- *     """EMMMesh(str mesh_fname, str svmesh_fname, bool delay_load=False)
- *         mesh_fname: filename of EMM static mesh
- */
-struct __pyx_obj_6geomag_3emm_EMMMesh {
-  struct __pyx_obj_6geomag_3emm_EMMBase __pyx_base;
-  EMM_tmesh _mesh;
-  EMM_tmesh _mesh_sv;
-  PyObject *_mfname;
-  PyObject *_smfname;
-  int _mloaded;
-  int _smloaded;
-};
-
-
-
-/* "geomag/emm.pyx":101
- *     int EMM_PointCalcFromMesh(MAGtype_CoordGeodetic CordGeo, MAGtype_CoordSpherical CordSph, MAGtype_Date UserDate, MAGtype_MagneticResults *MagResults, EMM_tmesh mesh, EMM_tmesh mesh_SV)
- * 
- * cdef class GeoMagneticElements:             # <<<<<<<<<<<<<<
- *     """GeoMagneticElements encapsulates the geomagnetic field paramters at a location.
- *     members:
- */
-
-struct __pyx_vtabstruct_6geomag_3emm_GeoMagneticElements {
-  PyObject *(*_setup)(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *, MAGtype_GeoMagneticElements);
-};
-static struct __pyx_vtabstruct_6geomag_3emm_GeoMagneticElements *__pyx_vtabptr_6geomag_3emm_GeoMagneticElements;
-
-
-/* "geomag/emm.pyx":145
- *     return r*57.29577951308232
- * 
- * cdef class EMMBase:             # <<<<<<<<<<<<<<
- *     cdef MAGtype_Geoid _geoid
- *     cdef MAGtype_Ellipsoid _ellip
- */
-
-struct __pyx_vtabstruct_6geomag_3emm_EMMBase {
-  PyObject *(*norm_lat_lon)(struct __pyx_obj_6geomag_3emm_EMMBase *, PyObject *, PyObject *);
-  PyObject *(*_EMM_check)(int);
-};
-static struct __pyx_vtabstruct_6geomag_3emm_EMMBase *__pyx_vtabptr_6geomag_3emm_EMMBase;
-
-
-/* "geomag/emm.pyx":224
- * 
- * 
- * cdef class EMMMesh(EMMBase):             # <<<<<<<<<<<<<<
- *     """EMMMesh(str mesh_fname, str svmesh_fname, bool delay_load=False)
- *         mesh_fname: filename of EMM static mesh
- */
-
-struct __pyx_vtabstruct_6geomag_3emm_EMMMesh {
-  struct __pyx_vtabstruct_6geomag_3emm_EMMBase __pyx_base;
-  MAGtype_GeoMagneticElements (*_compute_field_c)(struct __pyx_obj_6geomag_3emm_EMMMesh *, MAGtype_CoordGeodetic, MAGtype_CoordSpherical, MAGtype_Date, struct __pyx_opt_args_6geomag_3emm_7EMMMesh__compute_field_c *__pyx_optional_args);
-  MAGtype_GeoMagneticElements (*compute_field_c)(struct __pyx_obj_6geomag_3emm_EMMMesh *, double, double, double, double, struct __pyx_opt_args_6geomag_3emm_7EMMMesh_compute_field_c *__pyx_optional_args);
-  void (*_load_c)(struct __pyx_obj_6geomag_3emm_EMMMesh *);
-};
-static struct __pyx_vtabstruct_6geomag_3emm_EMMMesh *__pyx_vtabptr_6geomag_3emm_EMMMesh;
-
-/* --- Runtime support code (head) --- */
-/* Refnanny.proto */
-#ifndef CYTHON_REFNANNY
-  #define CYTHON_REFNANNY 0
-#endif
-#if CYTHON_REFNANNY
-  typedef struct {
-    void (*INCREF)(void*, PyObject*, int);
-    void (*DECREF)(void*, PyObject*, int);
-    void (*GOTREF)(void*, PyObject*, int);
-    void (*GIVEREF)(void*, PyObject*, int);
-    void* (*SetupContext)(const char*, int, const char*);
-    void (*FinishContext)(void**);
-  } __Pyx_RefNannyAPIStruct;
-  static __Pyx_RefNannyAPIStruct *__Pyx_RefNanny = NULL;
-  static __Pyx_RefNannyAPIStruct *__Pyx_RefNannyImportAPI(const char *modname);
-  #define __Pyx_RefNannyDeclarations void *__pyx_refnanny = NULL;
-#ifdef WITH_THREAD
-  #define __Pyx_RefNannySetupContext(name, acquire_gil)\
-          if (acquire_gil) {\
-              PyGILState_STATE __pyx_gilstate_save = PyGILState_Ensure();\
-              __pyx_refnanny = __Pyx_RefNanny->SetupContext((name), __LINE__, __FILE__);\
-              PyGILState_Release(__pyx_gilstate_save);\
-          } else {\
-              __pyx_refnanny = __Pyx_RefNanny->SetupContext((name), __LINE__, __FILE__);\
-          }
-#else
-  #define __Pyx_RefNannySetupContext(name, acquire_gil)\
-          __pyx_refnanny = __Pyx_RefNanny->SetupContext((name), __LINE__, __FILE__)
-#endif
-  #define __Pyx_RefNannyFinishContext()\
-          __Pyx_RefNanny->FinishContext(&__pyx_refnanny)
-  #define __Pyx_INCREF(r)  __Pyx_RefNanny->INCREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_DECREF(r)  __Pyx_RefNanny->DECREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_GOTREF(r)  __Pyx_RefNanny->GOTREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_GIVEREF(r) __Pyx_RefNanny->GIVEREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_XINCREF(r)  do { if((r) != NULL) {__Pyx_INCREF(r); }} while(0)
-  #define __Pyx_XDECREF(r)  do { if((r) != NULL) {__Pyx_DECREF(r); }} while(0)
-  #define __Pyx_XGOTREF(r)  do { if((r) != NULL) {__Pyx_GOTREF(r); }} while(0)
-  #define __Pyx_XGIVEREF(r) do { if((r) != NULL) {__Pyx_GIVEREF(r);}} while(0)
-#else
-  #define __Pyx_RefNannyDeclarations
-  #define __Pyx_RefNannySetupContext(name, acquire_gil)
-  #define __Pyx_RefNannyFinishContext()
-  #define __Pyx_INCREF(r) Py_INCREF(r)
-  #define __Pyx_DECREF(r) Py_DECREF(r)
-  #define __Pyx_GOTREF(r)
-  #define __Pyx_GIVEREF(r)
-  #define __Pyx_XINCREF(r) Py_XINCREF(r)
-  #define __Pyx_XDECREF(r) Py_XDECREF(r)
-  #define __Pyx_XGOTREF(r)
-  #define __Pyx_XGIVEREF(r)
-#endif
-#define __Pyx_XDECREF_SET(r, v) do {\
-        PyObject *tmp = (PyObject *) r;\
-        r = v; __Pyx_XDECREF(tmp);\
-    } while (0)
-#define __Pyx_DECREF_SET(r, v) do {\
-        PyObject *tmp = (PyObject *) r;\
-        r = v; __Pyx_DECREF(tmp);\
-    } while (0)
-#define __Pyx_CLEAR(r)    do { PyObject* tmp = ((PyObject*)(r)); r = NULL; __Pyx_DECREF(tmp);} while(0)
-#define __Pyx_XCLEAR(r)   do { if((r) != NULL) {PyObject* tmp = ((PyObject*)(r)); r = NULL; __Pyx_DECREF(tmp);}} while(0)
-
-/* PyObjectGetAttrStr.proto */
-#if CYTHON_USE_TYPE_SLOTS
-static CYTHON_INLINE PyObject* __Pyx_PyObject_GetAttrStr(PyObject* obj, PyObject* attr_name) {
-    PyTypeObject* tp = Py_TYPE(obj);
-    if (likely(tp->tp_getattro))
-        return tp->tp_getattro(obj, attr_name);
-#if PY_MAJOR_VERSION < 3
-    if (likely(tp->tp_getattr))
-        return tp->tp_getattr(obj, PyString_AS_STRING(attr_name));
-#endif
-    return PyObject_GetAttr(obj, attr_name);
-}
-#else
-#define __Pyx_PyObject_GetAttrStr(o,n) PyObject_GetAttr(o,n)
-#endif
-
-/* GetBuiltinName.proto */
-static PyObject *__Pyx_GetBuiltinName(PyObject *name);
-
-/* RaiseArgTupleInvalid.proto */
-static void __Pyx_RaiseArgtupleInvalid(const char* func_name, int exact,
-    Py_ssize_t num_min, Py_ssize_t num_max, Py_ssize_t num_found);
-
-/* KeywordStringCheck.proto */
-static CYTHON_INLINE int __Pyx_CheckKeywordStrings(PyObject *kwdict, const char* function_name, int kw_allowed);
-
-/* PyObjectCall.proto */
-#if CYTHON_COMPILING_IN_CPYTHON
-static CYTHON_INLINE PyObject* __Pyx_PyObject_Call(PyObject *func, PyObject *arg, PyObject *kw);
-#else
-#define __Pyx_PyObject_Call(func, arg, kw) PyObject_Call(func, arg, kw)
-#endif
-
-/* PyThreadStateGet.proto */
-#if CYTHON_FAST_THREAD_STATE
-#define __Pyx_PyThreadState_declare  PyThreadState *__pyx_tstate;
-#define __Pyx_PyThreadState_assign  __pyx_tstate = PyThreadState_GET();
-#else
-#define __Pyx_PyThreadState_declare
-#define __Pyx_PyThreadState_assign
-#endif
-
-/* PyErrFetchRestore.proto */
-#if CYTHON_FAST_THREAD_STATE
-#define __Pyx_ErrRestoreWithState(type, value, tb)  __Pyx_ErrRestoreInState(PyThreadState_GET(), type, value, tb)
-#define __Pyx_ErrFetchWithState(type, value, tb)    __Pyx_ErrFetchInState(PyThreadState_GET(), type, value, tb)
-#define __Pyx_ErrRestore(type, value, tb)  __Pyx_ErrRestoreInState(__pyx_tstate, type, value, tb)
-#define __Pyx_ErrFetch(type, value, tb)    __Pyx_ErrFetchInState(__pyx_tstate, type, value, tb)
-static CYTHON_INLINE void __Pyx_ErrRestoreInState(PyThreadState *tstate, PyObject *type, PyObject *value, PyObject *tb);
-static CYTHON_INLINE void __Pyx_ErrFetchInState(PyThreadState *tstate, PyObject **type, PyObject **value, PyObject **tb);
-#else
-#define __Pyx_ErrRestoreWithState(type, value, tb)  PyErr_Restore(type, value, tb)
-#define __Pyx_ErrFetchWithState(type, value, tb)  PyErr_Fetch(type, value, tb)
-#define __Pyx_ErrRestore(type, value, tb)  PyErr_Restore(type, value, tb)
-#define __Pyx_ErrFetch(type, value, tb)  PyErr_Fetch(type, value, tb)
-#endif
-
-/* RaiseException.proto */
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb, PyObject *cause);
-
-/* None.proto */
-static CYTHON_INLINE double __Pyx_mod_double(double, double);
-
-/* PyIntBinop.proto */
-#if !CYTHON_COMPILING_IN_PYPY
-static PyObject* __Pyx_PyInt_RemainderObjC(PyObject *op1, PyObject *op2, long intval, int inplace);
-#else
-#define __Pyx_PyInt_RemainderObjC(op1, op2, intval, inplace)\
-    (inplace ? PyNumber_InPlaceRemainder(op1, op2) : PyNumber_Remainder(op1, op2))
-#endif
-
-/* GetAttr.proto */
-static CYTHON_INLINE PyObject *__Pyx_GetAttr(PyObject *, PyObject *);
-
-/* HasAttr.proto */
-static CYTHON_INLINE int __Pyx_HasAttr(PyObject *, PyObject *);
-
-/* PyCFunctionFastCall.proto */
-#if CYTHON_FAST_PYCCALL
-static CYTHON_INLINE PyObject *__Pyx_PyCFunction_FastCall(PyObject *func, PyObject **args, Py_ssize_t nargs);
-#else
-#define __Pyx_PyCFunction_FastCall(func, args, nargs)  (assert(0), NULL)
-#endif
-
-/* PyFunctionFastCall.proto */
-#if CYTHON_FAST_PYCALL
-#define __Pyx_PyFunction_FastCall(func, args, nargs)\
-    __Pyx_PyFunction_FastCallDict((func), (args), (nargs), NULL)
-#if 1 || PY_VERSION_HEX < 0x030600B1
-static PyObject *__Pyx_PyFunction_FastCallDict(PyObject *func, PyObject **args, int nargs, PyObject *kwargs);
-#else
-#define __Pyx_PyFunction_FastCallDict(func, args, nargs, kwargs) _PyFunction_FastCallDict(func, args, nargs, kwargs)
-#endif
-#endif
-
-/* PyObjectCallMethO.proto */
-#if CYTHON_COMPILING_IN_CPYTHON
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallMethO(PyObject *func, PyObject *arg);
-#endif
-
-/* PyObjectCallOneArg.proto */
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallOneArg(PyObject *func, PyObject *arg);
-
-/* PyObjectCallNoArg.proto */
-#if CYTHON_COMPILING_IN_CPYTHON
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallNoArg(PyObject *func);
-#else
-#define __Pyx_PyObject_CallNoArg(func) __Pyx_PyObject_Call(func, __pyx_empty_tuple, NULL)
-#endif
-
-/* GetModuleGlobalName.proto */
-static CYTHON_INLINE PyObject *__Pyx_GetModuleGlobalName(PyObject *name);
-
-/* PyIntBinop.proto */
-#if !CYTHON_COMPILING_IN_PYPY
-static PyObject* __Pyx_PyInt_SubtractObjC(PyObject *op1, PyObject *op2, long intval, int inplace);
-#else
-#define __Pyx_PyInt_SubtractObjC(op1, op2, intval, inplace)\
-    (inplace ? PyNumber_InPlaceSubtract(op1, op2) : PyNumber_Subtract(op1, op2))
-#endif
-
-/* RaiseDoubleKeywords.proto */
-static void __Pyx_RaiseDoubleKeywordsError(const char* func_name, PyObject* kw_name);
-
-/* ParseKeywords.proto */
-static int __Pyx_ParseOptionalKeywords(PyObject *kwds, PyObject **argnames[],\
-    PyObject *kwds2, PyObject *values[], Py_ssize_t num_pos_args,\
-    const char* function_name);
-
-/* ArgTypeTest.proto */
-static CYTHON_INLINE int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact);
-
-/* WriteUnraisableException.proto */
-static void __Pyx_WriteUnraisable(const char *name, int clineno,
-                                  int lineno, const char *filename,
-                                  int full_traceback, int nogil);
-
-/* RaiseTooManyValuesToUnpack.proto */
-static CYTHON_INLINE void __Pyx_RaiseTooManyValuesError(Py_ssize_t expected);
-
-/* RaiseNeedMoreValuesToUnpack.proto */
-static CYTHON_INLINE void __Pyx_RaiseNeedMoreValuesError(Py_ssize_t index);
-
-/* RaiseNoneIterError.proto */
-static CYTHON_INLINE void __Pyx_RaiseNoneNotIterableError(void);
-
-/* SetVTable.proto */
-static int __Pyx_SetVtable(PyObject *dict, void *vtable);
-
-/* SetupReduce.proto */
-static int __Pyx_setup_reduce(PyObject* type_obj);
-
-/* Import.proto */
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list, int level);
-
-/* ImportFrom.proto */
-static PyObject* __Pyx_ImportFrom(PyObject* module, PyObject* name);
-
-/* GetNameInClass.proto */
-static PyObject *__Pyx_GetNameInClass(PyObject *nmspace, PyObject *name);
-
-/* CLineInTraceback.proto */
-static int __Pyx_CLineForTraceback(int c_line);
-
-/* CodeObjectCache.proto */
-typedef struct {
-    PyCodeObject* code_object;
-    int code_line;
-} __Pyx_CodeObjectCacheEntry;
-struct __Pyx_CodeObjectCache {
-    int count;
-    int max_count;
-    __Pyx_CodeObjectCacheEntry* entries;
-};
-static struct __Pyx_CodeObjectCache __pyx_code_cache = {0,0,NULL};
-static int __pyx_bisect_code_objects(__Pyx_CodeObjectCacheEntry* entries, int count, int code_line);
-static PyCodeObject *__pyx_find_code_object(int code_line);
-static void __pyx_insert_code_object(int code_line, PyCodeObject* code_object);
-
-/* AddTraceback.proto */
-static void __Pyx_AddTraceback(const char *funcname, int c_line,
-                               int py_line, const char *filename);
-
-/* CIntToPy.proto */
-static CYTHON_INLINE PyObject* __Pyx_PyInt_From_long(long value);
-
-/* CIntFromPy.proto */
-static CYTHON_INLINE long __Pyx_PyInt_As_long(PyObject *);
-
-/* CIntFromPy.proto */
-static CYTHON_INLINE int __Pyx_PyInt_As_int(PyObject *);
-
-/* CheckBinaryVersion.proto */
-static int __Pyx_check_binary_version(void);
-
-/* InitStrings.proto */
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t);
-
-static PyObject *__pyx_f_6geomag_3emm_19GeoMagneticElements__setup(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, MAGtype_GeoMagneticElements __pyx_v_elements); /* proto*/
-static PyObject *__pyx_f_6geomag_3emm_7EMMBase_norm_lat_lon(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMBase *__pyx_v_self, PyObject *__pyx_v_lat, PyObject *__pyx_v_lon); /* proto*/
-static PyObject *__pyx_f_6geomag_3emm_7EMMBase__EMM_check(int __pyx_v_err); /* proto*/
-static MAGtype_GeoMagneticElements __pyx_f_6geomag_3emm_7EMMMesh__compute_field_c(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, MAGtype_CoordGeodetic __pyx_v_pos, MAGtype_CoordSpherical __pyx_v_cs, MAGtype_Date __pyx_v_date, struct __pyx_opt_args_6geomag_3emm_7EMMMesh__compute_field_c *__pyx_optional_args); /* proto*/
-static MAGtype_GeoMagneticElements __pyx_f_6geomag_3emm_7EMMMesh_compute_field_c(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, double __pyx_v_lat, double __pyx_v_lon, double __pyx_v_height, double __pyx_v_year, struct __pyx_opt_args_6geomag_3emm_7EMMMesh_compute_field_c *__pyx_optional_args); /* proto*/
-static void __pyx_f_6geomag_3emm_7EMMMesh__load_c(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self); /* proto*/
-
-/* Module declarations from 'libc.math' */
-
-/* Module declarations from 'geomag.emm' */
-static PyTypeObject *__pyx_ptype_6geomag_3emm_GeoMagneticElements = 0;
-static PyTypeObject *__pyx_ptype_6geomag_3emm_EMMBase = 0;
-static PyTypeObject *__pyx_ptype_6geomag_3emm_EMMMesh = 0;
-static double __pyx_f_6geomag_3emm_d2r(double); /*proto*/
-static double __pyx_f_6geomag_3emm_r2d(double); /*proto*/
-#define __Pyx_MODULE_NAME "geomag.emm"
-int __pyx_module_is_main_geomag__emm = 0;
-
-/* Implementation of 'geomag.emm' */
-static PyObject *__pyx_builtin_staticmethod;
-static PyObject *__pyx_builtin_TypeError;
-static PyObject *__pyx_builtin_RuntimeError;
-static PyObject *__pyx_builtin_MemoryError;
-static const char __pyx_k_os[] = "os";
-static const char __pyx_k_lat[] = "lat";
-static const char __pyx_k_lon[] = "lon";
-static const char __pyx_k_Decl[] = "Decl";
-static const char __pyx_k_head[] = "head";
-static const char __pyx_k_main[] = "__main__";
-static const char __pyx_k_mesh[] = "mesh";
-static const char __pyx_k_name[] = "__name__";
-static const char __pyx_k_path[] = "path";
-static const char __pyx_k_test[] = "__test__";
-static const char __pyx_k_time[] = "time";
-static const char __pyx_k_year[] = "year";
-static const char __pyx_k_UTF_8[] = "UTF-8";
-static const char __pyx_k_bibtex[] = "bibtex";
-static const char __pyx_k_gmtime[] = "gmtime";
-static const char __pyx_k_height[] = "height";
-static const char __pyx_k_import[] = "__import__";
-static const char __pyx_k_reduce[] = "__reduce__";
-static const char __pyx_k_emm_pyx[] = "emm.pyx";
-static const char __pyx_k_secmesh[] = "secmesh";
-static const char __pyx_k_tm_yday[] = "tm_yday";
-static const char __pyx_k_tm_year[] = "tm_year";
-static const char __pyx_k_citation[] = "citation";
-static const char __pyx_k_geodetic[] = "geodetic";
-static const char __pyx_k_getstate[] = "__getstate__";
-static const char __pyx_k_setstate[] = "__setstate__";
-static const char __pyx_k_TypeError[] = "TypeError";
-static const char __pyx_k_reduce_ex[] = "__reduce_ex__";
-static const char __pyx_k_timetuple[] = "timetuple";
-static const char __pyx_k_delay_load[] = "delay_load";
-static const char __pyx_k_geomag_emm[] = "geomag.emm";
-static const char __pyx_k_mesh_fname[] = "mesh_fname";
-static const char __pyx_k_pyx_vtable[] = "__pyx_vtable__";
-static const char __pyx_k_MemoryError[] = "MemoryError";
-static const char __pyx_k_declination[] = "declination";
-static const char __pyx_k_RuntimeError[] = "RuntimeError";
-static const char __pyx_k_staticmethod[] = "staticmethod";
-static const char __pyx_k_compute_field[] = "compute_field";
-static const char __pyx_k_reduce_cython[] = "__reduce_cython__";
-static const char __pyx_k_secmesh_fname[] = "secmesh_fname";
-static const char __pyx_k_compute_change[] = "compute_change";
-static const char __pyx_k_setstate_cython[] = "__setstate_cython__";
-static const char __pyx_k_File_format_error[] = "File format error.";
-static const char __pyx_k_cline_in_traceback[] = "cline_in_traceback";
-static const char __pyx_k_Text_file_not_found[] = "Text file not found.";
-static const char __pyx_k_Binary_file_not_found[] = "Binary file not found.";
-static const char __pyx_k_Binary_file_write_error[] = "Binary file write error.";
-static const char __pyx_k_Error_setting_default_ellipsoid[] = "Error setting default ellipsoid and geoid parameters.";
-static const char __pyx_k_File_epoch_error_Model_year_out[] = "File epoch error (Model year out of range)";
-static const char __pyx_k_article_RN121_author_Chulliat_A[] = "@article{RN121,\n    author = {Chulliat, A and Alken, P and Nair, M and Woods, A and Maus, S},\n    title = {The Enhanced Magnetic Model 2015-2020},\n    journal = {National Centers for Environmental Information, NOAA},\n    DOI = {10.7289/V56971HV},\n    year = {2015},\n    type = {Journal Article}\n}";
-static const char __pyx_k_Chulliat_A_P_Alken_M_Nair_A_Wood[] = "Chulliat, A., P. Alken, M. Nair, A. Woods, and S. Maus, 2015, The Enhanced Magnetic Model 2015-2020, National Centers for Environmental Information, NOAA. doi: 10.7289/V56971HV.";
-static const char __pyx_k_File_error_altitude_out_of_range[] = "File error: altitude out of range.";
-static const char __pyx_k_File_error_number_of_altitude_la[] = "File error: number of altitude layers out of range.";
-static const char __pyx_k_File_error_number_of_latitude_ro[] = "File error: number of latitude rows out of range.";
-static const char __pyx_k_File_error_number_of_longitude_c[] = "File error: number of longitude cells at latitude and altitude out of range.";
-static const char __pyx_k_no_default___reduce___due_to_non[] = "no default __reduce__ due to non-trivial __cinit__";
-static PyObject *__pyx_kp_s_Binary_file_not_found;
-static PyObject *__pyx_kp_s_Binary_file_write_error;
-static PyObject *__pyx_kp_s_Chulliat_A_P_Alken_M_Nair_A_Wood;
-static PyObject *__pyx_n_s_Decl;
-static PyObject *__pyx_kp_s_Error_setting_default_ellipsoid;
-static PyObject *__pyx_kp_s_File_epoch_error_Model_year_out;
-static PyObject *__pyx_kp_s_File_error_altitude_out_of_range;
-static PyObject *__pyx_kp_s_File_error_number_of_altitude_la;
-static PyObject *__pyx_kp_s_File_error_number_of_latitude_ro;
-static PyObject *__pyx_kp_s_File_error_number_of_longitude_c;
-static PyObject *__pyx_kp_s_File_format_error;
-static PyObject *__pyx_n_s_MemoryError;
-static PyObject *__pyx_n_s_RuntimeError;
-static PyObject *__pyx_kp_s_Text_file_not_found;
-static PyObject *__pyx_n_s_TypeError;
-static PyObject *__pyx_kp_s_UTF_8;
-static PyObject *__pyx_kp_s_article_RN121_author_Chulliat_A;
-static PyObject *__pyx_n_s_bibtex;
-static PyObject *__pyx_n_s_citation;
-static PyObject *__pyx_n_s_cline_in_traceback;
-static PyObject *__pyx_n_s_compute_change;
-static PyObject *__pyx_n_s_compute_field;
-static PyObject *__pyx_n_s_declination;
-static PyObject *__pyx_n_s_delay_load;
-static PyObject *__pyx_kp_s_emm_pyx;
-static PyObject *__pyx_n_s_geodetic;
-static PyObject *__pyx_n_s_geomag_emm;
-static PyObject *__pyx_n_s_getstate;
-static PyObject *__pyx_n_s_gmtime;
-static PyObject *__pyx_n_s_head;
-static PyObject *__pyx_n_s_height;
-static PyObject *__pyx_n_s_import;
-static PyObject *__pyx_n_s_lat;
-static PyObject *__pyx_n_s_lon;
-static PyObject *__pyx_n_s_main;
-static PyObject *__pyx_n_s_mesh;
-static PyObject *__pyx_n_s_mesh_fname;
-static PyObject *__pyx_n_s_name;
-static PyObject *__pyx_kp_s_no_default___reduce___due_to_non;
-static PyObject *__pyx_n_s_os;
-static PyObject *__pyx_n_s_path;
-static PyObject *__pyx_n_s_pyx_vtable;
-static PyObject *__pyx_n_s_reduce;
-static PyObject *__pyx_n_s_reduce_cython;
-static PyObject *__pyx_n_s_reduce_ex;
-static PyObject *__pyx_n_s_secmesh;
-static PyObject *__pyx_n_s_secmesh_fname;
-static PyObject *__pyx_n_s_setstate;
-static PyObject *__pyx_n_s_setstate_cython;
-static PyObject *__pyx_n_s_staticmethod;
-static PyObject *__pyx_n_s_test;
-static PyObject *__pyx_n_s_time;
-static PyObject *__pyx_n_s_timetuple;
-static PyObject *__pyx_n_s_tm_yday;
-static PyObject *__pyx_n_s_tm_year;
-static PyObject *__pyx_n_s_year;
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements___cinit__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Decl___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Decl_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Incl___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Incl_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_1F___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_1F_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_1H___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_1H_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_1X___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_1X_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_1Y___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_1Y_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_1Z___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_1Z_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_2GV___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_2GV_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_7Decldot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_7Decldot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_7Incldot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_7Incldot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Fdot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Fdot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Hdot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Hdot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Xdot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Xdot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Ydot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Ydot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Zdot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Zdot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_5GVdot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_5GVdot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_2__reduce_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4__setstate_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, CYTHON_UNUSED PyObject *__pyx_v___pyx_state); /* proto */
-static int __pyx_pf_6geomag_3emm_7EMMBase___cinit__(struct __pyx_obj_6geomag_3emm_EMMBase *__pyx_v_self); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMBase_2citation(); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMBase_4bibtex(); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMBase_6decimal_year(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMBase *__pyx_v_self, PyObject *__pyx_v_t); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMBase_8__reduce_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMBase *__pyx_v_self); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMBase_10__setstate_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMBase *__pyx_v_self, CYTHON_UNUSED PyObject *__pyx_v___pyx_state); /* proto */
-static int __pyx_pf_6geomag_3emm_7EMMMesh___cinit__(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_mesh_fname, PyObject *__pyx_v_secmesh_fname, int __pyx_v_delay_load); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_2load(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_mesh, PyObject *__pyx_v_secmesh); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_4is_loaded(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_6compute_field(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_lat, PyObject *__pyx_v_lon, PyObject *__pyx_v_height, PyObject *__pyx_v_year, PyObject *__pyx_v_geodetic, PyObject *__pyx_v_compute_change); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_8declination(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_lat, PyObject *__pyx_v_lon, PyObject *__pyx_v_height, PyObject *__pyx_v_year, PyObject *__pyx_v_geodetic); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_10true_to_magnetic(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_head, PyObject *__pyx_v_lat, PyObject *__pyx_v_lon, PyObject *__pyx_v_height, PyObject *__pyx_v_year, PyObject *__pyx_v_geodetic); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_12magnetic_to_true(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_head, PyObject *__pyx_v_lat, PyObject *__pyx_v_lon, PyObject *__pyx_v_height, PyObject *__pyx_v_year, PyObject *__pyx_v_geodetic); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_14__reduce_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self); /* proto */
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_16__setstate_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, CYTHON_UNUSED PyObject *__pyx_v___pyx_state); /* proto */
-static PyObject *__pyx_tp_new_6geomag_3emm_GeoMagneticElements(PyTypeObject *t, PyObject *a, PyObject *k); /*proto*/
-static PyObject *__pyx_tp_new_6geomag_3emm_EMMBase(PyTypeObject *t, PyObject *a, PyObject *k); /*proto*/
-static PyObject *__pyx_tp_new_6geomag_3emm_EMMMesh(PyTypeObject *t, PyObject *a, PyObject *k); /*proto*/
-static PyObject *__pyx_int_0;
-static PyObject *__pyx_int_1;
-static PyObject *__pyx_int_90;
-static PyObject *__pyx_int_360;
-static PyObject *__pyx_int_365;
-static PyObject *__pyx_int_neg_90;
-static PyObject *__pyx_tuple_;
-static PyObject *__pyx_tuple__2;
-static PyObject *__pyx_tuple__3;
-static PyObject *__pyx_tuple__4;
-static PyObject *__pyx_tuple__5;
-static PyObject *__pyx_tuple__6;
-static PyObject *__pyx_tuple__7;
-static PyObject *__pyx_tuple__8;
-static PyObject *__pyx_tuple__9;
-static PyObject *__pyx_tuple__10;
-static PyObject *__pyx_tuple__11;
-static PyObject *__pyx_tuple__12;
-static PyObject *__pyx_tuple__13;
-static PyObject *__pyx_tuple__14;
-static PyObject *__pyx_tuple__15;
-static PyObject *__pyx_tuple__16;
-static PyObject *__pyx_codeobj__17;
-static PyObject *__pyx_codeobj__18;
-
-/* "geomag/emm.pyx":115
- *     """
- *     cdef public double Decl, Incl, F, H, X, Y, Z, GV, Decldot, Incldot, Fdot, Hdot, Xdot, Ydot, Zdot, GVdot
- *     def __cinit__(self):             # <<<<<<<<<<<<<<
- *         Decl = Incl = F = H = X = Y = Z = GV = Decldot = Incldot = Fdot = Hdot = Xdot = Ydot = Zdot = GVdot = 0
- * 
- */
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1__cinit__(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1__cinit__(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__cinit__ (wrapper)", 0);
-  if (unlikely(PyTuple_GET_SIZE(__pyx_args) > 0)) {
-    __Pyx_RaiseArgtupleInvalid("__cinit__", 1, 0, 0, PyTuple_GET_SIZE(__pyx_args)); return -1;}
-  if (unlikely(__pyx_kwds) && unlikely(PyDict_Size(__pyx_kwds) > 0) && unlikely(!__Pyx_CheckKeywordStrings(__pyx_kwds, "__cinit__", 0))) return -1;
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements___cinit__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements___cinit__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  CYTHON_UNUSED long __pyx_v_Decl;
-  CYTHON_UNUSED long __pyx_v_Incl;
-  CYTHON_UNUSED long __pyx_v_F;
-  CYTHON_UNUSED long __pyx_v_H;
-  CYTHON_UNUSED long __pyx_v_X;
-  CYTHON_UNUSED long __pyx_v_Y;
-  CYTHON_UNUSED long __pyx_v_Z;
-  CYTHON_UNUSED long __pyx_v_GV;
-  CYTHON_UNUSED long __pyx_v_Decldot;
-  CYTHON_UNUSED long __pyx_v_Incldot;
-  CYTHON_UNUSED long __pyx_v_Fdot;
-  CYTHON_UNUSED long __pyx_v_Hdot;
-  CYTHON_UNUSED long __pyx_v_Xdot;
-  CYTHON_UNUSED long __pyx_v_Ydot;
-  CYTHON_UNUSED long __pyx_v_Zdot;
-  CYTHON_UNUSED long __pyx_v_GVdot;
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__cinit__", 0);
-
-  /* "geomag/emm.pyx":116
- *     cdef public double Decl, Incl, F, H, X, Y, Z, GV, Decldot, Incldot, Fdot, Hdot, Xdot, Ydot, Zdot, GVdot
- *     def __cinit__(self):
- *         Decl = Incl = F = H = X = Y = Z = GV = Decldot = Incldot = Fdot = Hdot = Xdot = Ydot = Zdot = GVdot = 0             # <<<<<<<<<<<<<<
- * 
- *     cdef _setup(self, MAGtype_GeoMagneticElements elements):
- */
-  __pyx_v_Decl = 0;
-  __pyx_v_Incl = 0;
-  __pyx_v_F = 0;
-  __pyx_v_H = 0;
-  __pyx_v_X = 0;
-  __pyx_v_Y = 0;
-  __pyx_v_Z = 0;
-  __pyx_v_GV = 0;
-  __pyx_v_Decldot = 0;
-  __pyx_v_Incldot = 0;
-  __pyx_v_Fdot = 0;
-  __pyx_v_Hdot = 0;
-  __pyx_v_Xdot = 0;
-  __pyx_v_Ydot = 0;
-  __pyx_v_Zdot = 0;
-  __pyx_v_GVdot = 0;
-
-  /* "geomag/emm.pyx":115
- *     """
- *     cdef public double Decl, Incl, F, H, X, Y, Z, GV, Decldot, Incldot, Fdot, Hdot, Xdot, Ydot, Zdot, GVdot
- *     def __cinit__(self):             # <<<<<<<<<<<<<<
- *         Decl = Incl = F = H = X = Y = Z = GV = Decldot = Incldot = Fdot = Hdot = Xdot = Ydot = Zdot = GVdot = 0
- * 
- */
-
-  /* function exit code */
-  __pyx_r = 0;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":118
- *         Decl = Incl = F = H = X = Y = Z = GV = Decldot = Incldot = Fdot = Hdot = Xdot = Ydot = Zdot = GVdot = 0
- * 
- *     cdef _setup(self, MAGtype_GeoMagneticElements elements):             # <<<<<<<<<<<<<<
- *         self.Decl = elements.Decl
- *         self.Incl = elements.Incl
- */
-
-static PyObject *__pyx_f_6geomag_3emm_19GeoMagneticElements__setup(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, MAGtype_GeoMagneticElements __pyx_v_elements) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("_setup", 0);
-
-  /* "geomag/emm.pyx":119
- * 
- *     cdef _setup(self, MAGtype_GeoMagneticElements elements):
- *         self.Decl = elements.Decl             # <<<<<<<<<<<<<<
- *         self.Incl = elements.Incl
- *         self.F = elements.F
- */
-  __pyx_t_1 = __pyx_v_elements.Decl;
-  __pyx_v_self->Decl = __pyx_t_1;
-
-  /* "geomag/emm.pyx":120
- *     cdef _setup(self, MAGtype_GeoMagneticElements elements):
- *         self.Decl = elements.Decl
- *         self.Incl = elements.Incl             # <<<<<<<<<<<<<<
- *         self.F = elements.F
- *         self.H = elements.H
- */
-  __pyx_t_1 = __pyx_v_elements.Incl;
-  __pyx_v_self->Incl = __pyx_t_1;
-
-  /* "geomag/emm.pyx":121
- *         self.Decl = elements.Decl
- *         self.Incl = elements.Incl
- *         self.F = elements.F             # <<<<<<<<<<<<<<
- *         self.H = elements.H
- *         self.X = elements.X
- */
-  __pyx_t_1 = __pyx_v_elements.F;
-  __pyx_v_self->F = __pyx_t_1;
-
-  /* "geomag/emm.pyx":122
- *         self.Incl = elements.Incl
- *         self.F = elements.F
- *         self.H = elements.H             # <<<<<<<<<<<<<<
- *         self.X = elements.X
- *         self.Y = elements.Y
- */
-  __pyx_t_1 = __pyx_v_elements.H;
-  __pyx_v_self->H = __pyx_t_1;
-
-  /* "geomag/emm.pyx":123
- *         self.F = elements.F
- *         self.H = elements.H
- *         self.X = elements.X             # <<<<<<<<<<<<<<
- *         self.Y = elements.Y
- *         self.Z = elements.Z
- */
-  __pyx_t_1 = __pyx_v_elements.X;
-  __pyx_v_self->X = __pyx_t_1;
-
-  /* "geomag/emm.pyx":124
- *         self.H = elements.H
- *         self.X = elements.X
- *         self.Y = elements.Y             # <<<<<<<<<<<<<<
- *         self.Z = elements.Z
- *         self.GV = elements.GV
- */
-  __pyx_t_1 = __pyx_v_elements.Y;
-  __pyx_v_self->Y = __pyx_t_1;
-
-  /* "geomag/emm.pyx":125
- *         self.X = elements.X
- *         self.Y = elements.Y
- *         self.Z = elements.Z             # <<<<<<<<<<<<<<
- *         self.GV = elements.GV
- *         self.Decldot = elements.Decldot
- */
-  __pyx_t_1 = __pyx_v_elements.Z;
-  __pyx_v_self->Z = __pyx_t_1;
-
-  /* "geomag/emm.pyx":126
- *         self.Y = elements.Y
- *         self.Z = elements.Z
- *         self.GV = elements.GV             # <<<<<<<<<<<<<<
- *         self.Decldot = elements.Decldot
- *         self.Incldot = elements.Incldot
- */
-  __pyx_t_1 = __pyx_v_elements.GV;
-  __pyx_v_self->GV = __pyx_t_1;
-
-  /* "geomag/emm.pyx":127
- *         self.Z = elements.Z
- *         self.GV = elements.GV
- *         self.Decldot = elements.Decldot             # <<<<<<<<<<<<<<
- *         self.Incldot = elements.Incldot
- *         self.Fdot = elements.Fdot
- */
-  __pyx_t_1 = __pyx_v_elements.Decldot;
-  __pyx_v_self->Decldot = __pyx_t_1;
-
-  /* "geomag/emm.pyx":128
- *         self.GV = elements.GV
- *         self.Decldot = elements.Decldot
- *         self.Incldot = elements.Incldot             # <<<<<<<<<<<<<<
- *         self.Fdot = elements.Fdot
- *         self.Hdot = elements.Hdot
- */
-  __pyx_t_1 = __pyx_v_elements.Incldot;
-  __pyx_v_self->Incldot = __pyx_t_1;
-
-  /* "geomag/emm.pyx":129
- *         self.Decldot = elements.Decldot
- *         self.Incldot = elements.Incldot
- *         self.Fdot = elements.Fdot             # <<<<<<<<<<<<<<
- *         self.Hdot = elements.Hdot
- *         self.Xdot = elements.Xdot
- */
-  __pyx_t_1 = __pyx_v_elements.Fdot;
-  __pyx_v_self->Fdot = __pyx_t_1;
-
-  /* "geomag/emm.pyx":130
- *         self.Incldot = elements.Incldot
- *         self.Fdot = elements.Fdot
- *         self.Hdot = elements.Hdot             # <<<<<<<<<<<<<<
- *         self.Xdot = elements.Xdot
- *         self.Ydot = elements.Ydot
- */
-  __pyx_t_1 = __pyx_v_elements.Hdot;
-  __pyx_v_self->Hdot = __pyx_t_1;
-
-  /* "geomag/emm.pyx":131
- *         self.Fdot = elements.Fdot
- *         self.Hdot = elements.Hdot
- *         self.Xdot = elements.Xdot             # <<<<<<<<<<<<<<
- *         self.Ydot = elements.Ydot
- *         self.Zdot = elements.Zdot
- */
-  __pyx_t_1 = __pyx_v_elements.Xdot;
-  __pyx_v_self->Xdot = __pyx_t_1;
-
-  /* "geomag/emm.pyx":132
- *         self.Hdot = elements.Hdot
- *         self.Xdot = elements.Xdot
- *         self.Ydot = elements.Ydot             # <<<<<<<<<<<<<<
- *         self.Zdot = elements.Zdot
- *         self.GVdot = elements.GVdot
- */
-  __pyx_t_1 = __pyx_v_elements.Ydot;
-  __pyx_v_self->Ydot = __pyx_t_1;
-
-  /* "geomag/emm.pyx":133
- *         self.Xdot = elements.Xdot
- *         self.Ydot = elements.Ydot
- *         self.Zdot = elements.Zdot             # <<<<<<<<<<<<<<
- *         self.GVdot = elements.GVdot
- * 
- */
-  __pyx_t_1 = __pyx_v_elements.Zdot;
-  __pyx_v_self->Zdot = __pyx_t_1;
-
-  /* "geomag/emm.pyx":134
- *         self.Ydot = elements.Ydot
- *         self.Zdot = elements.Zdot
- *         self.GVdot = elements.GVdot             # <<<<<<<<<<<<<<
- * 
- * from libc.math cimport cos, sin, sqrt, atan2, asin
- */
-  __pyx_t_1 = __pyx_v_elements.GVdot;
-  __pyx_v_self->GVdot = __pyx_t_1;
-
-  /* "geomag/emm.pyx":118
- *         Decl = Incl = F = H = X = Y = Z = GV = Decldot = Incldot = Fdot = Hdot = Xdot = Ydot = Zdot = GVdot = 0
- * 
- *     cdef _setup(self, MAGtype_GeoMagneticElements elements):             # <<<<<<<<<<<<<<
- *         self.Decl = elements.Decl
- *         self.Incl = elements.Incl
- */
-
-  /* function exit code */
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":114
- *       Decldot, Incldot, Fdot, Hdot, Xdot, Ydot, Zdot, and GVdot: the change per year of each of the above.
- *     """
- *     cdef public double Decl, Incl, F, H, X, Y, Z, GV, Decldot, Incldot, Fdot, Hdot, Xdot, Ydot, Zdot, GVdot             # <<<<<<<<<<<<<<
- *     def __cinit__(self):
- *         Decl = Incl = F = H = X = Y = Z = GV = Decldot = Incldot = Fdot = Hdot = Xdot = Ydot = Zdot = GVdot = 0
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Decl_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Decl_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Decl___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Decl___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->Decl); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Decl.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Decl_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Decl_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Decl_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Decl_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->Decl = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Decl.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Incl_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Incl_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Incl___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Incl___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->Incl); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Incl.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Incl_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Incl_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Incl_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Incl_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->Incl = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Incl.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_1F_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_1F_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_1F___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_1F___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->F); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.F.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1F_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1F_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_1F_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_1F_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->F = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.F.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_1H_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_1H_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_1H___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_1H___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->H); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.H.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1H_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1H_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_1H_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_1H_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->H = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.H.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_1X_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_1X_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_1X___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_1X___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->X); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.X.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1X_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1X_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_1X_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_1X_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->X = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.X.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_1Y_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_1Y_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_1Y___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_1Y___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->Y); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Y.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1Y_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1Y_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_1Y_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_1Y_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->Y = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Y.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_1Z_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_1Z_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_1Z___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_1Z___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->Z); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Z.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1Z_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_1Z_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_1Z_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_1Z_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->Z = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Z.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_2GV_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_2GV_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_2GV___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_2GV___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->GV); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.GV.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_2GV_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_2GV_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_2GV_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_2GV_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->GV = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.GV.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_7Decldot_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_7Decldot_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_7Decldot___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_7Decldot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->Decldot); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Decldot.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_7Decldot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_7Decldot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_7Decldot_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_7Decldot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->Decldot = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Decldot.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_7Incldot_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_7Incldot_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_7Incldot___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_7Incldot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->Incldot); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Incldot.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_7Incldot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_7Incldot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_7Incldot_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_7Incldot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->Incldot = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Incldot.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Fdot_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Fdot_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Fdot___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Fdot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->Fdot); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Fdot.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Fdot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Fdot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Fdot_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Fdot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->Fdot = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Fdot.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Hdot_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Hdot_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Hdot___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Hdot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->Hdot); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Hdot.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Hdot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Hdot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Hdot_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Hdot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->Hdot = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Hdot.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Xdot_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Xdot_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Xdot___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Xdot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->Xdot); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Xdot.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Xdot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Xdot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Xdot_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Xdot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->Xdot = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Xdot.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Ydot_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Ydot_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Ydot___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Ydot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->Ydot); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Ydot.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Ydot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Ydot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Ydot_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Ydot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->Ydot = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Ydot.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Zdot_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_4Zdot_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Zdot___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4Zdot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->Zdot); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Zdot.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Zdot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Zdot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Zdot_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_4Zdot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->Zdot = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.Zdot.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_5GVdot_1__get__(PyObject *__pyx_v_self); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_5GVdot_1__get__(PyObject *__pyx_v_self) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__get__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_5GVdot___get__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_5GVdot___get__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__get__", 0);
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_self->GVdot); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 114, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.GVdot.__get__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_5GVdot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value); /*proto*/
-static int __pyx_pw_6geomag_3emm_19GeoMagneticElements_5GVdot_3__set__(PyObject *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__set__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_5GVdot_2__set__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v_value));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_19GeoMagneticElements_5GVdot_2__set__(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, PyObject *__pyx_v_value) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  double __pyx_t_1;
-  __Pyx_RefNannySetupContext("__set__", 0);
-  __pyx_t_1 = __pyx_PyFloat_AsDouble(__pyx_v_value); if (unlikely((__pyx_t_1 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 114, __pyx_L1_error)
-  __pyx_v_self->GVdot = __pyx_t_1;
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.GVdot.__set__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "(tree fragment)":1
- * def __reduce_cython__(self):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_3__reduce_cython__(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_3__reduce_cython__(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__reduce_cython__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_2__reduce_cython__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_2__reduce_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__reduce_cython__", 0);
-
-  /* "(tree fragment)":2
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-  __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_TypeError, __pyx_tuple_, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(1, 2, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __PYX_ERR(1, 2, __pyx_L1_error)
-
-  /* "(tree fragment)":1
- * def __reduce_cython__(self):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.__reduce_cython__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "(tree fragment)":3
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_5__setstate_cython__(PyObject *__pyx_v_self, PyObject *__pyx_v___pyx_state); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_19GeoMagneticElements_5__setstate_cython__(PyObject *__pyx_v_self, PyObject *__pyx_v___pyx_state) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__setstate_cython__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_19GeoMagneticElements_4__setstate_cython__(((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_v_self), ((PyObject *)__pyx_v___pyx_state));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_19GeoMagneticElements_4__setstate_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_self, CYTHON_UNUSED PyObject *__pyx_v___pyx_state) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__setstate_cython__", 0);
-
-  /* "(tree fragment)":4
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- */
-  __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_TypeError, __pyx_tuple__2, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(1, 4, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __PYX_ERR(1, 4, __pyx_L1_error)
-
-  /* "(tree fragment)":3
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.GeoMagneticElements.__setstate_cython__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":140
- * from os import path
- * 
- * cdef double d2r(double d):             # <<<<<<<<<<<<<<
- *     return d*0.017453292519943295
- * cdef double r2d(double r):
- */
-
-static double __pyx_f_6geomag_3emm_d2r(double __pyx_v_d) {
-  double __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("d2r", 0);
-
-  /* "geomag/emm.pyx":141
- * 
- * cdef double d2r(double d):
- *     return d*0.017453292519943295             # <<<<<<<<<<<<<<
- * cdef double r2d(double r):
- *     return r*57.29577951308232
- */
-  __pyx_r = (__pyx_v_d * 0.017453292519943295);
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":140
- * from os import path
- * 
- * cdef double d2r(double d):             # <<<<<<<<<<<<<<
- *     return d*0.017453292519943295
- * cdef double r2d(double r):
- */
-
-  /* function exit code */
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":142
- * cdef double d2r(double d):
- *     return d*0.017453292519943295
- * cdef double r2d(double r):             # <<<<<<<<<<<<<<
- *     return r*57.29577951308232
- * 
- */
-
-static double __pyx_f_6geomag_3emm_r2d(double __pyx_v_r) {
-  double __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("r2d", 0);
-
-  /* "geomag/emm.pyx":143
- *     return d*0.017453292519943295
- * cdef double r2d(double r):
- *     return r*57.29577951308232             # <<<<<<<<<<<<<<
- * 
- * cdef class EMMBase:
- */
-  __pyx_r = (__pyx_v_r * 57.29577951308232);
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":142
- * cdef double d2r(double d):
- *     return d*0.017453292519943295
- * cdef double r2d(double r):             # <<<<<<<<<<<<<<
- *     return r*57.29577951308232
- * 
- */
-
-  /* function exit code */
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":149
- *     cdef MAGtype_Ellipsoid _ellip
- * 
- *     def __cinit__(self):             # <<<<<<<<<<<<<<
- *         #initialize the ellipsoid and geoid
- *         if not MAG_SetDefaults(&self._ellip, &self._geoid):
- */
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_7EMMBase_1__cinit__(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static int __pyx_pw_6geomag_3emm_7EMMBase_1__cinit__(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__cinit__ (wrapper)", 0);
-  if (unlikely(PyTuple_GET_SIZE(__pyx_args) > 0)) {
-    __Pyx_RaiseArgtupleInvalid("__cinit__", 1, 0, 0, PyTuple_GET_SIZE(__pyx_args)); return -1;}
-  if (unlikely(__pyx_kwds) && unlikely(PyDict_Size(__pyx_kwds) > 0) && unlikely(!__Pyx_CheckKeywordStrings(__pyx_kwds, "__cinit__", 0))) return -1;
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMBase___cinit__(((struct __pyx_obj_6geomag_3emm_EMMBase *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_7EMMBase___cinit__(struct __pyx_obj_6geomag_3emm_EMMBase *__pyx_v_self) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  int __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  __Pyx_RefNannySetupContext("__cinit__", 0);
-
-  /* "geomag/emm.pyx":151
- *     def __cinit__(self):
- *         #initialize the ellipsoid and geoid
- *         if not MAG_SetDefaults(&self._ellip, &self._geoid):             # <<<<<<<<<<<<<<
- *             raise RuntimeError('Error setting default ellipsoid and geoid parameters.')
- *         self._geoid.GeoidHeightBuffer = GeoidHeightBuffer
- */
-  __pyx_t_1 = ((!(MAG_SetDefaults((&__pyx_v_self->_ellip), (&__pyx_v_self->_geoid)) != 0)) != 0);
-  if (__pyx_t_1) {
-
-    /* "geomag/emm.pyx":152
- *         #initialize the ellipsoid and geoid
- *         if not MAG_SetDefaults(&self._ellip, &self._geoid):
- *             raise RuntimeError('Error setting default ellipsoid and geoid parameters.')             # <<<<<<<<<<<<<<
- *         self._geoid.GeoidHeightBuffer = GeoidHeightBuffer
- *         self._geoid.Geoid_Initialized = 1
- */
-    __pyx_t_2 = __Pyx_PyObject_Call(__pyx_builtin_RuntimeError, __pyx_tuple__3, NULL); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 152, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_Raise(__pyx_t_2, 0, 0, 0);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    __PYX_ERR(0, 152, __pyx_L1_error)
-
-    /* "geomag/emm.pyx":151
- *     def __cinit__(self):
- *         #initialize the ellipsoid and geoid
- *         if not MAG_SetDefaults(&self._ellip, &self._geoid):             # <<<<<<<<<<<<<<
- *             raise RuntimeError('Error setting default ellipsoid and geoid parameters.')
- *         self._geoid.GeoidHeightBuffer = GeoidHeightBuffer
- */
-  }
-
-  /* "geomag/emm.pyx":153
- *         if not MAG_SetDefaults(&self._ellip, &self._geoid):
- *             raise RuntimeError('Error setting default ellipsoid and geoid parameters.')
- *         self._geoid.GeoidHeightBuffer = GeoidHeightBuffer             # <<<<<<<<<<<<<<
- *         self._geoid.Geoid_Initialized = 1
- * 
- */
-  __pyx_v_self->_geoid.GeoidHeightBuffer = GeoidHeightBuffer;
-
-  /* "geomag/emm.pyx":154
- *             raise RuntimeError('Error setting default ellipsoid and geoid parameters.')
- *         self._geoid.GeoidHeightBuffer = GeoidHeightBuffer
- *         self._geoid.Geoid_Initialized = 1             # <<<<<<<<<<<<<<
- * 
- *     cdef tuple norm_lat_lon(self, lat, lon):
- */
-  __pyx_v_self->_geoid.Geoid_Initialized = 1;
-
-  /* "geomag/emm.pyx":149
- *     cdef MAGtype_Ellipsoid _ellip
- * 
- *     def __cinit__(self):             # <<<<<<<<<<<<<<
- *         #initialize the ellipsoid and geoid
- *         if not MAG_SetDefaults(&self._ellip, &self._geoid):
- */
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("geomag.emm.EMMBase.__cinit__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":156
- *         self._geoid.Geoid_Initialized = 1
- * 
- *     cdef tuple norm_lat_lon(self, lat, lon):             # <<<<<<<<<<<<<<
- *         """Wrap out of bounds lat, lon into the valid range"""
- *         if lat < -90 or lat > 90:
- */
-
-static PyObject *__pyx_f_6geomag_3emm_7EMMBase_norm_lat_lon(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMBase *__pyx_v_self, PyObject *__pyx_v_lat, PyObject *__pyx_v_lon) {
-  double __pyx_v_x;
-  double __pyx_v_y;
-  double __pyx_v_z;
-  double __pyx_v_r;
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  int __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  int __pyx_t_3;
-  double __pyx_t_4;
-  double __pyx_t_5;
-  __Pyx_RefNannySetupContext("norm_lat_lon", 0);
-  __Pyx_INCREF(__pyx_v_lat);
-  __Pyx_INCREF(__pyx_v_lon);
-
-  /* "geomag/emm.pyx":158
- *     cdef tuple norm_lat_lon(self, lat, lon):
- *         """Wrap out of bounds lat, lon into the valid range"""
- *         if lat < -90 or lat > 90:             # <<<<<<<<<<<<<<
- *             #convert to cartesian and back
- *             x = cos(d2r(lon))*cos(d2r(lat))
- */
-  __pyx_t_2 = PyObject_RichCompare(__pyx_v_lat, __pyx_int_neg_90, Py_LT); __Pyx_XGOTREF(__pyx_t_2); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 158, __pyx_L1_error)
-  __pyx_t_3 = __Pyx_PyObject_IsTrue(__pyx_t_2); if (unlikely(__pyx_t_3 < 0)) __PYX_ERR(0, 158, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  if (!__pyx_t_3) {
-  } else {
-    __pyx_t_1 = __pyx_t_3;
-    goto __pyx_L4_bool_binop_done;
-  }
-  __pyx_t_2 = PyObject_RichCompare(__pyx_v_lat, __pyx_int_90, Py_GT); __Pyx_XGOTREF(__pyx_t_2); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 158, __pyx_L1_error)
-  __pyx_t_3 = __Pyx_PyObject_IsTrue(__pyx_t_2); if (unlikely(__pyx_t_3 < 0)) __PYX_ERR(0, 158, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_1 = __pyx_t_3;
-  __pyx_L4_bool_binop_done:;
-  if (__pyx_t_1) {
-
-    /* "geomag/emm.pyx":160
- *         if lat < -90 or lat > 90:
- *             #convert to cartesian and back
- *             x = cos(d2r(lon))*cos(d2r(lat))             # <<<<<<<<<<<<<<
- *             y = sin(d2r(lon))*cos(d2r(lat))
- *             z = sin(d2r(lat))
- */
-    __pyx_t_4 = __pyx_PyFloat_AsDouble(__pyx_v_lon); if (unlikely((__pyx_t_4 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 160, __pyx_L1_error)
-    __pyx_t_5 = __pyx_PyFloat_AsDouble(__pyx_v_lat); if (unlikely((__pyx_t_5 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 160, __pyx_L1_error)
-    __pyx_v_x = (cos(__pyx_f_6geomag_3emm_d2r(__pyx_t_4)) * cos(__pyx_f_6geomag_3emm_d2r(__pyx_t_5)));
-
-    /* "geomag/emm.pyx":161
- *             #convert to cartesian and back
- *             x = cos(d2r(lon))*cos(d2r(lat))
- *             y = sin(d2r(lon))*cos(d2r(lat))             # <<<<<<<<<<<<<<
- *             z = sin(d2r(lat))
- *             r = sqrt(x**2 + y**2 + z**2)
- */
-    __pyx_t_5 = __pyx_PyFloat_AsDouble(__pyx_v_lon); if (unlikely((__pyx_t_5 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 161, __pyx_L1_error)
-    __pyx_t_4 = __pyx_PyFloat_AsDouble(__pyx_v_lat); if (unlikely((__pyx_t_4 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 161, __pyx_L1_error)
-    __pyx_v_y = (sin(__pyx_f_6geomag_3emm_d2r(__pyx_t_5)) * cos(__pyx_f_6geomag_3emm_d2r(__pyx_t_4)));
-
-    /* "geomag/emm.pyx":162
- *             x = cos(d2r(lon))*cos(d2r(lat))
- *             y = sin(d2r(lon))*cos(d2r(lat))
- *             z = sin(d2r(lat))             # <<<<<<<<<<<<<<
- *             r = sqrt(x**2 + y**2 + z**2)
- *             lon = r2d(atan2(y,x)) % 360
- */
-    __pyx_t_4 = __pyx_PyFloat_AsDouble(__pyx_v_lat); if (unlikely((__pyx_t_4 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 162, __pyx_L1_error)
-    __pyx_v_z = sin(__pyx_f_6geomag_3emm_d2r(__pyx_t_4));
-
-    /* "geomag/emm.pyx":163
- *             y = sin(d2r(lon))*cos(d2r(lat))
- *             z = sin(d2r(lat))
- *             r = sqrt(x**2 + y**2 + z**2)             # <<<<<<<<<<<<<<
- *             lon = r2d(atan2(y,x)) % 360
- *             lat = r2d(asin(z/r))
- */
-    __pyx_v_r = sqrt(((pow(__pyx_v_x, 2.0) + pow(__pyx_v_y, 2.0)) + pow(__pyx_v_z, 2.0)));
-
-    /* "geomag/emm.pyx":164
- *             z = sin(d2r(lat))
- *             r = sqrt(x**2 + y**2 + z**2)
- *             lon = r2d(atan2(y,x)) % 360             # <<<<<<<<<<<<<<
- *             lat = r2d(asin(z/r))
- *         elif lon < 0 or lon > 360:
- */
-    __pyx_t_2 = PyFloat_FromDouble(__Pyx_mod_double(__pyx_f_6geomag_3emm_r2d(atan2(__pyx_v_y, __pyx_v_x)), 360.0)); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 164, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_DECREF_SET(__pyx_v_lon, __pyx_t_2);
-    __pyx_t_2 = 0;
-
-    /* "geomag/emm.pyx":165
- *             r = sqrt(x**2 + y**2 + z**2)
- *             lon = r2d(atan2(y,x)) % 360
- *             lat = r2d(asin(z/r))             # <<<<<<<<<<<<<<
- *         elif lon < 0 or lon > 360:
- *             lon = lon % 360
- */
-    if (unlikely(__pyx_v_r == 0)) {
-      PyErr_SetString(PyExc_ZeroDivisionError, "float division");
-      __PYX_ERR(0, 165, __pyx_L1_error)
-    }
-    __pyx_t_2 = PyFloat_FromDouble(__pyx_f_6geomag_3emm_r2d(asin((__pyx_v_z / __pyx_v_r)))); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 165, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_DECREF_SET(__pyx_v_lat, __pyx_t_2);
-    __pyx_t_2 = 0;
-
-    /* "geomag/emm.pyx":158
- *     cdef tuple norm_lat_lon(self, lat, lon):
- *         """Wrap out of bounds lat, lon into the valid range"""
- *         if lat < -90 or lat > 90:             # <<<<<<<<<<<<<<
- *             #convert to cartesian and back
- *             x = cos(d2r(lon))*cos(d2r(lat))
- */
-    goto __pyx_L3;
-  }
-
-  /* "geomag/emm.pyx":166
- *             lon = r2d(atan2(y,x)) % 360
- *             lat = r2d(asin(z/r))
- *         elif lon < 0 or lon > 360:             # <<<<<<<<<<<<<<
- *             lon = lon % 360
- *         return lat,lon
- */
-  __pyx_t_2 = PyObject_RichCompare(__pyx_v_lon, __pyx_int_0, Py_LT); __Pyx_XGOTREF(__pyx_t_2); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 166, __pyx_L1_error)
-  __pyx_t_3 = __Pyx_PyObject_IsTrue(__pyx_t_2); if (unlikely(__pyx_t_3 < 0)) __PYX_ERR(0, 166, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  if (!__pyx_t_3) {
-  } else {
-    __pyx_t_1 = __pyx_t_3;
-    goto __pyx_L6_bool_binop_done;
-  }
-  __pyx_t_2 = PyObject_RichCompare(__pyx_v_lon, __pyx_int_360, Py_GT); __Pyx_XGOTREF(__pyx_t_2); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 166, __pyx_L1_error)
-  __pyx_t_3 = __Pyx_PyObject_IsTrue(__pyx_t_2); if (unlikely(__pyx_t_3 < 0)) __PYX_ERR(0, 166, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_1 = __pyx_t_3;
-  __pyx_L6_bool_binop_done:;
-  if (__pyx_t_1) {
-
-    /* "geomag/emm.pyx":167
- *             lat = r2d(asin(z/r))
- *         elif lon < 0 or lon > 360:
- *             lon = lon % 360             # <<<<<<<<<<<<<<
- *         return lat,lon
- * 
- */
-    __pyx_t_2 = __Pyx_PyInt_RemainderObjC(__pyx_v_lon, __pyx_int_360, 0x168, 0); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 167, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_DECREF_SET(__pyx_v_lon, __pyx_t_2);
-    __pyx_t_2 = 0;
-
-    /* "geomag/emm.pyx":166
- *             lon = r2d(atan2(y,x)) % 360
- *             lat = r2d(asin(z/r))
- *         elif lon < 0 or lon > 360:             # <<<<<<<<<<<<<<
- *             lon = lon % 360
- *         return lat,lon
- */
-  }
-  __pyx_L3:;
-
-  /* "geomag/emm.pyx":168
- *         elif lon < 0 or lon > 360:
- *             lon = lon % 360
- *         return lat,lon             # <<<<<<<<<<<<<<
- * 
- *     @staticmethod
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 168, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_INCREF(__pyx_v_lat);
-  __Pyx_GIVEREF(__pyx_v_lat);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_lat);
-  __Pyx_INCREF(__pyx_v_lon);
-  __Pyx_GIVEREF(__pyx_v_lon);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_v_lon);
-  __pyx_r = ((PyObject*)__pyx_t_2);
-  __pyx_t_2 = 0;
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":156
- *         self._geoid.Geoid_Initialized = 1
- * 
- *     cdef tuple norm_lat_lon(self, lat, lon):             # <<<<<<<<<<<<<<
- *         """Wrap out of bounds lat, lon into the valid range"""
- *         if lat < -90 or lat > 90:
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("geomag.emm.EMMBase.norm_lat_lon", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = 0;
-  __pyx_L0:;
-  __Pyx_XDECREF(__pyx_v_lat);
-  __Pyx_XDECREF(__pyx_v_lon);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":171
- * 
- *     @staticmethod
- *     def citation():             # <<<<<<<<<<<<<<
- *         return "Chulliat, A., P. Alken, M. Nair, A. Woods, and S. Maus, 2015, The Enhanced Magnetic Model 2015-2020, National Centers for Environmental Information, NOAA. doi: 10.7289/V56971HV."
- * 
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMBase_3citation(CYTHON_UNUSED PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyMethodDef __pyx_mdef_6geomag_3emm_7EMMBase_3citation = {"citation", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMBase_3citation, METH_VARARGS|METH_KEYWORDS, 0};
-static PyObject *__pyx_pw_6geomag_3emm_7EMMBase_3citation(CYTHON_UNUSED PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("citation (wrapper)", 0);
-  if (unlikely(PyTuple_GET_SIZE(__pyx_args) > 0)) {
-    __Pyx_RaiseArgtupleInvalid("citation", 1, 0, 0, PyTuple_GET_SIZE(__pyx_args)); return NULL;}
-  if (unlikely(__pyx_kwds) && unlikely(PyDict_Size(__pyx_kwds) > 0) && unlikely(!__Pyx_CheckKeywordStrings(__pyx_kwds, "citation", 0))) return NULL;
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMBase_2citation();
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMBase_2citation() {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("citation", 0);
-
-  /* "geomag/emm.pyx":172
- *     @staticmethod
- *     def citation():
- *         return "Chulliat, A., P. Alken, M. Nair, A. Woods, and S. Maus, 2015, The Enhanced Magnetic Model 2015-2020, National Centers for Environmental Information, NOAA. doi: 10.7289/V56971HV."             # <<<<<<<<<<<<<<
- * 
- *     @staticmethod
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(__pyx_kp_s_Chulliat_A_P_Alken_M_Nair_A_Wood);
-  __pyx_r = __pyx_kp_s_Chulliat_A_P_Alken_M_Nair_A_Wood;
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":171
- * 
- *     @staticmethod
- *     def citation():             # <<<<<<<<<<<<<<
- *         return "Chulliat, A., P. Alken, M. Nair, A. Woods, and S. Maus, 2015, The Enhanced Magnetic Model 2015-2020, National Centers for Environmental Information, NOAA. doi: 10.7289/V56971HV."
- * 
- */
-
-  /* function exit code */
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":175
- * 
- *     @staticmethod
- *     def bibtex():             # <<<<<<<<<<<<<<
- *         return '@article{RN121,\n    author = {Chulliat, A and Alken, P and Nair, M and Woods, A and Maus, S},\n    title = {The Enhanced Magnetic Model 2015-2020},\n    journal = {National Centers for Environmental Information, NOAA},\n    DOI = {10.7289/V56971HV},\n    year = {2015},\n    type = {Journal Article}\n}'
- * 
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMBase_5bibtex(CYTHON_UNUSED PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyMethodDef __pyx_mdef_6geomag_3emm_7EMMBase_5bibtex = {"bibtex", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMBase_5bibtex, METH_VARARGS|METH_KEYWORDS, 0};
-static PyObject *__pyx_pw_6geomag_3emm_7EMMBase_5bibtex(CYTHON_UNUSED PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("bibtex (wrapper)", 0);
-  if (unlikely(PyTuple_GET_SIZE(__pyx_args) > 0)) {
-    __Pyx_RaiseArgtupleInvalid("bibtex", 1, 0, 0, PyTuple_GET_SIZE(__pyx_args)); return NULL;}
-  if (unlikely(__pyx_kwds) && unlikely(PyDict_Size(__pyx_kwds) > 0) && unlikely(!__Pyx_CheckKeywordStrings(__pyx_kwds, "bibtex", 0))) return NULL;
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMBase_4bibtex();
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMBase_4bibtex() {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("bibtex", 0);
-
-  /* "geomag/emm.pyx":176
- *     @staticmethod
- *     def bibtex():
- *         return '@article{RN121,\n    author = {Chulliat, A and Alken, P and Nair, M and Woods, A and Maus, S},\n    title = {The Enhanced Magnetic Model 2015-2020},\n    journal = {National Centers for Environmental Information, NOAA},\n    DOI = {10.7289/V56971HV},\n    year = {2015},\n    type = {Journal Article}\n}'             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(__pyx_kp_s_article_RN121_author_Chulliat_A);
-  __pyx_r = __pyx_kp_s_article_RN121_author_Chulliat_A;
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":175
- * 
- *     @staticmethod
- *     def bibtex():             # <<<<<<<<<<<<<<
- *         return '@article{RN121,\n    author = {Chulliat, A and Alken, P and Nair, M and Woods, A and Maus, S},\n    title = {The Enhanced Magnetic Model 2015-2020},\n    journal = {National Centers for Environmental Information, NOAA},\n    DOI = {10.7289/V56971HV},\n    year = {2015},\n    type = {Journal Article}\n}'
- * 
- */
-
-  /* function exit code */
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":179
- * 
- * 
- *     def decimal_year(self, t):             # <<<<<<<<<<<<<<
- *         """decimal_year(t)
- *         convert a time.struct_time, datetime.date, datetime.datetime, or UTC timestamp into a decimal year"""
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMBase_7decimal_year(PyObject *__pyx_v_self, PyObject *__pyx_v_t); /*proto*/
-static char __pyx_doc_6geomag_3emm_7EMMBase_6decimal_year[] = "decimal_year(t)\n        convert a time.struct_time, datetime.date, datetime.datetime, or UTC timestamp into a decimal year";
-static PyObject *__pyx_pw_6geomag_3emm_7EMMBase_7decimal_year(PyObject *__pyx_v_self, PyObject *__pyx_v_t) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("decimal_year (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMBase_6decimal_year(((struct __pyx_obj_6geomag_3emm_EMMBase *)__pyx_v_self), ((PyObject *)__pyx_v_t));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMBase_6decimal_year(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMBase *__pyx_v_self, PyObject *__pyx_v_t) {
-  PyObject *__pyx_v_tt = NULL;
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  int __pyx_t_1;
-  int __pyx_t_2;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  PyObject *__pyx_t_5 = NULL;
-  int __pyx_t_6;
-  PyObject *__pyx_t_7 = NULL;
-  __Pyx_RefNannySetupContext("decimal_year", 0);
-
-  /* "geomag/emm.pyx":182
- *         """decimal_year(t)
- *         convert a time.struct_time, datetime.date, datetime.datetime, or UTC timestamp into a decimal year"""
- *         if hasattr(t,'timetuple'): #date/datetime to struct_time:             # <<<<<<<<<<<<<<
- *             tt = t.timetuple()
- *         elif hasattr(t,'tm_year') and hasattr(t,'tm_yday'): #already a struct_time
- */
-  __pyx_t_1 = __Pyx_HasAttr(__pyx_v_t, __pyx_n_s_timetuple); if (unlikely(__pyx_t_1 == -1)) __PYX_ERR(0, 182, __pyx_L1_error)
-  __pyx_t_2 = (__pyx_t_1 != 0);
-  if (__pyx_t_2) {
-
-    /* "geomag/emm.pyx":183
- *         convert a time.struct_time, datetime.date, datetime.datetime, or UTC timestamp into a decimal year"""
- *         if hasattr(t,'timetuple'): #date/datetime to struct_time:
- *             tt = t.timetuple()             # <<<<<<<<<<<<<<
- *         elif hasattr(t,'tm_year') and hasattr(t,'tm_yday'): #already a struct_time
- *             tt = t
- */
-    __pyx_t_4 = __Pyx_PyObject_GetAttrStr(__pyx_v_t, __pyx_n_s_timetuple); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 183, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_4);
-    __pyx_t_5 = NULL;
-    if (CYTHON_UNPACK_METHODS && likely(PyMethod_Check(__pyx_t_4))) {
-      __pyx_t_5 = PyMethod_GET_SELF(__pyx_t_4);
-      if (likely(__pyx_t_5)) {
-        PyObject* function = PyMethod_GET_FUNCTION(__pyx_t_4);
-        __Pyx_INCREF(__pyx_t_5);
-        __Pyx_INCREF(function);
-        __Pyx_DECREF_SET(__pyx_t_4, function);
-      }
-    }
-    if (__pyx_t_5) {
-      __pyx_t_3 = __Pyx_PyObject_CallOneArg(__pyx_t_4, __pyx_t_5); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 183, __pyx_L1_error)
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-    } else {
-      __pyx_t_3 = __Pyx_PyObject_CallNoArg(__pyx_t_4); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 183, __pyx_L1_error)
-    }
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __pyx_v_tt = __pyx_t_3;
-    __pyx_t_3 = 0;
-
-    /* "geomag/emm.pyx":182
- *         """decimal_year(t)
- *         convert a time.struct_time, datetime.date, datetime.datetime, or UTC timestamp into a decimal year"""
- *         if hasattr(t,'timetuple'): #date/datetime to struct_time:             # <<<<<<<<<<<<<<
- *             tt = t.timetuple()
- *         elif hasattr(t,'tm_year') and hasattr(t,'tm_yday'): #already a struct_time
- */
-    goto __pyx_L3;
-  }
-
-  /* "geomag/emm.pyx":184
- *         if hasattr(t,'timetuple'): #date/datetime to struct_time:
- *             tt = t.timetuple()
- *         elif hasattr(t,'tm_year') and hasattr(t,'tm_yday'): #already a struct_time             # <<<<<<<<<<<<<<
- *             tt = t
- *         else: #seconds to struct_time
- */
-  __pyx_t_1 = __Pyx_HasAttr(__pyx_v_t, __pyx_n_s_tm_year); if (unlikely(__pyx_t_1 == -1)) __PYX_ERR(0, 184, __pyx_L1_error)
-  __pyx_t_6 = (__pyx_t_1 != 0);
-  if (__pyx_t_6) {
-  } else {
-    __pyx_t_2 = __pyx_t_6;
-    goto __pyx_L4_bool_binop_done;
-  }
-  __pyx_t_6 = __Pyx_HasAttr(__pyx_v_t, __pyx_n_s_tm_yday); if (unlikely(__pyx_t_6 == -1)) __PYX_ERR(0, 184, __pyx_L1_error)
-  __pyx_t_1 = (__pyx_t_6 != 0);
-  __pyx_t_2 = __pyx_t_1;
-  __pyx_L4_bool_binop_done:;
-  if (__pyx_t_2) {
-
-    /* "geomag/emm.pyx":185
- *             tt = t.timetuple()
- *         elif hasattr(t,'tm_year') and hasattr(t,'tm_yday'): #already a struct_time
- *             tt = t             # <<<<<<<<<<<<<<
- *         else: #seconds to struct_time
- *             tt = gmtime(t)
- */
-    __Pyx_INCREF(__pyx_v_t);
-    __pyx_v_tt = __pyx_v_t;
-
-    /* "geomag/emm.pyx":184
- *         if hasattr(t,'timetuple'): #date/datetime to struct_time:
- *             tt = t.timetuple()
- *         elif hasattr(t,'tm_year') and hasattr(t,'tm_yday'): #already a struct_time             # <<<<<<<<<<<<<<
- *             tt = t
- *         else: #seconds to struct_time
- */
-    goto __pyx_L3;
-  }
-
-  /* "geomag/emm.pyx":187
- *             tt = t
- *         else: #seconds to struct_time
- *             tt = gmtime(t)             # <<<<<<<<<<<<<<
- *         return tt.tm_year + (tt.tm_yday-1)/365 #leap years?
- * 
- */
-  /*else*/ {
-    __pyx_t_4 = __Pyx_GetModuleGlobalName(__pyx_n_s_gmtime); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 187, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_4);
-    __pyx_t_5 = NULL;
-    if (CYTHON_UNPACK_METHODS && unlikely(PyMethod_Check(__pyx_t_4))) {
-      __pyx_t_5 = PyMethod_GET_SELF(__pyx_t_4);
-      if (likely(__pyx_t_5)) {
-        PyObject* function = PyMethod_GET_FUNCTION(__pyx_t_4);
-        __Pyx_INCREF(__pyx_t_5);
-        __Pyx_INCREF(function);
-        __Pyx_DECREF_SET(__pyx_t_4, function);
-      }
-    }
-    if (!__pyx_t_5) {
-      __pyx_t_3 = __Pyx_PyObject_CallOneArg(__pyx_t_4, __pyx_v_t); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 187, __pyx_L1_error)
-      __Pyx_GOTREF(__pyx_t_3);
-    } else {
-      #if CYTHON_FAST_PYCALL
-      if (PyFunction_Check(__pyx_t_4)) {
-        PyObject *__pyx_temp[2] = {__pyx_t_5, __pyx_v_t};
-        __pyx_t_3 = __Pyx_PyFunction_FastCall(__pyx_t_4, __pyx_temp+1-1, 1+1); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 187, __pyx_L1_error)
-        __Pyx_XDECREF(__pyx_t_5); __pyx_t_5 = 0;
-        __Pyx_GOTREF(__pyx_t_3);
-      } else
-      #endif
-      #if CYTHON_FAST_PYCCALL
-      if (__Pyx_PyFastCFunction_Check(__pyx_t_4)) {
-        PyObject *__pyx_temp[2] = {__pyx_t_5, __pyx_v_t};
-        __pyx_t_3 = __Pyx_PyCFunction_FastCall(__pyx_t_4, __pyx_temp+1-1, 1+1); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 187, __pyx_L1_error)
-        __Pyx_XDECREF(__pyx_t_5); __pyx_t_5 = 0;
-        __Pyx_GOTREF(__pyx_t_3);
-      } else
-      #endif
-      {
-        __pyx_t_7 = PyTuple_New(1+1); if (unlikely(!__pyx_t_7)) __PYX_ERR(0, 187, __pyx_L1_error)
-        __Pyx_GOTREF(__pyx_t_7);
-        __Pyx_GIVEREF(__pyx_t_5); PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_t_5); __pyx_t_5 = NULL;
-        __Pyx_INCREF(__pyx_v_t);
-        __Pyx_GIVEREF(__pyx_v_t);
-        PyTuple_SET_ITEM(__pyx_t_7, 0+1, __pyx_v_t);
-        __pyx_t_3 = __Pyx_PyObject_Call(__pyx_t_4, __pyx_t_7, NULL); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 187, __pyx_L1_error)
-        __Pyx_GOTREF(__pyx_t_3);
-        __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-      }
-    }
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __pyx_v_tt = __pyx_t_3;
-    __pyx_t_3 = 0;
-  }
-  __pyx_L3:;
-
-  /* "geomag/emm.pyx":188
- *         else: #seconds to struct_time
- *             tt = gmtime(t)
- *         return tt.tm_year + (tt.tm_yday-1)/365 #leap years?             # <<<<<<<<<<<<<<
- * 
- *     @staticmethod
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_3 = __Pyx_PyObject_GetAttrStr(__pyx_v_tt, __pyx_n_s_tm_year); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 188, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_4 = __Pyx_PyObject_GetAttrStr(__pyx_v_tt, __pyx_n_s_tm_yday); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 188, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_7 = __Pyx_PyInt_SubtractObjC(__pyx_t_4, __pyx_int_1, 1, 0); if (unlikely(!__pyx_t_7)) __PYX_ERR(0, 188, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __pyx_t_4 = __Pyx_PyNumber_Divide(__pyx_t_7, __pyx_int_365); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 188, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_4);
-  __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-  __pyx_t_7 = PyNumber_Add(__pyx_t_3, __pyx_t_4); if (unlikely(!__pyx_t_7)) __PYX_ERR(0, 188, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __pyx_r = __pyx_t_7;
-  __pyx_t_7 = 0;
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":179
- * 
- * 
- *     def decimal_year(self, t):             # <<<<<<<<<<<<<<
- *         """decimal_year(t)
- *         convert a time.struct_time, datetime.date, datetime.datetime, or UTC timestamp into a decimal year"""
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_XDECREF(__pyx_t_7);
-  __Pyx_AddTraceback("geomag.emm.EMMBase.decimal_year", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XDECREF(__pyx_v_tt);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":191
- * 
- *     @staticmethod
- *     cdef _EMM_check(int err):             # <<<<<<<<<<<<<<
- *         """Check error codes"""
- *         if err == EXIT_MESH_MEM_ALLOC_ERROR:
- */
-
-static PyObject *__pyx_f_6geomag_3emm_7EMMBase__EMM_check(int __pyx_v_err) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("_EMM_check", 0);
-
-  /* "geomag/emm.pyx":193
- *     cdef _EMM_check(int err):
- *         """Check error codes"""
- *         if err == EXIT_MESH_MEM_ALLOC_ERROR:             # <<<<<<<<<<<<<<
- *             raise MemoryError()
- *         elif err == EXIT_MESH_TEXT_FILE_NOT_FOUND:
- */
-  switch (__pyx_v_err) {
-    case EXIT_MESH_MEM_ALLOC_ERROR:
-
-    /* "geomag/emm.pyx":194
- *         """Check error codes"""
- *         if err == EXIT_MESH_MEM_ALLOC_ERROR:
- *             raise MemoryError()             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_TEXT_FILE_NOT_FOUND:
- *             raise RuntimeError('Text file not found.')
- */
-    PyErr_NoMemory(); __PYX_ERR(0, 194, __pyx_L1_error)
-
-    /* "geomag/emm.pyx":193
- *     cdef _EMM_check(int err):
- *         """Check error codes"""
- *         if err == EXIT_MESH_MEM_ALLOC_ERROR:             # <<<<<<<<<<<<<<
- *             raise MemoryError()
- *         elif err == EXIT_MESH_TEXT_FILE_NOT_FOUND:
- */
-    break;
-
-    /* "geomag/emm.pyx":195
- *         if err == EXIT_MESH_MEM_ALLOC_ERROR:
- *             raise MemoryError()
- *         elif err == EXIT_MESH_TEXT_FILE_NOT_FOUND:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('Text file not found.')
- *         elif err == EXIT_MESH_BIN_FILE_WRITE_ERROR:
- */
-    case EXIT_MESH_TEXT_FILE_NOT_FOUND:
-
-    /* "geomag/emm.pyx":196
- *             raise MemoryError()
- *         elif err == EXIT_MESH_TEXT_FILE_NOT_FOUND:
- *             raise RuntimeError('Text file not found.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_BIN_FILE_WRITE_ERROR:
- *             raise RuntimeError('Binary file write error.')
- */
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_RuntimeError, __pyx_tuple__4, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 196, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __PYX_ERR(0, 196, __pyx_L1_error)
-
-    /* "geomag/emm.pyx":195
- *         if err == EXIT_MESH_MEM_ALLOC_ERROR:
- *             raise MemoryError()
- *         elif err == EXIT_MESH_TEXT_FILE_NOT_FOUND:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('Text file not found.')
- *         elif err == EXIT_MESH_BIN_FILE_WRITE_ERROR:
- */
-    break;
-
-    /* "geomag/emm.pyx":197
- *         elif err == EXIT_MESH_TEXT_FILE_NOT_FOUND:
- *             raise RuntimeError('Text file not found.')
- *         elif err == EXIT_MESH_BIN_FILE_WRITE_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('Binary file write error.')
- *         elif err == EXIT_MESH_BIN_FILE_NOT_FOUND:
- */
-    case EXIT_MESH_BIN_FILE_WRITE_ERROR:
-
-    /* "geomag/emm.pyx":198
- *             raise RuntimeError('Text file not found.')
- *         elif err == EXIT_MESH_BIN_FILE_WRITE_ERROR:
- *             raise RuntimeError('Binary file write error.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_BIN_FILE_NOT_FOUND:
- *             raise RuntimeError('Binary file not found.')
- */
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_RuntimeError, __pyx_tuple__5, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 198, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __PYX_ERR(0, 198, __pyx_L1_error)
-
-    /* "geomag/emm.pyx":197
- *         elif err == EXIT_MESH_TEXT_FILE_NOT_FOUND:
- *             raise RuntimeError('Text file not found.')
- *         elif err == EXIT_MESH_BIN_FILE_WRITE_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('Binary file write error.')
- *         elif err == EXIT_MESH_BIN_FILE_NOT_FOUND:
- */
-    break;
-
-    /* "geomag/emm.pyx":199
- *         elif err == EXIT_MESH_BIN_FILE_WRITE_ERROR:
- *             raise RuntimeError('Binary file write error.')
- *         elif err == EXIT_MESH_BIN_FILE_NOT_FOUND:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('Binary file not found.')
- *         elif err == EXIT_MESH_FILE_FORMAT_ERROR:
- */
-    case EXIT_MESH_BIN_FILE_NOT_FOUND:
-
-    /* "geomag/emm.pyx":200
- *             raise RuntimeError('Binary file write error.')
- *         elif err == EXIT_MESH_BIN_FILE_NOT_FOUND:
- *             raise RuntimeError('Binary file not found.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_FORMAT_ERROR:
- *             raise RuntimeError('File format error.')
- */
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_RuntimeError, __pyx_tuple__6, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 200, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __PYX_ERR(0, 200, __pyx_L1_error)
-
-    /* "geomag/emm.pyx":199
- *         elif err == EXIT_MESH_BIN_FILE_WRITE_ERROR:
- *             raise RuntimeError('Binary file write error.')
- *         elif err == EXIT_MESH_BIN_FILE_NOT_FOUND:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('Binary file not found.')
- *         elif err == EXIT_MESH_FILE_FORMAT_ERROR:
- */
-    break;
-
-    /* "geomag/emm.pyx":201
- *         elif err == EXIT_MESH_BIN_FILE_NOT_FOUND:
- *             raise RuntimeError('Binary file not found.')
- *         elif err == EXIT_MESH_FILE_FORMAT_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File format error.')
- *         elif err == EXIT_MESH_FILE_EPOCH_ERROR:
- */
-    case EXIT_MESH_FILE_FORMAT_ERROR:
-
-    /* "geomag/emm.pyx":202
- *             raise RuntimeError('Binary file not found.')
- *         elif err == EXIT_MESH_FILE_FORMAT_ERROR:
- *             raise RuntimeError('File format error.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_EPOCH_ERROR:
- *             raise RuntimeError('File epoch error (Model year out of range)')
- */
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_RuntimeError, __pyx_tuple__7, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 202, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __PYX_ERR(0, 202, __pyx_L1_error)
-
-    /* "geomag/emm.pyx":201
- *         elif err == EXIT_MESH_BIN_FILE_NOT_FOUND:
- *             raise RuntimeError('Binary file not found.')
- *         elif err == EXIT_MESH_FILE_FORMAT_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File format error.')
- *         elif err == EXIT_MESH_FILE_EPOCH_ERROR:
- */
-    break;
-
-    /* "geomag/emm.pyx":203
- *         elif err == EXIT_MESH_FILE_FORMAT_ERROR:
- *             raise RuntimeError('File format error.')
- *         elif err == EXIT_MESH_FILE_EPOCH_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File epoch error (Model year out of range)')
- *         elif err == EXIT_MESH_FILE_NALT_ERROR:
- */
-    case EXIT_MESH_FILE_EPOCH_ERROR:
-
-    /* "geomag/emm.pyx":204
- *             raise RuntimeError('File format error.')
- *         elif err == EXIT_MESH_FILE_EPOCH_ERROR:
- *             raise RuntimeError('File epoch error (Model year out of range)')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_NALT_ERROR:
- *             raise RuntimeError('File error: number of altitude layers out of range.')
- */
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_RuntimeError, __pyx_tuple__8, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 204, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __PYX_ERR(0, 204, __pyx_L1_error)
-
-    /* "geomag/emm.pyx":203
- *         elif err == EXIT_MESH_FILE_FORMAT_ERROR:
- *             raise RuntimeError('File format error.')
- *         elif err == EXIT_MESH_FILE_EPOCH_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File epoch error (Model year out of range)')
- *         elif err == EXIT_MESH_FILE_NALT_ERROR:
- */
-    break;
-
-    /* "geomag/emm.pyx":205
- *         elif err == EXIT_MESH_FILE_EPOCH_ERROR:
- *             raise RuntimeError('File epoch error (Model year out of range)')
- *         elif err == EXIT_MESH_FILE_NALT_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File error: number of altitude layers out of range.')
- *         elif err == EXIT_MESH_FILE_NLAT_ERROR:
- */
-    case EXIT_MESH_FILE_NALT_ERROR:
-
-    /* "geomag/emm.pyx":206
- *             raise RuntimeError('File epoch error (Model year out of range)')
- *         elif err == EXIT_MESH_FILE_NALT_ERROR:
- *             raise RuntimeError('File error: number of altitude layers out of range.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_NLAT_ERROR:
- *             raise RuntimeError('File error: number of latitude rows out of range.')
- */
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_RuntimeError, __pyx_tuple__9, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 206, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __PYX_ERR(0, 206, __pyx_L1_error)
-
-    /* "geomag/emm.pyx":205
- *         elif err == EXIT_MESH_FILE_EPOCH_ERROR:
- *             raise RuntimeError('File epoch error (Model year out of range)')
- *         elif err == EXIT_MESH_FILE_NALT_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File error: number of altitude layers out of range.')
- *         elif err == EXIT_MESH_FILE_NLAT_ERROR:
- */
-    break;
-
-    /* "geomag/emm.pyx":207
- *         elif err == EXIT_MESH_FILE_NALT_ERROR:
- *             raise RuntimeError('File error: number of altitude layers out of range.')
- *         elif err == EXIT_MESH_FILE_NLAT_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File error: number of latitude rows out of range.')
- *         elif err == EXIT_MESH_FILE_ALT_ERROR:
- */
-    case EXIT_MESH_FILE_NLAT_ERROR:
-
-    /* "geomag/emm.pyx":208
- *             raise RuntimeError('File error: number of altitude layers out of range.')
- *         elif err == EXIT_MESH_FILE_NLAT_ERROR:
- *             raise RuntimeError('File error: number of latitude rows out of range.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_ALT_ERROR:
- *             raise RuntimeError('File error: altitude out of range.')
- */
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_RuntimeError, __pyx_tuple__10, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 208, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __PYX_ERR(0, 208, __pyx_L1_error)
-
-    /* "geomag/emm.pyx":207
- *         elif err == EXIT_MESH_FILE_NALT_ERROR:
- *             raise RuntimeError('File error: number of altitude layers out of range.')
- *         elif err == EXIT_MESH_FILE_NLAT_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File error: number of latitude rows out of range.')
- *         elif err == EXIT_MESH_FILE_ALT_ERROR:
- */
-    break;
-
-    /* "geomag/emm.pyx":209
- *         elif err == EXIT_MESH_FILE_NLAT_ERROR:
- *             raise RuntimeError('File error: number of latitude rows out of range.')
- *         elif err == EXIT_MESH_FILE_ALT_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File error: altitude out of range.')
- *         elif err == EXIT_MESH_FILE_NLON_ERROR:
- */
-    case EXIT_MESH_FILE_ALT_ERROR:
-
-    /* "geomag/emm.pyx":210
- *             raise RuntimeError('File error: number of latitude rows out of range.')
- *         elif err == EXIT_MESH_FILE_ALT_ERROR:
- *             raise RuntimeError('File error: altitude out of range.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_NLON_ERROR:
- *             raise RuntimeError('File error: number of longitude cells at latitude and altitude out of range.')
- */
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_RuntimeError, __pyx_tuple__11, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 210, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __PYX_ERR(0, 210, __pyx_L1_error)
-
-    /* "geomag/emm.pyx":209
- *         elif err == EXIT_MESH_FILE_NLAT_ERROR:
- *             raise RuntimeError('File error: number of latitude rows out of range.')
- *         elif err == EXIT_MESH_FILE_ALT_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File error: altitude out of range.')
- *         elif err == EXIT_MESH_FILE_NLON_ERROR:
- */
-    break;
-
-    /* "geomag/emm.pyx":211
- *         elif err == EXIT_MESH_FILE_ALT_ERROR:
- *             raise RuntimeError('File error: altitude out of range.')
- *         elif err == EXIT_MESH_FILE_NLON_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File error: number of longitude cells at latitude and altitude out of range.')
- * 
- */
-    case EXIT_MESH_FILE_NLON_ERROR:
-
-    /* "geomag/emm.pyx":212
- *             raise RuntimeError('File error: altitude out of range.')
- *         elif err == EXIT_MESH_FILE_NLON_ERROR:
- *             raise RuntimeError('File error: number of longitude cells at latitude and altitude out of range.')             # <<<<<<<<<<<<<<
- * 
- * ##cdef class EMMSph(EMMBase):
- */
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_RuntimeError, __pyx_tuple__12, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 212, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __PYX_ERR(0, 212, __pyx_L1_error)
-
-    /* "geomag/emm.pyx":211
- *         elif err == EXIT_MESH_FILE_ALT_ERROR:
- *             raise RuntimeError('File error: altitude out of range.')
- *         elif err == EXIT_MESH_FILE_NLON_ERROR:             # <<<<<<<<<<<<<<
- *             raise RuntimeError('File error: number of longitude cells at latitude and altitude out of range.')
- * 
- */
-    break;
-    default: break;
-  }
-
-  /* "geomag/emm.pyx":191
- * 
- *     @staticmethod
- *     cdef _EMM_check(int err):             # <<<<<<<<<<<<<<
- *         """Check error codes"""
- *         if err == EXIT_MESH_MEM_ALLOC_ERROR:
- */
-
-  /* function exit code */
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.EMMBase._EMM_check", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = 0;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "(tree fragment)":1
- * def __reduce_cython__(self):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMBase_9__reduce_cython__(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_7EMMBase_9__reduce_cython__(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__reduce_cython__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMBase_8__reduce_cython__(((struct __pyx_obj_6geomag_3emm_EMMBase *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMBase_8__reduce_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMBase *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__reduce_cython__", 0);
-
-  /* "(tree fragment)":2
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-  __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_TypeError, __pyx_tuple__13, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(1, 2, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __PYX_ERR(1, 2, __pyx_L1_error)
-
-  /* "(tree fragment)":1
- * def __reduce_cython__(self):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.EMMBase.__reduce_cython__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "(tree fragment)":3
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMBase_11__setstate_cython__(PyObject *__pyx_v_self, PyObject *__pyx_v___pyx_state); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_7EMMBase_11__setstate_cython__(PyObject *__pyx_v_self, PyObject *__pyx_v___pyx_state) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__setstate_cython__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMBase_10__setstate_cython__(((struct __pyx_obj_6geomag_3emm_EMMBase *)__pyx_v_self), ((PyObject *)__pyx_v___pyx_state));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMBase_10__setstate_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMBase *__pyx_v_self, CYTHON_UNUSED PyObject *__pyx_v___pyx_state) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__setstate_cython__", 0);
-
-  /* "(tree fragment)":4
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- */
-  __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_TypeError, __pyx_tuple__14, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(1, 4, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __PYX_ERR(1, 4, __pyx_L1_error)
-
-  /* "(tree fragment)":3
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.EMMBase.__setstate_cython__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":239
- *     cdef bint _smloaded
- * 
- *     def __cinit__(self, str mesh_fname, str secmesh_fname, bint delay_load = False):             # <<<<<<<<<<<<<<
- *         self._mfname = bytes(mesh_fname,'UTF-8')
- *         self._smfname = bytes(secmesh_fname,'UTF-8')
- */
-
-/* Python wrapper */
-static int __pyx_pw_6geomag_3emm_7EMMMesh_1__cinit__(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static int __pyx_pw_6geomag_3emm_7EMMMesh_1__cinit__(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_mesh_fname = 0;
-  PyObject *__pyx_v_secmesh_fname = 0;
-  int __pyx_v_delay_load;
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__cinit__ (wrapper)", 0);
-  {
-    static PyObject **__pyx_pyargnames[] = {&__pyx_n_s_mesh_fname,&__pyx_n_s_secmesh_fname,&__pyx_n_s_delay_load,0};
-    PyObject* values[3] = {0,0,0};
-    if (unlikely(__pyx_kwds)) {
-      Py_ssize_t kw_args;
-      const Py_ssize_t pos_args = PyTuple_GET_SIZE(__pyx_args);
-      switch (pos_args) {
-        case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-        CYTHON_FALLTHROUGH;
-        case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        CYTHON_FALLTHROUGH;
-        case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        CYTHON_FALLTHROUGH;
-        case  0: break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-      kw_args = PyDict_Size(__pyx_kwds);
-      switch (pos_args) {
-        case  0:
-        if (likely((values[0] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_mesh_fname)) != 0)) kw_args--;
-        else goto __pyx_L5_argtuple_error;
-        CYTHON_FALLTHROUGH;
-        case  1:
-        if (likely((values[1] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_secmesh_fname)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("__cinit__", 0, 2, 3, 1); __PYX_ERR(0, 239, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  2:
-        if (kw_args > 0) {
-          PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_n_s_delay_load);
-          if (value) { values[2] = value; kw_args--; }
-        }
-      }
-      if (unlikely(kw_args > 0)) {
-        if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, pos_args, "__cinit__") < 0)) __PYX_ERR(0, 239, __pyx_L3_error)
-      }
-    } else {
-      switch (PyTuple_GET_SIZE(__pyx_args)) {
-        case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-        CYTHON_FALLTHROUGH;
-        case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-    }
-    __pyx_v_mesh_fname = ((PyObject*)values[0]);
-    __pyx_v_secmesh_fname = ((PyObject*)values[1]);
-    if (values[2]) {
-      __pyx_v_delay_load = __Pyx_PyObject_IsTrue(values[2]); if (unlikely((__pyx_v_delay_load == (int)-1) && PyErr_Occurred())) __PYX_ERR(0, 239, __pyx_L3_error)
-    } else {
-      __pyx_v_delay_load = ((int)0);
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("__cinit__", 0, 2, 3, PyTuple_GET_SIZE(__pyx_args)); __PYX_ERR(0, 239, __pyx_L3_error)
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.__cinit__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __Pyx_RefNannyFinishContext();
-  return -1;
-  __pyx_L4_argument_unpacking_done:;
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_mesh_fname), (&PyString_Type), 1, "mesh_fname", 1))) __PYX_ERR(0, 239, __pyx_L1_error)
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_secmesh_fname), (&PyString_Type), 1, "secmesh_fname", 1))) __PYX_ERR(0, 239, __pyx_L1_error)
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMMesh___cinit__(((struct __pyx_obj_6geomag_3emm_EMMMesh *)__pyx_v_self), __pyx_v_mesh_fname, __pyx_v_secmesh_fname, __pyx_v_delay_load);
-
-  /* function exit code */
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static int __pyx_pf_6geomag_3emm_7EMMMesh___cinit__(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_mesh_fname, PyObject *__pyx_v_secmesh_fname, int __pyx_v_delay_load) {
-  int __pyx_r;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  int __pyx_t_3;
-  __Pyx_RefNannySetupContext("__cinit__", 0);
-
-  /* "geomag/emm.pyx":240
- * 
- *     def __cinit__(self, str mesh_fname, str secmesh_fname, bint delay_load = False):
- *         self._mfname = bytes(mesh_fname,'UTF-8')             # <<<<<<<<<<<<<<
- *         self._smfname = bytes(secmesh_fname,'UTF-8')
- *         self._mloaded = 0
- */
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 240, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_INCREF(__pyx_v_mesh_fname);
-  __Pyx_GIVEREF(__pyx_v_mesh_fname);
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_mesh_fname);
-  __Pyx_INCREF(__pyx_kp_s_UTF_8);
-  __Pyx_GIVEREF(__pyx_kp_s_UTF_8);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_kp_s_UTF_8);
-  __pyx_t_2 = __Pyx_PyObject_Call(((PyObject *)(&PyBytes_Type)), __pyx_t_1, NULL); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 240, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_GIVEREF(__pyx_t_2);
-  __Pyx_GOTREF(__pyx_v_self->_mfname);
-  __Pyx_DECREF(__pyx_v_self->_mfname);
-  __pyx_v_self->_mfname = ((PyObject*)__pyx_t_2);
-  __pyx_t_2 = 0;
-
-  /* "geomag/emm.pyx":241
- *     def __cinit__(self, str mesh_fname, str secmesh_fname, bint delay_load = False):
- *         self._mfname = bytes(mesh_fname,'UTF-8')
- *         self._smfname = bytes(secmesh_fname,'UTF-8')             # <<<<<<<<<<<<<<
- *         self._mloaded = 0
- *         self._smloaded = 0
- */
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 241, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_INCREF(__pyx_v_secmesh_fname);
-  __Pyx_GIVEREF(__pyx_v_secmesh_fname);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_secmesh_fname);
-  __Pyx_INCREF(__pyx_kp_s_UTF_8);
-  __Pyx_GIVEREF(__pyx_kp_s_UTF_8);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_kp_s_UTF_8);
-  __pyx_t_1 = __Pyx_PyObject_Call(((PyObject *)(&PyBytes_Type)), __pyx_t_2, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 241, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_GIVEREF(__pyx_t_1);
-  __Pyx_GOTREF(__pyx_v_self->_smfname);
-  __Pyx_DECREF(__pyx_v_self->_smfname);
-  __pyx_v_self->_smfname = ((PyObject*)__pyx_t_1);
-  __pyx_t_1 = 0;
-
-  /* "geomag/emm.pyx":242
- *         self._mfname = bytes(mesh_fname,'UTF-8')
- *         self._smfname = bytes(secmesh_fname,'UTF-8')
- *         self._mloaded = 0             # <<<<<<<<<<<<<<
- *         self._smloaded = 0
- *         if not delay_load:
- */
-  __pyx_v_self->_mloaded = 0;
-
-  /* "geomag/emm.pyx":243
- *         self._smfname = bytes(secmesh_fname,'UTF-8')
- *         self._mloaded = 0
- *         self._smloaded = 0             # <<<<<<<<<<<<<<
- *         if not delay_load:
- *             self._load_c()
- */
-  __pyx_v_self->_smloaded = 0;
-
-  /* "geomag/emm.pyx":244
- *         self._mloaded = 0
- *         self._smloaded = 0
- *         if not delay_load:             # <<<<<<<<<<<<<<
- *             self._load_c()
- * 
- */
-  __pyx_t_3 = ((!(__pyx_v_delay_load != 0)) != 0);
-  if (__pyx_t_3) {
-
-    /* "geomag/emm.pyx":245
- *         self._smloaded = 0
- *         if not delay_load:
- *             self._load_c()             # <<<<<<<<<<<<<<
- * 
- *     cdef MAGtype_GeoMagneticElements _compute_field_c(self, MAGtype_CoordGeodetic pos, MAGtype_CoordSpherical cs, MAGtype_Date date, bint compute_change = False):
- */
-    ((struct __pyx_vtabstruct_6geomag_3emm_EMMMesh *)__pyx_v_self->__pyx_base.__pyx_vtab)->_load_c(__pyx_v_self);
-
-    /* "geomag/emm.pyx":244
- *         self._mloaded = 0
- *         self._smloaded = 0
- *         if not delay_load:             # <<<<<<<<<<<<<<
- *             self._load_c()
- * 
- */
-  }
-
-  /* "geomag/emm.pyx":239
- *     cdef bint _smloaded
- * 
- *     def __cinit__(self, str mesh_fname, str secmesh_fname, bint delay_load = False):             # <<<<<<<<<<<<<<
- *         self._mfname = bytes(mesh_fname,'UTF-8')
- *         self._smfname = bytes(secmesh_fname,'UTF-8')
- */
-
-  /* function exit code */
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.__cinit__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":247
- *             self._load_c()
- * 
- *     cdef MAGtype_GeoMagneticElements _compute_field_c(self, MAGtype_CoordGeodetic pos, MAGtype_CoordSpherical cs, MAGtype_Date date, bint compute_change = False):             # <<<<<<<<<<<<<<
- *         #local variables:
- *         cdef MAGtype_MagneticResults magResults, magVariation
- */
-
-static MAGtype_GeoMagneticElements __pyx_f_6geomag_3emm_7EMMMesh__compute_field_c(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, MAGtype_CoordGeodetic __pyx_v_pos, MAGtype_CoordSpherical __pyx_v_cs, MAGtype_Date __pyx_v_date, struct __pyx_opt_args_6geomag_3emm_7EMMMesh__compute_field_c *__pyx_optional_args) {
-  int __pyx_v_compute_change = ((int)0);
-  MAGtype_MagneticResults __pyx_v_magResults;
-  MAGtype_MagneticResults __pyx_v_magVariation;
-  MAGtype_GeoMagneticElements __pyx_v_elements;
-  MAGtype_GeoMagneticElements __pyx_r;
-  __Pyx_RefNannyDeclarations
-  int __pyx_t_1;
-  __Pyx_RefNannySetupContext("_compute_field_c", 0);
-  if (__pyx_optional_args) {
-    if (__pyx_optional_args->__pyx_n > 0) {
-      __pyx_v_compute_change = __pyx_optional_args->compute_change;
-    }
-  }
-
-  /* "geomag/emm.pyx":252
- *         cdef MAGtype_GeoMagneticElements elements
- *         #load meshes if necessary:
- *         self._load_c()             # <<<<<<<<<<<<<<
- *         #compute magnetic results
- *         EMM_PointCalcFromMesh(pos, cs, date, &magResults, self._mesh, self._mesh_sv)
- */
-  ((struct __pyx_vtabstruct_6geomag_3emm_EMMMesh *)__pyx_v_self->__pyx_base.__pyx_vtab)->_load_c(__pyx_v_self);
-
-  /* "geomag/emm.pyx":254
- *         self._load_c()
- *         #compute magnetic results
- *         EMM_PointCalcFromMesh(pos, cs, date, &magResults, self._mesh, self._mesh_sv)             # <<<<<<<<<<<<<<
- *         #convert to geo-magnetic elements
- *         MAG_CalculateGeoMagneticElements(&magResults, &elements)
- */
-  EMM_PointCalcFromMesh(__pyx_v_pos, __pyx_v_cs, __pyx_v_date, (&__pyx_v_magResults), __pyx_v_self->_mesh, __pyx_v_self->_mesh_sv);
-
-  /* "geomag/emm.pyx":256
- *         EMM_PointCalcFromMesh(pos, cs, date, &magResults, self._mesh, self._mesh_sv)
- *         #convert to geo-magnetic elements
- *         MAG_CalculateGeoMagneticElements(&magResults, &elements)             # <<<<<<<<<<<<<<
- *         #compute secular variation
- *         if compute_change:
- */
-  MAG_CalculateGeoMagneticElements((&__pyx_v_magResults), (&__pyx_v_elements));
-
-  /* "geomag/emm.pyx":258
- *         MAG_CalculateGeoMagneticElements(&magResults, &elements)
- *         #compute secular variation
- *         if compute_change:             # <<<<<<<<<<<<<<
- *             date.DecimalYear += 1
- *             EMM_PointCalcFromMesh(pos, cs, date, &magVariation, self._mesh, self._mesh_sv)
- */
-  __pyx_t_1 = (__pyx_v_compute_change != 0);
-  if (__pyx_t_1) {
-
-    /* "geomag/emm.pyx":259
- *         #compute secular variation
- *         if compute_change:
- *             date.DecimalYear += 1             # <<<<<<<<<<<<<<
- *             EMM_PointCalcFromMesh(pos, cs, date, &magVariation, self._mesh, self._mesh_sv)
- *             magVariation.Bx -= magResults.Bx
- */
-    __pyx_v_date.DecimalYear = (__pyx_v_date.DecimalYear + 1.0);
-
-    /* "geomag/emm.pyx":260
- *         if compute_change:
- *             date.DecimalYear += 1
- *             EMM_PointCalcFromMesh(pos, cs, date, &magVariation, self._mesh, self._mesh_sv)             # <<<<<<<<<<<<<<
- *             magVariation.Bx -= magResults.Bx
- *             magVariation.By -= magResults.By
- */
-    EMM_PointCalcFromMesh(__pyx_v_pos, __pyx_v_cs, __pyx_v_date, (&__pyx_v_magVariation), __pyx_v_self->_mesh, __pyx_v_self->_mesh_sv);
-
-    /* "geomag/emm.pyx":261
- *             date.DecimalYear += 1
- *             EMM_PointCalcFromMesh(pos, cs, date, &magVariation, self._mesh, self._mesh_sv)
- *             magVariation.Bx -= magResults.Bx             # <<<<<<<<<<<<<<
- *             magVariation.By -= magResults.By
- *             magVariation.Bz -= magResults.Bz
- */
-    __pyx_v_magVariation.Bx = (__pyx_v_magVariation.Bx - __pyx_v_magResults.Bx);
-
-    /* "geomag/emm.pyx":262
- *             EMM_PointCalcFromMesh(pos, cs, date, &magVariation, self._mesh, self._mesh_sv)
- *             magVariation.Bx -= magResults.Bx
- *             magVariation.By -= magResults.By             # <<<<<<<<<<<<<<
- *             magVariation.Bz -= magResults.Bz
- *             MAG_CalculateSecularVariationElements(magVariation, &elements)
- */
-    __pyx_v_magVariation.By = (__pyx_v_magVariation.By - __pyx_v_magResults.By);
-
-    /* "geomag/emm.pyx":263
- *             magVariation.Bx -= magResults.Bx
- *             magVariation.By -= magResults.By
- *             magVariation.Bz -= magResults.Bz             # <<<<<<<<<<<<<<
- *             MAG_CalculateSecularVariationElements(magVariation, &elements)
- *         return elements
- */
-    __pyx_v_magVariation.Bz = (__pyx_v_magVariation.Bz - __pyx_v_magResults.Bz);
-
-    /* "geomag/emm.pyx":264
- *             magVariation.By -= magResults.By
- *             magVariation.Bz -= magResults.Bz
- *             MAG_CalculateSecularVariationElements(magVariation, &elements)             # <<<<<<<<<<<<<<
- *         return elements
- * 
- */
-    MAG_CalculateSecularVariationElements(__pyx_v_magVariation, (&__pyx_v_elements));
-
-    /* "geomag/emm.pyx":258
- *         MAG_CalculateGeoMagneticElements(&magResults, &elements)
- *         #compute secular variation
- *         if compute_change:             # <<<<<<<<<<<<<<
- *             date.DecimalYear += 1
- *             EMM_PointCalcFromMesh(pos, cs, date, &magVariation, self._mesh, self._mesh_sv)
- */
-  }
-
-  /* "geomag/emm.pyx":265
- *             magVariation.Bz -= magResults.Bz
- *             MAG_CalculateSecularVariationElements(magVariation, &elements)
- *         return elements             # <<<<<<<<<<<<<<
- * 
- *     cdef MAGtype_GeoMagneticElements compute_field_c(self, double lat, double lon, double height, double year, bint geodetic = True, bint compute_change = False):
- */
-  __pyx_r = __pyx_v_elements;
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":247
- *             self._load_c()
- * 
- *     cdef MAGtype_GeoMagneticElements _compute_field_c(self, MAGtype_CoordGeodetic pos, MAGtype_CoordSpherical cs, MAGtype_Date date, bint compute_change = False):             # <<<<<<<<<<<<<<
- *         #local variables:
- *         cdef MAGtype_MagneticResults magResults, magVariation
- */
-
-  /* function exit code */
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":267
- *         return elements
- * 
- *     cdef MAGtype_GeoMagneticElements compute_field_c(self, double lat, double lon, double height, double year, bint geodetic = True, bint compute_change = False):             # <<<<<<<<<<<<<<
- *         #local variables
- *         cdef MAGtype_Date date
- */
-
-static MAGtype_GeoMagneticElements __pyx_f_6geomag_3emm_7EMMMesh_compute_field_c(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, double __pyx_v_lat, double __pyx_v_lon, double __pyx_v_height, double __pyx_v_year, struct __pyx_opt_args_6geomag_3emm_7EMMMesh_compute_field_c *__pyx_optional_args) {
-  int __pyx_v_geodetic = ((int)1);
-  int __pyx_v_compute_change = ((int)0);
-  MAGtype_Date __pyx_v_date;
-  MAGtype_CoordGeodetic __pyx_v_pos;
-  MAGtype_CoordSpherical __pyx_v_cs;
-  MAGtype_GeoMagneticElements __pyx_r;
-  __Pyx_RefNannyDeclarations
-  int __pyx_t_1;
-  MAGtype_GeoMagneticElements __pyx_t_2;
-  struct __pyx_opt_args_6geomag_3emm_7EMMMesh__compute_field_c __pyx_t_3;
-  __Pyx_RefNannySetupContext("compute_field_c", 0);
-  if (__pyx_optional_args) {
-    if (__pyx_optional_args->__pyx_n > 0) {
-      __pyx_v_geodetic = __pyx_optional_args->geodetic;
-      if (__pyx_optional_args->__pyx_n > 1) {
-        __pyx_v_compute_change = __pyx_optional_args->compute_change;
-      }
-    }
-  }
-
-  /* "geomag/emm.pyx":274
- * 
- *         #put year into a date struct:
- *         date.DecimalYear = year             # <<<<<<<<<<<<<<
- * 
- *         #convert coordinates
- */
-  __pyx_v_date.DecimalYear = __pyx_v_year;
-
-  /* "geomag/emm.pyx":277
- * 
- *         #convert coordinates
- *         pos.lat = lat             # <<<<<<<<<<<<<<
- *         pos.lon = lon
- *         if geodetic:
- */
-  __pyx_v_pos.phi = __pyx_v_lat;
-
-  /* "geomag/emm.pyx":278
- *         #convert coordinates
- *         pos.lat = lat
- *         pos.lon = lon             # <<<<<<<<<<<<<<
- *         if geodetic:
- *             pos.HeightAboveGeoid = height
- */
-  __pyx_v_pos.lambda = __pyx_v_lon;
-
-  /* "geomag/emm.pyx":279
- *         pos.lat = lat
- *         pos.lon = lon
- *         if geodetic:             # <<<<<<<<<<<<<<
- *             pos.HeightAboveGeoid = height
- *             pos.UseGeoid = 1
- */
-  __pyx_t_1 = (__pyx_v_geodetic != 0);
-  if (__pyx_t_1) {
-
-    /* "geomag/emm.pyx":280
- *         pos.lon = lon
- *         if geodetic:
- *             pos.HeightAboveGeoid = height             # <<<<<<<<<<<<<<
- *             pos.UseGeoid = 1
- *             self._geoid.UseGeoid = 1
- */
-    __pyx_v_pos.HeightAboveGeoid = __pyx_v_height;
-
-    /* "geomag/emm.pyx":281
- *         if geodetic:
- *             pos.HeightAboveGeoid = height
- *             pos.UseGeoid = 1             # <<<<<<<<<<<<<<
- *             self._geoid.UseGeoid = 1
- *             MAG_ConvertGeoidToEllipsoidHeight(&pos, &self._geoid)
- */
-    __pyx_v_pos.UseGeoid = 1;
-
-    /* "geomag/emm.pyx":282
- *             pos.HeightAboveGeoid = height
- *             pos.UseGeoid = 1
- *             self._geoid.UseGeoid = 1             # <<<<<<<<<<<<<<
- *             MAG_ConvertGeoidToEllipsoidHeight(&pos, &self._geoid)
- *         else:
- */
-    __pyx_v_self->__pyx_base._geoid.UseGeoid = 1;
-
-    /* "geomag/emm.pyx":283
- *             pos.UseGeoid = 1
- *             self._geoid.UseGeoid = 1
- *             MAG_ConvertGeoidToEllipsoidHeight(&pos, &self._geoid)             # <<<<<<<<<<<<<<
- *         else:
- *             pos.UseGeoid = 0
- */
-    MAG_ConvertGeoidToEllipsoidHeight((&__pyx_v_pos), (&__pyx_v_self->__pyx_base._geoid));
-
-    /* "geomag/emm.pyx":279
- *         pos.lat = lat
- *         pos.lon = lon
- *         if geodetic:             # <<<<<<<<<<<<<<
- *             pos.HeightAboveGeoid = height
- *             pos.UseGeoid = 1
- */
-    goto __pyx_L3;
-  }
-
-  /* "geomag/emm.pyx":285
- *             MAG_ConvertGeoidToEllipsoidHeight(&pos, &self._geoid)
- *         else:
- *             pos.UseGeoid = 0             # <<<<<<<<<<<<<<
- *             self._geoid.UseGeoid = 0
- *             pos.HeightAboveGeoid = height
- */
-  /*else*/ {
-    __pyx_v_pos.UseGeoid = 0;
-
-    /* "geomag/emm.pyx":286
- *         else:
- *             pos.UseGeoid = 0
- *             self._geoid.UseGeoid = 0             # <<<<<<<<<<<<<<
- *             pos.HeightAboveGeoid = height
- *             pos.HeightAboveEllipsoid = height
- */
-    __pyx_v_self->__pyx_base._geoid.UseGeoid = 0;
-
-    /* "geomag/emm.pyx":287
- *             pos.UseGeoid = 0
- *             self._geoid.UseGeoid = 0
- *             pos.HeightAboveGeoid = height             # <<<<<<<<<<<<<<
- *             pos.HeightAboveEllipsoid = height
- * 
- */
-    __pyx_v_pos.HeightAboveGeoid = __pyx_v_height;
-
-    /* "geomag/emm.pyx":288
- *             self._geoid.UseGeoid = 0
- *             pos.HeightAboveGeoid = height
- *             pos.HeightAboveEllipsoid = height             # <<<<<<<<<<<<<<
- * 
- *         MAG_GeodeticToSpherical(self._ellip, pos, &cs)
- */
-    __pyx_v_pos.HeightAboveEllipsoid = __pyx_v_height;
-  }
-  __pyx_L3:;
-
-  /* "geomag/emm.pyx":290
- *             pos.HeightAboveEllipsoid = height
- * 
- *         MAG_GeodeticToSpherical(self._ellip, pos, &cs)             # <<<<<<<<<<<<<<
- * 
- *         return self._compute_field_c(pos, cs, date, compute_change)
- */
-  MAG_GeodeticToSpherical(__pyx_v_self->__pyx_base._ellip, __pyx_v_pos, (&__pyx_v_cs));
-
-  /* "geomag/emm.pyx":292
- *         MAG_GeodeticToSpherical(self._ellip, pos, &cs)
- * 
- *         return self._compute_field_c(pos, cs, date, compute_change)             # <<<<<<<<<<<<<<
- * 
- *     cdef void _load_c(self):
- */
-  __pyx_t_3.__pyx_n = 1;
-  __pyx_t_3.compute_change = __pyx_v_compute_change;
-  __pyx_t_2 = ((struct __pyx_vtabstruct_6geomag_3emm_EMMMesh *)__pyx_v_self->__pyx_base.__pyx_vtab)->_compute_field_c(__pyx_v_self, __pyx_v_pos, __pyx_v_cs, __pyx_v_date, &__pyx_t_3); 
-  __pyx_r = __pyx_t_2;
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":267
- *         return elements
- * 
- *     cdef MAGtype_GeoMagneticElements compute_field_c(self, double lat, double lon, double height, double year, bint geodetic = True, bint compute_change = False):             # <<<<<<<<<<<<<<
- *         #local variables
- *         cdef MAGtype_Date date
- */
-
-  /* function exit code */
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":294
- *         return self._compute_field_c(pos, cs, date, compute_change)
- * 
- *     cdef void _load_c(self):             # <<<<<<<<<<<<<<
- *         if not self._mloaded:
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._mfname, &self._mesh))
- */
-
-static void __pyx_f_6geomag_3emm_7EMMMesh__load_c(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self) {
-  __Pyx_RefNannyDeclarations
-  int __pyx_t_1;
-  char *__pyx_t_2;
-  PyObject *__pyx_t_3 = NULL;
-  __Pyx_RefNannySetupContext("_load_c", 0);
-
-  /* "geomag/emm.pyx":295
- * 
- *     cdef void _load_c(self):
- *         if not self._mloaded:             # <<<<<<<<<<<<<<
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._mfname, &self._mesh))
- *             self._mloaded = 1
- */
-  __pyx_t_1 = ((!(__pyx_v_self->_mloaded != 0)) != 0);
-  if (__pyx_t_1) {
-
-    /* "geomag/emm.pyx":296
- *     cdef void _load_c(self):
- *         if not self._mloaded:
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._mfname, &self._mesh))             # <<<<<<<<<<<<<<
- *             self._mloaded = 1
- *         if not self._smloaded:
- */
-    __pyx_t_2 = __Pyx_PyObject_AsWritableString(__pyx_v_self->_mfname); if (unlikely((!__pyx_t_2) && PyErr_Occurred())) __PYX_ERR(0, 296, __pyx_L1_error)
-    __pyx_t_3 = __pyx_vtabptr_6geomag_3emm_EMMMesh->__pyx_base._EMM_check(EMM_mesh_read(0, __pyx_t_2, (&__pyx_v_self->_mesh))); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 296, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-
-    /* "geomag/emm.pyx":297
- *         if not self._mloaded:
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._mfname, &self._mesh))
- *             self._mloaded = 1             # <<<<<<<<<<<<<<
- *         if not self._smloaded:
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._smfname, &self._mesh_sv))
- */
-    __pyx_v_self->_mloaded = 1;
-
-    /* "geomag/emm.pyx":295
- * 
- *     cdef void _load_c(self):
- *         if not self._mloaded:             # <<<<<<<<<<<<<<
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._mfname, &self._mesh))
- *             self._mloaded = 1
- */
-  }
-
-  /* "geomag/emm.pyx":298
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._mfname, &self._mesh))
- *             self._mloaded = 1
- *         if not self._smloaded:             # <<<<<<<<<<<<<<
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._smfname, &self._mesh_sv))
- *             self._smloaded = 1
- */
-  __pyx_t_1 = ((!(__pyx_v_self->_smloaded != 0)) != 0);
-  if (__pyx_t_1) {
-
-    /* "geomag/emm.pyx":299
- *             self._mloaded = 1
- *         if not self._smloaded:
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._smfname, &self._mesh_sv))             # <<<<<<<<<<<<<<
- *             self._smloaded = 1
- * 
- */
-    __pyx_t_2 = __Pyx_PyObject_AsWritableString(__pyx_v_self->_smfname); if (unlikely((!__pyx_t_2) && PyErr_Occurred())) __PYX_ERR(0, 299, __pyx_L1_error)
-    __pyx_t_3 = __pyx_vtabptr_6geomag_3emm_EMMMesh->__pyx_base._EMM_check(EMM_mesh_read(0, __pyx_t_2, (&__pyx_v_self->_mesh_sv))); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 299, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-
-    /* "geomag/emm.pyx":300
- *         if not self._smloaded:
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._smfname, &self._mesh_sv))
- *             self._smloaded = 1             # <<<<<<<<<<<<<<
- * 
- *     def load(self,mesh=None,secmesh=None):
- */
-    __pyx_v_self->_smloaded = 1;
-
-    /* "geomag/emm.pyx":298
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._mfname, &self._mesh))
- *             self._mloaded = 1
- *         if not self._smloaded:             # <<<<<<<<<<<<<<
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._smfname, &self._mesh_sv))
- *             self._smloaded = 1
- */
-  }
-
-  /* "geomag/emm.pyx":294
- *         return self._compute_field_c(pos, cs, date, compute_change)
- * 
- *     cdef void _load_c(self):             # <<<<<<<<<<<<<<
- *         if not self._mloaded:
- *             EMMMesh._EMM_check(EMM_mesh_read(0, self._mfname, &self._mesh))
- */
-
-  /* function exit code */
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_WriteUnraisable("geomag.emm.EMMMesh._load_c", __pyx_clineno, __pyx_lineno, __pyx_filename, 1, 0);
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-}
-
-/* "geomag/emm.pyx":302
- *             self._smloaded = 1
- * 
- *     def load(self,mesh=None,secmesh=None):             # <<<<<<<<<<<<<<
- *         """load(mesh=None,secmesh=None)
- *             Load the specified mesh files, or if delay_load=True was specified in the constructor, load those files.
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_3load(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_6geomag_3emm_7EMMMesh_2load[] = "load(mesh=None,secmesh=None)\n            Load the specified mesh files, or if delay_load=True was specified in the constructor, load those files.\n            Paramters:\n                mesh, secmesh - filenames for mesh or secular variation mesh. Both are optional\n            No return value.\n        ";
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_3load(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_mesh = 0;
-  PyObject *__pyx_v_secmesh = 0;
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("load (wrapper)", 0);
-  {
-    static PyObject **__pyx_pyargnames[] = {&__pyx_n_s_mesh,&__pyx_n_s_secmesh,0};
-    PyObject* values[2] = {0,0};
-    values[0] = ((PyObject *)Py_None);
-    values[1] = ((PyObject *)Py_None);
-    if (unlikely(__pyx_kwds)) {
-      Py_ssize_t kw_args;
-      const Py_ssize_t pos_args = PyTuple_GET_SIZE(__pyx_args);
-      switch (pos_args) {
-        case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        CYTHON_FALLTHROUGH;
-        case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        CYTHON_FALLTHROUGH;
-        case  0: break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-      kw_args = PyDict_Size(__pyx_kwds);
-      switch (pos_args) {
-        case  0:
-        if (kw_args > 0) {
-          PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_n_s_mesh);
-          if (value) { values[0] = value; kw_args--; }
-        }
-        CYTHON_FALLTHROUGH;
-        case  1:
-        if (kw_args > 0) {
-          PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_n_s_secmesh);
-          if (value) { values[1] = value; kw_args--; }
-        }
-      }
-      if (unlikely(kw_args > 0)) {
-        if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, pos_args, "load") < 0)) __PYX_ERR(0, 302, __pyx_L3_error)
-      }
-    } else {
-      switch (PyTuple_GET_SIZE(__pyx_args)) {
-        case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        CYTHON_FALLTHROUGH;
-        case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        CYTHON_FALLTHROUGH;
-        case  0: break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-    }
-    __pyx_v_mesh = values[0];
-    __pyx_v_secmesh = values[1];
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("load", 0, 0, 2, PyTuple_GET_SIZE(__pyx_args)); __PYX_ERR(0, 302, __pyx_L3_error)
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.load", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __Pyx_RefNannyFinishContext();
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMMesh_2load(((struct __pyx_obj_6geomag_3emm_EMMMesh *)__pyx_v_self), __pyx_v_mesh, __pyx_v_secmesh);
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_2load(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_mesh, PyObject *__pyx_v_secmesh) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  int __pyx_t_1;
-  int __pyx_t_2;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  __Pyx_RefNannySetupContext("load", 0);
-
-  /* "geomag/emm.pyx":309
- *             No return value.
- *         """
- *         if mesh is not None:             # <<<<<<<<<<<<<<
- *             self._mfname = bytes(mesh,'UTF-8')
- *             self._mloaded = False
- */
-  __pyx_t_1 = (__pyx_v_mesh != Py_None);
-  __pyx_t_2 = (__pyx_t_1 != 0);
-  if (__pyx_t_2) {
-
-    /* "geomag/emm.pyx":310
- *         """
- *         if mesh is not None:
- *             self._mfname = bytes(mesh,'UTF-8')             # <<<<<<<<<<<<<<
- *             self._mloaded = False
- *         if secmesh is not None:
- */
-    __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 310, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_INCREF(__pyx_v_mesh);
-    __Pyx_GIVEREF(__pyx_v_mesh);
-    PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_v_mesh);
-    __Pyx_INCREF(__pyx_kp_s_UTF_8);
-    __Pyx_GIVEREF(__pyx_kp_s_UTF_8);
-    PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_kp_s_UTF_8);
-    __pyx_t_4 = __Pyx_PyObject_Call(((PyObject *)(&PyBytes_Type)), __pyx_t_3, NULL); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 310, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_GIVEREF(__pyx_t_4);
-    __Pyx_GOTREF(__pyx_v_self->_mfname);
-    __Pyx_DECREF(__pyx_v_self->_mfname);
-    __pyx_v_self->_mfname = ((PyObject*)__pyx_t_4);
-    __pyx_t_4 = 0;
-
-    /* "geomag/emm.pyx":311
- *         if mesh is not None:
- *             self._mfname = bytes(mesh,'UTF-8')
- *             self._mloaded = False             # <<<<<<<<<<<<<<
- *         if secmesh is not None:
- *             self._smfname = bytes(secmesh, 'UTF-8')
- */
-    __pyx_v_self->_mloaded = 0;
-
-    /* "geomag/emm.pyx":309
- *             No return value.
- *         """
- *         if mesh is not None:             # <<<<<<<<<<<<<<
- *             self._mfname = bytes(mesh,'UTF-8')
- *             self._mloaded = False
- */
-  }
-
-  /* "geomag/emm.pyx":312
- *             self._mfname = bytes(mesh,'UTF-8')
- *             self._mloaded = False
- *         if secmesh is not None:             # <<<<<<<<<<<<<<
- *             self._smfname = bytes(secmesh, 'UTF-8')
- *             self._smloaded = False
- */
-  __pyx_t_2 = (__pyx_v_secmesh != Py_None);
-  __pyx_t_1 = (__pyx_t_2 != 0);
-  if (__pyx_t_1) {
-
-    /* "geomag/emm.pyx":313
- *             self._mloaded = False
- *         if secmesh is not None:
- *             self._smfname = bytes(secmesh, 'UTF-8')             # <<<<<<<<<<<<<<
- *             self._smloaded = False
- *         self._load_c()
- */
-    __pyx_t_4 = PyTuple_New(2); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 313, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_INCREF(__pyx_v_secmesh);
-    __Pyx_GIVEREF(__pyx_v_secmesh);
-    PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_v_secmesh);
-    __Pyx_INCREF(__pyx_kp_s_UTF_8);
-    __Pyx_GIVEREF(__pyx_kp_s_UTF_8);
-    PyTuple_SET_ITEM(__pyx_t_4, 1, __pyx_kp_s_UTF_8);
-    __pyx_t_3 = __Pyx_PyObject_Call(((PyObject *)(&PyBytes_Type)), __pyx_t_4, NULL); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 313, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __Pyx_GIVEREF(__pyx_t_3);
-    __Pyx_GOTREF(__pyx_v_self->_smfname);
-    __Pyx_DECREF(__pyx_v_self->_smfname);
-    __pyx_v_self->_smfname = ((PyObject*)__pyx_t_3);
-    __pyx_t_3 = 0;
-
-    /* "geomag/emm.pyx":314
- *         if secmesh is not None:
- *             self._smfname = bytes(secmesh, 'UTF-8')
- *             self._smloaded = False             # <<<<<<<<<<<<<<
- *         self._load_c()
- * 
- */
-    __pyx_v_self->_smloaded = 0;
-
-    /* "geomag/emm.pyx":312
- *             self._mfname = bytes(mesh,'UTF-8')
- *             self._mloaded = False
- *         if secmesh is not None:             # <<<<<<<<<<<<<<
- *             self._smfname = bytes(secmesh, 'UTF-8')
- *             self._smloaded = False
- */
-  }
-
-  /* "geomag/emm.pyx":315
- *             self._smfname = bytes(secmesh, 'UTF-8')
- *             self._smloaded = False
- *         self._load_c()             # <<<<<<<<<<<<<<
- * 
- *     def is_loaded(self):
- */
-  ((struct __pyx_vtabstruct_6geomag_3emm_EMMMesh *)__pyx_v_self->__pyx_base.__pyx_vtab)->_load_c(__pyx_v_self);
-
-  /* "geomag/emm.pyx":302
- *             self._smloaded = 1
- * 
- *     def load(self,mesh=None,secmesh=None):             # <<<<<<<<<<<<<<
- *         """load(mesh=None,secmesh=None)
- *             Load the specified mesh files, or if delay_load=True was specified in the constructor, load those files.
- */
-
-  /* function exit code */
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.load", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":317
- *         self._load_c()
- * 
- *     def is_loaded(self):             # <<<<<<<<<<<<<<
- *         """is_loaded()
- *         Return True if mesh files have been loaded
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_5is_loaded(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused); /*proto*/
-static char __pyx_doc_6geomag_3emm_7EMMMesh_4is_loaded[] = "is_loaded()\n        Return True if mesh files have been loaded\n        ";
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_5is_loaded(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("is_loaded (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMMesh_4is_loaded(((struct __pyx_obj_6geomag_3emm_EMMMesh *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_4is_loaded(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  __Pyx_RefNannySetupContext("is_loaded", 0);
-
-  /* "geomag/emm.pyx":321
- *         Return True if mesh files have been loaded
- *         """
- *         return self._mloaded and self._smloaded             # <<<<<<<<<<<<<<
- * 
- *     def compute_field(self, lat, lon, height, year, geodetic = True, compute_change = False):
- */
-  __Pyx_XDECREF(__pyx_r);
-  if (__pyx_v_self->_mloaded) {
-  } else {
-    __pyx_t_2 = __Pyx_PyBool_FromLong(__pyx_v_self->_mloaded); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 321, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_2);
-    __pyx_t_1 = __pyx_t_2;
-    __pyx_t_2 = 0;
-    goto __pyx_L3_bool_binop_done;
-  }
-  __pyx_t_2 = __Pyx_PyBool_FromLong(__pyx_v_self->_smloaded); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 321, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = __pyx_t_2;
-  __pyx_t_2 = 0;
-  __pyx_L3_bool_binop_done:;
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":317
- *         self._load_c()
- * 
- *     def is_loaded(self):             # <<<<<<<<<<<<<<
- *         """is_loaded()
- *         Return True if mesh files have been loaded
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.is_loaded", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":323
- *         return self._mloaded and self._smloaded
- * 
- *     def compute_field(self, lat, lon, height, year, geodetic = True, compute_change = False):             # <<<<<<<<<<<<<<
- *         """compute_field(lat, lon, height, year, geodetic = True, compute_change = False)
- *             Parameters:
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_7compute_field(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_6geomag_3emm_7EMMMesh_6compute_field[] = "compute_field(lat, lon, height, year, geodetic = True, compute_change = False)\n            Parameters:\n                lat - latitude, in degrees\n                lon - longitude, in degrees\n                height - height above EGM96 mean sea level, or WGS-84 ellipsoid if geodetic = False\n                year - date, in decimal years\n                geodetic - if true, use EGM96 mean sea level as reference for height, otherwise use WGS-84 ellipsoid\n                compute_change - if true, compute secular variation of magnetic field (rate of chage per year)\n            Returns a GeoMagneticElements object with the results.\n        ";
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_7compute_field(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_lat = 0;
-  PyObject *__pyx_v_lon = 0;
-  PyObject *__pyx_v_height = 0;
-  PyObject *__pyx_v_year = 0;
-  PyObject *__pyx_v_geodetic = 0;
-  PyObject *__pyx_v_compute_change = 0;
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("compute_field (wrapper)", 0);
-  {
-    static PyObject **__pyx_pyargnames[] = {&__pyx_n_s_lat,&__pyx_n_s_lon,&__pyx_n_s_height,&__pyx_n_s_year,&__pyx_n_s_geodetic,&__pyx_n_s_compute_change,0};
-    PyObject* values[6] = {0,0,0,0,0,0};
-    values[4] = ((PyObject *)Py_True);
-    values[5] = ((PyObject *)Py_False);
-    if (unlikely(__pyx_kwds)) {
-      Py_ssize_t kw_args;
-      const Py_ssize_t pos_args = PyTuple_GET_SIZE(__pyx_args);
-      switch (pos_args) {
-        case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-        CYTHON_FALLTHROUGH;
-        case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-        CYTHON_FALLTHROUGH;
-        case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-        CYTHON_FALLTHROUGH;
-        case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-        CYTHON_FALLTHROUGH;
-        case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        CYTHON_FALLTHROUGH;
-        case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        CYTHON_FALLTHROUGH;
-        case  0: break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-      kw_args = PyDict_Size(__pyx_kwds);
-      switch (pos_args) {
-        case  0:
-        if (likely((values[0] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_lat)) != 0)) kw_args--;
-        else goto __pyx_L5_argtuple_error;
-        CYTHON_FALLTHROUGH;
-        case  1:
-        if (likely((values[1] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_lon)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("compute_field", 0, 4, 6, 1); __PYX_ERR(0, 323, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  2:
-        if (likely((values[2] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_height)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("compute_field", 0, 4, 6, 2); __PYX_ERR(0, 323, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  3:
-        if (likely((values[3] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_year)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("compute_field", 0, 4, 6, 3); __PYX_ERR(0, 323, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  4:
-        if (kw_args > 0) {
-          PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_n_s_geodetic);
-          if (value) { values[4] = value; kw_args--; }
-        }
-        CYTHON_FALLTHROUGH;
-        case  5:
-        if (kw_args > 0) {
-          PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_n_s_compute_change);
-          if (value) { values[5] = value; kw_args--; }
-        }
-      }
-      if (unlikely(kw_args > 0)) {
-        if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, pos_args, "compute_field") < 0)) __PYX_ERR(0, 323, __pyx_L3_error)
-      }
-    } else {
-      switch (PyTuple_GET_SIZE(__pyx_args)) {
-        case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-        CYTHON_FALLTHROUGH;
-        case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-        CYTHON_FALLTHROUGH;
-        case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-        values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-        values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-    }
-    __pyx_v_lat = values[0];
-    __pyx_v_lon = values[1];
-    __pyx_v_height = values[2];
-    __pyx_v_year = values[3];
-    __pyx_v_geodetic = values[4];
-    __pyx_v_compute_change = values[5];
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("compute_field", 0, 4, 6, PyTuple_GET_SIZE(__pyx_args)); __PYX_ERR(0, 323, __pyx_L3_error)
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.compute_field", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __Pyx_RefNannyFinishContext();
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMMesh_6compute_field(((struct __pyx_obj_6geomag_3emm_EMMMesh *)__pyx_v_self), __pyx_v_lat, __pyx_v_lon, __pyx_v_height, __pyx_v_year, __pyx_v_geodetic, __pyx_v_compute_change);
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_6compute_field(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_lat, PyObject *__pyx_v_lon, PyObject *__pyx_v_height, PyObject *__pyx_v_year, PyObject *__pyx_v_geodetic, PyObject *__pyx_v_compute_change) {
-  struct __pyx_obj_6geomag_3emm_GeoMagneticElements *__pyx_v_elements = NULL;
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  double __pyx_t_4;
-  double __pyx_t_5;
-  double __pyx_t_6;
-  double __pyx_t_7;
-  int __pyx_t_8;
-  int __pyx_t_9;
-  MAGtype_GeoMagneticElements __pyx_t_10;
-  struct __pyx_opt_args_6geomag_3emm_7EMMMesh_compute_field_c __pyx_t_11;
-  __Pyx_RefNannySetupContext("compute_field", 0);
-  __Pyx_INCREF(__pyx_v_lat);
-  __Pyx_INCREF(__pyx_v_lon);
-
-  /* "geomag/emm.pyx":334
- *             Returns a GeoMagneticElements object with the results.
- *         """
- *         lat,lon = self.norm_lat_lon(lat,lon)             # <<<<<<<<<<<<<<
- *         elements = GeoMagneticElements()
- *         elements._setup(self.compute_field_c(lat,lon,height,year,geodetic,compute_change))
- */
-  __pyx_t_1 = ((struct __pyx_vtabstruct_6geomag_3emm_EMMMesh *)__pyx_v_self->__pyx_base.__pyx_vtab)->__pyx_base.norm_lat_lon(((struct __pyx_obj_6geomag_3emm_EMMBase *)__pyx_v_self), __pyx_v_lat, __pyx_v_lon); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 334, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  if (likely(__pyx_t_1 != Py_None)) {
-    PyObject* sequence = __pyx_t_1;
-    #if !CYTHON_COMPILING_IN_PYPY
-    Py_ssize_t size = Py_SIZE(sequence);
-    #else
-    Py_ssize_t size = PySequence_Size(sequence);
-    #endif
-    if (unlikely(size != 2)) {
-      if (size > 2) __Pyx_RaiseTooManyValuesError(2);
-      else if (size >= 0) __Pyx_RaiseNeedMoreValuesError(size);
-      __PYX_ERR(0, 334, __pyx_L1_error)
-    }
-    #if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_AVOID_BORROWED_REFS
-    __pyx_t_2 = PyTuple_GET_ITEM(sequence, 0); 
-    __pyx_t_3 = PyTuple_GET_ITEM(sequence, 1); 
-    __Pyx_INCREF(__pyx_t_2);
-    __Pyx_INCREF(__pyx_t_3);
-    #else
-    __pyx_t_2 = PySequence_ITEM(sequence, 0); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 334, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_2);
-    __pyx_t_3 = PySequence_ITEM(sequence, 1); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 334, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_3);
-    #endif
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  } else {
-    __Pyx_RaiseNoneNotIterableError(); __PYX_ERR(0, 334, __pyx_L1_error)
-  }
-  __Pyx_DECREF_SET(__pyx_v_lat, __pyx_t_2);
-  __pyx_t_2 = 0;
-  __Pyx_DECREF_SET(__pyx_v_lon, __pyx_t_3);
-  __pyx_t_3 = 0;
-
-  /* "geomag/emm.pyx":335
- *         """
- *         lat,lon = self.norm_lat_lon(lat,lon)
- *         elements = GeoMagneticElements()             # <<<<<<<<<<<<<<
- *         elements._setup(self.compute_field_c(lat,lon,height,year,geodetic,compute_change))
- *         return elements
- */
-  __pyx_t_1 = __Pyx_PyObject_Call(((PyObject *)__pyx_ptype_6geomag_3emm_GeoMagneticElements), __pyx_empty_tuple, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 335, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_v_elements = ((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)__pyx_t_1);
-  __pyx_t_1 = 0;
-
-  /* "geomag/emm.pyx":336
- *         lat,lon = self.norm_lat_lon(lat,lon)
- *         elements = GeoMagneticElements()
- *         elements._setup(self.compute_field_c(lat,lon,height,year,geodetic,compute_change))             # <<<<<<<<<<<<<<
- *         return elements
- * 
- */
-  __pyx_t_4 = __pyx_PyFloat_AsDouble(__pyx_v_lat); if (unlikely((__pyx_t_4 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 336, __pyx_L1_error)
-  __pyx_t_5 = __pyx_PyFloat_AsDouble(__pyx_v_lon); if (unlikely((__pyx_t_5 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 336, __pyx_L1_error)
-  __pyx_t_6 = __pyx_PyFloat_AsDouble(__pyx_v_height); if (unlikely((__pyx_t_6 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 336, __pyx_L1_error)
-  __pyx_t_7 = __pyx_PyFloat_AsDouble(__pyx_v_year); if (unlikely((__pyx_t_7 == (double)-1) && PyErr_Occurred())) __PYX_ERR(0, 336, __pyx_L1_error)
-  __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_v_geodetic); if (unlikely((__pyx_t_8 == (int)-1) && PyErr_Occurred())) __PYX_ERR(0, 336, __pyx_L1_error)
-  __pyx_t_9 = __Pyx_PyObject_IsTrue(__pyx_v_compute_change); if (unlikely((__pyx_t_9 == (int)-1) && PyErr_Occurred())) __PYX_ERR(0, 336, __pyx_L1_error)
-  __pyx_t_11.__pyx_n = 2;
-  __pyx_t_11.geodetic = __pyx_t_8;
-  __pyx_t_11.compute_change = __pyx_t_9;
-  __pyx_t_10 = ((struct __pyx_vtabstruct_6geomag_3emm_EMMMesh *)__pyx_v_self->__pyx_base.__pyx_vtab)->compute_field_c(__pyx_v_self, __pyx_t_4, __pyx_t_5, __pyx_t_6, __pyx_t_7, &__pyx_t_11); 
-  __pyx_t_1 = ((struct __pyx_vtabstruct_6geomag_3emm_GeoMagneticElements *)__pyx_v_elements->__pyx_vtab)->_setup(__pyx_v_elements, __pyx_t_10); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 336, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "geomag/emm.pyx":337
- *         elements = GeoMagneticElements()
- *         elements._setup(self.compute_field_c(lat,lon,height,year,geodetic,compute_change))
- *         return elements             # <<<<<<<<<<<<<<
- * 
- *     def declination(self, lat, lon, height, year, geodetic = True):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(((PyObject *)__pyx_v_elements));
-  __pyx_r = ((PyObject *)__pyx_v_elements);
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":323
- *         return self._mloaded and self._smloaded
- * 
- *     def compute_field(self, lat, lon, height, year, geodetic = True, compute_change = False):             # <<<<<<<<<<<<<<
- *         """compute_field(lat, lon, height, year, geodetic = True, compute_change = False)
- *             Parameters:
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.compute_field", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XDECREF((PyObject *)__pyx_v_elements);
-  __Pyx_XDECREF(__pyx_v_lat);
-  __Pyx_XDECREF(__pyx_v_lon);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":339
- *         return elements
- * 
- *     def declination(self, lat, lon, height, year, geodetic = True):             # <<<<<<<<<<<<<<
- *         """declination(lat, lon, height, year, geodetic = True)
- *         Angle (deg) between the magnetic field vector and true north, positive east."""
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_9declination(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_6geomag_3emm_7EMMMesh_8declination[] = "declination(lat, lon, height, year, geodetic = True)\n        Angle (deg) between the magnetic field vector and true north, positive east.";
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_9declination(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_lat = 0;
-  PyObject *__pyx_v_lon = 0;
-  PyObject *__pyx_v_height = 0;
-  PyObject *__pyx_v_year = 0;
-  PyObject *__pyx_v_geodetic = 0;
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("declination (wrapper)", 0);
-  {
-    static PyObject **__pyx_pyargnames[] = {&__pyx_n_s_lat,&__pyx_n_s_lon,&__pyx_n_s_height,&__pyx_n_s_year,&__pyx_n_s_geodetic,0};
-    PyObject* values[5] = {0,0,0,0,0};
-    values[4] = ((PyObject *)Py_True);
-    if (unlikely(__pyx_kwds)) {
-      Py_ssize_t kw_args;
-      const Py_ssize_t pos_args = PyTuple_GET_SIZE(__pyx_args);
-      switch (pos_args) {
-        case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-        CYTHON_FALLTHROUGH;
-        case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-        CYTHON_FALLTHROUGH;
-        case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-        CYTHON_FALLTHROUGH;
-        case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        CYTHON_FALLTHROUGH;
-        case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        CYTHON_FALLTHROUGH;
-        case  0: break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-      kw_args = PyDict_Size(__pyx_kwds);
-      switch (pos_args) {
-        case  0:
-        if (likely((values[0] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_lat)) != 0)) kw_args--;
-        else goto __pyx_L5_argtuple_error;
-        CYTHON_FALLTHROUGH;
-        case  1:
-        if (likely((values[1] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_lon)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("declination", 0, 4, 5, 1); __PYX_ERR(0, 339, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  2:
-        if (likely((values[2] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_height)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("declination", 0, 4, 5, 2); __PYX_ERR(0, 339, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  3:
-        if (likely((values[3] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_year)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("declination", 0, 4, 5, 3); __PYX_ERR(0, 339, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  4:
-        if (kw_args > 0) {
-          PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_n_s_geodetic);
-          if (value) { values[4] = value; kw_args--; }
-        }
-      }
-      if (unlikely(kw_args > 0)) {
-        if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, pos_args, "declination") < 0)) __PYX_ERR(0, 339, __pyx_L3_error)
-      }
-    } else {
-      switch (PyTuple_GET_SIZE(__pyx_args)) {
-        case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-        CYTHON_FALLTHROUGH;
-        case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-        values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-        values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-    }
-    __pyx_v_lat = values[0];
-    __pyx_v_lon = values[1];
-    __pyx_v_height = values[2];
-    __pyx_v_year = values[3];
-    __pyx_v_geodetic = values[4];
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("declination", 0, 4, 5, PyTuple_GET_SIZE(__pyx_args)); __PYX_ERR(0, 339, __pyx_L3_error)
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.declination", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __Pyx_RefNannyFinishContext();
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMMesh_8declination(((struct __pyx_obj_6geomag_3emm_EMMMesh *)__pyx_v_self), __pyx_v_lat, __pyx_v_lon, __pyx_v_height, __pyx_v_year, __pyx_v_geodetic);
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_8declination(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_lat, PyObject *__pyx_v_lon, PyObject *__pyx_v_height, PyObject *__pyx_v_year, PyObject *__pyx_v_geodetic) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  PyObject *__pyx_t_5 = NULL;
-  __Pyx_RefNannySetupContext("declination", 0);
-
-  /* "geomag/emm.pyx":342
- *         """declination(lat, lon, height, year, geodetic = True)
- *         Angle (deg) between the magnetic field vector and true north, positive east."""
- *         return self.compute_field(lat,lon,height,year,geodetic).Decl             # <<<<<<<<<<<<<<
- * 
- *     def true_to_magnetic(self, head, lat, lon, height, year, geodetic = True):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_2 = __Pyx_PyObject_GetAttrStr(((PyObject *)__pyx_v_self), __pyx_n_s_compute_field); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 342, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = NULL;
-  __pyx_t_4 = 0;
-  if (CYTHON_UNPACK_METHODS && likely(PyMethod_Check(__pyx_t_2))) {
-    __pyx_t_3 = PyMethod_GET_SELF(__pyx_t_2);
-    if (likely(__pyx_t_3)) {
-      PyObject* function = PyMethod_GET_FUNCTION(__pyx_t_2);
-      __Pyx_INCREF(__pyx_t_3);
-      __Pyx_INCREF(function);
-      __Pyx_DECREF_SET(__pyx_t_2, function);
-      __pyx_t_4 = 1;
-    }
-  }
-  #if CYTHON_FAST_PYCALL
-  if (PyFunction_Check(__pyx_t_2)) {
-    PyObject *__pyx_temp[6] = {__pyx_t_3, __pyx_v_lat, __pyx_v_lon, __pyx_v_height, __pyx_v_year, __pyx_v_geodetic};
-    __pyx_t_1 = __Pyx_PyFunction_FastCall(__pyx_t_2, __pyx_temp+1-__pyx_t_4, 5+__pyx_t_4); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 342, __pyx_L1_error)
-    __Pyx_XDECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_GOTREF(__pyx_t_1);
-  } else
-  #endif
-  #if CYTHON_FAST_PYCCALL
-  if (__Pyx_PyFastCFunction_Check(__pyx_t_2)) {
-    PyObject *__pyx_temp[6] = {__pyx_t_3, __pyx_v_lat, __pyx_v_lon, __pyx_v_height, __pyx_v_year, __pyx_v_geodetic};
-    __pyx_t_1 = __Pyx_PyCFunction_FastCall(__pyx_t_2, __pyx_temp+1-__pyx_t_4, 5+__pyx_t_4); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 342, __pyx_L1_error)
-    __Pyx_XDECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_GOTREF(__pyx_t_1);
-  } else
-  #endif
-  {
-    __pyx_t_5 = PyTuple_New(5+__pyx_t_4); if (unlikely(!__pyx_t_5)) __PYX_ERR(0, 342, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_5);
-    if (__pyx_t_3) {
-      __Pyx_GIVEREF(__pyx_t_3); PyTuple_SET_ITEM(__pyx_t_5, 0, __pyx_t_3); __pyx_t_3 = NULL;
-    }
-    __Pyx_INCREF(__pyx_v_lat);
-    __Pyx_GIVEREF(__pyx_v_lat);
-    PyTuple_SET_ITEM(__pyx_t_5, 0+__pyx_t_4, __pyx_v_lat);
-    __Pyx_INCREF(__pyx_v_lon);
-    __Pyx_GIVEREF(__pyx_v_lon);
-    PyTuple_SET_ITEM(__pyx_t_5, 1+__pyx_t_4, __pyx_v_lon);
-    __Pyx_INCREF(__pyx_v_height);
-    __Pyx_GIVEREF(__pyx_v_height);
-    PyTuple_SET_ITEM(__pyx_t_5, 2+__pyx_t_4, __pyx_v_height);
-    __Pyx_INCREF(__pyx_v_year);
-    __Pyx_GIVEREF(__pyx_v_year);
-    PyTuple_SET_ITEM(__pyx_t_5, 3+__pyx_t_4, __pyx_v_year);
-    __Pyx_INCREF(__pyx_v_geodetic);
-    __Pyx_GIVEREF(__pyx_v_geodetic);
-    PyTuple_SET_ITEM(__pyx_t_5, 4+__pyx_t_4, __pyx_v_geodetic);
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_t_2, __pyx_t_5, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 342, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-  }
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_2 = __Pyx_PyObject_GetAttrStr(__pyx_t_1, __pyx_n_s_Decl); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 342, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_r = __pyx_t_2;
-  __pyx_t_2 = 0;
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":339
- *         return elements
- * 
- *     def declination(self, lat, lon, height, year, geodetic = True):             # <<<<<<<<<<<<<<
- *         """declination(lat, lon, height, year, geodetic = True)
- *         Angle (deg) between the magnetic field vector and true north, positive east."""
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.declination", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":344
- *         return self.compute_field(lat,lon,height,year,geodetic).Decl
- * 
- *     def true_to_magnetic(self, head, lat, lon, height, year, geodetic = True):             # <<<<<<<<<<<<<<
- *         """true_to_magnetic(head, lat, lon, height, year, geodetic = True)
- *         Convert a heading (deg) from true north to magnetic north (subtract declination)"""
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_11true_to_magnetic(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_6geomag_3emm_7EMMMesh_10true_to_magnetic[] = "true_to_magnetic(head, lat, lon, height, year, geodetic = True)\n        Convert a heading (deg) from true north to magnetic north (subtract declination)";
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_11true_to_magnetic(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_head = 0;
-  PyObject *__pyx_v_lat = 0;
-  PyObject *__pyx_v_lon = 0;
-  PyObject *__pyx_v_height = 0;
-  PyObject *__pyx_v_year = 0;
-  PyObject *__pyx_v_geodetic = 0;
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("true_to_magnetic (wrapper)", 0);
-  {
-    static PyObject **__pyx_pyargnames[] = {&__pyx_n_s_head,&__pyx_n_s_lat,&__pyx_n_s_lon,&__pyx_n_s_height,&__pyx_n_s_year,&__pyx_n_s_geodetic,0};
-    PyObject* values[6] = {0,0,0,0,0,0};
-    values[5] = ((PyObject *)Py_True);
-    if (unlikely(__pyx_kwds)) {
-      Py_ssize_t kw_args;
-      const Py_ssize_t pos_args = PyTuple_GET_SIZE(__pyx_args);
-      switch (pos_args) {
-        case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-        CYTHON_FALLTHROUGH;
-        case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-        CYTHON_FALLTHROUGH;
-        case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-        CYTHON_FALLTHROUGH;
-        case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-        CYTHON_FALLTHROUGH;
-        case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        CYTHON_FALLTHROUGH;
-        case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        CYTHON_FALLTHROUGH;
-        case  0: break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-      kw_args = PyDict_Size(__pyx_kwds);
-      switch (pos_args) {
-        case  0:
-        if (likely((values[0] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_head)) != 0)) kw_args--;
-        else goto __pyx_L5_argtuple_error;
-        CYTHON_FALLTHROUGH;
-        case  1:
-        if (likely((values[1] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_lat)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("true_to_magnetic", 0, 5, 6, 1); __PYX_ERR(0, 344, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  2:
-        if (likely((values[2] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_lon)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("true_to_magnetic", 0, 5, 6, 2); __PYX_ERR(0, 344, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  3:
-        if (likely((values[3] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_height)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("true_to_magnetic", 0, 5, 6, 3); __PYX_ERR(0, 344, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  4:
-        if (likely((values[4] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_year)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("true_to_magnetic", 0, 5, 6, 4); __PYX_ERR(0, 344, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  5:
-        if (kw_args > 0) {
-          PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_n_s_geodetic);
-          if (value) { values[5] = value; kw_args--; }
-        }
-      }
-      if (unlikely(kw_args > 0)) {
-        if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, pos_args, "true_to_magnetic") < 0)) __PYX_ERR(0, 344, __pyx_L3_error)
-      }
-    } else {
-      switch (PyTuple_GET_SIZE(__pyx_args)) {
-        case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-        CYTHON_FALLTHROUGH;
-        case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-        values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-        values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-        values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-    }
-    __pyx_v_head = values[0];
-    __pyx_v_lat = values[1];
-    __pyx_v_lon = values[2];
-    __pyx_v_height = values[3];
-    __pyx_v_year = values[4];
-    __pyx_v_geodetic = values[5];
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("true_to_magnetic", 0, 5, 6, PyTuple_GET_SIZE(__pyx_args)); __PYX_ERR(0, 344, __pyx_L3_error)
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.true_to_magnetic", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __Pyx_RefNannyFinishContext();
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMMesh_10true_to_magnetic(((struct __pyx_obj_6geomag_3emm_EMMMesh *)__pyx_v_self), __pyx_v_head, __pyx_v_lat, __pyx_v_lon, __pyx_v_height, __pyx_v_year, __pyx_v_geodetic);
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_10true_to_magnetic(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_head, PyObject *__pyx_v_lat, PyObject *__pyx_v_lon, PyObject *__pyx_v_height, PyObject *__pyx_v_year, PyObject *__pyx_v_geodetic) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  PyObject *__pyx_t_5 = NULL;
-  __Pyx_RefNannySetupContext("true_to_magnetic", 0);
-
-  /* "geomag/emm.pyx":347
- *         """true_to_magnetic(head, lat, lon, height, year, geodetic = True)
- *         Convert a heading (deg) from true north to magnetic north (subtract declination)"""
- *         return head - self.declination(lat,lon,height,year,geodetic)             # <<<<<<<<<<<<<<
- * 
- *     def magnetic_to_true(self,head,lat,lon,height,year,geodetic=True):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_2 = __Pyx_PyObject_GetAttrStr(((PyObject *)__pyx_v_self), __pyx_n_s_declination); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 347, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = NULL;
-  __pyx_t_4 = 0;
-  if (CYTHON_UNPACK_METHODS && likely(PyMethod_Check(__pyx_t_2))) {
-    __pyx_t_3 = PyMethod_GET_SELF(__pyx_t_2);
-    if (likely(__pyx_t_3)) {
-      PyObject* function = PyMethod_GET_FUNCTION(__pyx_t_2);
-      __Pyx_INCREF(__pyx_t_3);
-      __Pyx_INCREF(function);
-      __Pyx_DECREF_SET(__pyx_t_2, function);
-      __pyx_t_4 = 1;
-    }
-  }
-  #if CYTHON_FAST_PYCALL
-  if (PyFunction_Check(__pyx_t_2)) {
-    PyObject *__pyx_temp[6] = {__pyx_t_3, __pyx_v_lat, __pyx_v_lon, __pyx_v_height, __pyx_v_year, __pyx_v_geodetic};
-    __pyx_t_1 = __Pyx_PyFunction_FastCall(__pyx_t_2, __pyx_temp+1-__pyx_t_4, 5+__pyx_t_4); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 347, __pyx_L1_error)
-    __Pyx_XDECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_GOTREF(__pyx_t_1);
-  } else
-  #endif
-  #if CYTHON_FAST_PYCCALL
-  if (__Pyx_PyFastCFunction_Check(__pyx_t_2)) {
-    PyObject *__pyx_temp[6] = {__pyx_t_3, __pyx_v_lat, __pyx_v_lon, __pyx_v_height, __pyx_v_year, __pyx_v_geodetic};
-    __pyx_t_1 = __Pyx_PyCFunction_FastCall(__pyx_t_2, __pyx_temp+1-__pyx_t_4, 5+__pyx_t_4); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 347, __pyx_L1_error)
-    __Pyx_XDECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_GOTREF(__pyx_t_1);
-  } else
-  #endif
-  {
-    __pyx_t_5 = PyTuple_New(5+__pyx_t_4); if (unlikely(!__pyx_t_5)) __PYX_ERR(0, 347, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_5);
-    if (__pyx_t_3) {
-      __Pyx_GIVEREF(__pyx_t_3); PyTuple_SET_ITEM(__pyx_t_5, 0, __pyx_t_3); __pyx_t_3 = NULL;
-    }
-    __Pyx_INCREF(__pyx_v_lat);
-    __Pyx_GIVEREF(__pyx_v_lat);
-    PyTuple_SET_ITEM(__pyx_t_5, 0+__pyx_t_4, __pyx_v_lat);
-    __Pyx_INCREF(__pyx_v_lon);
-    __Pyx_GIVEREF(__pyx_v_lon);
-    PyTuple_SET_ITEM(__pyx_t_5, 1+__pyx_t_4, __pyx_v_lon);
-    __Pyx_INCREF(__pyx_v_height);
-    __Pyx_GIVEREF(__pyx_v_height);
-    PyTuple_SET_ITEM(__pyx_t_5, 2+__pyx_t_4, __pyx_v_height);
-    __Pyx_INCREF(__pyx_v_year);
-    __Pyx_GIVEREF(__pyx_v_year);
-    PyTuple_SET_ITEM(__pyx_t_5, 3+__pyx_t_4, __pyx_v_year);
-    __Pyx_INCREF(__pyx_v_geodetic);
-    __Pyx_GIVEREF(__pyx_v_geodetic);
-    PyTuple_SET_ITEM(__pyx_t_5, 4+__pyx_t_4, __pyx_v_geodetic);
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_t_2, __pyx_t_5, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 347, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-  }
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_2 = PyNumber_Subtract(__pyx_v_head, __pyx_t_1); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 347, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_r = __pyx_t_2;
-  __pyx_t_2 = 0;
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":344
- *         return self.compute_field(lat,lon,height,year,geodetic).Decl
- * 
- *     def true_to_magnetic(self, head, lat, lon, height, year, geodetic = True):             # <<<<<<<<<<<<<<
- *         """true_to_magnetic(head, lat, lon, height, year, geodetic = True)
- *         Convert a heading (deg) from true north to magnetic north (subtract declination)"""
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.true_to_magnetic", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "geomag/emm.pyx":349
- *         return head - self.declination(lat,lon,height,year,geodetic)
- * 
- *     def magnetic_to_true(self,head,lat,lon,height,year,geodetic=True):             # <<<<<<<<<<<<<<
- *         """magnetic_to_true(head, lat, lon, height, year, geodetic = True)
- *         Convert a heading (deg) from magnetic north to true north (add declination)"""
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_13magnetic_to_true(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_6geomag_3emm_7EMMMesh_12magnetic_to_true[] = "magnetic_to_true(head, lat, lon, height, year, geodetic = True)\n        Convert a heading (deg) from magnetic north to true north (add declination)";
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_13magnetic_to_true(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_head = 0;
-  PyObject *__pyx_v_lat = 0;
-  PyObject *__pyx_v_lon = 0;
-  PyObject *__pyx_v_height = 0;
-  PyObject *__pyx_v_year = 0;
-  PyObject *__pyx_v_geodetic = 0;
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("magnetic_to_true (wrapper)", 0);
-  {
-    static PyObject **__pyx_pyargnames[] = {&__pyx_n_s_head,&__pyx_n_s_lat,&__pyx_n_s_lon,&__pyx_n_s_height,&__pyx_n_s_year,&__pyx_n_s_geodetic,0};
-    PyObject* values[6] = {0,0,0,0,0,0};
-    values[5] = ((PyObject *)Py_True);
-    if (unlikely(__pyx_kwds)) {
-      Py_ssize_t kw_args;
-      const Py_ssize_t pos_args = PyTuple_GET_SIZE(__pyx_args);
-      switch (pos_args) {
-        case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-        CYTHON_FALLTHROUGH;
-        case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-        CYTHON_FALLTHROUGH;
-        case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-        CYTHON_FALLTHROUGH;
-        case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-        CYTHON_FALLTHROUGH;
-        case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        CYTHON_FALLTHROUGH;
-        case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        CYTHON_FALLTHROUGH;
-        case  0: break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-      kw_args = PyDict_Size(__pyx_kwds);
-      switch (pos_args) {
-        case  0:
-        if (likely((values[0] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_head)) != 0)) kw_args--;
-        else goto __pyx_L5_argtuple_error;
-        CYTHON_FALLTHROUGH;
-        case  1:
-        if (likely((values[1] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_lat)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("magnetic_to_true", 0, 5, 6, 1); __PYX_ERR(0, 349, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  2:
-        if (likely((values[2] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_lon)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("magnetic_to_true", 0, 5, 6, 2); __PYX_ERR(0, 349, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  3:
-        if (likely((values[3] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_height)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("magnetic_to_true", 0, 5, 6, 3); __PYX_ERR(0, 349, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  4:
-        if (likely((values[4] = PyDict_GetItem(__pyx_kwds, __pyx_n_s_year)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("magnetic_to_true", 0, 5, 6, 4); __PYX_ERR(0, 349, __pyx_L3_error)
-        }
-        CYTHON_FALLTHROUGH;
-        case  5:
-        if (kw_args > 0) {
-          PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_n_s_geodetic);
-          if (value) { values[5] = value; kw_args--; }
-        }
-      }
-      if (unlikely(kw_args > 0)) {
-        if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, pos_args, "magnetic_to_true") < 0)) __PYX_ERR(0, 349, __pyx_L3_error)
-      }
-    } else {
-      switch (PyTuple_GET_SIZE(__pyx_args)) {
-        case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-        CYTHON_FALLTHROUGH;
-        case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-        values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-        values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-        values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-    }
-    __pyx_v_head = values[0];
-    __pyx_v_lat = values[1];
-    __pyx_v_lon = values[2];
-    __pyx_v_height = values[3];
-    __pyx_v_year = values[4];
-    __pyx_v_geodetic = values[5];
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("magnetic_to_true", 0, 5, 6, PyTuple_GET_SIZE(__pyx_args)); __PYX_ERR(0, 349, __pyx_L3_error)
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.magnetic_to_true", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __Pyx_RefNannyFinishContext();
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMMesh_12magnetic_to_true(((struct __pyx_obj_6geomag_3emm_EMMMesh *)__pyx_v_self), __pyx_v_head, __pyx_v_lat, __pyx_v_lon, __pyx_v_height, __pyx_v_year, __pyx_v_geodetic);
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_12magnetic_to_true(struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, PyObject *__pyx_v_head, PyObject *__pyx_v_lat, PyObject *__pyx_v_lon, PyObject *__pyx_v_height, PyObject *__pyx_v_year, PyObject *__pyx_v_geodetic) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  PyObject *__pyx_t_5 = NULL;
-  __Pyx_RefNannySetupContext("magnetic_to_true", 0);
-
-  /* "geomag/emm.pyx":352
- *         """magnetic_to_true(head, lat, lon, height, year, geodetic = True)
- *         Convert a heading (deg) from magnetic north to true north (add declination)"""
- *         return head + self.declination(lat,lon,height,year,geodetic)             # <<<<<<<<<<<<<<
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_2 = __Pyx_PyObject_GetAttrStr(((PyObject *)__pyx_v_self), __pyx_n_s_declination); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 352, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = NULL;
-  __pyx_t_4 = 0;
-  if (CYTHON_UNPACK_METHODS && likely(PyMethod_Check(__pyx_t_2))) {
-    __pyx_t_3 = PyMethod_GET_SELF(__pyx_t_2);
-    if (likely(__pyx_t_3)) {
-      PyObject* function = PyMethod_GET_FUNCTION(__pyx_t_2);
-      __Pyx_INCREF(__pyx_t_3);
-      __Pyx_INCREF(function);
-      __Pyx_DECREF_SET(__pyx_t_2, function);
-      __pyx_t_4 = 1;
-    }
-  }
-  #if CYTHON_FAST_PYCALL
-  if (PyFunction_Check(__pyx_t_2)) {
-    PyObject *__pyx_temp[6] = {__pyx_t_3, __pyx_v_lat, __pyx_v_lon, __pyx_v_height, __pyx_v_year, __pyx_v_geodetic};
-    __pyx_t_1 = __Pyx_PyFunction_FastCall(__pyx_t_2, __pyx_temp+1-__pyx_t_4, 5+__pyx_t_4); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 352, __pyx_L1_error)
-    __Pyx_XDECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_GOTREF(__pyx_t_1);
-  } else
-  #endif
-  #if CYTHON_FAST_PYCCALL
-  if (__Pyx_PyFastCFunction_Check(__pyx_t_2)) {
-    PyObject *__pyx_temp[6] = {__pyx_t_3, __pyx_v_lat, __pyx_v_lon, __pyx_v_height, __pyx_v_year, __pyx_v_geodetic};
-    __pyx_t_1 = __Pyx_PyCFunction_FastCall(__pyx_t_2, __pyx_temp+1-__pyx_t_4, 5+__pyx_t_4); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 352, __pyx_L1_error)
-    __Pyx_XDECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_GOTREF(__pyx_t_1);
-  } else
-  #endif
-  {
-    __pyx_t_5 = PyTuple_New(5+__pyx_t_4); if (unlikely(!__pyx_t_5)) __PYX_ERR(0, 352, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_5);
-    if (__pyx_t_3) {
-      __Pyx_GIVEREF(__pyx_t_3); PyTuple_SET_ITEM(__pyx_t_5, 0, __pyx_t_3); __pyx_t_3 = NULL;
-    }
-    __Pyx_INCREF(__pyx_v_lat);
-    __Pyx_GIVEREF(__pyx_v_lat);
-    PyTuple_SET_ITEM(__pyx_t_5, 0+__pyx_t_4, __pyx_v_lat);
-    __Pyx_INCREF(__pyx_v_lon);
-    __Pyx_GIVEREF(__pyx_v_lon);
-    PyTuple_SET_ITEM(__pyx_t_5, 1+__pyx_t_4, __pyx_v_lon);
-    __Pyx_INCREF(__pyx_v_height);
-    __Pyx_GIVEREF(__pyx_v_height);
-    PyTuple_SET_ITEM(__pyx_t_5, 2+__pyx_t_4, __pyx_v_height);
-    __Pyx_INCREF(__pyx_v_year);
-    __Pyx_GIVEREF(__pyx_v_year);
-    PyTuple_SET_ITEM(__pyx_t_5, 3+__pyx_t_4, __pyx_v_year);
-    __Pyx_INCREF(__pyx_v_geodetic);
-    __Pyx_GIVEREF(__pyx_v_geodetic);
-    PyTuple_SET_ITEM(__pyx_t_5, 4+__pyx_t_4, __pyx_v_geodetic);
-    __pyx_t_1 = __Pyx_PyObject_Call(__pyx_t_2, __pyx_t_5, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 352, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-  }
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_2 = PyNumber_Add(__pyx_v_head, __pyx_t_1); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 352, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_r = __pyx_t_2;
-  __pyx_t_2 = 0;
-  goto __pyx_L0;
-
-  /* "geomag/emm.pyx":349
- *         return head - self.declination(lat,lon,height,year,geodetic)
- * 
- *     def magnetic_to_true(self,head,lat,lon,height,year,geodetic=True):             # <<<<<<<<<<<<<<
- *         """magnetic_to_true(head, lat, lon, height, year, geodetic = True)
- *         Convert a heading (deg) from magnetic north to true north (add declination)"""
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.magnetic_to_true", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "(tree fragment)":1
- * def __reduce_cython__(self):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_15__reduce_cython__(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_15__reduce_cython__(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__reduce_cython__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMMesh_14__reduce_cython__(((struct __pyx_obj_6geomag_3emm_EMMMesh *)__pyx_v_self));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_14__reduce_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__reduce_cython__", 0);
-
-  /* "(tree fragment)":2
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-  __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_TypeError, __pyx_tuple__15, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(1, 2, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __PYX_ERR(1, 2, __pyx_L1_error)
-
-  /* "(tree fragment)":1
- * def __reduce_cython__(self):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.__reduce_cython__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "(tree fragment)":3
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-
-/* Python wrapper */
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_17__setstate_cython__(PyObject *__pyx_v_self, PyObject *__pyx_v___pyx_state); /*proto*/
-static PyObject *__pyx_pw_6geomag_3emm_7EMMMesh_17__setstate_cython__(PyObject *__pyx_v_self, PyObject *__pyx_v___pyx_state) {
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__setstate_cython__ (wrapper)", 0);
-  __pyx_r = __pyx_pf_6geomag_3emm_7EMMMesh_16__setstate_cython__(((struct __pyx_obj_6geomag_3emm_EMMMesh *)__pyx_v_self), ((PyObject *)__pyx_v___pyx_state));
-
-  /* function exit code */
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_pf_6geomag_3emm_7EMMMesh_16__setstate_cython__(CYTHON_UNUSED struct __pyx_obj_6geomag_3emm_EMMMesh *__pyx_v_self, CYTHON_UNUSED PyObject *__pyx_v___pyx_state) {
-  PyObject *__pyx_r = NULL;
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("__setstate_cython__", 0);
-
-  /* "(tree fragment)":4
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- */
-  __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_TypeError, __pyx_tuple__16, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(1, 4, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_Raise(__pyx_t_1, 0, 0, 0);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __PYX_ERR(1, 4, __pyx_L1_error)
-
-  /* "(tree fragment)":3
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):             # <<<<<<<<<<<<<<
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-
-  /* function exit code */
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("geomag.emm.EMMMesh.__setstate_cython__", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-static struct __pyx_vtabstruct_6geomag_3emm_GeoMagneticElements __pyx_vtable_6geomag_3emm_GeoMagneticElements;
-
-static PyObject *__pyx_tp_new_6geomag_3emm_GeoMagneticElements(PyTypeObject *t, CYTHON_UNUSED PyObject *a, CYTHON_UNUSED PyObject *k) {
-  struct __pyx_obj_6geomag_3emm_GeoMagneticElements *p;
-  PyObject *o;
-  if (likely((t->tp_flags & Py_TPFLAGS_IS_ABSTRACT) == 0)) {
-    o = (*t->tp_alloc)(t, 0);
-  } else {
-    o = (PyObject *) PyBaseObject_Type.tp_new(t, __pyx_empty_tuple, 0);
-  }
-  if (unlikely(!o)) return 0;
-  p = ((struct __pyx_obj_6geomag_3emm_GeoMagneticElements *)o);
-  p->__pyx_vtab = __pyx_vtabptr_6geomag_3emm_GeoMagneticElements;
-  if (unlikely(__pyx_pw_6geomag_3emm_19GeoMagneticElements_1__cinit__(o, __pyx_empty_tuple, NULL) < 0)) goto bad;
-  return o;
-  bad:
-  Py_DECREF(o); o = 0;
-  return NULL;
-}
-
-static void __pyx_tp_dealloc_6geomag_3emm_GeoMagneticElements(PyObject *o) {
-  #if PY_VERSION_HEX >= 0x030400a1
-  if (unlikely(PyType_HasFeature(Py_TYPE(o), Py_TPFLAGS_HAVE_FINALIZE) && Py_TYPE(o)->tp_finalize) && (!PyType_IS_GC(Py_TYPE(o)) || !_PyGC_FINALIZED(o))) {
-    if (PyObject_CallFinalizerFromDealloc(o)) return;
-  }
-  #endif
-  (*Py_TYPE(o)->tp_free)(o);
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_Decl(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Decl_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Decl(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Decl_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_Incl(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Incl_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Incl(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Incl_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_F(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_1F_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_F(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_1F_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_H(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_1H_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_H(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_1H_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_X(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_1X_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_X(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_1X_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_Y(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_1Y_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Y(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_1Y_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_Z(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_1Z_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Z(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_1Z_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_GV(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_2GV_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_GV(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_2GV_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_Decldot(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_7Decldot_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Decldot(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_7Decldot_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_Incldot(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_7Incldot_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Incldot(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_7Incldot_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_Fdot(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Fdot_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Fdot(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Fdot_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_Hdot(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Hdot_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Hdot(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Hdot_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_Xdot(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Xdot_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Xdot(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Xdot_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_Ydot(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Ydot_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Ydot(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Ydot_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_Zdot(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Zdot_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Zdot(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_4Zdot_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyObject *__pyx_getprop_6geomag_3emm_19GeoMagneticElements_GVdot(PyObject *o, CYTHON_UNUSED void *x) {
-  return __pyx_pw_6geomag_3emm_19GeoMagneticElements_5GVdot_1__get__(o);
-}
-
-static int __pyx_setprop_6geomag_3emm_19GeoMagneticElements_GVdot(PyObject *o, PyObject *v, CYTHON_UNUSED void *x) {
-  if (v) {
-    return __pyx_pw_6geomag_3emm_19GeoMagneticElements_5GVdot_3__set__(o, v);
-  }
-  else {
-    PyErr_SetString(PyExc_NotImplementedError, "__del__");
-    return -1;
-  }
-}
-
-static PyMethodDef __pyx_methods_6geomag_3emm_GeoMagneticElements[] = {
-  {"__reduce_cython__", (PyCFunction)__pyx_pw_6geomag_3emm_19GeoMagneticElements_3__reduce_cython__, METH_NOARGS, 0},
-  {"__setstate_cython__", (PyCFunction)__pyx_pw_6geomag_3emm_19GeoMagneticElements_5__setstate_cython__, METH_O, 0},
-  {0, 0, 0, 0}
-};
-
-static struct PyGetSetDef __pyx_getsets_6geomag_3emm_GeoMagneticElements[] = {
-  {(char *)"Decl", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_Decl, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Decl, (char *)0, 0},
-  {(char *)"Incl", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_Incl, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Incl, (char *)0, 0},
-  {(char *)"F", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_F, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_F, (char *)0, 0},
-  {(char *)"H", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_H, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_H, (char *)0, 0},
-  {(char *)"X", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_X, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_X, (char *)0, 0},
-  {(char *)"Y", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_Y, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Y, (char *)0, 0},
-  {(char *)"Z", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_Z, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Z, (char *)0, 0},
-  {(char *)"GV", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_GV, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_GV, (char *)0, 0},
-  {(char *)"Decldot", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_Decldot, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Decldot, (char *)0, 0},
-  {(char *)"Incldot", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_Incldot, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Incldot, (char *)0, 0},
-  {(char *)"Fdot", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_Fdot, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Fdot, (char *)0, 0},
-  {(char *)"Hdot", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_Hdot, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Hdot, (char *)0, 0},
-  {(char *)"Xdot", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_Xdot, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Xdot, (char *)0, 0},
-  {(char *)"Ydot", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_Ydot, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Ydot, (char *)0, 0},
-  {(char *)"Zdot", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_Zdot, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_Zdot, (char *)0, 0},
-  {(char *)"GVdot", __pyx_getprop_6geomag_3emm_19GeoMagneticElements_GVdot, __pyx_setprop_6geomag_3emm_19GeoMagneticElements_GVdot, (char *)0, 0},
-  {0, 0, 0, 0, 0}
-};
-
-static PyTypeObject __pyx_type_6geomag_3emm_GeoMagneticElements = {
-  PyVarObject_HEAD_INIT(0, 0)
-  "geomag.emm.GeoMagneticElements", /*tp_name*/
-  sizeof(struct __pyx_obj_6geomag_3emm_GeoMagneticElements), /*tp_basicsize*/
-  0, /*tp_itemsize*/
-  __pyx_tp_dealloc_6geomag_3emm_GeoMagneticElements, /*tp_dealloc*/
-  0, /*tp_print*/
-  0, /*tp_getattr*/
-  0, /*tp_setattr*/
-  #if PY_MAJOR_VERSION < 3
-  0, /*tp_compare*/
-  #endif
-  #if PY_MAJOR_VERSION >= 3
-  0, /*tp_as_async*/
-  #endif
-  0, /*tp_repr*/
-  0, /*tp_as_number*/
-  0, /*tp_as_sequence*/
-  0, /*tp_as_mapping*/
-  0, /*tp_hash*/
-  0, /*tp_call*/
-  0, /*tp_str*/
-  0, /*tp_getattro*/
-  0, /*tp_setattro*/
-  0, /*tp_as_buffer*/
-  Py_TPFLAGS_DEFAULT|Py_TPFLAGS_HAVE_VERSION_TAG|Py_TPFLAGS_CHECKTYPES|Py_TPFLAGS_HAVE_NEWBUFFER|Py_TPFLAGS_BASETYPE, /*tp_flags*/
-  "GeoMagneticElements encapsulates the geomagnetic field paramters at a location.\n    members: \n      Decl = Angle between the magnetic field vector and true north, positive east.\n      Incl = Angle between the magnetic field vector and the horizontal plane, positive down.\n      F = Magnetic field strength.\n      H = Horizontal magnetic field strength.\n      X = Northern component of the magnetic field vector.\n      Y = Eastern component of the magnetic field vector.\n      Z = Downward component of the magnetic field vector.\n      GV = The grid variation.\n      Decldot, Incldot, Fdot, Hdot, Xdot, Ydot, Zdot, and GVdot: the change per year of each of the above.\n    ", /*tp_doc*/
-  0, /*tp_traverse*/
-  0, /*tp_clear*/
-  0, /*tp_richcompare*/
-  0, /*tp_weaklistoffset*/
-  0, /*tp_iter*/
-  0, /*tp_iternext*/
-  __pyx_methods_6geomag_3emm_GeoMagneticElements, /*tp_methods*/
-  0, /*tp_members*/
-  __pyx_getsets_6geomag_3emm_GeoMagneticElements, /*tp_getset*/
-  0, /*tp_base*/
-  0, /*tp_dict*/
-  0, /*tp_descr_get*/
-  0, /*tp_descr_set*/
-  0, /*tp_dictoffset*/
-  0, /*tp_init*/
-  0, /*tp_alloc*/
-  __pyx_tp_new_6geomag_3emm_GeoMagneticElements, /*tp_new*/
-  0, /*tp_free*/
-  0, /*tp_is_gc*/
-  0, /*tp_bases*/
-  0, /*tp_mro*/
-  0, /*tp_cache*/
-  0, /*tp_subclasses*/
-  0, /*tp_weaklist*/
-  0, /*tp_del*/
-  0, /*tp_version_tag*/
-  #if PY_VERSION_HEX >= 0x030400a1
-  0, /*tp_finalize*/
-  #endif
-};
-static struct __pyx_vtabstruct_6geomag_3emm_EMMBase __pyx_vtable_6geomag_3emm_EMMBase;
-
-static PyObject *__pyx_tp_new_6geomag_3emm_EMMBase(PyTypeObject *t, CYTHON_UNUSED PyObject *a, CYTHON_UNUSED PyObject *k) {
-  struct __pyx_obj_6geomag_3emm_EMMBase *p;
-  PyObject *o;
-  if (likely((t->tp_flags & Py_TPFLAGS_IS_ABSTRACT) == 0)) {
-    o = (*t->tp_alloc)(t, 0);
-  } else {
-    o = (PyObject *) PyBaseObject_Type.tp_new(t, __pyx_empty_tuple, 0);
-  }
-  if (unlikely(!o)) return 0;
-  p = ((struct __pyx_obj_6geomag_3emm_EMMBase *)o);
-  p->__pyx_vtab = __pyx_vtabptr_6geomag_3emm_EMMBase;
-  if (unlikely(__pyx_pw_6geomag_3emm_7EMMBase_1__cinit__(o, __pyx_empty_tuple, NULL) < 0)) goto bad;
-  return o;
-  bad:
-  Py_DECREF(o); o = 0;
-  return NULL;
-}
-
-static void __pyx_tp_dealloc_6geomag_3emm_EMMBase(PyObject *o) {
-  #if PY_VERSION_HEX >= 0x030400a1
-  if (unlikely(PyType_HasFeature(Py_TYPE(o), Py_TPFLAGS_HAVE_FINALIZE) && Py_TYPE(o)->tp_finalize) && (!PyType_IS_GC(Py_TYPE(o)) || !_PyGC_FINALIZED(o))) {
-    if (PyObject_CallFinalizerFromDealloc(o)) return;
-  }
-  #endif
-  (*Py_TYPE(o)->tp_free)(o);
-}
-
-static PyMethodDef __pyx_methods_6geomag_3emm_EMMBase[] = {
-  {"citation", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMBase_3citation, METH_VARARGS|METH_KEYWORDS, 0},
-  {"bibtex", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMBase_5bibtex, METH_VARARGS|METH_KEYWORDS, 0},
-  {"decimal_year", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMBase_7decimal_year, METH_O, __pyx_doc_6geomag_3emm_7EMMBase_6decimal_year},
-  {"__reduce_cython__", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMBase_9__reduce_cython__, METH_NOARGS, 0},
-  {"__setstate_cython__", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMBase_11__setstate_cython__, METH_O, 0},
-  {0, 0, 0, 0}
-};
-
-static PyTypeObject __pyx_type_6geomag_3emm_EMMBase = {
-  PyVarObject_HEAD_INIT(0, 0)
-  "geomag.emm.EMMBase", /*tp_name*/
-  sizeof(struct __pyx_obj_6geomag_3emm_EMMBase), /*tp_basicsize*/
-  0, /*tp_itemsize*/
-  __pyx_tp_dealloc_6geomag_3emm_EMMBase, /*tp_dealloc*/
-  0, /*tp_print*/
-  0, /*tp_getattr*/
-  0, /*tp_setattr*/
-  #if PY_MAJOR_VERSION < 3
-  0, /*tp_compare*/
-  #endif
-  #if PY_MAJOR_VERSION >= 3
-  0, /*tp_as_async*/
-  #endif
-  0, /*tp_repr*/
-  0, /*tp_as_number*/
-  0, /*tp_as_sequence*/
-  0, /*tp_as_mapping*/
-  0, /*tp_hash*/
-  0, /*tp_call*/
-  0, /*tp_str*/
-  0, /*tp_getattro*/
-  0, /*tp_setattro*/
-  0, /*tp_as_buffer*/
-  Py_TPFLAGS_DEFAULT|Py_TPFLAGS_HAVE_VERSION_TAG|Py_TPFLAGS_CHECKTYPES|Py_TPFLAGS_HAVE_NEWBUFFER|Py_TPFLAGS_BASETYPE, /*tp_flags*/
-  0, /*tp_doc*/
-  0, /*tp_traverse*/
-  0, /*tp_clear*/
-  0, /*tp_richcompare*/
-  0, /*tp_weaklistoffset*/
-  0, /*tp_iter*/
-  0, /*tp_iternext*/
-  __pyx_methods_6geomag_3emm_EMMBase, /*tp_methods*/
-  0, /*tp_members*/
-  0, /*tp_getset*/
-  0, /*tp_base*/
-  0, /*tp_dict*/
-  0, /*tp_descr_get*/
-  0, /*tp_descr_set*/
-  0, /*tp_dictoffset*/
-  0, /*tp_init*/
-  0, /*tp_alloc*/
-  __pyx_tp_new_6geomag_3emm_EMMBase, /*tp_new*/
-  0, /*tp_free*/
-  0, /*tp_is_gc*/
-  0, /*tp_bases*/
-  0, /*tp_mro*/
-  0, /*tp_cache*/
-  0, /*tp_subclasses*/
-  0, /*tp_weaklist*/
-  0, /*tp_del*/
-  0, /*tp_version_tag*/
-  #if PY_VERSION_HEX >= 0x030400a1
-  0, /*tp_finalize*/
-  #endif
-};
-static struct __pyx_vtabstruct_6geomag_3emm_EMMMesh __pyx_vtable_6geomag_3emm_EMMMesh;
-
-static PyObject *__pyx_tp_new_6geomag_3emm_EMMMesh(PyTypeObject *t, PyObject *a, PyObject *k) {
-  struct __pyx_obj_6geomag_3emm_EMMMesh *p;
-  PyObject *o = __pyx_tp_new_6geomag_3emm_EMMBase(t, a, k);
-  if (unlikely(!o)) return 0;
-  p = ((struct __pyx_obj_6geomag_3emm_EMMMesh *)o);
-  p->__pyx_base.__pyx_vtab = (struct __pyx_vtabstruct_6geomag_3emm_EMMBase*)__pyx_vtabptr_6geomag_3emm_EMMMesh;
-  p->_mfname = ((PyObject*)Py_None); Py_INCREF(Py_None);
-  p->_smfname = ((PyObject*)Py_None); Py_INCREF(Py_None);
-  if (unlikely(__pyx_pw_6geomag_3emm_7EMMMesh_1__cinit__(o, a, k) < 0)) goto bad;
-  return o;
-  bad:
-  Py_DECREF(o); o = 0;
-  return NULL;
-}
-
-static void __pyx_tp_dealloc_6geomag_3emm_EMMMesh(PyObject *o) {
-  struct __pyx_obj_6geomag_3emm_EMMMesh *p = (struct __pyx_obj_6geomag_3emm_EMMMesh *)o;
-  #if PY_VERSION_HEX >= 0x030400a1
-  if (unlikely(PyType_HasFeature(Py_TYPE(o), Py_TPFLAGS_HAVE_FINALIZE) && Py_TYPE(o)->tp_finalize) && (!PyType_IS_GC(Py_TYPE(o)) || !_PyGC_FINALIZED(o))) {
-    if (PyObject_CallFinalizerFromDealloc(o)) return;
-  }
-  #endif
-  Py_CLEAR(p->_mfname);
-  Py_CLEAR(p->_smfname);
-  __pyx_tp_dealloc_6geomag_3emm_EMMBase(o);
-}
-
-static PyMethodDef __pyx_methods_6geomag_3emm_EMMMesh[] = {
-  {"load", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMMesh_3load, METH_VARARGS|METH_KEYWORDS, __pyx_doc_6geomag_3emm_7EMMMesh_2load},
-  {"is_loaded", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMMesh_5is_loaded, METH_NOARGS, __pyx_doc_6geomag_3emm_7EMMMesh_4is_loaded},
-  {"compute_field", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMMesh_7compute_field, METH_VARARGS|METH_KEYWORDS, __pyx_doc_6geomag_3emm_7EMMMesh_6compute_field},
-  {"declination", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMMesh_9declination, METH_VARARGS|METH_KEYWORDS, __pyx_doc_6geomag_3emm_7EMMMesh_8declination},
-  {"true_to_magnetic", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMMesh_11true_to_magnetic, METH_VARARGS|METH_KEYWORDS, __pyx_doc_6geomag_3emm_7EMMMesh_10true_to_magnetic},
-  {"magnetic_to_true", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMMesh_13magnetic_to_true, METH_VARARGS|METH_KEYWORDS, __pyx_doc_6geomag_3emm_7EMMMesh_12magnetic_to_true},
-  {"__reduce_cython__", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMMesh_15__reduce_cython__, METH_NOARGS, 0},
-  {"__setstate_cython__", (PyCFunction)__pyx_pw_6geomag_3emm_7EMMMesh_17__setstate_cython__, METH_O, 0},
-  {0, 0, 0, 0}
-};
-
-static PyTypeObject __pyx_type_6geomag_3emm_EMMMesh = {
-  PyVarObject_HEAD_INIT(0, 0)
-  "geomag.emm.EMMMesh", /*tp_name*/
-  sizeof(struct __pyx_obj_6geomag_3emm_EMMMesh), /*tp_basicsize*/
-  0, /*tp_itemsize*/
-  __pyx_tp_dealloc_6geomag_3emm_EMMMesh, /*tp_dealloc*/
-  0, /*tp_print*/
-  0, /*tp_getattr*/
-  0, /*tp_setattr*/
-  #if PY_MAJOR_VERSION < 3
-  0, /*tp_compare*/
-  #endif
-  #if PY_MAJOR_VERSION >= 3
-  0, /*tp_as_async*/
-  #endif
-  0, /*tp_repr*/
-  0, /*tp_as_number*/
-  0, /*tp_as_sequence*/
-  0, /*tp_as_mapping*/
-  0, /*tp_hash*/
-  0, /*tp_call*/
-  0, /*tp_str*/
-  0, /*tp_getattro*/
-  0, /*tp_setattro*/
-  0, /*tp_as_buffer*/
-  Py_TPFLAGS_DEFAULT|Py_TPFLAGS_HAVE_VERSION_TAG|Py_TPFLAGS_CHECKTYPES|Py_TPFLAGS_HAVE_NEWBUFFER|Py_TPFLAGS_BASETYPE, /*tp_flags*/
-  "EMMMesh(str mesh_fname, str svmesh_fname, bool delay_load=False)\n        mesh_fname: filename of EMM static mesh\n        secmesh_fname: filename of EMM secular variation mesh\n        delay_load: if True, meshes will not be loaded until load() or a function requiring them is called\n    This class wraps NOAA's Enhanced Magnetic Model (EMM) Mesh routines.\n    These routines use less CPU time than EMMSph, but have a larger memory footprint.\n    ", /*tp_doc*/
-  0, /*tp_traverse*/
-  0, /*tp_clear*/
-  0, /*tp_richcompare*/
-  0, /*tp_weaklistoffset*/
-  0, /*tp_iter*/
-  0, /*tp_iternext*/
-  __pyx_methods_6geomag_3emm_EMMMesh, /*tp_methods*/
-  0, /*tp_members*/
-  0, /*tp_getset*/
-  0, /*tp_base*/
-  0, /*tp_dict*/
-  0, /*tp_descr_get*/
-  0, /*tp_descr_set*/
-  0, /*tp_dictoffset*/
-  0, /*tp_init*/
-  0, /*tp_alloc*/
-  __pyx_tp_new_6geomag_3emm_EMMMesh, /*tp_new*/
-  0, /*tp_free*/
-  0, /*tp_is_gc*/
-  0, /*tp_bases*/
-  0, /*tp_mro*/
-  0, /*tp_cache*/
-  0, /*tp_subclasses*/
-  0, /*tp_weaklist*/
-  0, /*tp_del*/
-  0, /*tp_version_tag*/
-  #if PY_VERSION_HEX >= 0x030400a1
-  0, /*tp_finalize*/
-  #endif
-};
-
-static PyMethodDef __pyx_methods[] = {
-  {0, 0, 0, 0}
-};
-
-#if PY_MAJOR_VERSION >= 3
-static struct PyModuleDef __pyx_moduledef = {
-  #if PY_VERSION_HEX < 0x03020000
-    { PyObject_HEAD_INIT(NULL) NULL, 0, NULL },
-  #else
-    PyModuleDef_HEAD_INIT,
-  #endif
-    "emm",
-    0, /* m_doc */
-    -1, /* m_size */
-    __pyx_methods /* m_methods */,
-    NULL, /* m_reload */
-    NULL, /* m_traverse */
-    NULL, /* m_clear */
-    NULL /* m_free */
-};
-#endif
-
-static __Pyx_StringTabEntry __pyx_string_tab[] = {
-  {&__pyx_kp_s_Binary_file_not_found, __pyx_k_Binary_file_not_found, sizeof(__pyx_k_Binary_file_not_found), 0, 0, 1, 0},
-  {&__pyx_kp_s_Binary_file_write_error, __pyx_k_Binary_file_write_error, sizeof(__pyx_k_Binary_file_write_error), 0, 0, 1, 0},
-  {&__pyx_kp_s_Chulliat_A_P_Alken_M_Nair_A_Wood, __pyx_k_Chulliat_A_P_Alken_M_Nair_A_Wood, sizeof(__pyx_k_Chulliat_A_P_Alken_M_Nair_A_Wood), 0, 0, 1, 0},
-  {&__pyx_n_s_Decl, __pyx_k_Decl, sizeof(__pyx_k_Decl), 0, 0, 1, 1},
-  {&__pyx_kp_s_Error_setting_default_ellipsoid, __pyx_k_Error_setting_default_ellipsoid, sizeof(__pyx_k_Error_setting_default_ellipsoid), 0, 0, 1, 0},
-  {&__pyx_kp_s_File_epoch_error_Model_year_out, __pyx_k_File_epoch_error_Model_year_out, sizeof(__pyx_k_File_epoch_error_Model_year_out), 0, 0, 1, 0},
-  {&__pyx_kp_s_File_error_altitude_out_of_range, __pyx_k_File_error_altitude_out_of_range, sizeof(__pyx_k_File_error_altitude_out_of_range), 0, 0, 1, 0},
-  {&__pyx_kp_s_File_error_number_of_altitude_la, __pyx_k_File_error_number_of_altitude_la, sizeof(__pyx_k_File_error_number_of_altitude_la), 0, 0, 1, 0},
-  {&__pyx_kp_s_File_error_number_of_latitude_ro, __pyx_k_File_error_number_of_latitude_ro, sizeof(__pyx_k_File_error_number_of_latitude_ro), 0, 0, 1, 0},
-  {&__pyx_kp_s_File_error_number_of_longitude_c, __pyx_k_File_error_number_of_longitude_c, sizeof(__pyx_k_File_error_number_of_longitude_c), 0, 0, 1, 0},
-  {&__pyx_kp_s_File_format_error, __pyx_k_File_format_error, sizeof(__pyx_k_File_format_error), 0, 0, 1, 0},
-  {&__pyx_n_s_MemoryError, __pyx_k_MemoryError, sizeof(__pyx_k_MemoryError), 0, 0, 1, 1},
-  {&__pyx_n_s_RuntimeError, __pyx_k_RuntimeError, sizeof(__pyx_k_RuntimeError), 0, 0, 1, 1},
-  {&__pyx_kp_s_Text_file_not_found, __pyx_k_Text_file_not_found, sizeof(__pyx_k_Text_file_not_found), 0, 0, 1, 0},
-  {&__pyx_n_s_TypeError, __pyx_k_TypeError, sizeof(__pyx_k_TypeError), 0, 0, 1, 1},
-  {&__pyx_kp_s_UTF_8, __pyx_k_UTF_8, sizeof(__pyx_k_UTF_8), 0, 0, 1, 0},
-  {&__pyx_kp_s_article_RN121_author_Chulliat_A, __pyx_k_article_RN121_author_Chulliat_A, sizeof(__pyx_k_article_RN121_author_Chulliat_A), 0, 0, 1, 0},
-  {&__pyx_n_s_bibtex, __pyx_k_bibtex, sizeof(__pyx_k_bibtex), 0, 0, 1, 1},
-  {&__pyx_n_s_citation, __pyx_k_citation, sizeof(__pyx_k_citation), 0, 0, 1, 1},
-  {&__pyx_n_s_cline_in_traceback, __pyx_k_cline_in_traceback, sizeof(__pyx_k_cline_in_traceback), 0, 0, 1, 1},
-  {&__pyx_n_s_compute_change, __pyx_k_compute_change, sizeof(__pyx_k_compute_change), 0, 0, 1, 1},
-  {&__pyx_n_s_compute_field, __pyx_k_compute_field, sizeof(__pyx_k_compute_field), 0, 0, 1, 1},
-  {&__pyx_n_s_declination, __pyx_k_declination, sizeof(__pyx_k_declination), 0, 0, 1, 1},
-  {&__pyx_n_s_delay_load, __pyx_k_delay_load, sizeof(__pyx_k_delay_load), 0, 0, 1, 1},
-  {&__pyx_kp_s_emm_pyx, __pyx_k_emm_pyx, sizeof(__pyx_k_emm_pyx), 0, 0, 1, 0},
-  {&__pyx_n_s_geodetic, __pyx_k_geodetic, sizeof(__pyx_k_geodetic), 0, 0, 1, 1},
-  {&__pyx_n_s_geomag_emm, __pyx_k_geomag_emm, sizeof(__pyx_k_geomag_emm), 0, 0, 1, 1},
-  {&__pyx_n_s_getstate, __pyx_k_getstate, sizeof(__pyx_k_getstate), 0, 0, 1, 1},
-  {&__pyx_n_s_gmtime, __pyx_k_gmtime, sizeof(__pyx_k_gmtime), 0, 0, 1, 1},
-  {&__pyx_n_s_head, __pyx_k_head, sizeof(__pyx_k_head), 0, 0, 1, 1},
-  {&__pyx_n_s_height, __pyx_k_height, sizeof(__pyx_k_height), 0, 0, 1, 1},
-  {&__pyx_n_s_import, __pyx_k_import, sizeof(__pyx_k_import), 0, 0, 1, 1},
-  {&__pyx_n_s_lat, __pyx_k_lat, sizeof(__pyx_k_lat), 0, 0, 1, 1},
-  {&__pyx_n_s_lon, __pyx_k_lon, sizeof(__pyx_k_lon), 0, 0, 1, 1},
-  {&__pyx_n_s_main, __pyx_k_main, sizeof(__pyx_k_main), 0, 0, 1, 1},
-  {&__pyx_n_s_mesh, __pyx_k_mesh, sizeof(__pyx_k_mesh), 0, 0, 1, 1},
-  {&__pyx_n_s_mesh_fname, __pyx_k_mesh_fname, sizeof(__pyx_k_mesh_fname), 0, 0, 1, 1},
-  {&__pyx_n_s_name, __pyx_k_name, sizeof(__pyx_k_name), 0, 0, 1, 1},
-  {&__pyx_kp_s_no_default___reduce___due_to_non, __pyx_k_no_default___reduce___due_to_non, sizeof(__pyx_k_no_default___reduce___due_to_non), 0, 0, 1, 0},
-  {&__pyx_n_s_os, __pyx_k_os, sizeof(__pyx_k_os), 0, 0, 1, 1},
-  {&__pyx_n_s_path, __pyx_k_path, sizeof(__pyx_k_path), 0, 0, 1, 1},
-  {&__pyx_n_s_pyx_vtable, __pyx_k_pyx_vtable, sizeof(__pyx_k_pyx_vtable), 0, 0, 1, 1},
-  {&__pyx_n_s_reduce, __pyx_k_reduce, sizeof(__pyx_k_reduce), 0, 0, 1, 1},
-  {&__pyx_n_s_reduce_cython, __pyx_k_reduce_cython, sizeof(__pyx_k_reduce_cython), 0, 0, 1, 1},
-  {&__pyx_n_s_reduce_ex, __pyx_k_reduce_ex, sizeof(__pyx_k_reduce_ex), 0, 0, 1, 1},
-  {&__pyx_n_s_secmesh, __pyx_k_secmesh, sizeof(__pyx_k_secmesh), 0, 0, 1, 1},
-  {&__pyx_n_s_secmesh_fname, __pyx_k_secmesh_fname, sizeof(__pyx_k_secmesh_fname), 0, 0, 1, 1},
-  {&__pyx_n_s_setstate, __pyx_k_setstate, sizeof(__pyx_k_setstate), 0, 0, 1, 1},
-  {&__pyx_n_s_setstate_cython, __pyx_k_setstate_cython, sizeof(__pyx_k_setstate_cython), 0, 0, 1, 1},
-  {&__pyx_n_s_staticmethod, __pyx_k_staticmethod, sizeof(__pyx_k_staticmethod), 0, 0, 1, 1},
-  {&__pyx_n_s_test, __pyx_k_test, sizeof(__pyx_k_test), 0, 0, 1, 1},
-  {&__pyx_n_s_time, __pyx_k_time, sizeof(__pyx_k_time), 0, 0, 1, 1},
-  {&__pyx_n_s_timetuple, __pyx_k_timetuple, sizeof(__pyx_k_timetuple), 0, 0, 1, 1},
-  {&__pyx_n_s_tm_yday, __pyx_k_tm_yday, sizeof(__pyx_k_tm_yday), 0, 0, 1, 1},
-  {&__pyx_n_s_tm_year, __pyx_k_tm_year, sizeof(__pyx_k_tm_year), 0, 0, 1, 1},
-  {&__pyx_n_s_year, __pyx_k_year, sizeof(__pyx_k_year), 0, 0, 1, 1},
-  {0, 0, 0, 0, 0, 0, 0}
-};
-static int __Pyx_InitCachedBuiltins(void) {
-  __pyx_builtin_staticmethod = __Pyx_GetBuiltinName(__pyx_n_s_staticmethod); if (!__pyx_builtin_staticmethod) __PYX_ERR(0, 170, __pyx_L1_error)
-  __pyx_builtin_TypeError = __Pyx_GetBuiltinName(__pyx_n_s_TypeError); if (!__pyx_builtin_TypeError) __PYX_ERR(1, 2, __pyx_L1_error)
-  __pyx_builtin_RuntimeError = __Pyx_GetBuiltinName(__pyx_n_s_RuntimeError); if (!__pyx_builtin_RuntimeError) __PYX_ERR(0, 152, __pyx_L1_error)
-  __pyx_builtin_MemoryError = __Pyx_GetBuiltinName(__pyx_n_s_MemoryError); if (!__pyx_builtin_MemoryError) __PYX_ERR(0, 194, __pyx_L1_error)
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-static int __Pyx_InitCachedConstants(void) {
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__Pyx_InitCachedConstants", 0);
-
-  /* "(tree fragment)":2
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-  __pyx_tuple_ = PyTuple_Pack(1, __pyx_kp_s_no_default___reduce___due_to_non); if (unlikely(!__pyx_tuple_)) __PYX_ERR(1, 2, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple_);
-  __Pyx_GIVEREF(__pyx_tuple_);
-
-  /* "(tree fragment)":4
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- */
-  __pyx_tuple__2 = PyTuple_Pack(1, __pyx_kp_s_no_default___reduce___due_to_non); if (unlikely(!__pyx_tuple__2)) __PYX_ERR(1, 4, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__2);
-  __Pyx_GIVEREF(__pyx_tuple__2);
-
-  /* "geomag/emm.pyx":152
- *         #initialize the ellipsoid and geoid
- *         if not MAG_SetDefaults(&self._ellip, &self._geoid):
- *             raise RuntimeError('Error setting default ellipsoid and geoid parameters.')             # <<<<<<<<<<<<<<
- *         self._geoid.GeoidHeightBuffer = GeoidHeightBuffer
- *         self._geoid.Geoid_Initialized = 1
- */
-  __pyx_tuple__3 = PyTuple_Pack(1, __pyx_kp_s_Error_setting_default_ellipsoid); if (unlikely(!__pyx_tuple__3)) __PYX_ERR(0, 152, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__3);
-  __Pyx_GIVEREF(__pyx_tuple__3);
-
-  /* "geomag/emm.pyx":196
- *             raise MemoryError()
- *         elif err == EXIT_MESH_TEXT_FILE_NOT_FOUND:
- *             raise RuntimeError('Text file not found.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_BIN_FILE_WRITE_ERROR:
- *             raise RuntimeError('Binary file write error.')
- */
-  __pyx_tuple__4 = PyTuple_Pack(1, __pyx_kp_s_Text_file_not_found); if (unlikely(!__pyx_tuple__4)) __PYX_ERR(0, 196, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__4);
-  __Pyx_GIVEREF(__pyx_tuple__4);
-
-  /* "geomag/emm.pyx":198
- *             raise RuntimeError('Text file not found.')
- *         elif err == EXIT_MESH_BIN_FILE_WRITE_ERROR:
- *             raise RuntimeError('Binary file write error.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_BIN_FILE_NOT_FOUND:
- *             raise RuntimeError('Binary file not found.')
- */
-  __pyx_tuple__5 = PyTuple_Pack(1, __pyx_kp_s_Binary_file_write_error); if (unlikely(!__pyx_tuple__5)) __PYX_ERR(0, 198, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__5);
-  __Pyx_GIVEREF(__pyx_tuple__5);
-
-  /* "geomag/emm.pyx":200
- *             raise RuntimeError('Binary file write error.')
- *         elif err == EXIT_MESH_BIN_FILE_NOT_FOUND:
- *             raise RuntimeError('Binary file not found.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_FORMAT_ERROR:
- *             raise RuntimeError('File format error.')
- */
-  __pyx_tuple__6 = PyTuple_Pack(1, __pyx_kp_s_Binary_file_not_found); if (unlikely(!__pyx_tuple__6)) __PYX_ERR(0, 200, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__6);
-  __Pyx_GIVEREF(__pyx_tuple__6);
-
-  /* "geomag/emm.pyx":202
- *             raise RuntimeError('Binary file not found.')
- *         elif err == EXIT_MESH_FILE_FORMAT_ERROR:
- *             raise RuntimeError('File format error.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_EPOCH_ERROR:
- *             raise RuntimeError('File epoch error (Model year out of range)')
- */
-  __pyx_tuple__7 = PyTuple_Pack(1, __pyx_kp_s_File_format_error); if (unlikely(!__pyx_tuple__7)) __PYX_ERR(0, 202, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__7);
-  __Pyx_GIVEREF(__pyx_tuple__7);
-
-  /* "geomag/emm.pyx":204
- *             raise RuntimeError('File format error.')
- *         elif err == EXIT_MESH_FILE_EPOCH_ERROR:
- *             raise RuntimeError('File epoch error (Model year out of range)')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_NALT_ERROR:
- *             raise RuntimeError('File error: number of altitude layers out of range.')
- */
-  __pyx_tuple__8 = PyTuple_Pack(1, __pyx_kp_s_File_epoch_error_Model_year_out); if (unlikely(!__pyx_tuple__8)) __PYX_ERR(0, 204, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__8);
-  __Pyx_GIVEREF(__pyx_tuple__8);
-
-  /* "geomag/emm.pyx":206
- *             raise RuntimeError('File epoch error (Model year out of range)')
- *         elif err == EXIT_MESH_FILE_NALT_ERROR:
- *             raise RuntimeError('File error: number of altitude layers out of range.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_NLAT_ERROR:
- *             raise RuntimeError('File error: number of latitude rows out of range.')
- */
-  __pyx_tuple__9 = PyTuple_Pack(1, __pyx_kp_s_File_error_number_of_altitude_la); if (unlikely(!__pyx_tuple__9)) __PYX_ERR(0, 206, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__9);
-  __Pyx_GIVEREF(__pyx_tuple__9);
-
-  /* "geomag/emm.pyx":208
- *             raise RuntimeError('File error: number of altitude layers out of range.')
- *         elif err == EXIT_MESH_FILE_NLAT_ERROR:
- *             raise RuntimeError('File error: number of latitude rows out of range.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_ALT_ERROR:
- *             raise RuntimeError('File error: altitude out of range.')
- */
-  __pyx_tuple__10 = PyTuple_Pack(1, __pyx_kp_s_File_error_number_of_latitude_ro); if (unlikely(!__pyx_tuple__10)) __PYX_ERR(0, 208, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__10);
-  __Pyx_GIVEREF(__pyx_tuple__10);
-
-  /* "geomag/emm.pyx":210
- *             raise RuntimeError('File error: number of latitude rows out of range.')
- *         elif err == EXIT_MESH_FILE_ALT_ERROR:
- *             raise RuntimeError('File error: altitude out of range.')             # <<<<<<<<<<<<<<
- *         elif err == EXIT_MESH_FILE_NLON_ERROR:
- *             raise RuntimeError('File error: number of longitude cells at latitude and altitude out of range.')
- */
-  __pyx_tuple__11 = PyTuple_Pack(1, __pyx_kp_s_File_error_altitude_out_of_range); if (unlikely(!__pyx_tuple__11)) __PYX_ERR(0, 210, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__11);
-  __Pyx_GIVEREF(__pyx_tuple__11);
-
-  /* "geomag/emm.pyx":212
- *             raise RuntimeError('File error: altitude out of range.')
- *         elif err == EXIT_MESH_FILE_NLON_ERROR:
- *             raise RuntimeError('File error: number of longitude cells at latitude and altitude out of range.')             # <<<<<<<<<<<<<<
- * 
- * ##cdef class EMMSph(EMMBase):
- */
-  __pyx_tuple__12 = PyTuple_Pack(1, __pyx_kp_s_File_error_number_of_longitude_c); if (unlikely(!__pyx_tuple__12)) __PYX_ERR(0, 212, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__12);
-  __Pyx_GIVEREF(__pyx_tuple__12);
-
-  /* "(tree fragment)":2
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-  __pyx_tuple__13 = PyTuple_Pack(1, __pyx_kp_s_no_default___reduce___due_to_non); if (unlikely(!__pyx_tuple__13)) __PYX_ERR(1, 2, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__13);
-  __Pyx_GIVEREF(__pyx_tuple__13);
-
-  /* "(tree fragment)":4
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- */
-  __pyx_tuple__14 = PyTuple_Pack(1, __pyx_kp_s_no_default___reduce___due_to_non); if (unlikely(!__pyx_tuple__14)) __PYX_ERR(1, 4, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__14);
-  __Pyx_GIVEREF(__pyx_tuple__14);
-
-  /* "(tree fragment)":2
- * def __reduce_cython__(self):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- */
-  __pyx_tuple__15 = PyTuple_Pack(1, __pyx_kp_s_no_default___reduce___due_to_non); if (unlikely(!__pyx_tuple__15)) __PYX_ERR(1, 2, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__15);
-  __Pyx_GIVEREF(__pyx_tuple__15);
-
-  /* "(tree fragment)":4
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")
- * def __setstate_cython__(self, __pyx_state):
- *     raise TypeError("no default __reduce__ due to non-trivial __cinit__")             # <<<<<<<<<<<<<<
- */
-  __pyx_tuple__16 = PyTuple_Pack(1, __pyx_kp_s_no_default___reduce___due_to_non); if (unlikely(!__pyx_tuple__16)) __PYX_ERR(1, 4, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__16);
-  __Pyx_GIVEREF(__pyx_tuple__16);
-
-  /* "geomag/emm.pyx":171
- * 
- *     @staticmethod
- *     def citation():             # <<<<<<<<<<<<<<
- *         return "Chulliat, A., P. Alken, M. Nair, A. Woods, and S. Maus, 2015, The Enhanced Magnetic Model 2015-2020, National Centers for Environmental Information, NOAA. doi: 10.7289/V56971HV."
- * 
- */
-  __pyx_codeobj__17 = (PyObject*)__Pyx_PyCode_New(0, 0, 0, 0, 0, __pyx_empty_bytes, __pyx_empty_tuple, __pyx_empty_tuple, __pyx_empty_tuple, __pyx_empty_tuple, __pyx_empty_tuple, __pyx_kp_s_emm_pyx, __pyx_n_s_citation, 171, __pyx_empty_bytes); if (unlikely(!__pyx_codeobj__17)) __PYX_ERR(0, 171, __pyx_L1_error)
-
-  /* "geomag/emm.pyx":175
- * 
- *     @staticmethod
- *     def bibtex():             # <<<<<<<<<<<<<<
- *         return '@article{RN121,\n    author = {Chulliat, A and Alken, P and Nair, M and Woods, A and Maus, S},\n    title = {The Enhanced Magnetic Model 2015-2020},\n    journal = {National Centers for Environmental Information, NOAA},\n    DOI = {10.7289/V56971HV},\n    year = {2015},\n    type = {Journal Article}\n}'
- * 
- */
-  __pyx_codeobj__18 = (PyObject*)__Pyx_PyCode_New(0, 0, 0, 0, 0, __pyx_empty_bytes, __pyx_empty_tuple, __pyx_empty_tuple, __pyx_empty_tuple, __pyx_empty_tuple, __pyx_empty_tuple, __pyx_kp_s_emm_pyx, __pyx_n_s_bibtex, 175, __pyx_empty_bytes); if (unlikely(!__pyx_codeobj__18)) __PYX_ERR(0, 175, __pyx_L1_error)
-  __Pyx_RefNannyFinishContext();
-  return 0;
-  __pyx_L1_error:;
-  __Pyx_RefNannyFinishContext();
-  return -1;
-}
-
-static int __Pyx_InitGlobals(void) {
-  if (__Pyx_InitStrings(__pyx_string_tab) < 0) __PYX_ERR(0, 2, __pyx_L1_error);
-  __pyx_int_0 = PyInt_FromLong(0); if (unlikely(!__pyx_int_0)) __PYX_ERR(0, 2, __pyx_L1_error)
-  __pyx_int_1 = PyInt_FromLong(1); if (unlikely(!__pyx_int_1)) __PYX_ERR(0, 2, __pyx_L1_error)
-  __pyx_int_90 = PyInt_FromLong(90); if (unlikely(!__pyx_int_90)) __PYX_ERR(0, 2, __pyx_L1_error)
-  __pyx_int_360 = PyInt_FromLong(360); if (unlikely(!__pyx_int_360)) __PYX_ERR(0, 2, __pyx_L1_error)
-  __pyx_int_365 = PyInt_FromLong(365); if (unlikely(!__pyx_int_365)) __PYX_ERR(0, 2, __pyx_L1_error)
-  __pyx_int_neg_90 = PyInt_FromLong(-90); if (unlikely(!__pyx_int_neg_90)) __PYX_ERR(0, 2, __pyx_L1_error)
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-#if PY_MAJOR_VERSION < 3
-PyMODINIT_FUNC initemm(void); /*proto*/
-PyMODINIT_FUNC initemm(void)
-#else
-PyMODINIT_FUNC PyInit_emm(void); /*proto*/
-PyMODINIT_FUNC PyInit_emm(void)
-#endif
-{
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  __Pyx_RefNannyDeclarations
-  #if CYTHON_REFNANNY
-  __Pyx_RefNanny = __Pyx_RefNannyImportAPI("refnanny");
-  if (!__Pyx_RefNanny) {
-      PyErr_Clear();
-      __Pyx_RefNanny = __Pyx_RefNannyImportAPI("Cython.Runtime.refnanny");
-      if (!__Pyx_RefNanny)
-          Py_FatalError("failed to import 'refnanny' module");
-  }
-  #endif
-  __Pyx_RefNannySetupContext("PyMODINIT_FUNC PyInit_emm(void)", 0);
-  if (__Pyx_check_binary_version() < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  __pyx_empty_tuple = PyTuple_New(0); if (unlikely(!__pyx_empty_tuple)) __PYX_ERR(0, 2, __pyx_L1_error)
-  __pyx_empty_bytes = PyBytes_FromStringAndSize("", 0); if (unlikely(!__pyx_empty_bytes)) __PYX_ERR(0, 2, __pyx_L1_error)
-  __pyx_empty_unicode = PyUnicode_FromStringAndSize("", 0); if (unlikely(!__pyx_empty_unicode)) __PYX_ERR(0, 2, __pyx_L1_error)
-  #ifdef __Pyx_CyFunction_USED
-  if (__pyx_CyFunction_init() < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  #endif
-  #ifdef __Pyx_FusedFunction_USED
-  if (__pyx_FusedFunction_init() < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  #endif
-  #ifdef __Pyx_Coroutine_USED
-  if (__pyx_Coroutine_init() < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  #endif
-  #ifdef __Pyx_Generator_USED
-  if (__pyx_Generator_init() < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  #endif
-  #ifdef __Pyx_StopAsyncIteration_USED
-  if (__pyx_StopAsyncIteration_init() < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  #endif
-  /*--- Library function declarations ---*/
-  /*--- Threads initialization code ---*/
-  #if defined(__PYX_FORCE_INIT_THREADS) && __PYX_FORCE_INIT_THREADS
-  #ifdef WITH_THREAD /* Python build with threading support? */
-  PyEval_InitThreads();
-  #endif
-  #endif
-  /*--- Module creation code ---*/
-  #if PY_MAJOR_VERSION < 3
-  __pyx_m = Py_InitModule4("emm", __pyx_methods, 0, 0, PYTHON_API_VERSION); Py_XINCREF(__pyx_m);
-  #else
-  __pyx_m = PyModule_Create(&__pyx_moduledef);
-  #endif
-  if (unlikely(!__pyx_m)) __PYX_ERR(0, 2, __pyx_L1_error)
-  __pyx_d = PyModule_GetDict(__pyx_m); if (unlikely(!__pyx_d)) __PYX_ERR(0, 2, __pyx_L1_error)
-  Py_INCREF(__pyx_d);
-  __pyx_b = PyImport_AddModule(__Pyx_BUILTIN_MODULE_NAME); if (unlikely(!__pyx_b)) __PYX_ERR(0, 2, __pyx_L1_error)
-  __pyx_cython_runtime = PyImport_AddModule((char *) "cython_runtime"); if (unlikely(!__pyx_cython_runtime)) __PYX_ERR(0, 2, __pyx_L1_error)
-  #if CYTHON_COMPILING_IN_PYPY
-  Py_INCREF(__pyx_b);
-  #endif
-  if (PyObject_SetAttrString(__pyx_m, "__builtins__", __pyx_b) < 0) __PYX_ERR(0, 2, __pyx_L1_error);
-  /*--- Initialize various global constants etc. ---*/
-  if (__Pyx_InitGlobals() < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  #if PY_MAJOR_VERSION < 3 && (__PYX_DEFAULT_STRING_ENCODING_IS_ASCII || __PYX_DEFAULT_STRING_ENCODING_IS_DEFAULT)
-  if (__Pyx_init_sys_getdefaultencoding_params() < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  #endif
-  if (__pyx_module_is_main_geomag__emm) {
-    if (PyObject_SetAttrString(__pyx_m, "__name__", __pyx_n_s_main) < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  }
-  #if PY_MAJOR_VERSION >= 3
-  {
-    PyObject *modules = PyImport_GetModuleDict(); if (unlikely(!modules)) __PYX_ERR(0, 2, __pyx_L1_error)
-    if (!PyDict_GetItemString(modules, "geomag.emm")) {
-      if (unlikely(PyDict_SetItemString(modules, "geomag.emm", __pyx_m) < 0)) __PYX_ERR(0, 2, __pyx_L1_error)
-    }
-  }
-  #endif
-  /*--- Builtin init code ---*/
-  if (__Pyx_InitCachedBuiltins() < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  /*--- Constants init code ---*/
-  if (__Pyx_InitCachedConstants() < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  /*--- Global init code ---*/
-  /*--- Variable export code ---*/
-  /*--- Function export code ---*/
-  /*--- Type init code ---*/
-  __pyx_vtabptr_6geomag_3emm_GeoMagneticElements = &__pyx_vtable_6geomag_3emm_GeoMagneticElements;
-  __pyx_vtable_6geomag_3emm_GeoMagneticElements._setup = (PyObject *(*)(struct __pyx_obj_6geomag_3emm_GeoMagneticElements *, MAGtype_GeoMagneticElements))__pyx_f_6geomag_3emm_19GeoMagneticElements__setup;
-  if (PyType_Ready(&__pyx_type_6geomag_3emm_GeoMagneticElements) < 0) __PYX_ERR(0, 101, __pyx_L1_error)
-  __pyx_type_6geomag_3emm_GeoMagneticElements.tp_print = 0;
-  if (__Pyx_SetVtable(__pyx_type_6geomag_3emm_GeoMagneticElements.tp_dict, __pyx_vtabptr_6geomag_3emm_GeoMagneticElements) < 0) __PYX_ERR(0, 101, __pyx_L1_error)
-  if (PyObject_SetAttrString(__pyx_m, "GeoMagneticElements", (PyObject *)&__pyx_type_6geomag_3emm_GeoMagneticElements) < 0) __PYX_ERR(0, 101, __pyx_L1_error)
-  if (__Pyx_setup_reduce((PyObject*)&__pyx_type_6geomag_3emm_GeoMagneticElements) < 0) __PYX_ERR(0, 101, __pyx_L1_error)
-  __pyx_ptype_6geomag_3emm_GeoMagneticElements = &__pyx_type_6geomag_3emm_GeoMagneticElements;
-  __pyx_vtabptr_6geomag_3emm_EMMBase = &__pyx_vtable_6geomag_3emm_EMMBase;
-  __pyx_vtable_6geomag_3emm_EMMBase.norm_lat_lon = (PyObject *(*)(struct __pyx_obj_6geomag_3emm_EMMBase *, PyObject *, PyObject *))__pyx_f_6geomag_3emm_7EMMBase_norm_lat_lon;
-  __pyx_vtable_6geomag_3emm_EMMBase._EMM_check = (PyObject *(*)(int))__pyx_f_6geomag_3emm_7EMMBase__EMM_check;
-  if (PyType_Ready(&__pyx_type_6geomag_3emm_EMMBase) < 0) __PYX_ERR(0, 145, __pyx_L1_error)
-  __pyx_type_6geomag_3emm_EMMBase.tp_print = 0;
-  if (__Pyx_SetVtable(__pyx_type_6geomag_3emm_EMMBase.tp_dict, __pyx_vtabptr_6geomag_3emm_EMMBase) < 0) __PYX_ERR(0, 145, __pyx_L1_error)
-  if (PyObject_SetAttrString(__pyx_m, "EMMBase", (PyObject *)&__pyx_type_6geomag_3emm_EMMBase) < 0) __PYX_ERR(0, 145, __pyx_L1_error)
-  if (__Pyx_setup_reduce((PyObject*)&__pyx_type_6geomag_3emm_EMMBase) < 0) __PYX_ERR(0, 145, __pyx_L1_error)
-  __pyx_ptype_6geomag_3emm_EMMBase = &__pyx_type_6geomag_3emm_EMMBase;
-  __pyx_vtabptr_6geomag_3emm_EMMMesh = &__pyx_vtable_6geomag_3emm_EMMMesh;
-  __pyx_vtable_6geomag_3emm_EMMMesh.__pyx_base = *__pyx_vtabptr_6geomag_3emm_EMMBase;
-  __pyx_vtable_6geomag_3emm_EMMMesh._compute_field_c = (MAGtype_GeoMagneticElements (*)(struct __pyx_obj_6geomag_3emm_EMMMesh *, MAGtype_CoordGeodetic, MAGtype_CoordSpherical, MAGtype_Date, struct __pyx_opt_args_6geomag_3emm_7EMMMesh__compute_field_c *__pyx_optional_args))__pyx_f_6geomag_3emm_7EMMMesh__compute_field_c;
-  __pyx_vtable_6geomag_3emm_EMMMesh.compute_field_c = (MAGtype_GeoMagneticElements (*)(struct __pyx_obj_6geomag_3emm_EMMMesh *, double, double, double, double, struct __pyx_opt_args_6geomag_3emm_7EMMMesh_compute_field_c *__pyx_optional_args))__pyx_f_6geomag_3emm_7EMMMesh_compute_field_c;
-  __pyx_vtable_6geomag_3emm_EMMMesh._load_c = (void (*)(struct __pyx_obj_6geomag_3emm_EMMMesh *))__pyx_f_6geomag_3emm_7EMMMesh__load_c;
-  __pyx_type_6geomag_3emm_EMMMesh.tp_base = __pyx_ptype_6geomag_3emm_EMMBase;
-  if (PyType_Ready(&__pyx_type_6geomag_3emm_EMMMesh) < 0) __PYX_ERR(0, 224, __pyx_L1_error)
-  __pyx_type_6geomag_3emm_EMMMesh.tp_print = 0;
-  if (__Pyx_SetVtable(__pyx_type_6geomag_3emm_EMMMesh.tp_dict, __pyx_vtabptr_6geomag_3emm_EMMMesh) < 0) __PYX_ERR(0, 224, __pyx_L1_error)
-  if (PyObject_SetAttrString(__pyx_m, "EMMMesh", (PyObject *)&__pyx_type_6geomag_3emm_EMMMesh) < 0) __PYX_ERR(0, 224, __pyx_L1_error)
-  if (__Pyx_setup_reduce((PyObject*)&__pyx_type_6geomag_3emm_EMMMesh) < 0) __PYX_ERR(0, 224, __pyx_L1_error)
-  __pyx_ptype_6geomag_3emm_EMMMesh = &__pyx_type_6geomag_3emm_EMMMesh;
-  /*--- Type import code ---*/
-  /*--- Variable import code ---*/
-  /*--- Function import code ---*/
-  /*--- Execution code ---*/
-  #if defined(__Pyx_Generator_USED) || defined(__Pyx_Coroutine_USED)
-  if (__Pyx_patch_abc() < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  #endif
-
-  /* "geomag/emm.pyx":137
- * 
- * from libc.math cimport cos, sin, sqrt, atan2, asin
- * from time import gmtime             # <<<<<<<<<<<<<<
- * from os import path
- * 
- */
-  __pyx_t_1 = PyList_New(1); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 137, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_INCREF(__pyx_n_s_gmtime);
-  __Pyx_GIVEREF(__pyx_n_s_gmtime);
-  PyList_SET_ITEM(__pyx_t_1, 0, __pyx_n_s_gmtime);
-  __pyx_t_2 = __Pyx_Import(__pyx_n_s_time, __pyx_t_1, -1); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 137, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_1 = __Pyx_ImportFrom(__pyx_t_2, __pyx_n_s_gmtime); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 137, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_d, __pyx_n_s_gmtime, __pyx_t_1) < 0) __PYX_ERR(0, 137, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "geomag/emm.pyx":138
- * from libc.math cimport cos, sin, sqrt, atan2, asin
- * from time import gmtime
- * from os import path             # <<<<<<<<<<<<<<
- * 
- * cdef double d2r(double d):
- */
-  __pyx_t_2 = PyList_New(1); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 138, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_INCREF(__pyx_n_s_path);
-  __Pyx_GIVEREF(__pyx_n_s_path);
-  PyList_SET_ITEM(__pyx_t_2, 0, __pyx_n_s_path);
-  __pyx_t_1 = __Pyx_Import(__pyx_n_s_os, __pyx_t_2, -1); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 138, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_2 = __Pyx_ImportFrom(__pyx_t_1, __pyx_n_s_path); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 138, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  if (PyDict_SetItem(__pyx_d, __pyx_n_s_path, __pyx_t_2) < 0) __PYX_ERR(0, 138, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "geomag/emm.pyx":171
- * 
- *     @staticmethod
- *     def citation():             # <<<<<<<<<<<<<<
- *         return "Chulliat, A., P. Alken, M. Nair, A. Woods, and S. Maus, 2015, The Enhanced Magnetic Model 2015-2020, National Centers for Environmental Information, NOAA. doi: 10.7289/V56971HV."
- * 
- */
-  __pyx_t_1 = PyCFunction_NewEx(&__pyx_mdef_6geomag_3emm_7EMMBase_3citation, NULL, __pyx_n_s_geomag_emm); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 171, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem((PyObject *)__pyx_ptype_6geomag_3emm_EMMBase->tp_dict, __pyx_n_s_citation, __pyx_t_1) < 0) __PYX_ERR(0, 171, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  PyType_Modified(__pyx_ptype_6geomag_3emm_EMMBase);
-
-  /* "geomag/emm.pyx":170
- *         return lat,lon
- * 
- *     @staticmethod             # <<<<<<<<<<<<<<
- *     def citation():
- *         return "Chulliat, A., P. Alken, M. Nair, A. Woods, and S. Maus, 2015, The Enhanced Magnetic Model 2015-2020, National Centers for Environmental Information, NOAA. doi: 10.7289/V56971HV."
- */
-  __pyx_t_1 = __Pyx_GetNameInClass((PyObject *)__pyx_ptype_6geomag_3emm_EMMBase, __pyx_n_s_citation); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 171, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 170, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_staticmethod, __pyx_t_2, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 170, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  if (PyDict_SetItem((PyObject *)__pyx_ptype_6geomag_3emm_EMMBase->tp_dict, __pyx_n_s_citation, __pyx_t_1) < 0) __PYX_ERR(0, 171, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  PyType_Modified(__pyx_ptype_6geomag_3emm_EMMBase);
-
-  /* "geomag/emm.pyx":175
- * 
- *     @staticmethod
- *     def bibtex():             # <<<<<<<<<<<<<<
- *         return '@article{RN121,\n    author = {Chulliat, A and Alken, P and Nair, M and Woods, A and Maus, S},\n    title = {The Enhanced Magnetic Model 2015-2020},\n    journal = {National Centers for Environmental Information, NOAA},\n    DOI = {10.7289/V56971HV},\n    year = {2015},\n    type = {Journal Article}\n}'
- * 
- */
-  __pyx_t_1 = PyCFunction_NewEx(&__pyx_mdef_6geomag_3emm_7EMMBase_5bibtex, NULL, __pyx_n_s_geomag_emm); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 175, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem((PyObject *)__pyx_ptype_6geomag_3emm_EMMBase->tp_dict, __pyx_n_s_bibtex, __pyx_t_1) < 0) __PYX_ERR(0, 175, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  PyType_Modified(__pyx_ptype_6geomag_3emm_EMMBase);
-
-  /* "geomag/emm.pyx":174
- *         return "Chulliat, A., P. Alken, M. Nair, A. Woods, and S. Maus, 2015, The Enhanced Magnetic Model 2015-2020, National Centers for Environmental Information, NOAA. doi: 10.7289/V56971HV."
- * 
- *     @staticmethod             # <<<<<<<<<<<<<<
- *     def bibtex():
- *         return '@article{RN121,\n    author = {Chulliat, A and Alken, P and Nair, M and Woods, A and Maus, S},\n    title = {The Enhanced Magnetic Model 2015-2020},\n    journal = {National Centers for Environmental Information, NOAA},\n    DOI = {10.7289/V56971HV},\n    year = {2015},\n    type = {Journal Article}\n}'
- */
-  __pyx_t_1 = __Pyx_GetNameInClass((PyObject *)__pyx_ptype_6geomag_3emm_EMMBase, __pyx_n_s_bibtex); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 175, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 174, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = __Pyx_PyObject_Call(__pyx_builtin_staticmethod, __pyx_t_2, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 174, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  if (PyDict_SetItem((PyObject *)__pyx_ptype_6geomag_3emm_EMMBase->tp_dict, __pyx_n_s_bibtex, __pyx_t_1) < 0) __PYX_ERR(0, 175, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  PyType_Modified(__pyx_ptype_6geomag_3emm_EMMBase);
-
-  /* "geomag/emm.pyx":2
- * 
- * cdef extern from "EGM9615.h":             # <<<<<<<<<<<<<<
- *     float *GeoidHeightBuffer
- * 
- */
-  __pyx_t_1 = PyDict_New(); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 2, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_d, __pyx_n_s_test, __pyx_t_1) < 0) __PYX_ERR(0, 2, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /*--- Wrapped vars code ---*/
-
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  if (__pyx_m) {
-    if (__pyx_d) {
-      __Pyx_AddTraceback("init geomag.emm", 0, __pyx_lineno, __pyx_filename);
-    }
-    Py_DECREF(__pyx_m); __pyx_m = 0;
-  } else if (!PyErr_Occurred()) {
-    PyErr_SetString(PyExc_ImportError, "init geomag.emm");
-  }
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  #if PY_MAJOR_VERSION < 3
-  return;
-  #else
-  return __pyx_m;
-  #endif
-}
-
-/* --- Runtime support code --- */
-/* Refnanny */
-#if CYTHON_REFNANNY
-static __Pyx_RefNannyAPIStruct *__Pyx_RefNannyImportAPI(const char *modname) {
-    PyObject *m = NULL, *p = NULL;
-    void *r = NULL;
-    m = PyImport_ImportModule((char *)modname);
-    if (!m) goto end;
-    p = PyObject_GetAttrString(m, (char *)"RefNannyAPI");
-    if (!p) goto end;
-    r = PyLong_AsVoidPtr(p);
-end:
-    Py_XDECREF(p);
-    Py_XDECREF(m);
-    return (__Pyx_RefNannyAPIStruct *)r;
-}
-#endif
-
-/* GetBuiltinName */
-static PyObject *__Pyx_GetBuiltinName(PyObject *name) {
-    PyObject* result = __Pyx_PyObject_GetAttrStr(__pyx_b, name);
-    if (unlikely(!result)) {
-        PyErr_Format(PyExc_NameError,
-#if PY_MAJOR_VERSION >= 3
-            "name '%U' is not defined", name);
-#else
-            "name '%.200s' is not defined", PyString_AS_STRING(name));
-#endif
-    }
-    return result;
-}
-
-/* RaiseArgTupleInvalid */
-static void __Pyx_RaiseArgtupleInvalid(
-    const char* func_name,
-    int exact,
-    Py_ssize_t num_min,
-    Py_ssize_t num_max,
-    Py_ssize_t num_found)
-{
-    Py_ssize_t num_expected;
-    const char *more_or_less;
-    if (num_found < num_min) {
-        num_expected = num_min;
-        more_or_less = "at least";
-    } else {
-        num_expected = num_max;
-        more_or_less = "at most";
-    }
-    if (exact) {
-        more_or_less = "exactly";
-    }
-    PyErr_Format(PyExc_TypeError,
-                 "%.200s() takes %.8s %" CYTHON_FORMAT_SSIZE_T "d positional argument%.1s (%" CYTHON_FORMAT_SSIZE_T "d given)",
-                 func_name, more_or_less, num_expected,
-                 (num_expected == 1) ? "" : "s", num_found);
-}
-
-/* KeywordStringCheck */
-static CYTHON_INLINE int __Pyx_CheckKeywordStrings(
-    PyObject *kwdict,
-    const char* function_name,
-    int kw_allowed)
-{
-    PyObject* key = 0;
-    Py_ssize_t pos = 0;
-#if CYTHON_COMPILING_IN_PYPY
-    if (!kw_allowed && PyDict_Next(kwdict, &pos, &key, 0))
-        goto invalid_keyword;
-    return 1;
-#else
-    while (PyDict_Next(kwdict, &pos, &key, 0)) {
-        #if PY_MAJOR_VERSION < 3
-        if (unlikely(!PyString_CheckExact(key)) && unlikely(!PyString_Check(key)))
-        #endif
-            if (unlikely(!PyUnicode_Check(key)))
-                goto invalid_keyword_type;
-    }
-    if ((!kw_allowed) && unlikely(key))
-        goto invalid_keyword;
-    return 1;
-invalid_keyword_type:
-    PyErr_Format(PyExc_TypeError,
-        "%.200s() keywords must be strings", function_name);
-    return 0;
-#endif
-invalid_keyword:
-    PyErr_Format(PyExc_TypeError,
-    #if PY_MAJOR_VERSION < 3
-        "%.200s() got an unexpected keyword argument '%.200s'",
-        function_name, PyString_AsString(key));
-    #else
-        "%s() got an unexpected keyword argument '%U'",
-        function_name, key);
-    #endif
-    return 0;
-}
-
-/* PyObjectCall */
-#if CYTHON_COMPILING_IN_CPYTHON
-static CYTHON_INLINE PyObject* __Pyx_PyObject_Call(PyObject *func, PyObject *arg, PyObject *kw) {
-    PyObject *result;
-    ternaryfunc call = func->ob_type->tp_call;
-    if (unlikely(!call))
-        return PyObject_Call(func, arg, kw);
-    if (unlikely(Py_EnterRecursiveCall((char*)" while calling a Python object")))
-        return NULL;
-    result = (*call)(func, arg, kw);
-    Py_LeaveRecursiveCall();
-    if (unlikely(!result) && unlikely(!PyErr_Occurred())) {
-        PyErr_SetString(
-            PyExc_SystemError,
-            "NULL result without error in PyObject_Call");
-    }
-    return result;
-}
-#endif
-
-/* PyErrFetchRestore */
-#if CYTHON_FAST_THREAD_STATE
-static CYTHON_INLINE void __Pyx_ErrRestoreInState(PyThreadState *tstate, PyObject *type, PyObject *value, PyObject *tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    tmp_type = tstate->curexc_type;
-    tmp_value = tstate->curexc_value;
-    tmp_tb = tstate->curexc_traceback;
-    tstate->curexc_type = type;
-    tstate->curexc_value = value;
-    tstate->curexc_traceback = tb;
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-}
-static CYTHON_INLINE void __Pyx_ErrFetchInState(PyThreadState *tstate, PyObject **type, PyObject **value, PyObject **tb) {
-    *type = tstate->curexc_type;
-    *value = tstate->curexc_value;
-    *tb = tstate->curexc_traceback;
-    tstate->curexc_type = 0;
-    tstate->curexc_value = 0;
-    tstate->curexc_traceback = 0;
-}
-#endif
-
-/* RaiseException */
-#if PY_MAJOR_VERSION < 3
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb,
-                        CYTHON_UNUSED PyObject *cause) {
-    __Pyx_PyThreadState_declare
-    Py_XINCREF(type);
-    if (!value || value == Py_None)
-        value = NULL;
-    else
-        Py_INCREF(value);
-    if (!tb || tb == Py_None)
-        tb = NULL;
-    else {
-        Py_INCREF(tb);
-        if (!PyTraceBack_Check(tb)) {
-            PyErr_SetString(PyExc_TypeError,
-                "raise: arg 3 must be a traceback or None");
-            goto raise_error;
-        }
-    }
-    if (PyType_Check(type)) {
-#if CYTHON_COMPILING_IN_PYPY
-        if (!value) {
-            Py_INCREF(Py_None);
-            value = Py_None;
-        }
-#endif
-        PyErr_NormalizeException(&type, &value, &tb);
-    } else {
-        if (value) {
-            PyErr_SetString(PyExc_TypeError,
-                "instance exception may not have a separate value");
-            goto raise_error;
-        }
-        value = type;
-        type = (PyObject*) Py_TYPE(type);
-        Py_INCREF(type);
-        if (!PyType_IsSubtype((PyTypeObject *)type, (PyTypeObject *)PyExc_BaseException)) {
-            PyErr_SetString(PyExc_TypeError,
-                "raise: exception class must be a subclass of BaseException");
-            goto raise_error;
-        }
-    }
-    __Pyx_PyThreadState_assign
-    __Pyx_ErrRestore(type, value, tb);
-    return;
-raise_error:
-    Py_XDECREF(value);
-    Py_XDECREF(type);
-    Py_XDECREF(tb);
-    return;
-}
-#else
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb, PyObject *cause) {
-    PyObject* owned_instance = NULL;
-    if (tb == Py_None) {
-        tb = 0;
-    } else if (tb && !PyTraceBack_Check(tb)) {
-        PyErr_SetString(PyExc_TypeError,
-            "raise: arg 3 must be a traceback or None");
-        goto bad;
-    }
-    if (value == Py_None)
-        value = 0;
-    if (PyExceptionInstance_Check(type)) {
-        if (value) {
-            PyErr_SetString(PyExc_TypeError,
-                "instance exception may not have a separate value");
-            goto bad;
-        }
-        value = type;
-        type = (PyObject*) Py_TYPE(value);
-    } else if (PyExceptionClass_Check(type)) {
-        PyObject *instance_class = NULL;
-        if (value && PyExceptionInstance_Check(value)) {
-            instance_class = (PyObject*) Py_TYPE(value);
-            if (instance_class != type) {
-                int is_subclass = PyObject_IsSubclass(instance_class, type);
-                if (!is_subclass) {
-                    instance_class = NULL;
-                } else if (unlikely(is_subclass == -1)) {
-                    goto bad;
-                } else {
-                    type = instance_class;
-                }
-            }
-        }
-        if (!instance_class) {
-            PyObject *args;
-            if (!value)
-                args = PyTuple_New(0);
-            else if (PyTuple_Check(value)) {
-                Py_INCREF(value);
-                args = value;
-            } else
-                args = PyTuple_Pack(1, value);
-            if (!args)
-                goto bad;
-            owned_instance = PyObject_Call(type, args, NULL);
-            Py_DECREF(args);
-            if (!owned_instance)
-                goto bad;
-            value = owned_instance;
-            if (!PyExceptionInstance_Check(value)) {
-                PyErr_Format(PyExc_TypeError,
-                             "calling %R should have returned an instance of "
-                             "BaseException, not %R",
-                             type, Py_TYPE(value));
-                goto bad;
-            }
-        }
-    } else {
-        PyErr_SetString(PyExc_TypeError,
-            "raise: exception class must be a subclass of BaseException");
-        goto bad;
-    }
-#if PY_VERSION_HEX >= 0x03030000
-    if (cause) {
-#else
-    if (cause && cause != Py_None) {
-#endif
-        PyObject *fixed_cause;
-        if (cause == Py_None) {
-            fixed_cause = NULL;
-        } else if (PyExceptionClass_Check(cause)) {
-            fixed_cause = PyObject_CallObject(cause, NULL);
-            if (fixed_cause == NULL)
-                goto bad;
-        } else if (PyExceptionInstance_Check(cause)) {
-            fixed_cause = cause;
-            Py_INCREF(fixed_cause);
-        } else {
-            PyErr_SetString(PyExc_TypeError,
-                            "exception causes must derive from "
-                            "BaseException");
-            goto bad;
-        }
-        PyException_SetCause(value, fixed_cause);
-    }
-    PyErr_SetObject(type, value);
-    if (tb) {
-#if CYTHON_COMPILING_IN_PYPY
-        PyObject *tmp_type, *tmp_value, *tmp_tb;
-        PyErr_Fetch(&tmp_type, &tmp_value, &tmp_tb);
-        Py_INCREF(tb);
-        PyErr_Restore(tmp_type, tmp_value, tb);
-        Py_XDECREF(tmp_tb);
-#else
-        PyThreadState *tstate = PyThreadState_GET();
-        PyObject* tmp_tb = tstate->curexc_traceback;
-        if (tb != tmp_tb) {
-            Py_INCREF(tb);
-            tstate->curexc_traceback = tb;
-            Py_XDECREF(tmp_tb);
-        }
-#endif
-    }
-bad:
-    Py_XDECREF(owned_instance);
-    return;
-}
-#endif
-
-/* None */
-  static CYTHON_INLINE double __Pyx_mod_double(double a, double b) {
-    double r = fmod(a, b);
-    r += ((r != 0) & ((r < 0) ^ (b < 0))) * b;
-    return r;
-}
-
-/* PyIntBinop */
-  #if !CYTHON_COMPILING_IN_PYPY
-static PyObject* __Pyx_PyInt_RemainderObjC(PyObject *op1, PyObject *op2, CYTHON_UNUSED long intval, CYTHON_UNUSED int inplace) {
-    #if PY_MAJOR_VERSION < 3
-    if (likely(PyInt_CheckExact(op1))) {
-        const long b = intval;
-        long x;
-        long a = PyInt_AS_LONG(op1);
-            x = a % b;
-            x += ((x != 0) & ((x ^ b) < 0)) * b;
-            return PyInt_FromLong(x);
-    }
-    #endif
-    #if CYTHON_USE_PYLONG_INTERNALS
-    if (likely(PyLong_CheckExact(op1))) {
-        const long b = intval;
-        long a, x;
-#ifdef HAVE_LONG_LONG
-        const PY_LONG_LONG llb = intval;
-        PY_LONG_LONG lla, llx;
-#endif
-        const digit* digits = ((PyLongObject*)op1)->ob_digit;
-        const Py_ssize_t size = Py_SIZE(op1);
-        if (likely(__Pyx_sst_abs(size) <= 1)) {
-            a = likely(size) ? digits[0] : 0;
-            if (size == -1) a = -a;
-        } else {
-            switch (size) {
-                case -2:
-                    if (8 * sizeof(long) - 1 > 2 * PyLong_SHIFT) {
-                        a = -(long) (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 2 * PyLong_SHIFT) {
-                        lla = -(PY_LONG_LONG) (((((unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                case 2:
-                    if (8 * sizeof(long) - 1 > 2 * PyLong_SHIFT) {
-                        a = (long) (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 2 * PyLong_SHIFT) {
-                        lla = (PY_LONG_LONG) (((((unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                case -3:
-                    if (8 * sizeof(long) - 1 > 3 * PyLong_SHIFT) {
-                        a = -(long) (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 3 * PyLong_SHIFT) {
-                        lla = -(PY_LONG_LONG) (((((((unsigned PY_LONG_LONG)digits[2]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                case 3:
-                    if (8 * sizeof(long) - 1 > 3 * PyLong_SHIFT) {
-                        a = (long) (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 3 * PyLong_SHIFT) {
-                        lla = (PY_LONG_LONG) (((((((unsigned PY_LONG_LONG)digits[2]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                case -4:
-                    if (8 * sizeof(long) - 1 > 4 * PyLong_SHIFT) {
-                        a = -(long) (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 4 * PyLong_SHIFT) {
-                        lla = -(PY_LONG_LONG) (((((((((unsigned PY_LONG_LONG)digits[3]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[2]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                case 4:
-                    if (8 * sizeof(long) - 1 > 4 * PyLong_SHIFT) {
-                        a = (long) (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 4 * PyLong_SHIFT) {
-                        lla = (PY_LONG_LONG) (((((((((unsigned PY_LONG_LONG)digits[3]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[2]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                default: return PyLong_Type.tp_as_number->nb_remainder(op1, op2);
-            }
-        }
-                x = a % b;
-                x += ((x != 0) & ((x ^ b) < 0)) * b;
-            return PyLong_FromLong(x);
-#ifdef HAVE_LONG_LONG
-        long_long:
-                llx = lla % llb;
-                llx += ((llx != 0) & ((llx ^ llb) < 0)) * llb;
-            return PyLong_FromLongLong(llx);
-#endif
-        
-        
-    }
-    #endif
-    return (inplace ? PyNumber_InPlaceRemainder : PyNumber_Remainder)(op1, op2);
-}
-#endif
-
-/* GetAttr */
-  static CYTHON_INLINE PyObject *__Pyx_GetAttr(PyObject *o, PyObject *n) {
-#if CYTHON_COMPILING_IN_CPYTHON
-#if PY_MAJOR_VERSION >= 3
-    if (likely(PyUnicode_Check(n)))
-#else
-    if (likely(PyString_Check(n)))
-#endif
-        return __Pyx_PyObject_GetAttrStr(o, n);
-#endif
-    return PyObject_GetAttr(o, n);
-}
-
-/* HasAttr */
-  static CYTHON_INLINE int __Pyx_HasAttr(PyObject *o, PyObject *n) {
-    PyObject *r;
-    if (unlikely(!__Pyx_PyBaseString_Check(n))) {
-        PyErr_SetString(PyExc_TypeError,
-                        "hasattr(): attribute name must be string");
-        return -1;
-    }
-    r = __Pyx_GetAttr(o, n);
-    if (unlikely(!r)) {
-        PyErr_Clear();
-        return 0;
-    } else {
-        Py_DECREF(r);
-        return 1;
-    }
-}
-
-/* PyCFunctionFastCall */
-  #if CYTHON_FAST_PYCCALL
-static CYTHON_INLINE PyObject * __Pyx_PyCFunction_FastCall(PyObject *func_obj, PyObject **args, Py_ssize_t nargs) {
-    PyCFunctionObject *func = (PyCFunctionObject*)func_obj;
-    PyCFunction meth = PyCFunction_GET_FUNCTION(func);
-    PyObject *self = PyCFunction_GET_SELF(func);
-    int flags = PyCFunction_GET_FLAGS(func);
-    assert(PyCFunction_Check(func));
-    assert(METH_FASTCALL == (flags & ~(METH_CLASS | METH_STATIC | METH_COEXIST | METH_KEYWORDS)));
-    assert(nargs >= 0);
-    assert(nargs == 0 || args != NULL);
-    /* _PyCFunction_FastCallDict() must not be called with an exception set,
-       because it may clear it (directly or indirectly) and so the
-       caller loses its exception */
-    assert(!PyErr_Occurred());
-    if ((PY_VERSION_HEX < 0x030700A0) || unlikely(flags & METH_KEYWORDS)) {
-        return (*((__Pyx_PyCFunctionFastWithKeywords)meth)) (self, args, nargs, NULL);
-    } else {
-        return (*((__Pyx_PyCFunctionFast)meth)) (self, args, nargs);
-    }
-}
-#endif
-
-/* PyFunctionFastCall */
-  #if CYTHON_FAST_PYCALL
-#include "frameobject.h"
-static PyObject* __Pyx_PyFunction_FastCallNoKw(PyCodeObject *co, PyObject **args, Py_ssize_t na,
-                                               PyObject *globals) {
-    PyFrameObject *f;
-    PyThreadState *tstate = PyThreadState_GET();
-    PyObject **fastlocals;
-    Py_ssize_t i;
-    PyObject *result;
-    assert(globals != NULL);
-    /* XXX Perhaps we should create a specialized
-       PyFrame_New() that doesn't take locals, but does
-       take builtins without sanity checking them.
-       */
-    assert(tstate != NULL);
-    f = PyFrame_New(tstate, co, globals, NULL);
-    if (f == NULL) {
-        return NULL;
-    }
-    fastlocals = f->f_localsplus;
-    for (i = 0; i < na; i++) {
-        Py_INCREF(*args);
-        fastlocals[i] = *args++;
-    }
-    result = PyEval_EvalFrameEx(f,0);
-    ++tstate->recursion_depth;
-    Py_DECREF(f);
-    --tstate->recursion_depth;
-    return result;
-}
-#if 1 || PY_VERSION_HEX < 0x030600B1
-static PyObject *__Pyx_PyFunction_FastCallDict(PyObject *func, PyObject **args, int nargs, PyObject *kwargs) {
-    PyCodeObject *co = (PyCodeObject *)PyFunction_GET_CODE(func);
-    PyObject *globals = PyFunction_GET_GLOBALS(func);
-    PyObject *argdefs = PyFunction_GET_DEFAULTS(func);
-    PyObject *closure;
-#if PY_MAJOR_VERSION >= 3
-    PyObject *kwdefs;
-#endif
-    PyObject *kwtuple, **k;
-    PyObject **d;
-    Py_ssize_t nd;
-    Py_ssize_t nk;
-    PyObject *result;
-    assert(kwargs == NULL || PyDict_Check(kwargs));
-    nk = kwargs ? PyDict_Size(kwargs) : 0;
-    if (Py_EnterRecursiveCall((char*)" while calling a Python object")) {
-        return NULL;
-    }
-    if (
-#if PY_MAJOR_VERSION >= 3
-            co->co_kwonlyargcount == 0 &&
-#endif
-            likely(kwargs == NULL || nk == 0) &&
-            co->co_flags == (CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE)) {
-        if (argdefs == NULL && co->co_argcount == nargs) {
-            result = __Pyx_PyFunction_FastCallNoKw(co, args, nargs, globals);
-            goto done;
-        }
-        else if (nargs == 0 && argdefs != NULL
-                 && co->co_argcount == Py_SIZE(argdefs)) {
-            /* function called with no arguments, but all parameters have
-               a default value: use default values as arguments .*/
-            args = &PyTuple_GET_ITEM(argdefs, 0);
-            result =__Pyx_PyFunction_FastCallNoKw(co, args, Py_SIZE(argdefs), globals);
-            goto done;
-        }
-    }
-    if (kwargs != NULL) {
-        Py_ssize_t pos, i;
-        kwtuple = PyTuple_New(2 * nk);
-        if (kwtuple == NULL) {
-            result = NULL;
-            goto done;
-        }
-        k = &PyTuple_GET_ITEM(kwtuple, 0);
-        pos = i = 0;
-        while (PyDict_Next(kwargs, &pos, &k[i], &k[i+1])) {
-            Py_INCREF(k[i]);
-            Py_INCREF(k[i+1]);
-            i += 2;
-        }
-        nk = i / 2;
-    }
-    else {
-        kwtuple = NULL;
-        k = NULL;
-    }
-    closure = PyFunction_GET_CLOSURE(func);
-#if PY_MAJOR_VERSION >= 3
-    kwdefs = PyFunction_GET_KW_DEFAULTS(func);
-#endif
-    if (argdefs != NULL) {
-        d = &PyTuple_GET_ITEM(argdefs, 0);
-        nd = Py_SIZE(argdefs);
-    }
-    else {
-        d = NULL;
-        nd = 0;
-    }
-#if PY_MAJOR_VERSION >= 3
-    result = PyEval_EvalCodeEx((PyObject*)co, globals, (PyObject *)NULL,
-                               args, nargs,
-                               k, (int)nk,
-                               d, (int)nd, kwdefs, closure);
-#else
-    result = PyEval_EvalCodeEx(co, globals, (PyObject *)NULL,
-                               args, nargs,
-                               k, (int)nk,
-                               d, (int)nd, closure);
-#endif
-    Py_XDECREF(kwtuple);
-done:
-    Py_LeaveRecursiveCall();
-    return result;
-}
-#endif
-#endif
-
-/* PyObjectCallMethO */
-  #if CYTHON_COMPILING_IN_CPYTHON
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallMethO(PyObject *func, PyObject *arg) {
-    PyObject *self, *result;
-    PyCFunction cfunc;
-    cfunc = PyCFunction_GET_FUNCTION(func);
-    self = PyCFunction_GET_SELF(func);
-    if (unlikely(Py_EnterRecursiveCall((char*)" while calling a Python object")))
-        return NULL;
-    result = cfunc(self, arg);
-    Py_LeaveRecursiveCall();
-    if (unlikely(!result) && unlikely(!PyErr_Occurred())) {
-        PyErr_SetString(
-            PyExc_SystemError,
-            "NULL result without error in PyObject_Call");
-    }
-    return result;
-}
-#endif
-
-/* PyObjectCallOneArg */
-  #if CYTHON_COMPILING_IN_CPYTHON
-static PyObject* __Pyx__PyObject_CallOneArg(PyObject *func, PyObject *arg) {
-    PyObject *result;
-    PyObject *args = PyTuple_New(1);
-    if (unlikely(!args)) return NULL;
-    Py_INCREF(arg);
-    PyTuple_SET_ITEM(args, 0, arg);
-    result = __Pyx_PyObject_Call(func, args, NULL);
-    Py_DECREF(args);
-    return result;
-}
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallOneArg(PyObject *func, PyObject *arg) {
-#if CYTHON_FAST_PYCALL
-    if (PyFunction_Check(func)) {
-        return __Pyx_PyFunction_FastCall(func, &arg, 1);
-    }
-#endif
-    if (likely(PyCFunction_Check(func))) {
-        if (likely(PyCFunction_GET_FLAGS(func) & METH_O)) {
-            return __Pyx_PyObject_CallMethO(func, arg);
-#if CYTHON_FAST_PYCCALL
-        } else if (PyCFunction_GET_FLAGS(func) & METH_FASTCALL) {
-            return __Pyx_PyCFunction_FastCall(func, &arg, 1);
-#endif
-        }
-    }
-    return __Pyx__PyObject_CallOneArg(func, arg);
-}
-#else
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallOneArg(PyObject *func, PyObject *arg) {
-    PyObject *result;
-    PyObject *args = PyTuple_Pack(1, arg);
-    if (unlikely(!args)) return NULL;
-    result = __Pyx_PyObject_Call(func, args, NULL);
-    Py_DECREF(args);
-    return result;
-}
-#endif
-
-/* PyObjectCallNoArg */
-  #if CYTHON_COMPILING_IN_CPYTHON
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallNoArg(PyObject *func) {
-#if CYTHON_FAST_PYCALL
-    if (PyFunction_Check(func)) {
-        return __Pyx_PyFunction_FastCall(func, NULL, 0);
-    }
-#endif
-#ifdef __Pyx_CyFunction_USED
-    if (likely(PyCFunction_Check(func) || PyObject_TypeCheck(func, __pyx_CyFunctionType))) {
-#else
-    if (likely(PyCFunction_Check(func))) {
-#endif
-        if (likely(PyCFunction_GET_FLAGS(func) & METH_NOARGS)) {
-            return __Pyx_PyObject_CallMethO(func, NULL);
-        }
-    }
-    return __Pyx_PyObject_Call(func, __pyx_empty_tuple, NULL);
-}
-#endif
-
-/* GetModuleGlobalName */
-    static CYTHON_INLINE PyObject *__Pyx_GetModuleGlobalName(PyObject *name) {
-    PyObject *result;
-#if !CYTHON_AVOID_BORROWED_REFS
-    result = PyDict_GetItem(__pyx_d, name);
-    if (likely(result)) {
-        Py_INCREF(result);
-    } else {
-#else
-    result = PyObject_GetItem(__pyx_d, name);
-    if (!result) {
-        PyErr_Clear();
-#endif
-        result = __Pyx_GetBuiltinName(name);
-    }
-    return result;
-}
-
-/* PyIntBinop */
-      #if !CYTHON_COMPILING_IN_PYPY
-static PyObject* __Pyx_PyInt_SubtractObjC(PyObject *op1, PyObject *op2, CYTHON_UNUSED long intval, CYTHON_UNUSED int inplace) {
-    #if PY_MAJOR_VERSION < 3
-    if (likely(PyInt_CheckExact(op1))) {
-        const long b = intval;
-        long x;
-        long a = PyInt_AS_LONG(op1);
-            x = (long)((unsigned long)a - b);
-            if (likely((x^a) >= 0 || (x^~b) >= 0))
-                return PyInt_FromLong(x);
-            return PyLong_Type.tp_as_number->nb_subtract(op1, op2);
-    }
-    #endif
-    #if CYTHON_USE_PYLONG_INTERNALS
-    if (likely(PyLong_CheckExact(op1))) {
-        const long b = intval;
-        long a, x;
-#ifdef HAVE_LONG_LONG
-        const PY_LONG_LONG llb = intval;
-        PY_LONG_LONG lla, llx;
-#endif
-        const digit* digits = ((PyLongObject*)op1)->ob_digit;
-        const Py_ssize_t size = Py_SIZE(op1);
-        if (likely(__Pyx_sst_abs(size) <= 1)) {
-            a = likely(size) ? digits[0] : 0;
-            if (size == -1) a = -a;
-        } else {
-            switch (size) {
-                case -2:
-                    if (8 * sizeof(long) - 1 > 2 * PyLong_SHIFT) {
-                        a = -(long) (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 2 * PyLong_SHIFT) {
-                        lla = -(PY_LONG_LONG) (((((unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                case 2:
-                    if (8 * sizeof(long) - 1 > 2 * PyLong_SHIFT) {
-                        a = (long) (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 2 * PyLong_SHIFT) {
-                        lla = (PY_LONG_LONG) (((((unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                case -3:
-                    if (8 * sizeof(long) - 1 > 3 * PyLong_SHIFT) {
-                        a = -(long) (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 3 * PyLong_SHIFT) {
-                        lla = -(PY_LONG_LONG) (((((((unsigned PY_LONG_LONG)digits[2]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                case 3:
-                    if (8 * sizeof(long) - 1 > 3 * PyLong_SHIFT) {
-                        a = (long) (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 3 * PyLong_SHIFT) {
-                        lla = (PY_LONG_LONG) (((((((unsigned PY_LONG_LONG)digits[2]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                case -4:
-                    if (8 * sizeof(long) - 1 > 4 * PyLong_SHIFT) {
-                        a = -(long) (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 4 * PyLong_SHIFT) {
-                        lla = -(PY_LONG_LONG) (((((((((unsigned PY_LONG_LONG)digits[3]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[2]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                case 4:
-                    if (8 * sizeof(long) - 1 > 4 * PyLong_SHIFT) {
-                        a = (long) (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
-                        break;
-#ifdef HAVE_LONG_LONG
-                    } else if (8 * sizeof(PY_LONG_LONG) - 1 > 4 * PyLong_SHIFT) {
-                        lla = (PY_LONG_LONG) (((((((((unsigned PY_LONG_LONG)digits[3]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[2]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[1]) << PyLong_SHIFT) | (unsigned PY_LONG_LONG)digits[0]));
-                        goto long_long;
-#endif
-                    }
-                default: return PyLong_Type.tp_as_number->nb_subtract(op1, op2);
-            }
-        }
-                x = a - b;
-            return PyLong_FromLong(x);
-#ifdef HAVE_LONG_LONG
-        long_long:
-                llx = lla - llb;
-            return PyLong_FromLongLong(llx);
-#endif
-        
-        
-    }
-    #endif
-    if (PyFloat_CheckExact(op1)) {
-        const long b = intval;
-        double a = PyFloat_AS_DOUBLE(op1);
-            double result;
-            PyFPE_START_PROTECT("subtract", return NULL)
-            result = ((double)a) - (double)b;
-            PyFPE_END_PROTECT(result)
-            return PyFloat_FromDouble(result);
-    }
-    return (inplace ? PyNumber_InPlaceSubtract : PyNumber_Subtract)(op1, op2);
-}
-#endif
-
-/* RaiseDoubleKeywords */
-      static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name,
-    PyObject* kw_name)
-{
-    PyErr_Format(PyExc_TypeError,
-        #if PY_MAJOR_VERSION >= 3
-        "%s() got multiple values for keyword argument '%U'", func_name, kw_name);
-        #else
-        "%s() got multiple values for keyword argument '%s'", func_name,
-        PyString_AsString(kw_name));
-        #endif
-}
-
-/* ParseKeywords */
-      static int __Pyx_ParseOptionalKeywords(
-    PyObject *kwds,
-    PyObject **argnames[],
-    PyObject *kwds2,
-    PyObject *values[],
-    Py_ssize_t num_pos_args,
-    const char* function_name)
-{
-    PyObject *key = 0, *value = 0;
-    Py_ssize_t pos = 0;
-    PyObject*** name;
-    PyObject*** first_kw_arg = argnames + num_pos_args;
-    while (PyDict_Next(kwds, &pos, &key, &value)) {
-        name = first_kw_arg;
-        while (*name && (**name != key)) name++;
-        if (*name) {
-            values[name-argnames] = value;
-            continue;
-        }
-        name = first_kw_arg;
-        #if PY_MAJOR_VERSION < 3
-        if (likely(PyString_CheckExact(key)) || likely(PyString_Check(key))) {
-            while (*name) {
-                if ((CYTHON_COMPILING_IN_PYPY || PyString_GET_SIZE(**name) == PyString_GET_SIZE(key))
-                        && _PyString_Eq(**name, key)) {
-                    values[name-argnames] = value;
-                    break;
-                }
-                name++;
-            }
-            if (*name) continue;
-            else {
-                PyObject*** argname = argnames;
-                while (argname != first_kw_arg) {
-                    if ((**argname == key) || (
-                            (CYTHON_COMPILING_IN_PYPY || PyString_GET_SIZE(**argname) == PyString_GET_SIZE(key))
-                             && _PyString_Eq(**argname, key))) {
-                        goto arg_passed_twice;
-                    }
-                    argname++;
-                }
-            }
-        } else
-        #endif
-        if (likely(PyUnicode_Check(key))) {
-            while (*name) {
-                int cmp = (**name == key) ? 0 :
-                #if !CYTHON_COMPILING_IN_PYPY && PY_MAJOR_VERSION >= 3
-                    (PyUnicode_GET_SIZE(**name) != PyUnicode_GET_SIZE(key)) ? 1 :
-                #endif
-                    PyUnicode_Compare(**name, key);
-                if (cmp < 0 && unlikely(PyErr_Occurred())) goto bad;
-                if (cmp == 0) {
-                    values[name-argnames] = value;
-                    break;
-                }
-                name++;
-            }
-            if (*name) continue;
-            else {
-                PyObject*** argname = argnames;
-                while (argname != first_kw_arg) {
-                    int cmp = (**argname == key) ? 0 :
-                    #if !CYTHON_COMPILING_IN_PYPY && PY_MAJOR_VERSION >= 3
-                        (PyUnicode_GET_SIZE(**argname) != PyUnicode_GET_SIZE(key)) ? 1 :
-                    #endif
-                        PyUnicode_Compare(**argname, key);
-                    if (cmp < 0 && unlikely(PyErr_Occurred())) goto bad;
-                    if (cmp == 0) goto arg_passed_twice;
-                    argname++;
-                }
-            }
-        } else
-            goto invalid_keyword_type;
-        if (kwds2) {
-            if (unlikely(PyDict_SetItem(kwds2, key, value))) goto bad;
-        } else {
-            goto invalid_keyword;
-        }
-    }
-    return 0;
-arg_passed_twice:
-    __Pyx_RaiseDoubleKeywordsError(function_name, key);
-    goto bad;
-invalid_keyword_type:
-    PyErr_Format(PyExc_TypeError,
-        "%.200s() keywords must be strings", function_name);
-    goto bad;
-invalid_keyword:
-    PyErr_Format(PyExc_TypeError,
-    #if PY_MAJOR_VERSION < 3
-        "%.200s() got an unexpected keyword argument '%.200s'",
-        function_name, PyString_AsString(key));
-    #else
-        "%s() got an unexpected keyword argument '%U'",
-        function_name, key);
-    #endif
-bad:
-    return -1;
-}
-
-/* ArgTypeTest */
-      static void __Pyx_RaiseArgumentTypeInvalid(const char* name, PyObject *obj, PyTypeObject *type) {
-    PyErr_Format(PyExc_TypeError,
-        "Argument '%.200s' has incorrect type (expected %.200s, got %.200s)",
-        name, type->tp_name, Py_TYPE(obj)->tp_name);
-}
-static CYTHON_INLINE int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact)
-{
-    if (unlikely(!type)) {
-        PyErr_SetString(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (none_allowed && obj == Py_None) return 1;
-    else if (exact) {
-        if (likely(Py_TYPE(obj) == type)) return 1;
-        #if PY_MAJOR_VERSION == 2
-        else if ((type == &PyBaseString_Type) && likely(__Pyx_PyBaseString_CheckExact(obj))) return 1;
-        #endif
-    }
-    else {
-        if (likely(PyObject_TypeCheck(obj, type))) return 1;
-    }
-    __Pyx_RaiseArgumentTypeInvalid(name, obj, type);
-    return 0;
-}
-
-/* WriteUnraisableException */
-      static void __Pyx_WriteUnraisable(const char *name, CYTHON_UNUSED int clineno,
-                                  CYTHON_UNUSED int lineno, CYTHON_UNUSED const char *filename,
-                                  int full_traceback, CYTHON_UNUSED int nogil) {
-    PyObject *old_exc, *old_val, *old_tb;
-    PyObject *ctx;
-    __Pyx_PyThreadState_declare
-#ifdef WITH_THREAD
-    PyGILState_STATE state;
-    if (nogil)
-        state = PyGILState_Ensure();
-#ifdef _MSC_VER
-    else state = (PyGILState_STATE)-1;
-#endif
-#endif
-    __Pyx_PyThreadState_assign
-    __Pyx_ErrFetch(&old_exc, &old_val, &old_tb);
-    if (full_traceback) {
-        Py_XINCREF(old_exc);
-        Py_XINCREF(old_val);
-        Py_XINCREF(old_tb);
-        __Pyx_ErrRestore(old_exc, old_val, old_tb);
-        PyErr_PrintEx(1);
-    }
-    #if PY_MAJOR_VERSION < 3
-    ctx = PyString_FromString(name);
-    #else
-    ctx = PyUnicode_FromString(name);
-    #endif
-    __Pyx_ErrRestore(old_exc, old_val, old_tb);
-    if (!ctx) {
-        PyErr_WriteUnraisable(Py_None);
-    } else {
-        PyErr_WriteUnraisable(ctx);
-        Py_DECREF(ctx);
-    }
-#ifdef WITH_THREAD
-    if (nogil)
-        PyGILState_Release(state);
-#endif
-}
-
-/* RaiseTooManyValuesToUnpack */
-      static CYTHON_INLINE void __Pyx_RaiseTooManyValuesError(Py_ssize_t expected) {
-    PyErr_Format(PyExc_ValueError,
-                 "too many values to unpack (expected %" CYTHON_FORMAT_SSIZE_T "d)", expected);
-}
-
-/* RaiseNeedMoreValuesToUnpack */
-      static CYTHON_INLINE void __Pyx_RaiseNeedMoreValuesError(Py_ssize_t index) {
-    PyErr_Format(PyExc_ValueError,
-                 "need more than %" CYTHON_FORMAT_SSIZE_T "d value%.1s to unpack",
-                 index, (index == 1) ? "" : "s");
-}
-
-/* RaiseNoneIterError */
-      static CYTHON_INLINE void __Pyx_RaiseNoneNotIterableError(void) {
-    PyErr_SetString(PyExc_TypeError, "'NoneType' object is not iterable");
-}
-
-/* SetVTable */
-      static int __Pyx_SetVtable(PyObject *dict, void *vtable) {
-#if PY_VERSION_HEX >= 0x02070000
-    PyObject *ob = PyCapsule_New(vtable, 0, 0);
-#else
-    PyObject *ob = PyCObject_FromVoidPtr(vtable, 0);
-#endif
-    if (!ob)
-        goto bad;
-    if (PyDict_SetItem(dict, __pyx_n_s_pyx_vtable, ob) < 0)
-        goto bad;
-    Py_DECREF(ob);
-    return 0;
-bad:
-    Py_XDECREF(ob);
-    return -1;
-}
-
-/* SetupReduce */
-      static int __Pyx_setup_reduce_is_named(PyObject* meth, PyObject* name) {
-  int ret;
-  PyObject *name_attr;
-  name_attr = __Pyx_PyObject_GetAttrStr(meth, __pyx_n_s_name);
-  if (likely(name_attr)) {
-      ret = PyObject_RichCompareBool(name_attr, name, Py_EQ);
-  } else {
-      ret = -1;
-  }
-  if (unlikely(ret < 0)) {
-      PyErr_Clear();
-      ret = 0;
-  }
-  Py_XDECREF(name_attr);
-  return ret;
-}
-static int __Pyx_setup_reduce(PyObject* type_obj) {
-    int ret = 0;
-    PyObject *object_reduce = NULL;
-    PyObject *object_reduce_ex = NULL;
-    PyObject *reduce = NULL;
-    PyObject *reduce_ex = NULL;
-    PyObject *reduce_cython = NULL;
-    PyObject *setstate = NULL;
-    PyObject *setstate_cython = NULL;
-#if CYTHON_USE_PYTYPE_LOOKUP
-    if (_PyType_Lookup((PyTypeObject*)type_obj, __pyx_n_s_getstate)) goto GOOD;
-#else
-    if (PyObject_HasAttr(type_obj, __pyx_n_s_getstate)) goto GOOD;
-#endif
-#if CYTHON_USE_PYTYPE_LOOKUP
-    object_reduce_ex = _PyType_Lookup(&PyBaseObject_Type, __pyx_n_s_reduce_ex); if (!object_reduce_ex) goto BAD;
-#else
-    object_reduce_ex = __Pyx_PyObject_GetAttrStr((PyObject*)&PyBaseObject_Type, __pyx_n_s_reduce_ex); if (!object_reduce_ex) goto BAD;
-#endif
-    reduce_ex = __Pyx_PyObject_GetAttrStr(type_obj, __pyx_n_s_reduce_ex); if (unlikely(!reduce_ex)) goto BAD;
-    if (reduce_ex == object_reduce_ex) {
-#if CYTHON_USE_PYTYPE_LOOKUP
-        object_reduce = _PyType_Lookup(&PyBaseObject_Type, __pyx_n_s_reduce); if (!object_reduce) goto BAD;
-#else
-        object_reduce = __Pyx_PyObject_GetAttrStr((PyObject*)&PyBaseObject_Type, __pyx_n_s_reduce); if (!object_reduce) goto BAD;
-#endif
-        reduce = __Pyx_PyObject_GetAttrStr(type_obj, __pyx_n_s_reduce); if (unlikely(!reduce)) goto BAD;
-        if (reduce == object_reduce || __Pyx_setup_reduce_is_named(reduce, __pyx_n_s_reduce_cython)) {
-            reduce_cython = __Pyx_PyObject_GetAttrStr(type_obj, __pyx_n_s_reduce_cython); if (unlikely(!reduce_cython)) goto BAD;
-            ret = PyDict_SetItem(((PyTypeObject*)type_obj)->tp_dict, __pyx_n_s_reduce, reduce_cython); if (unlikely(ret < 0)) goto BAD;
-            ret = PyDict_DelItem(((PyTypeObject*)type_obj)->tp_dict, __pyx_n_s_reduce_cython); if (unlikely(ret < 0)) goto BAD;
-            setstate = __Pyx_PyObject_GetAttrStr(type_obj, __pyx_n_s_setstate);
-            if (!setstate) PyErr_Clear();
-            if (!setstate || __Pyx_setup_reduce_is_named(setstate, __pyx_n_s_setstate_cython)) {
-                setstate_cython = __Pyx_PyObject_GetAttrStr(type_obj, __pyx_n_s_setstate_cython); if (unlikely(!setstate_cython)) goto BAD;
-                ret = PyDict_SetItem(((PyTypeObject*)type_obj)->tp_dict, __pyx_n_s_setstate, setstate_cython); if (unlikely(ret < 0)) goto BAD;
-                ret = PyDict_DelItem(((PyTypeObject*)type_obj)->tp_dict, __pyx_n_s_setstate_cython); if (unlikely(ret < 0)) goto BAD;
-            }
-            PyType_Modified((PyTypeObject*)type_obj);
-        }
-    }
-    goto GOOD;
-BAD:
-    if (!PyErr_Occurred())
-        PyErr_Format(PyExc_RuntimeError, "Unable to initialize pickling for %s", ((PyTypeObject*)type_obj)->tp_name);
-    ret = -1;
-GOOD:
-#if !CYTHON_COMPILING_IN_CPYTHON
-    Py_XDECREF(object_reduce);
-    Py_XDECREF(object_reduce_ex);
-#endif
-    Py_XDECREF(reduce);
-    Py_XDECREF(reduce_ex);
-    Py_XDECREF(reduce_cython);
-    Py_XDECREF(setstate);
-    Py_XDECREF(setstate_cython);
-    return ret;
-}
-
-/* Import */
-      static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list, int level) {
-    PyObject *empty_list = 0;
-    PyObject *module = 0;
-    PyObject *global_dict = 0;
-    PyObject *empty_dict = 0;
-    PyObject *list;
-    #if PY_VERSION_HEX < 0x03030000
-    PyObject *py_import;
-    py_import = __Pyx_PyObject_GetAttrStr(__pyx_b, __pyx_n_s_import);
-    if (!py_import)
-        goto bad;
-    #endif
-    if (from_list)
-        list = from_list;
-    else {
-        empty_list = PyList_New(0);
-        if (!empty_list)
-            goto bad;
-        list = empty_list;
-    }
-    global_dict = PyModule_GetDict(__pyx_m);
-    if (!global_dict)
-        goto bad;
-    empty_dict = PyDict_New();
-    if (!empty_dict)
-        goto bad;
-    {
-        #if PY_MAJOR_VERSION >= 3
-        if (level == -1) {
-            if (strchr(__Pyx_MODULE_NAME, '.')) {
-                #if PY_VERSION_HEX < 0x03030000
-                PyObject *py_level = PyInt_FromLong(1);
-                if (!py_level)
-                    goto bad;
-                module = PyObject_CallFunctionObjArgs(py_import,
-                    name, global_dict, empty_dict, list, py_level, NULL);
-                Py_DECREF(py_level);
-                #else
-                module = PyImport_ImportModuleLevelObject(
-                    name, global_dict, empty_dict, list, 1);
-                #endif
-                if (!module) {
-                    if (!PyErr_ExceptionMatches(PyExc_ImportError))
-                        goto bad;
-                    PyErr_Clear();
-                }
-            }
-            level = 0;
-        }
-        #endif
-        if (!module) {
-            #if PY_VERSION_HEX < 0x03030000
-            PyObject *py_level = PyInt_FromLong(level);
-            if (!py_level)
-                goto bad;
-            module = PyObject_CallFunctionObjArgs(py_import,
-                name, global_dict, empty_dict, list, py_level, NULL);
-            Py_DECREF(py_level);
-            #else
-            module = PyImport_ImportModuleLevelObject(
-                name, global_dict, empty_dict, list, level);
-            #endif
-        }
-    }
-bad:
-    #if PY_VERSION_HEX < 0x03030000
-    Py_XDECREF(py_import);
-    #endif
-    Py_XDECREF(empty_list);
-    Py_XDECREF(empty_dict);
-    return module;
-}
-
-/* ImportFrom */
-      static PyObject* __Pyx_ImportFrom(PyObject* module, PyObject* name) {
-    PyObject* value = __Pyx_PyObject_GetAttrStr(module, name);
-    if (unlikely(!value) && PyErr_ExceptionMatches(PyExc_AttributeError)) {
-        PyErr_Format(PyExc_ImportError,
-        #if PY_MAJOR_VERSION < 3
-            "cannot import name %.230s", PyString_AS_STRING(name));
-        #else
-            "cannot import name %S", name);
-        #endif
-    }
-    return value;
-}
-
-/* GetNameInClass */
-      static PyObject *__Pyx_GetNameInClass(PyObject *nmspace, PyObject *name) {
-    PyObject *result;
-    result = __Pyx_PyObject_GetAttrStr(nmspace, name);
-    if (!result)
-        result = __Pyx_GetModuleGlobalName(name);
-    return result;
-}
-
-/* CLineInTraceback */
-      static int __Pyx_CLineForTraceback(int c_line) {
-#ifdef CYTHON_CLINE_IN_TRACEBACK
-    return ((CYTHON_CLINE_IN_TRACEBACK)) ? c_line : 0;
-#else
-    PyObject *use_cline;
-#if CYTHON_COMPILING_IN_CPYTHON
-    PyObject **cython_runtime_dict = _PyObject_GetDictPtr(__pyx_cython_runtime);
-    if (likely(cython_runtime_dict)) {
-      use_cline = PyDict_GetItem(*cython_runtime_dict, __pyx_n_s_cline_in_traceback);
-    } else
-#endif
-    {
-      PyObject *ptype, *pvalue, *ptraceback;
-      PyObject *use_cline_obj;
-      PyErr_Fetch(&ptype, &pvalue, &ptraceback);
-      use_cline_obj = __Pyx_PyObject_GetAttrStr(__pyx_cython_runtime, __pyx_n_s_cline_in_traceback);
-      if (use_cline_obj) {
-        use_cline = PyObject_Not(use_cline_obj) ? Py_False : Py_True;
-        Py_DECREF(use_cline_obj);
-      } else {
-        use_cline = NULL;
-      }
-      PyErr_Restore(ptype, pvalue, ptraceback);
-    }
-    if (!use_cline) {
-        c_line = 0;
-        PyObject_SetAttr(__pyx_cython_runtime, __pyx_n_s_cline_in_traceback, Py_False);
-    }
-    else if (PyObject_Not(use_cline) != 0) {
-        c_line = 0;
-    }
-    return c_line;
-#endif
-}
-
-/* CodeObjectCache */
-      static int __pyx_bisect_code_objects(__Pyx_CodeObjectCacheEntry* entries, int count, int code_line) {
-    int start = 0, mid = 0, end = count - 1;
-    if (end >= 0 && code_line > entries[end].code_line) {
-        return count;
-    }
-    while (start < end) {
-        mid = start + (end - start) / 2;
-        if (code_line < entries[mid].code_line) {
-            end = mid;
-        } else if (code_line > entries[mid].code_line) {
-             start = mid + 1;
-        } else {
-            return mid;
-        }
-    }
-    if (code_line <= entries[mid].code_line) {
-        return mid;
-    } else {
-        return mid + 1;
-    }
-}
-static PyCodeObject *__pyx_find_code_object(int code_line) {
-    PyCodeObject* code_object;
-    int pos;
-    if (unlikely(!code_line) || unlikely(!__pyx_code_cache.entries)) {
-        return NULL;
-    }
-    pos = __pyx_bisect_code_objects(__pyx_code_cache.entries, __pyx_code_cache.count, code_line);
-    if (unlikely(pos >= __pyx_code_cache.count) || unlikely(__pyx_code_cache.entries[pos].code_line != code_line)) {
-        return NULL;
-    }
-    code_object = __pyx_code_cache.entries[pos].code_object;
-    Py_INCREF(code_object);
-    return code_object;
-}
-static void __pyx_insert_code_object(int code_line, PyCodeObject* code_object) {
-    int pos, i;
-    __Pyx_CodeObjectCacheEntry* entries = __pyx_code_cache.entries;
-    if (unlikely(!code_line)) {
-        return;
-    }
-    if (unlikely(!entries)) {
-        entries = (__Pyx_CodeObjectCacheEntry*)PyMem_Malloc(64*sizeof(__Pyx_CodeObjectCacheEntry));
-        if (likely(entries)) {
-            __pyx_code_cache.entries = entries;
-            __pyx_code_cache.max_count = 64;
-            __pyx_code_cache.count = 1;
-            entries[0].code_line = code_line;
-            entries[0].code_object = code_object;
-            Py_INCREF(code_object);
-        }
-        return;
-    }
-    pos = __pyx_bisect_code_objects(__pyx_code_cache.entries, __pyx_code_cache.count, code_line);
-    if ((pos < __pyx_code_cache.count) && unlikely(__pyx_code_cache.entries[pos].code_line == code_line)) {
-        PyCodeObject* tmp = entries[pos].code_object;
-        entries[pos].code_object = code_object;
-        Py_DECREF(tmp);
-        return;
-    }
-    if (__pyx_code_cache.count == __pyx_code_cache.max_count) {
-        int new_max = __pyx_code_cache.max_count + 64;
-        entries = (__Pyx_CodeObjectCacheEntry*)PyMem_Realloc(
-            __pyx_code_cache.entries, (size_t)new_max*sizeof(__Pyx_CodeObjectCacheEntry));
-        if (unlikely(!entries)) {
-            return;
-        }
-        __pyx_code_cache.entries = entries;
-        __pyx_code_cache.max_count = new_max;
-    }
-    for (i=__pyx_code_cache.count; i>pos; i--) {
-        entries[i] = entries[i-1];
-    }
-    entries[pos].code_line = code_line;
-    entries[pos].code_object = code_object;
-    __pyx_code_cache.count++;
-    Py_INCREF(code_object);
-}
-
-/* AddTraceback */
-      #include "compile.h"
-#include "frameobject.h"
-#include "traceback.h"
-static PyCodeObject* __Pyx_CreateCodeObjectForTraceback(
-            const char *funcname, int c_line,
-            int py_line, const char *filename) {
-    PyCodeObject *py_code = 0;
-    PyObject *py_srcfile = 0;
-    PyObject *py_funcname = 0;
-    #if PY_MAJOR_VERSION < 3
-    py_srcfile = PyString_FromString(filename);
-    #else
-    py_srcfile = PyUnicode_FromString(filename);
-    #endif
-    if (!py_srcfile) goto bad;
-    if (c_line) {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, c_line);
-        #else
-        py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, c_line);
-        #endif
-    }
-    else {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromString(funcname);
-        #else
-        py_funcname = PyUnicode_FromString(funcname);
-        #endif
-    }
-    if (!py_funcname) goto bad;
-    py_code = __Pyx_PyCode_New(
-        0,
-        0,
-        0,
-        0,
-        0,
-        __pyx_empty_bytes, /*PyObject *code,*/
-        __pyx_empty_tuple, /*PyObject *consts,*/
-        __pyx_empty_tuple, /*PyObject *names,*/
-        __pyx_empty_tuple, /*PyObject *varnames,*/
-        __pyx_empty_tuple, /*PyObject *freevars,*/
-        __pyx_empty_tuple, /*PyObject *cellvars,*/
-        py_srcfile,   /*PyObject *filename,*/
-        py_funcname,  /*PyObject *name,*/
-        py_line,
-        __pyx_empty_bytes  /*PyObject *lnotab*/
-    );
-    Py_DECREF(py_srcfile);
-    Py_DECREF(py_funcname);
-    return py_code;
-bad:
-    Py_XDECREF(py_srcfile);
-    Py_XDECREF(py_funcname);
-    return NULL;
-}
-static void __Pyx_AddTraceback(const char *funcname, int c_line,
-                               int py_line, const char *filename) {
-    PyCodeObject *py_code = 0;
-    PyFrameObject *py_frame = 0;
-    if (c_line) {
-        c_line = __Pyx_CLineForTraceback(c_line);
-    }
-    py_code = __pyx_find_code_object(c_line ? -c_line : py_line);
-    if (!py_code) {
-        py_code = __Pyx_CreateCodeObjectForTraceback(
-            funcname, c_line, py_line, filename);
-        if (!py_code) goto bad;
-        __pyx_insert_code_object(c_line ? -c_line : py_line, py_code);
-    }
-    py_frame = PyFrame_New(
-        PyThreadState_GET(), /*PyThreadState *tstate,*/
-        py_code,             /*PyCodeObject *code,*/
-        __pyx_d,      /*PyObject *globals,*/
-        0                    /*PyObject *locals*/
-    );
-    if (!py_frame) goto bad;
-    __Pyx_PyFrame_SetLineNumber(py_frame, py_line);
-    PyTraceBack_Here(py_frame);
-bad:
-    Py_XDECREF(py_code);
-    Py_XDECREF(py_frame);
-}
-
-/* CIntToPy */
-      static CYTHON_INLINE PyObject* __Pyx_PyInt_From_long(long value) {
-    const long neg_one = (long) -1, const_zero = (long) 0;
-    const int is_unsigned = neg_one > const_zero;
-    if (is_unsigned) {
-        if (sizeof(long) < sizeof(long)) {
-            return PyInt_FromLong((long) value);
-        } else if (sizeof(long) <= sizeof(unsigned long)) {
-            return PyLong_FromUnsignedLong((unsigned long) value);
-#ifdef HAVE_LONG_LONG
-        } else if (sizeof(long) <= sizeof(unsigned PY_LONG_LONG)) {
-            return PyLong_FromUnsignedLongLong((unsigned PY_LONG_LONG) value);
-#endif
-        }
-    } else {
-        if (sizeof(long) <= sizeof(long)) {
-            return PyInt_FromLong((long) value);
-#ifdef HAVE_LONG_LONG
-        } else if (sizeof(long) <= sizeof(PY_LONG_LONG)) {
-            return PyLong_FromLongLong((PY_LONG_LONG) value);
-#endif
-        }
-    }
-    {
-        int one = 1; int little = (int)*(unsigned char *)&one;
-        unsigned char *bytes = (unsigned char *)&value;
-        return _PyLong_FromByteArray(bytes, sizeof(long),
-                                     little, !is_unsigned);
-    }
-}
-
-/* CIntFromPyVerify */
-      #define __PYX_VERIFY_RETURN_INT(target_type, func_type, func_value)\
-    __PYX__VERIFY_RETURN_INT(target_type, func_type, func_value, 0)
-#define __PYX_VERIFY_RETURN_INT_EXC(target_type, func_type, func_value)\
-    __PYX__VERIFY_RETURN_INT(target_type, func_type, func_value, 1)
-#define __PYX__VERIFY_RETURN_INT(target_type, func_type, func_value, exc)\
-    {\
-        func_type value = func_value;\
-        if (sizeof(target_type) < sizeof(func_type)) {\
-            if (unlikely(value != (func_type) (target_type) value)) {\
-                func_type zero = 0;\
-                if (exc && unlikely(value == (func_type)-1 && PyErr_Occurred()))\
-                    return (target_type) -1;\
-                if (is_unsigned && unlikely(value < zero))\
-                    goto raise_neg_overflow;\
-                else\
-                    goto raise_overflow;\
-            }\
-        }\
-        return (target_type) value;\
-    }
-
-/* CIntFromPy */
-      static CYTHON_INLINE long __Pyx_PyInt_As_long(PyObject *x) {
-    const long neg_one = (long) -1, const_zero = (long) 0;
-    const int is_unsigned = neg_one > const_zero;
-#if PY_MAJOR_VERSION < 3
-    if (likely(PyInt_Check(x))) {
-        if (sizeof(long) < sizeof(long)) {
-            __PYX_VERIFY_RETURN_INT(long, long, PyInt_AS_LONG(x))
-        } else {
-            long val = PyInt_AS_LONG(x);
-            if (is_unsigned && unlikely(val < 0)) {
-                goto raise_neg_overflow;
-            }
-            return (long) val;
-        }
-    } else
-#endif
-    if (likely(PyLong_Check(x))) {
-        if (is_unsigned) {
-#if CYTHON_USE_PYLONG_INTERNALS
-            const digit* digits = ((PyLongObject*)x)->ob_digit;
-            switch (Py_SIZE(x)) {
-                case  0: return (long) 0;
-                case  1: __PYX_VERIFY_RETURN_INT(long, digit, digits[0])
-                case 2:
-                    if (8 * sizeof(long) > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) >= 2 * PyLong_SHIFT) {
-                            return (long) (((((long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
-                        }
-                    }
-                    break;
-                case 3:
-                    if (8 * sizeof(long) > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) >= 3 * PyLong_SHIFT) {
-                            return (long) (((((((long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
-                        }
-                    }
-                    break;
-                case 4:
-                    if (8 * sizeof(long) > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) >= 4 * PyLong_SHIFT) {
-                            return (long) (((((((((long)digits[3]) << PyLong_SHIFT) | (long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
-                        }
-                    }
-                    break;
-            }
-#endif
-#if CYTHON_COMPILING_IN_CPYTHON
-            if (unlikely(Py_SIZE(x) < 0)) {
-                goto raise_neg_overflow;
-            }
-#else
-            {
-                int result = PyObject_RichCompareBool(x, Py_False, Py_LT);
-                if (unlikely(result < 0))
-                    return (long) -1;
-                if (unlikely(result == 1))
-                    goto raise_neg_overflow;
-            }
-#endif
-            if (sizeof(long) <= sizeof(unsigned long)) {
-                __PYX_VERIFY_RETURN_INT_EXC(long, unsigned long, PyLong_AsUnsignedLong(x))
-#ifdef HAVE_LONG_LONG
-            } else if (sizeof(long) <= sizeof(unsigned PY_LONG_LONG)) {
-                __PYX_VERIFY_RETURN_INT_EXC(long, unsigned PY_LONG_LONG, PyLong_AsUnsignedLongLong(x))
-#endif
-            }
-        } else {
-#if CYTHON_USE_PYLONG_INTERNALS
-            const digit* digits = ((PyLongObject*)x)->ob_digit;
-            switch (Py_SIZE(x)) {
-                case  0: return (long) 0;
-                case -1: __PYX_VERIFY_RETURN_INT(long, sdigit, (sdigit) (-(sdigit)digits[0]))
-                case  1: __PYX_VERIFY_RETURN_INT(long,  digit, +digits[0])
-                case -2:
-                    if (8 * sizeof(long) - 1 > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, long, -(long) (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 2 * PyLong_SHIFT) {
-                            return (long) (((long)-1)*(((((long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
-                case 2:
-                    if (8 * sizeof(long) > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 2 * PyLong_SHIFT) {
-                            return (long) ((((((long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
-                case -3:
-                    if (8 * sizeof(long) - 1 > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, long, -(long) (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 3 * PyLong_SHIFT) {
-                            return (long) (((long)-1)*(((((((long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
-                case 3:
-                    if (8 * sizeof(long) > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 3 * PyLong_SHIFT) {
-                            return (long) ((((((((long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
-                case -4:
-                    if (8 * sizeof(long) - 1 > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, long, -(long) (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 4 * PyLong_SHIFT) {
-                            return (long) (((long)-1)*(((((((((long)digits[3]) << PyLong_SHIFT) | (long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
-                case 4:
-                    if (8 * sizeof(long) > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 4 * PyLong_SHIFT) {
-                            return (long) ((((((((((long)digits[3]) << PyLong_SHIFT) | (long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
-            }
-#endif
-            if (sizeof(long) <= sizeof(long)) {
-                __PYX_VERIFY_RETURN_INT_EXC(long, long, PyLong_AsLong(x))
-#ifdef HAVE_LONG_LONG
-            } else if (sizeof(long) <= sizeof(PY_LONG_LONG)) {
-                __PYX_VERIFY_RETURN_INT_EXC(long, PY_LONG_LONG, PyLong_AsLongLong(x))
-#endif
-            }
-        }
-        {
-#if CYTHON_COMPILING_IN_PYPY && !defined(_PyLong_AsByteArray)
-            PyErr_SetString(PyExc_RuntimeError,
-                            "_PyLong_AsByteArray() not available in PyPy, cannot convert large numbers");
-#else
-            long val;
-            PyObject *v = __Pyx_PyNumber_IntOrLong(x);
- #if PY_MAJOR_VERSION < 3
-            if (likely(v) && !PyLong_Check(v)) {
-                PyObject *tmp = v;
-                v = PyNumber_Long(tmp);
-                Py_DECREF(tmp);
-            }
- #endif
-            if (likely(v)) {
-                int one = 1; int is_little = (int)*(unsigned char *)&one;
-                unsigned char *bytes = (unsigned char *)&val;
-                int ret = _PyLong_AsByteArray((PyLongObject *)v,
-                                              bytes, sizeof(val),
-                                              is_little, !is_unsigned);
-                Py_DECREF(v);
-                if (likely(!ret))
-                    return val;
-            }
-#endif
-            return (long) -1;
-        }
-    } else {
-        long val;
-        PyObject *tmp = __Pyx_PyNumber_IntOrLong(x);
-        if (!tmp) return (long) -1;
-        val = __Pyx_PyInt_As_long(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-raise_overflow:
-    PyErr_SetString(PyExc_OverflowError,
-        "value too large to convert to long");
-    return (long) -1;
-raise_neg_overflow:
-    PyErr_SetString(PyExc_OverflowError,
-        "can't convert negative value to long");
-    return (long) -1;
-}
-
-/* CIntFromPy */
-      static CYTHON_INLINE int __Pyx_PyInt_As_int(PyObject *x) {
-    const int neg_one = (int) -1, const_zero = (int) 0;
-    const int is_unsigned = neg_one > const_zero;
-#if PY_MAJOR_VERSION < 3
-    if (likely(PyInt_Check(x))) {
-        if (sizeof(int) < sizeof(long)) {
-            __PYX_VERIFY_RETURN_INT(int, long, PyInt_AS_LONG(x))
-        } else {
-            long val = PyInt_AS_LONG(x);
-            if (is_unsigned && unlikely(val < 0)) {
-                goto raise_neg_overflow;
-            }
-            return (int) val;
-        }
-    } else
-#endif
-    if (likely(PyLong_Check(x))) {
-        if (is_unsigned) {
-#if CYTHON_USE_PYLONG_INTERNALS
-            const digit* digits = ((PyLongObject*)x)->ob_digit;
-            switch (Py_SIZE(x)) {
-                case  0: return (int) 0;
-                case  1: __PYX_VERIFY_RETURN_INT(int, digit, digits[0])
-                case 2:
-                    if (8 * sizeof(int) > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) >= 2 * PyLong_SHIFT) {
-                            return (int) (((((int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
-                        }
-                    }
-                    break;
-                case 3:
-                    if (8 * sizeof(int) > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) >= 3 * PyLong_SHIFT) {
-                            return (int) (((((((int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
-                        }
-                    }
-                    break;
-                case 4:
-                    if (8 * sizeof(int) > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) >= 4 * PyLong_SHIFT) {
-                            return (int) (((((((((int)digits[3]) << PyLong_SHIFT) | (int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
-                        }
-                    }
-                    break;
-            }
-#endif
-#if CYTHON_COMPILING_IN_CPYTHON
-            if (unlikely(Py_SIZE(x) < 0)) {
-                goto raise_neg_overflow;
-            }
-#else
-            {
-                int result = PyObject_RichCompareBool(x, Py_False, Py_LT);
-                if (unlikely(result < 0))
-                    return (int) -1;
-                if (unlikely(result == 1))
-                    goto raise_neg_overflow;
-            }
-#endif
-            if (sizeof(int) <= sizeof(unsigned long)) {
-                __PYX_VERIFY_RETURN_INT_EXC(int, unsigned long, PyLong_AsUnsignedLong(x))
-#ifdef HAVE_LONG_LONG
-            } else if (sizeof(int) <= sizeof(unsigned PY_LONG_LONG)) {
-                __PYX_VERIFY_RETURN_INT_EXC(int, unsigned PY_LONG_LONG, PyLong_AsUnsignedLongLong(x))
-#endif
-            }
-        } else {
-#if CYTHON_USE_PYLONG_INTERNALS
-            const digit* digits = ((PyLongObject*)x)->ob_digit;
-            switch (Py_SIZE(x)) {
-                case  0: return (int) 0;
-                case -1: __PYX_VERIFY_RETURN_INT(int, sdigit, (sdigit) (-(sdigit)digits[0]))
-                case  1: __PYX_VERIFY_RETURN_INT(int,  digit, +digits[0])
-                case -2:
-                    if (8 * sizeof(int) - 1 > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, long, -(long) (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 2 * PyLong_SHIFT) {
-                            return (int) (((int)-1)*(((((int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-                case 2:
-                    if (8 * sizeof(int) > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 2 * PyLong_SHIFT) {
-                            return (int) ((((((int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-                case -3:
-                    if (8 * sizeof(int) - 1 > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, long, -(long) (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 3 * PyLong_SHIFT) {
-                            return (int) (((int)-1)*(((((((int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-                case 3:
-                    if (8 * sizeof(int) > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 3 * PyLong_SHIFT) {
-                            return (int) ((((((((int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-                case -4:
-                    if (8 * sizeof(int) - 1 > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, long, -(long) (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 4 * PyLong_SHIFT) {
-                            return (int) (((int)-1)*(((((((((int)digits[3]) << PyLong_SHIFT) | (int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-                case 4:
-                    if (8 * sizeof(int) > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 4 * PyLong_SHIFT) {
-                            return (int) ((((((((((int)digits[3]) << PyLong_SHIFT) | (int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-            }
-#endif
-            if (sizeof(int) <= sizeof(long)) {
-                __PYX_VERIFY_RETURN_INT_EXC(int, long, PyLong_AsLong(x))
-#ifdef HAVE_LONG_LONG
-            } else if (sizeof(int) <= sizeof(PY_LONG_LONG)) {
-                __PYX_VERIFY_RETURN_INT_EXC(int, PY_LONG_LONG, PyLong_AsLongLong(x))
-#endif
-            }
-        }
-        {
-#if CYTHON_COMPILING_IN_PYPY && !defined(_PyLong_AsByteArray)
-            PyErr_SetString(PyExc_RuntimeError,
-                            "_PyLong_AsByteArray() not available in PyPy, cannot convert large numbers");
-#else
-            int val;
-            PyObject *v = __Pyx_PyNumber_IntOrLong(x);
- #if PY_MAJOR_VERSION < 3
-            if (likely(v) && !PyLong_Check(v)) {
-                PyObject *tmp = v;
-                v = PyNumber_Long(tmp);
-                Py_DECREF(tmp);
-            }
- #endif
-            if (likely(v)) {
-                int one = 1; int is_little = (int)*(unsigned char *)&one;
-                unsigned char *bytes = (unsigned char *)&val;
-                int ret = _PyLong_AsByteArray((PyLongObject *)v,
-                                              bytes, sizeof(val),
-                                              is_little, !is_unsigned);
-                Py_DECREF(v);
-                if (likely(!ret))
-                    return val;
-            }
-#endif
-            return (int) -1;
-        }
-    } else {
-        int val;
-        PyObject *tmp = __Pyx_PyNumber_IntOrLong(x);
-        if (!tmp) return (int) -1;
-        val = __Pyx_PyInt_As_int(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-raise_overflow:
-    PyErr_SetString(PyExc_OverflowError,
-        "value too large to convert to int");
-    return (int) -1;
-raise_neg_overflow:
-    PyErr_SetString(PyExc_OverflowError,
-        "can't convert negative value to int");
-    return (int) -1;
-}
-
-/* CheckBinaryVersion */
-      static int __Pyx_check_binary_version(void) {
-    char ctversion[4], rtversion[4];
-    PyOS_snprintf(ctversion, 4, "%d.%d", PY_MAJOR_VERSION, PY_MINOR_VERSION);
-    PyOS_snprintf(rtversion, 4, "%s", Py_GetVersion());
-    if (ctversion[0] != rtversion[0] || ctversion[2] != rtversion[2]) {
-        char message[200];
-        PyOS_snprintf(message, sizeof(message),
-                      "compiletime version %s of module '%.100s' "
-                      "does not match runtime version %s",
-                      ctversion, __Pyx_MODULE_NAME, rtversion);
-        return PyErr_WarnEx(NULL, message, 1);
-    }
-    return 0;
-}
-
-/* InitStrings */
-      static int __Pyx_InitStrings(__Pyx_StringTabEntry *t) {
-    while (t->p) {
-        #if PY_MAJOR_VERSION < 3
-        if (t->is_unicode) {
-            *t->p = PyUnicode_DecodeUTF8(t->s, t->n - 1, NULL);
-        } else if (t->intern) {
-            *t->p = PyString_InternFromString(t->s);
-        } else {
-            *t->p = PyString_FromStringAndSize(t->s, t->n - 1);
-        }
-        #else
-        if (t->is_unicode | t->is_str) {
-            if (t->intern) {
-                *t->p = PyUnicode_InternFromString(t->s);
-            } else if (t->encoding) {
-                *t->p = PyUnicode_Decode(t->s, t->n - 1, t->encoding, NULL);
-            } else {
-                *t->p = PyUnicode_FromStringAndSize(t->s, t->n - 1);
-            }
-        } else {
-            *t->p = PyBytes_FromStringAndSize(t->s, t->n - 1);
-        }
-        #endif
-        if (!*t->p)
-            return -1;
-        if (PyObject_Hash(*t->p) == -1)
-            PyErr_Clear();
-        ++t;
-    }
-    return 0;
-}
-
-static CYTHON_INLINE PyObject* __Pyx_PyUnicode_FromString(const char* c_str) {
-    return __Pyx_PyUnicode_FromStringAndSize(c_str, (Py_ssize_t)strlen(c_str));
-}
-static CYTHON_INLINE const char* __Pyx_PyObject_AsString(PyObject* o) {
-    Py_ssize_t ignore;
-    return __Pyx_PyObject_AsStringAndSize(o, &ignore);
-}
-static CYTHON_INLINE const char* __Pyx_PyObject_AsStringAndSize(PyObject* o, Py_ssize_t *length) {
-#if CYTHON_COMPILING_IN_CPYTHON && (__PYX_DEFAULT_STRING_ENCODING_IS_ASCII || __PYX_DEFAULT_STRING_ENCODING_IS_DEFAULT)
-    if (
-#if PY_MAJOR_VERSION < 3 && __PYX_DEFAULT_STRING_ENCODING_IS_ASCII
-            __Pyx_sys_getdefaultencoding_not_ascii &&
-#endif
-            PyUnicode_Check(o)) {
-#if PY_VERSION_HEX < 0x03030000
-        char* defenc_c;
-        PyObject* defenc = _PyUnicode_AsDefaultEncodedString(o, NULL);
-        if (!defenc) return NULL;
-        defenc_c = PyBytes_AS_STRING(defenc);
-#if __PYX_DEFAULT_STRING_ENCODING_IS_ASCII
-        {
-            char* end = defenc_c + PyBytes_GET_SIZE(defenc);
-            char* c;
-            for (c = defenc_c; c < end; c++) {
-                if ((unsigned char) (*c) >= 128) {
-                    PyUnicode_AsASCIIString(o);
-                    return NULL;
-                }
-            }
-        }
-#endif
-        *length = PyBytes_GET_SIZE(defenc);
-        return defenc_c;
-#else
-        if (__Pyx_PyUnicode_READY(o) == -1) return NULL;
-#if __PYX_DEFAULT_STRING_ENCODING_IS_ASCII
-        if (PyUnicode_IS_ASCII(o)) {
-            *length = PyUnicode_GET_LENGTH(o);
-            return PyUnicode_AsUTF8(o);
-        } else {
-            PyUnicode_AsASCIIString(o);
-            return NULL;
-        }
-#else
-        return PyUnicode_AsUTF8AndSize(o, length);
-#endif
-#endif
-    } else
-#endif
-#if (!CYTHON_COMPILING_IN_PYPY) || (defined(PyByteArray_AS_STRING) && defined(PyByteArray_GET_SIZE))
-    if (PyByteArray_Check(o)) {
-        *length = PyByteArray_GET_SIZE(o);
-        return PyByteArray_AS_STRING(o);
-    } else
-#endif
-    {
-        char* result;
-        int r = PyBytes_AsStringAndSize(o, &result, length);
-        if (unlikely(r < 0)) {
-            return NULL;
-        } else {
-            return result;
-        }
-    }
-}
-static CYTHON_INLINE int __Pyx_PyObject_IsTrue(PyObject* x) {
-   int is_true = x == Py_True;
-   if (is_true | (x == Py_False) | (x == Py_None)) return is_true;
-   else return PyObject_IsTrue(x);
-}
-static CYTHON_INLINE PyObject* __Pyx_PyNumber_IntOrLong(PyObject* x) {
-#if CYTHON_USE_TYPE_SLOTS
-  PyNumberMethods *m;
-#endif
-  const char *name = NULL;
-  PyObject *res = NULL;
-#if PY_MAJOR_VERSION < 3
-  if (PyInt_Check(x) || PyLong_Check(x))
-#else
-  if (PyLong_Check(x))
-#endif
-    return __Pyx_NewRef(x);
-#if CYTHON_USE_TYPE_SLOTS
-  m = Py_TYPE(x)->tp_as_number;
-  #if PY_MAJOR_VERSION < 3
-  if (m && m->nb_int) {
-    name = "int";
-    res = PyNumber_Int(x);
-  }
-  else if (m && m->nb_long) {
-    name = "long";
-    res = PyNumber_Long(x);
-  }
-  #else
-  if (m && m->nb_int) {
-    name = "int";
-    res = PyNumber_Long(x);
-  }
-  #endif
-#else
-  res = PyNumber_Int(x);
-#endif
-  if (res) {
-#if PY_MAJOR_VERSION < 3
-    if (!PyInt_Check(res) && !PyLong_Check(res)) {
-#else
-    if (!PyLong_Check(res)) {
-#endif
-      PyErr_Format(PyExc_TypeError,
-                   "__%.4s__ returned non-%.4s (type %.200s)",
-                   name, name, Py_TYPE(res)->tp_name);
-      Py_DECREF(res);
-      return NULL;
-    }
-  }
-  else if (!PyErr_Occurred()) {
-    PyErr_SetString(PyExc_TypeError,
-                    "an integer is required");
-  }
-  return res;
-}
-static CYTHON_INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject* b) {
-  Py_ssize_t ival;
-  PyObject *x;
-#if PY_MAJOR_VERSION < 3
-  if (likely(PyInt_CheckExact(b))) {
-    if (sizeof(Py_ssize_t) >= sizeof(long))
-        return PyInt_AS_LONG(b);
-    else
-        return PyInt_AsSsize_t(x);
-  }
-#endif
-  if (likely(PyLong_CheckExact(b))) {
-    #if CYTHON_USE_PYLONG_INTERNALS
-    const digit* digits = ((PyLongObject*)b)->ob_digit;
-    const Py_ssize_t size = Py_SIZE(b);
-    if (likely(__Pyx_sst_abs(size) <= 1)) {
-        ival = likely(size) ? digits[0] : 0;
-        if (size == -1) ival = -ival;
-        return ival;
-    } else {
-      switch (size) {
-         case 2:
-           if (8 * sizeof(Py_ssize_t) > 2 * PyLong_SHIFT) {
-             return (Py_ssize_t) (((((size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-         case -2:
-           if (8 * sizeof(Py_ssize_t) > 2 * PyLong_SHIFT) {
-             return -(Py_ssize_t) (((((size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-         case 3:
-           if (8 * sizeof(Py_ssize_t) > 3 * PyLong_SHIFT) {
-             return (Py_ssize_t) (((((((size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-         case -3:
-           if (8 * sizeof(Py_ssize_t) > 3 * PyLong_SHIFT) {
-             return -(Py_ssize_t) (((((((size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-         case 4:
-           if (8 * sizeof(Py_ssize_t) > 4 * PyLong_SHIFT) {
-             return (Py_ssize_t) (((((((((size_t)digits[3]) << PyLong_SHIFT) | (size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-         case -4:
-           if (8 * sizeof(Py_ssize_t) > 4 * PyLong_SHIFT) {
-             return -(Py_ssize_t) (((((((((size_t)digits[3]) << PyLong_SHIFT) | (size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-      }
-    }
-    #endif
-    return PyLong_AsSsize_t(b);
-  }
-  x = PyNumber_Index(b);
-  if (!x) return -1;
-  ival = PyInt_AsSsize_t(x);
-  Py_DECREF(x);
-  return ival;
-}
-static CYTHON_INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t ival) {
-    return PyInt_FromSize_t(ival);
-}
-
-
-#endif /* Py_PYTHON_H */
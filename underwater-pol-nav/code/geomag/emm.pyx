@@ -2,10 +2,12 @@
 cdef extern from "EGM9615.h":
     float *GeoidHeightBuffer
 
-cdef extern from "GeomagnetismHeader.h":
+cdef extern from "GeomagnetismHeader.h" nogil:
     #types    
     ctypedef struct MAGtype_MagneticModel:
-        pass
+        double epoch
+        int nMax
+        int nMaxSecVar
 
     ctypedef struct MAGtype_Ellipsoid:
         pass
@@ -75,10 +77,25 @@ cdef extern from "GeomagnetismHeader.h":
     bint MAG_CalculateSecularVariationElements(MAGtype_MagneticResults MagneticVariation, MAGtype_GeoMagneticElements *MagneticElements)
     void MAG_AssignMagneticModelCoeffs(MAGtype_MagneticModel *ass, MAGtype_MagneticModel *src, int nMax, int nMaxSecVar)
     MAGtype_MagneticModel *MAG_AllocateModelMemory(int numTerms)
+    MAGtype_LegendreFunction *MAG_AllocateLegendreFunctionMemory(int NumTerms)
+    MAGtype_SphericalHarmonicVariables *MAG_AllocateSphVarMemory(int nMax)
+    int MAG_FreeMagneticModelMemory(MAGtype_MagneticModel *MagneticModel)
+    int MAG_FreeLegendreMemory(MAGtype_LegendreFunction *LegendreFunction)
+    int MAG_FreeSphVarMemory(MAGtype_SphericalHarmonicVariables *SphVar)
+    int MAG_TimelyModifyMagneticModel(MAGtype_Date UserDate, MAGtype_MagneticModel *MagneticModel, MAGtype_MagneticModel *TimedMagneticModel)
+    int MAG_ComputeSphericalHarmonicVariables(MAGtype_Ellipsoid Ellip, MAGtype_CoordSpherical CoordSpherical, int nMax, MAGtype_SphericalHarmonicVariables *SphVariables)
+    int MAG_AssociatedLegendreFunction(MAGtype_CoordSpherical CoordSpherical, int nMax, MAGtype_LegendreFunction *LegendreFunction)
+    int MAG_Summation(MAGtype_LegendreFunction *LegendreFunction, MAGtype_MagneticModel *MagneticModel, MAGtype_SphericalHarmonicVariables SphVariables, MAGtype_CoordSpherical CoordSpherical, MAGtype_MagneticResults *MagneticResults)
+    int MAG_SecVarSummation(MAGtype_LegendreFunction *LegendreFunction, MAGtype_MagneticModel *MagneticModel, MAGtype_SphericalHarmonicVariables SphVariables, MAGtype_CoordSpherical CoordSpherical, MAGtype_MagneticResults *MagneticResults)
+    int MAG_RotateMagneticVector(MAGtype_CoordSpherical CoordSpherical, MAGtype_CoordGeodetic CoordGeodetic, MAGtype_MagneticResults MagneticResultsSph, MAGtype_MagneticResults *MagneticResultsGeo)
+    int MAG_CalculateGridVariation(MAGtype_CoordGeodetic location, MAGtype_GeoMagneticElements *elements)
 
-cdef extern from "MeshHeader.h":
+cdef extern from "MeshHeader.h" nogil:
     #types
     ctypedef struct EMM_tmesh:
+        int nalt
+        double *latres
+    ctypedef struct EMM_tsnapshot_cache:
         pass
     #error codes
     cdef enum:
@@ -94,9 +111,25 @@ cdef extern from "MeshHeader.h":
         EXIT_MESH_FILE_NLAT_ERROR      = 22 # Number of rows at this altitude is out of range
         EXIT_MESH_FILE_ALT_ERROR       = 23 # Altitude out of range
         EXIT_MESH_FILE_NLON_ERROR      = 24 # Number cells at this latitude and altitude is out of range
+        EXIT_MESH_GEOMETRY_ERROR       = 25 # Main field and secular variation meshes do not share a grid geometry
+        EXIT_MESH_FILE_LAT_ERROR       = 26 # Latitude out of range
+        EXIT_MESH_SHM_ERROR            = 27 # Shared memory mesh could not be created, opened or mapped
+        EXIT_MESH_SHM_UNSUPPORTED      = 28 # Shared memory meshes need POSIX shared memory
+        EXIT_MESH_QUANTIZED_ERROR      = 29 # Operation needs the full precision cells of a quantized mesh
     #functions
     int EMM_mesh_read(int verbose, char *meshfname, EMM_tmesh *mesh)
     int EMM_PointCalcFromMesh(MAGtype_CoordGeodetic CordGeo, MAGtype_CoordSpherical CordSph, MAGtype_Date UserDate, MAGtype_MagneticResults *MagResults, EMM_tmesh mesh, EMM_tmesh mesh_SV)
+    int EMM_PointCalcFromSnapshot(MAGtype_CoordGeodetic CordGeo, MAGtype_CoordSpherical CordSph, MAGtype_MagneticResults *MagResults, EMM_tmesh snapshot)
+    int EMM_mesh_precompute(int verbose, EMM_tmesh *mesh)
+    void EMM_mesh_free(EMM_tmesh *mesh)
+    int EMM_mesh_quantize(int verbose, EMM_tmesh *mesh, double maxerr[12])
+    int EMM_mesh_publish(int verbose, EMM_tmesh mesh, const char *name)
+    int EMM_mesh_attach(int verbose, const char *name, EMM_tmesh *mesh)
+    int EMM_mesh_unpublish(int verbose, const char *name)
+    void EMM_snapshot_cache_init(EMM_tsnapshot_cache *cache)
+    EMM_tmesh *EMM_snapshot_cache_find(EMM_tsnapshot_cache *cache, double year)
+    int EMM_snapshot_cache_get(int verbose, EMM_tsnapshot_cache *cache, EMM_tmesh mesh, EMM_tmesh mesh_SV, double year, EMM_tmesh **snapshot)
+    void EMM_snapshot_cache_free(EMM_tsnapshot_cache *cache)
 
 cdef class GeoMagneticElements:
     """GeoMagneticElements encapsulates the geomagnetic field paramters at a location.
@@ -133,15 +166,78 @@ cdef class GeoMagneticElements:
         self.Zdot = elements.Zdot
         self.GVdot = elements.GVdot
 
-from libc.math cimport cos, sin, sqrt, atan2, asin
-from time import gmtime
-from os import path
+from libc.math cimport cos, sin, sqrt, atan2, asin, fmod, floor, ceil, isfinite, NAN
+from libc.string cimport memset
+from libc.stdlib cimport calloc, free
+cimport cython
+from cython.parallel cimport prange
+from sunpos.csunpos cimport ticks_posix, datetime64_ticks
+from calendar import timegm
+from os import path, cpu_count, makedirs, replace, stat, getpid
+from hashlib import sha1
+import numpy as np
+
+#fields of the structured arrays returned by compute_field_array, in the order of MAGtype_GeoMagneticElements
+ELEMENTS = ('Decl','Incl','F','H','X','Y','Z','GV','Decldot','Incldot','Fdot','Hdot','Xdot','Ydot','Zdot','GVdot')
+elements_dtype = np.dtype([(e, np.float64) for e in ELEMENTS])
 
-cdef double d2r(double d):
+cdef double d2r(double d) noexcept nogil:
     return d*0.017453292519943295
-cdef double r2d(double r):
+cdef double r2d(double r) noexcept nogil:
     return r*57.29577951308232
 
+cdef void norm_lat_lon_c(double *lat, double *lon) noexcept nogil:
+    """Wrap out of bounds lat, lon into the valid range, as EMMBase.norm_lat_lon"""
+    cdef double x, y, z, r
+    if lat[0] < -90 or lat[0] > 90:
+        #convert to cartesian and back
+        x = cos(d2r(lon[0]))*cos(d2r(lat[0]))
+        y = sin(d2r(lon[0]))*cos(d2r(lat[0]))
+        z = sin(d2r(lat[0]))
+        r = sqrt(x*x + y*y + z*z)
+        lon[0] = r2d(atan2(y,x))
+        lat[0] = r2d(asin(z/r))
+    elif not (lon[0] < 0 or lon[0] > 360):
+        return
+    lon[0] = fmod(lon[0], 360)
+    if lon[0] < 0:
+        lon[0] += 360
+
+cdef long long jan1_days(long long y) noexcept nogil:
+    #days from 1970-01-01 to January 1 of year y, proleptic Gregorian calendar
+    y -= 1
+    return 365*(y - 1969) + y//4 - y//100 + y//400 - 477
+
+cdef double decimal_year_c(double t) noexcept nogil:
+    """POSIX timestamp (UTC seconds) to decimal year, with leap years"""
+    cdef long long y, days, start, end
+    if not isfinite(t):
+        return t
+    days = <long long>floor(t/86400)
+    y = 1970 + <long long>floor(days/365.2425)
+    while jan1_days(y + 1) <= days:
+        y += 1
+    while jan1_days(y) > days:
+        y -= 1
+    start = jan1_days(y)
+    end = jan1_days(y + 1)
+    return y + (t - start*86400.0)/((end - start)*86400.0)
+
+@cython.boundscheck(False)
+@cython.wraparound(False)
+cdef void decimal_year_array_c(const double[::1] t, double[::1] out) noexcept nogil:
+    cdef Py_ssize_t i
+    for i in range(t.shape[0]):
+        out[i] = decimal_year_c(t[i])
+
+@cython.boundscheck(False)
+@cython.wraparound(False)
+cdef void decimal_year_ticks_c(const long long[::1] ticks, long long per_day, double[::1] out) noexcept nogil:
+    #datetime64 values, converted as by sunpos.julian_day
+    cdef Py_ssize_t i
+    for i in range(ticks.shape[0]):
+        out[i] = decimal_year_c(ticks_posix(ticks[i], per_day))
+
 cdef class EMMBase:
     cdef MAGtype_Geoid _geoid
     cdef MAGtype_Ellipsoid _ellip
@@ -152,6 +248,8 @@ cdef class EMMBase:
             raise RuntimeError('Error setting default ellipsoid and geoid parameters.')
         self._geoid.GeoidHeightBuffer = GeoidHeightBuffer
         self._geoid.Geoid_Initialized = 1
+        #only consulted for geodetic heights, and never changed afterwards, so threads can share it
+        self._geoid.UseGeoid = 1
 
     cdef tuple norm_lat_lon(self, lat, lon):
         """Wrap out of bounds lat, lon into the valid range"""
@@ -178,14 +276,99 @@ cdef class EMMBase:
 
     def decimal_year(self, t):
         """decimal_year(t)
-        convert a time.struct_time, datetime.date, datetime.datetime, or UTC timestamp into a decimal year"""
+        convert a time.struct_time, datetime.date, datetime.datetime, numpy.datetime64, or UTC timestamp into a decimal year.
+        The fraction is the time since January 1 over the length of the year, 365 or 366 days."""
+        if isinstance(t, np.datetime64):
+            return float(self.decimal_year_array(t))
         if hasattr(t,'timetuple'): #date/datetime to struct_time:
-            tt = t.timetuple()
+            return decimal_year_c(timegm(t.timetuple()) + getattr(t,'microsecond',0)*1e-6)
         elif hasattr(t,'tm_year') and hasattr(t,'tm_yday'): #already a struct_time
-            tt = t
-        else: #seconds to struct_time
-            tt = gmtime(t)
-        return tt.tm_year + (tt.tm_yday-1)/365 #leap years?
+            return decimal_year_c(timegm(t))
+        else: #seconds
+            return decimal_year_c(t)
+
+    def decimal_year_array(self, t):
+        """decimal_year_array(t)
+        Vectorized decimal_year, for an array_like of UTC timestamps (seconds) or numpy.datetime64.
+        Object arrays (of datetime, struct_time...) go through decimal_year one element at a time.
+        NaN and NaT give NaN. Returns a float64 array of the shape of t."""
+        t = np.asarray(t)
+        if t.dtype.kind == 'O':
+            return np.vectorize(self.decimal_year, otypes=[np.float64])(t)
+        shape = t.shape
+        out = np.empty(t.size)
+        if t.dtype.kind == 'M':
+            ticks, per_day = datetime64_ticks(t)
+            decimal_year_ticks_c(np.ascontiguousarray(ticks).ravel(), per_day, out)
+        else:
+            decimal_year_array_c(np.ascontiguousarray(t, dtype=np.float64).ravel(), out)
+        return out.reshape(shape)
+
+    def _years(self, year, timestamps):
+        #dates of the array APIs as decimal years
+        year = np.asarray(year)
+        if timestamps or year.dtype.kind in 'MO':
+            return self.decimal_year_array(year)
+        return year.astype(np.float64, copy=False)
+
+    def declination(self, lat, lon, height, year, geodetic = True):
+        """declination(lat, lon, height, year, geodetic = True)
+        Angle (deg) between the magnetic field vector and true north, positive east."""
+        return self.compute_field(lat,lon,height,year,geodetic).Decl
+
+    def _linear_segments(self, year):
+        """_linear_segments(year)
+        Index of the time interval over which the model is linear, for each of the years (array).
+        Non-finite years get an arbitrary valid index."""
+        return np.zeros(year.shape, dtype=np.intp)
+
+    def _cache_key(self):
+        """_cache_key()
+        String identifying the model data, for caches of computed results on disk; None if it cannot be identified"""
+        return None
+
+    @staticmethod
+    def _file_keys(fnames):
+        #absolute path, size and modification time of each file, or None if one is missing
+        try:
+            return '|'.join('%s:%d:%d' % (path.abspath(f), stat(f).st_size, stat(f).st_mtime_ns) for f in fnames)
+        except OSError:
+            return None
+
+    def declination_series(self, lat, lon, height, year, geodetic = True, timestamps = False):
+        """declination_series(lat, lon, height, year, geodetic = True, timestamps = False)
+        Declination (deg) at one site for an array of dates, in the shape of year.
+            Parameters:
+                lat, lon, height, geodetic - as compute_field, scalars
+                year - dates, in decimal years, array_like
+                timestamps - as compute_field_array
+        The field and its secular variation are computed once per epoch of the model spanned by year,
+        and X, Y are extrapolated linearly to each date. The model is linear in time within an epoch, so
+        the result is the same as declination() for every date, up to rounding.
+        Declination itself is not linear in time, and is recomputed from the extrapolated X, Y.
+        NaN dates (and NaT) give NaN, as in compute_field_array.
+        """
+        year = self._years(year, timestamps)
+        res = np.full(year.shape, np.nan)
+        ok = np.isfinite(year)
+        seg = self._linear_segments(year)
+        for s in np.unique(seg[ok]):
+            idx = ok & (seg == s)
+            ref = year[idx].min()
+            e = self.compute_field(lat,lon,height,ref,geodetic,compute_change=True)
+            dt = year[idx] - ref
+            res[idx] = np.rad2deg(np.arctan2(e.Y + e.Ydot*dt, e.X + e.Xdot*dt))
+        return res
+
+    def true_to_magnetic(self, head, lat, lon, height, year, geodetic = True):
+        """true_to_magnetic(head, lat, lon, height, year, geodetic = True)
+        Convert a heading (deg) from true north to magnetic north (subtract declination)"""
+        return head - self.declination(lat,lon,height,year,geodetic)
+
+    def magnetic_to_true(self,head,lat,lon,height,year,geodetic=True):
+        """magnetic_to_true(head, lat, lon, height, year, geodetic = True)
+        Convert a heading (deg) from magnetic north to true north (add declination)"""
+        return head + self.declination(lat,lon,height,year,geodetic)
 
     @staticmethod
     cdef _EMM_check(int err):
@@ -210,24 +393,320 @@ cdef class EMMBase:
             raise RuntimeError('File error: altitude out of range.')
         elif err == EXIT_MESH_FILE_NLON_ERROR:
             raise RuntimeError('File error: number of longitude cells at latitude and altitude out of range.')
+        elif err == EXIT_MESH_GEOMETRY_ERROR:
+            raise RuntimeError('Main field and secular variation meshes do not share a grid geometry.')
+        elif err == EXIT_MESH_FILE_LAT_ERROR:
+            raise RuntimeError('Latitude out of range.')
+        elif err == EXIT_MESH_SHM_ERROR:
+            raise RuntimeError('Shared memory mesh could not be created, opened or mapped.')
+        elif err == EXIT_MESH_SHM_UNSUPPORTED:
+            raise RuntimeError('Shared memory meshes need POSIX shared memory.')
+        elif err == EXIT_MESH_QUANTIZED_ERROR:
+            raise RuntimeError('Operation needs the full precision mesh, but the mesh is quantized.')
+
+ctypedef struct sph_workspace:
+    #memory of one thread of EMMSph, as BATCH_workspace in emm_sph_file.c
+    MAGtype_MagneticModel *MagneticModel #the full model with the main field of LoadedEpoch
+    MAGtype_MagneticModel *TimedMagneticModel
+    MAGtype_LegendreFunction *LegendreFunction
+    MAGtype_SphericalHarmonicVariables *SphVariables
+    int LoadedEpoch
+    double TimedYear #NaN if TimedMagneticModel is not up to date
+
+cdef bint sph_workspace_init(sph_workspace *ws, MAGtype_MagneticModel *model) noexcept nogil:
+    cdef int NumTerms = (model.nMax + 1) * (model.nMax + 2) // 2
+    ws.MagneticModel = MAG_AllocateModelMemory(NumTerms)
+    ws.TimedMagneticModel = MAG_AllocateModelMemory(NumTerms)
+    ws.LegendreFunction = MAG_AllocateLegendreFunctionMemory(NumTerms)
+    ws.SphVariables = MAG_AllocateSphVarMemory(model.nMax)
+    if ws.MagneticModel == NULL or ws.TimedMagneticModel == NULL or ws.LegendreFunction == NULL or ws.SphVariables == NULL:
+        return 0
+    ws.MagneticModel.epoch = model.epoch
+    ws.MagneticModel.nMax = model.nMax
+    ws.MagneticModel.nMaxSecVar = model.nMaxSecVar
+    MAG_AssignMagneticModelCoeffs(ws.MagneticModel, model, model.nMax, model.nMaxSecVar)
+    ws.LoadedEpoch = -1
+    ws.TimedYear = NAN
+    return 1
 
-##cdef class EMMSph(EMMBase):
-##    """EMMSph(cof_dir, first_year, last_year)
-##        cof_dir: path to directory containing coefficient files
-##        first_year, last_year: inclusive year range for loading coefficient files
-##
-##    This class wraps NOAA's Enhanced Magnetic Model (EMM) spherical harmonic routines
-##    These routines have a lower memory footprint than EMMMesh, but will use more CPU time.
-##    """
+cdef void sph_workspace_free(sph_workspace *ws) noexcept nogil:
+    if ws.MagneticModel != NULL:
+        MAG_FreeMagneticModelMemory(ws.MagneticModel)
+    if ws.TimedMagneticModel != NULL:
+        MAG_FreeMagneticModelMemory(ws.TimedMagneticModel)
+    if ws.LegendreFunction != NULL:
+        MAG_FreeLegendreMemory(ws.LegendreFunction)
+    if ws.SphVariables != NULL:
+        MAG_FreeSphVarMemory(ws.SphVariables)
+    ws.MagneticModel = NULL
+    ws.TimedMagneticModel = NULL
+    ws.LegendreFunction = NULL
+    ws.SphVariables = NULL
+
+cdef class EMMSph(EMMBase):
+    """EMMSph(str cof_dir='.', int first_year=2000, int last_year=2015, bool delay_load=False)
+        cof_dir: path to directory containing coefficient files EMM<year>.COF and EMM<year>SV.COF
+        first_year, last_year: inclusive year range for loading coefficient files
+        delay_load: if True, coefficients will not be loaded until load() or a function requiring them is called
+
+    This class wraps NOAA's Enhanced Magnetic Model (EMM) spherical harmonic routines
+    These routines have a lower memory footprint than EMMMesh, but will use more CPU time.
+    As in emm_sph_file, the main field of each year's file is combined with the crustal field
+    (the higher degrees) of last_year. Dates before first_year use the first year's main field,
+    dates after last_year the last one, which is valid for five years.
+    """
+    cdef MAGtype_MagneticModel **_models #the files of each year, the last one truncated to the degree of the first
+    cdef MAGtype_MagneticModel *_full #the file of last_year
+    cdef int _nepochs
+    cdef str _cof_dir
+    cdef int _first_year
+    cdef bint _loaded
+    cdef sph_workspace _ws #for compute_field; compute_field_array has its own
+
+    def __cinit__(self, str cof_dir = '.', int first_year = 2000, int last_year = 2015, bint delay_load = False):
+        if last_year < first_year:
+            raise ValueError('last_year is before first_year.')
+        self._cof_dir = cof_dir
+        self._first_year = first_year
+        self._nepochs = last_year - first_year + 1
+        self._loaded = 0
+        self._models = <MAGtype_MagneticModel **>calloc(self._nepochs, sizeof(MAGtype_MagneticModel *))
+        if self._models == NULL:
+            raise MemoryError()
+        if not delay_load:
+            self._load_c()
+
+    def __dealloc__(self):
+        cdef int i
+        sph_workspace_free(&self._ws)
+        if self._models != NULL:
+            for i in range(self._nepochs - 1):
+                if self._models[i] != NULL:
+                    MAG_FreeMagneticModelMemory(self._models[i])
+            if self._models[self._nepochs - 1] != NULL and self._models[self._nepochs - 1] != self._full:
+                MAG_FreeMagneticModelMemory(self._models[self._nepochs - 1])
+            free(self._models)
+        if self._full != NULL:
+            MAG_FreeMagneticModelMemory(self._full)
+
+    cdef MAGtype_MagneticModel *_read_c(self, int year) except NULL:
+        cdef MAGtype_MagneticModel *model = NULL
+        fname = path.join(self._cof_dir, 'EMM%d.COF' % year)
+        svfname = path.join(self._cof_dir, 'EMM%dSV.COF' % year)
+        if not MAG_robustReadMagneticModel_Large(bytes(fname, 'UTF-8'), bytes(svfname, 'UTF-8'), &model) or model == NULL:
+            raise RuntimeError('Coefficient file %s or %s not found.' % (fname, svfname))
+        return model
+
+    cdef void _load_c(self):
+        cdef MAGtype_MagneticModel *first
+        cdef int i, last = self._nepochs - 1, NumTerms
+        if self._loaded:
+            return
+        if self._full == NULL:
+            self._full = self._read_c(self._first_year + last)
+        for i in range(last):
+            if self._models[i] == NULL:
+                self._models[i] = self._read_c(self._first_year + i)
+        if last == 0:
+            self._models[0] = self._full
+        elif self._models[last] == NULL:
+            first = self._models[0]
+            NumTerms = (first.nMax + 1) * (first.nMax + 2) // 2
+            self._models[last] = MAG_AllocateModelMemory(NumTerms)
+            if self._models[last] == NULL:
+                raise MemoryError()
+            self._models[last].nMax = first.nMax
+            self._models[last].nMaxSecVar = first.nMaxSecVar
+            self._models[last].epoch = self._full.epoch
+            MAG_AssignMagneticModelCoeffs(self._models[last], self._full, first.nMax, first.nMaxSecVar)
+        if not sph_workspace_init(&self._ws, self._full):
+            sph_workspace_free(&self._ws)
+            raise MemoryError()
+        self._loaded = 1
+
+    cdef MAGtype_GeoMagneticElements compute_field_c(self, sph_workspace *ws, double lat, double lon, double height, double year, bint geodetic = True, bint compute_change = False) noexcept nogil:
+        #the coefficients must be loaded (_load_c) before calling this. Threads need workspaces of their own
+        #local variables
+        cdef MAGtype_Date date
+        cdef MAGtype_CoordGeodetic pos
+        cdef MAGtype_CoordSpherical cs
+        cdef MAGtype_MagneticResults resultsSph, resultsGeo, variationSph, variationGeo
+        cdef MAGtype_GeoMagneticElements elements
+        cdef int epoch, nMax
+
+        memset(&elements, 0, sizeof(elements))
+        date.DecimalYear = year
+
+        #main field of the epoch, and the time adjusted model, kept while the year does not change
+        epoch = <int>(<int>year - self._models[0].epoch)
+        if epoch < 0:
+            epoch = 0
+        if epoch > self._nepochs - 1:
+            epoch = self._nepochs - 1
+        if ws.LoadedEpoch != epoch:
+            ws.MagneticModel.epoch = self._models[epoch].epoch
+            MAG_AssignMagneticModelCoeffs(ws.MagneticModel, self._models[epoch], self._models[epoch].nMax, self._models[epoch].nMaxSecVar)
+            ws.LoadedEpoch = epoch
+            ws.TimedYear = NAN
+        if ws.TimedYear != year:
+            MAG_TimelyModifyMagneticModel(date, ws.MagneticModel, ws.TimedMagneticModel)
+            ws.TimedYear = year
+
+        #convert coordinates
+        pos.lat = lat
+        pos.lon = lon
+        if geodetic:
+            pos.HeightAboveGeoid = height
+            pos.UseGeoid = 1
+            MAG_ConvertGeoidToEllipsoidHeight(&pos, &self._geoid)
+        else:
+            pos.UseGeoid = 0
+            pos.HeightAboveGeoid = height
+            pos.HeightAboveEllipsoid = height
+
+        MAG_GeodeticToSpherical(self._ellip, pos, &cs)
+
+        #MAG_Geomag, with the Legendre functions of the workspace
+        nMax = ws.TimedMagneticModel.nMax
+        MAG_ComputeSphericalHarmonicVariables(self._ellip, cs, nMax, ws.SphVariables)
+        MAG_AssociatedLegendreFunction(cs, nMax, ws.LegendreFunction)
+        MAG_Summation(ws.LegendreFunction, ws.TimedMagneticModel, ws.SphVariables[0], cs, &resultsSph)
+        MAG_RotateMagneticVector(cs, pos, resultsSph, &resultsGeo)
+        MAG_CalculateGeoMagneticElements(&resultsGeo, &elements)
+        if compute_change:
+            MAG_SecVarSummation(ws.LegendreFunction, ws.TimedMagneticModel, ws.SphVariables[0], cs, &variationSph)
+            MAG_RotateMagneticVector(cs, pos, variationSph, &variationGeo)
+            MAG_CalculateSecularVariationElements(variationGeo, &elements)
+        MAG_CalculateGridVariation(pos, &elements)
+        return elements
+
+    cdef void _compute_range_c(self, sph_workspace *ws, const double *lat, const double *lon, const double *height, const double *year, MAGtype_GeoMagneticElements *out,
+            Py_ssize_t start, Py_ssize_t stop, bint geodetic, bint compute_change) noexcept nogil:
+        #compute_field_c for points start to stop - 1, after wrapping lat, lon into range
+        cdef Py_ssize_t i
+        cdef double plat, plon
+        for i in range(start, stop):
+            plat = lat[i]
+            plon = lon[i]
+            norm_lat_lon_c(&plat, &plon)
+            out[i] = self.compute_field_c(ws, plat, plon, height[i], year[i], geodetic, compute_change)
+
+    def load(self):
+        """load()
+            Load the coefficient files, if delay_load=True was specified in the constructor.
+            No return value.
+        """
+        self._load_c()
+
+    def is_loaded(self):
+        """is_loaded()
+        Return True if the coefficient files have been loaded
+        """
+        return self._loaded
+
+    def _cache_key(self):
+        fnames = []
+        for y in range(self._first_year, self._first_year + self._nepochs):
+            fnames += [path.join(self._cof_dir, 'EMM%d.COF' % y), path.join(self._cof_dir, 'EMM%dSV.COF' % y)]
+        files = EMMBase._file_keys(fnames)
+        return None if files is None else 'EMMSph|' + files
+
+    def _linear_segments(self, year):
+        #each year file is an epoch, selected as in compute_field_c; clipped before the cast, which NaN and
+        #huge years would leave undefined
+        self._load_c()
+        epoch = np.nan_to_num(np.trunc(year), nan=self._models[0].epoch) - self._models[0].epoch
+        return np.clip(epoch, 0, self._nepochs - 1).astype(np.intp)
+
+    def compute_field(self, lat, lon, height, year, geodetic = True, compute_change = False):
+        """compute_field(lat, lon, height, year, geodetic = True, compute_change = False)
+            Parameters:
+                lat - latitude, in degrees
+                lon - longitude, in degrees
+                height - height above EGM96 mean sea level, or WGS-84 ellipsoid if geodetic = False
+                year - date, in decimal years
+                geodetic - if true, use EGM96 mean sea level as reference for height, otherwise use WGS-84 ellipsoid
+                compute_change - if true, compute secular variation of magnetic field (rate of chage per year)
+            Returns a GeoMagneticElements object with the results.
+        """
+        lat,lon = self.norm_lat_lon(lat,lon)
+        self._load_c()
+        elements = GeoMagneticElements()
+        elements._setup(self.compute_field_c(&self._ws,lat,lon,height,year,geodetic,compute_change))
+        return elements
+
+    def compute_field_array(self, lat, lon, height, year, geodetic = True, compute_change = False, num_threads = None, timestamps = False):
+        """compute_field_array(lat, lon, height, year, geodetic = True, compute_change = False, num_threads = None, timestamps = False)
+            Vectorized compute_field. The points are evaluated without the GIL, split between OpenMP threads.
+            Every thread allocates two models and the Legendre functions, about 20 MB at degree 720.
+            Parameters:
+                lat, lon, height, year - as compute_field, array_like, broadcast against each other
+                geodetic, compute_change - as compute_field
+                timestamps - if true, year holds UTC timestamps (seconds), converted with decimal_year_array.
+                    Arrays of numpy.datetime64 or datetime objects are converted without it.
+                num_threads - number of threads, by default the number of cores.
+                    The module runs on one thread if it was built without OpenMP.
+            Returns a structured array (dtype elements_dtype) of the broadcast shape, with fields
+            Decl, Incl, F, H, X, Y, Z, GV, Decldot, ..., GVdot. Without compute_change the *dot fields are 0.
+        """
+        cdef const double[::1] la, lo, he, ye
+        cdef MAGtype_GeoMagneticElements[::1] out
+        cdef sph_workspace *workspaces
+        cdef Py_ssize_t c, n, chunk
+        cdef bint geo = geodetic, change = compute_change
+        cdef int nthreads = 0, nchunks
+        if num_threads is not None:
+            nthreads = num_threads
+            if nthreads < 1:
+                raise ValueError('num_threads must be positive.')
+        b = np.broadcast_arrays(*[np.asarray(a, dtype=np.float64) for a in (lat, lon, height, self._years(year, timestamps))])
+        shape = b[0].shape
+        la, lo, he, ye = [np.ascontiguousarray(a).ravel() for a in b]
+        n = la.shape[0]
+        result = np.zeros(n, dtype=elements_dtype)
+        if n == 0:
+            return result.reshape(shape)
+        out = result
+        self._load_c()
+        #one contiguous range of points per workspace, so the time adjusted models are reused along the range
+        nchunks = min(nthreads or cpu_count() or 1, n)
+        chunk = (n + nchunks - 1) // nchunks
+        workspaces = <sph_workspace *>calloc(nchunks, sizeof(sph_workspace))
+        if workspaces == NULL:
+            raise MemoryError()
+        try:
+            for c in range(nchunks):
+                if not sph_workspace_init(&workspaces[c], self._full):
+                    raise MemoryError()
+            if nthreads:
+                for c in prange(nchunks, nogil=True, schedule='static', chunksize=1, num_threads=nthreads):
+                    self._compute_range_c(&workspaces[c], &la[0], &lo[0], &he[0], &ye[0], &out[0], c*chunk, min((c+1)*chunk, n), geo, change)
+            else:
+                for c in prange(nchunks, nogil=True, schedule='static', chunksize=1):
+                    self._compute_range_c(&workspaces[c], &la[0], &lo[0], &he[0], &ye[0], &out[0], c*chunk, min((c+1)*chunk, n), geo, change)
+        finally:
+            for c in range(nchunks):
+                sph_workspace_free(&workspaces[c])
+            free(workspaces)
+        return result.reshape(shape)
 
 
 cdef class EMMMesh(EMMBase):
-    """EMMMesh(str mesh_fname, str svmesh_fname, bool delay_load=False)
+    """EMMMesh(str mesh_fname, str svmesh_fname, bool delay_load=False, bool precompute=False, bool quantize=False)
         mesh_fname: filename of EMM static mesh
         secmesh_fname: filename of EMM secular variation mesh
         delay_load: if True, meshes will not be loaded until load() or a function requiring them is called
+        precompute: if True, store the cell interpolation polynomials at load time. Queries get faster,
+            at the cost of about three times the mesh memory.
+        quantize: if True, keep the meshes as 16-bit values with a scale and offset per row, about a quarter
+            of the memory (half the file size). See quantization_error() for the error bounds.
+            Cannot be combined with precompute, snapshot() or publish().
     This class wraps NOAA's Enhanced Magnetic Model (EMM) Mesh routines.
     These routines use less CPU time than EMMSph, but have a larger memory footprint.
+    The meshes are freed by close(), or at the end of a with block. Instances can be pickled, e.g. to
+    pass them to multiprocessing workers: only the file names are stored, and the copy loads the files
+    when it is first used. After publish(name), or for an instance from attach(name), the copy attaches
+    to the shared memory meshes instead, which costs no reading and no memory for the cells.
     """
     cdef EMM_tmesh _mesh
     cdef EMM_tmesh _mesh_sv
@@ -235,23 +714,70 @@ cdef class EMMMesh(EMMBase):
     cdef bytes _smfname
     cdef bint _mloaded
     cdef bint _smloaded
+    cdef str _shm_name #name of shared memory meshes holding the same data, None if not published or attached
+    cdef bint _attached #the meshes are loaded with EMM_mesh_attach(_shm_name) instead of from the files
+    cdef EMM_tsnapshot_cache _snapshots
+    cdef bint _precompute
+    cdef bint _quantize
+    cdef double _qerr[12]
+    cdef double _sqerr[12]
 
-    def __cinit__(self, str mesh_fname, str secmesh_fname, bint delay_load = False):
+    def __cinit__(self, str mesh_fname, str secmesh_fname, bint delay_load = False, bint precompute = False, bint quantize = False):
+        if precompute and quantize:
+            raise ValueError('precompute and quantize cannot be combined.')
         self._mfname = bytes(mesh_fname,'UTF-8')
         self._smfname = bytes(secmesh_fname,'UTF-8')
         self._mloaded = 0
         self._smloaded = 0
+        self._shm_name = None
+        self._attached = 0
+        self._precompute = precompute
+        self._quantize = quantize
+        EMM_snapshot_cache_init(&self._snapshots)
         if not delay_load:
             self._load_c()
 
-    cdef MAGtype_GeoMagneticElements _compute_field_c(self, MAGtype_CoordGeodetic pos, MAGtype_CoordSpherical cs, MAGtype_Date date, bint compute_change = False):
+    def __dealloc__(self):
+        EMM_snapshot_cache_free(&self._snapshots)
+        EMM_mesh_free(&self._mesh)
+        EMM_mesh_free(&self._mesh_sv)
+
+    def __reduce__(self):
+        if self._shm_name is not None:
+            return (EMMMesh.attach, (self._shm_name, self._precompute))
+        return (EMMMesh, (self._mfname.decode('UTF-8'), self._smfname.decode('UTF-8'), True, self._precompute, self._quantize))
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+        return False
+
+    def close(self):
+        """close()
+            Free the meshes and snapshots. A later query loads (or attaches) the meshes again, as with delay_load.
+            No return value.
+        """
+        EMM_snapshot_cache_free(&self._snapshots)
+        EMM_mesh_free(&self._mesh)
+        EMM_mesh_free(&self._mesh_sv)
+        self._mloaded = 0
+        self._smloaded = 0
+
+    cdef MAGtype_GeoMagneticElements _compute_field_c(self, MAGtype_CoordGeodetic pos, MAGtype_CoordSpherical cs, MAGtype_Date date, bint compute_change = False) noexcept nogil:
+        #the meshes must be loaded (_load_c) before calling this
         #local variables:
         cdef MAGtype_MagneticResults magResults, magVariation
         cdef MAGtype_GeoMagneticElements elements
-        #load meshes if necessary:
-        self._load_c()
-        #compute magnetic results
-        EMM_PointCalcFromMesh(pos, cs, date, &magResults, self._mesh, self._mesh_sv)
+        cdef EMM_tmesh *snapshot
+        memset(&elements, 0, sizeof(elements))
+        #compute magnetic results, from a single timed mesh if one was materialized for this year
+        snapshot = EMM_snapshot_cache_find(&self._snapshots, date.DecimalYear)
+        if snapshot != NULL and not compute_change:
+            EMM_PointCalcFromSnapshot(pos, cs, &magResults, snapshot[0])
+        else:
+            EMM_PointCalcFromMesh(pos, cs, date, &magResults, self._mesh, self._mesh_sv)
         #convert to geo-magnetic elements
         MAG_CalculateGeoMagneticElements(&magResults, &elements)
         #compute secular variation
@@ -264,7 +790,8 @@ cdef class EMMMesh(EMMBase):
             MAG_CalculateSecularVariationElements(magVariation, &elements)
         return elements
 
-    cdef MAGtype_GeoMagneticElements compute_field_c(self, double lat, double lon, double height, double year, bint geodetic = True, bint compute_change = False):
+    cdef MAGtype_GeoMagneticElements compute_field_c(self, double lat, double lon, double height, double year, bint geodetic = True, bint compute_change = False) noexcept nogil:
+        #the meshes must be loaded (_load_c) before calling this. Safe to call from several threads at once
         #local variables
         cdef MAGtype_Date date
         cdef MAGtype_CoordGeodetic pos
@@ -279,11 +806,9 @@ cdef class EMMMesh(EMMBase):
         if geodetic:
             pos.HeightAboveGeoid = height
             pos.UseGeoid = 1
-            self._geoid.UseGeoid = 1
             MAG_ConvertGeoidToEllipsoidHeight(&pos, &self._geoid)
         else:
             pos.UseGeoid = 0
-            self._geoid.UseGeoid = 0
             pos.HeightAboveGeoid = height
             pos.HeightAboveEllipsoid = height
 
@@ -291,12 +816,33 @@ cdef class EMMMesh(EMMBase):
 
         return self._compute_field_c(pos, cs, date, compute_change)
 
+    cdef MAGtype_GeoMagneticElements _compute_field_norm_c(self, double lat, double lon, double height, double year, bint geodetic, bint compute_change) noexcept nogil:
+        #compute_field_c after wrapping lat, lon into range
+        norm_lat_lon_c(&lat, &lon)
+        return self.compute_field_c(lat, lon, height, year, geodetic, compute_change)
+
     cdef void _load_c(self):
+        if self._attached and not (self._mloaded and self._smloaded):
+            mname, smname = EMMMesh._shm_names(self._shm_name)
         if not self._mloaded:
-            EMMMesh._EMM_check(EMM_mesh_read(0, self._mfname, &self._mesh))
+            if self._attached:
+                EMMMesh._EMM_check(EMM_mesh_attach(0, mname, &self._mesh))
+            else:
+                EMMMesh._EMM_check(EMM_mesh_read(0, self._mfname, &self._mesh))
+            if self._precompute:
+                EMMMesh._EMM_check(EMM_mesh_precompute(0, &self._mesh))
+            if self._quantize:
+                EMMMesh._EMM_check(EMM_mesh_quantize(0, &self._mesh, self._qerr))
             self._mloaded = 1
         if not self._smloaded:
-            EMMMesh._EMM_check(EMM_mesh_read(0, self._smfname, &self._mesh_sv))
+            if self._attached:
+                EMMMesh._EMM_check(EMM_mesh_attach(0, smname, &self._mesh_sv))
+            else:
+                EMMMesh._EMM_check(EMM_mesh_read(0, self._smfname, &self._mesh_sv))
+            if self._precompute:
+                EMMMesh._EMM_check(EMM_mesh_precompute(0, &self._mesh_sv))
+            if self._quantize:
+                EMMMesh._EMM_check(EMM_mesh_quantize(0, &self._mesh_sv, self._sqerr))
             self._smloaded = 1
 
     def load(self,mesh=None,secmesh=None):
@@ -308,11 +854,113 @@ cdef class EMMMesh(EMMBase):
         """
         if mesh is not None: 
             self._mfname = bytes(mesh,'UTF-8')
+            EMM_mesh_free(&self._mesh)
             self._mloaded = False
         if secmesh is not None:
             self._smfname = bytes(secmesh, 'UTF-8')
+            EMM_mesh_free(&self._mesh_sv)
             self._smloaded = False
+        if mesh is not None or secmesh is not None:
+            EMM_snapshot_cache_free(&self._snapshots)
+            #the files replace the shared memory meshes
+            if self._attached:
+                self.close()
+            self._shm_name = None
+            self._attached = 0
+        self._load_c()
+
+    def snapshot(self, year):
+        """snapshot(year)
+            Materialize the field at a decimal year as a single timed mesh. Later queries for exactly
+            this year (without compute_change) interpolate one mesh instead of the static and secular
+            variation meshes. The most recent snapshots are kept; each costs as much memory as the static mesh.
+            Parameters:
+                year - date, in decimal years
+            No return value.
+        """
+        cdef EMM_tmesh *snapshot
+        self._load_c()
+        EMMMesh._EMM_check(EMM_snapshot_cache_get(0, &self._snapshots, self._mesh, self._mesh_sv, year, &snapshot))
+        if self._precompute:
+            EMMMesh._EMM_check(EMM_mesh_precompute(0, snapshot))
+
+    @staticmethod
+    def _shm_names(str name):
+        """POSIX shared memory object names of the static and secular variation meshes published under name"""
+        name = name.lstrip('/')
+        return bytes('/%s_static' % name, 'UTF-8'), bytes('/%s_secvar' % name, 'UTF-8')
+
+    def publish(self, name):
+        """publish(name)
+            Copy both meshes into POSIX shared memory, so that other processes can use them through
+            EMMMesh.attach(name) instead of loading their own copies. Publishing again under the same name
+            replaces the meshes; processes already attached keep the previous ones. The shared memory
+            remains after this process exits, until EMMMesh.unpublish(name) is called.
+            Parameters:
+                name - short name without slashes, e.g. 'emm'
+            No return value.
+        """
+        mname, smname = EMMMesh._shm_names(name)
+        self._load_c()
+        EMMMesh._EMM_check(EMM_mesh_publish(0, self._mesh, mname))
+        EMMMesh._EMM_check(EMM_mesh_publish(0, self._mesh_sv, smname))
+        self._shm_name = name
+
+    @staticmethod
+    def unpublish(name):
+        """unpublish(name)
+            Remove meshes published under name. Processes still attached keep their mapping, but pickles
+            of instances published or attached under name can no longer be loaded.
+            No return value.
+        """
+        mname, smname = EMMMesh._shm_names(name)
+        EMMMesh._EMM_check(EMM_mesh_unpublish(0, mname))
+        EMMMesh._EMM_check(EMM_mesh_unpublish(0, smname))
+
+    @staticmethod
+    def attach(name, precompute = False):
+        """attach(name, precompute=False)
+            Return an EMMMesh using meshes published by another process with publish(name). The mesh data
+            is mapped read-only and shared; only small per-row tables are allocated by this process.
+            precompute still stores the cell polynomials in this process's memory.
+        """
+        cdef EMMMesh m
+        m = EMMMesh.__new__(EMMMesh, '', '', True, precompute)
+        m._shm_name = name
+        m._attached = 1
+        m._load_c()
+        return m
+
+    def quantization_error(self):
+        """quantization_error()
+        Largest difference between the quantized meshes and the mesh files, or None if quantize=False.
+        Returns (static, secvar), each a tuple of 12 values: for x, y and z in turn the value (nT) and its
+        derivatives with respect to longitude, latitude (nT/deg) and altitude (nT/km).
+        """
+        if not self._quantize:
+            return None
         self._load_c()
+        return tuple(self._qerr), tuple(self._sqerr)
+
+    def lat_resolution(self):
+        """lat_resolution()
+        Finest latitude spacing of the static mesh layers, in degrees. Rasters of the model (DeclinationRaster)
+        gain little from a finer grid.
+        """
+        cdef int i
+        cdef double res
+        self._load_c()
+        res = self._mesh.latres[0]
+        for i in range(1, self._mesh.nalt):
+            res = min(res, self._mesh.latres[i])
+        return res
+
+    def _cache_key(self):
+        #the contents of shared memory meshes are not tied to a file
+        if self._attached:
+            return None
+        files = EMMBase._file_keys((self._mfname.decode('UTF-8'), self._smfname.decode('UTF-8')))
+        return None if files is None else 'EMMMesh|%s|quantize=%d' % (files, self._quantize)
 
     def is_loaded(self):
         """is_loaded()
@@ -332,22 +980,240 @@ cdef class EMMMesh(EMMBase):
             Returns a GeoMagneticElements object with the results.
         """
         lat,lon = self.norm_lat_lon(lat,lon)
+        self._load_c()
         elements = GeoMagneticElements()
         elements._setup(self.compute_field_c(lat,lon,height,year,geodetic,compute_change))
         return elements
 
-    def declination(self, lat, lon, height, year, geodetic = True):
-        """declination(lat, lon, height, year, geodetic = True)
-        Angle (deg) between the magnetic field vector and true north, positive east."""
-        return self.compute_field(lat,lon,height,year,geodetic).Decl
+    @cython.boundscheck(False)
+    @cython.wraparound(False)
+    def compute_field_array(self, lat, lon, height, year, geodetic = True, compute_change = False, num_threads = None, timestamps = False):
+        """compute_field_array(lat, lon, height, year, geodetic = True, compute_change = False, num_threads = None, timestamps = False)
+            Vectorized compute_field. The points are evaluated without the GIL, split between OpenMP threads.
+            Parameters:
+                lat, lon, height, year - as compute_field, array_like, broadcast against each other
+                geodetic, compute_change - as compute_field
+                timestamps - if true, year holds UTC timestamps (seconds), converted with decimal_year_array.
+                    Arrays of numpy.datetime64 or datetime objects are converted without it.
+                num_threads - number of threads, by default as set by OMP_NUM_THREADS or the number of cores.
+                    The module runs on one thread if it was built without OpenMP.
+            Returns a structured array (dtype elements_dtype) of the broadcast shape, with fields
+            Decl, Incl, F, H, X, Y, Z, GV, Decldot, ..., GVdot. GV and, without compute_change, the *dot fields are 0.
+        """
+        cdef const double[::1] la, lo, he, ye
+        cdef MAGtype_GeoMagneticElements[::1] out
+        cdef Py_ssize_t i, n
+        cdef bint geo = geodetic, change = compute_change
+        cdef int nthreads = 0
+        if num_threads is not None:
+            nthreads = num_threads
+            if nthreads < 1:
+                raise ValueError('num_threads must be positive.')
+        b = np.broadcast_arrays(*[np.asarray(a, dtype=np.float64) for a in (lat, lon, height, self._years(year, timestamps))])
+        shape = b[0].shape
+        la, lo, he, ye = [np.ascontiguousarray(a).ravel() for a in b]
+        n = la.shape[0]
+        result = np.zeros(n, dtype=elements_dtype)
+        out = result
+        self._load_c()
+        if nthreads:
+            for i in prange(n, nogil=True, schedule='static', num_threads=nthreads):
+                out[i] = self._compute_field_norm_c(la[i], lo[i], he[i], ye[i], geo, change)
+        else:
+            for i in prange(n, nogil=True, schedule='static'):
+                out[i] = self._compute_field_norm_c(la[i], lo[i], he[i], ye[i], geo, change)
+        return result.reshape(shape)
 
-    def true_to_magnetic(self, head, lat, lon, height, year, geodetic = True):
-        """true_to_magnetic(head, lat, lon, height, year, geodetic = True)
-        Convert a heading (deg) from true north to magnetic north (subtract declination)"""
-        return head - self.declination(lat,lon,height,year,geodetic)
+cdef class DeclinationRaster:
+    """DeclinationRaster(EMMBase gm, double year, lat_range=(-90,90), lon_range=(0,360), double resolution=0.5,
+            double height=0, bool geodetic=True, bool cubic=True, cache_dir=None, num_threads=None)
+        gm: EMMMesh or EMMSph model
+        year: date of the raster, in decimal years
+        lat_range, lon_range: area of the raster, in degrees. A longitude range may cross 0 (e.g. (350, 10));
+            one of 360 degrees or more is global and wraps around.
+        resolution: grid spacing (deg), rounded down so the grid ends on the range
+        height, geodetic: as compute_field, for every point of the raster
+        cubic: if True, interpolate with Catmull-Rom splines over 4x4 points, otherwise bilinearly over 2x2
+        cache_dir: if given, the grid is saved there, and loaded instead of computed when a raster of the same
+            model files (path, size and modification time), date, area, resolution and height is requested again
+        num_threads: threads for computing the grid, as compute_field_array
 
-    def magnetic_to_true(self,head,lat,lon,height,year,geodetic=True):
-        """magnetic_to_true(head, lat, lon, height, year, geodetic = True)
-        Convert a heading (deg) from magnetic north to true north (add declination)"""
-        return head + self.declination(lat,lon,height,year,geodetic)
-    
\ No newline at end of file
+    Declination at many points for a single date, e.g. for a position search. The X and Y components of
+    the field are computed on a grid once, with compute_field_array, and interpolated at each query;
+    declination is taken from the interpolated components, so it does not wrap around at +-180 deg.
+    Use interpolation_error() to compare against the model at random points.
+    """
+    cdef EMMBase _gm
+    cdef readonly double year, height
+    cdef readonly bint geodetic, cubic
+    cdef readonly object cache_file #path of the cached grid, None if not cached
+    cdef bint _periodic #longitude wraps around; the last column repeats the first
+    cdef double _lat0, _lon0, _lat_span, _lon_span, _dlat, _dlon
+    cdef Py_ssize_t _nlat, _nlon
+    cdef object _x, _y
+    cdef const double[:, ::1] _xv
+    cdef const double[:, ::1] _yv
+
+    def __cinit__(self, EMMBase gm not None, double year, lat_range = (-90, 90), lon_range = (0, 360), double resolution = 0.5,
+            double height = 0, bint geodetic = True, bint cubic = True, cache_dir = None, num_threads = None):
+        if not resolution > 0:
+            raise ValueError('resolution must be positive.')
+        self._gm = gm
+        self.year = year
+        self.height = height
+        self.geodetic = geodetic
+        self.cubic = cubic
+        self.cache_file = None
+        self._lat0 = max(min(lat_range), -90)
+        self._lat_span = min(max(lat_range), 90) - self._lat0
+        if not self._lat_span > 0:
+            raise ValueError('Empty latitude range.')
+        self._lon0 = lon_range[0]
+        self._lon_span = lon_range[1] - lon_range[0]
+        if self._lon_span <= 0:
+            self._lon_span += 360
+        self._periodic = self._lon_span >= 360
+        if self._periodic:
+            self._lon_span = 360
+        self._lon0 = fmod(self._lon0, 360)
+        if self._lon0 < 0:
+            self._lon0 += 360
+        self._nlat = max(<Py_ssize_t>ceil(self._lat_span/resolution - 1e-9), 1) + 1
+        self._nlon = max(<Py_ssize_t>ceil(self._lon_span/resolution - 1e-9), 1) + 1
+        self._dlat = self._lat_span/(self._nlat - 1)
+        self._dlon = self._lon_span/(self._nlon - 1)
+
+        key = gm._cache_key()
+        if key is not None and cache_dir is not None:
+            key = '%s|year=%r|lat=%r,%r|lon=%r,%r|n=%d,%d|height=%r|geodetic=%d' % (key, year, self._lat0, self._lat_span,
+                self._lon0, self._lon_span, self._nlat, self._nlon, height, geodetic)
+            self.cache_file = path.join(cache_dir, 'decl_%s.npz' % sha1(key.encode('UTF-8')).hexdigest()[:20])
+            if not self._read_cache(key):
+                self._compute(num_threads)
+                makedirs(cache_dir, exist_ok = True)
+                tmp = '%s.%d.tmp' % (self.cache_file, getpid())
+                with open(tmp, 'wb') as f:
+                    np.savez(f, key = key, x = self._x, y = self._y)
+                replace(tmp, self.cache_file)
+        else:
+            self._compute(num_threads)
+        self._xv = self._x
+        self._yv = self._y
+
+    def _compute(self, num_threads):
+        lon, lat = np.meshgrid(self._lon0 + self._dlon*np.arange(self._nlon), self._lat0 + self._dlat*np.arange(self._nlat))
+        res = self._gm.compute_field_array(lat, lon, self.height, self.year, self.geodetic, num_threads = num_threads)
+        self._x = np.ascontiguousarray(res['X'])
+        self._y = np.ascontiguousarray(res['Y'])
+
+    def _read_cache(self, key):
+        #True if the cache file holds the grid for key
+        try:
+            with np.load(self.cache_file) as f:
+                if str(f['key']) != key or f['x'].shape != (self._nlat, self._nlon) or f['y'].shape != (self._nlat, self._nlon):
+                    return False
+                self._x = np.ascontiguousarray(f['x'], dtype = np.float64)
+                self._y = np.ascontiguousarray(f['y'], dtype = np.float64)
+                return True
+        except (OSError, KeyError, ValueError):
+            return False
+
+    @property
+    def shape(self):
+        """(rows, columns) of the grid"""
+        return (self._nlat, self._nlon)
+
+    cdef inline Py_ssize_t _col(self, Py_ssize_t j) noexcept nogil:
+        #column index, wrapped around the globe or clamped to the grid
+        if self._periodic:
+            return j % (self._nlon - 1)
+        return 0 if j < 0 else (self._nlon - 1 if j >= self._nlon else j)
+
+    cdef inline Py_ssize_t _row(self, Py_ssize_t i) noexcept nogil:
+        return 0 if i < 0 else (self._nlat - 1 if i >= self._nlat else i)
+
+    @cython.boundscheck(False)
+    @cython.wraparound(False)
+    cdef double declination_c(self, double lat, double lon) noexcept nogil:
+        """Interpolated declination (deg), NaN outside the raster"""
+        cdef double u, v, tx, ty, x, y, w
+        cdef double wx[4]
+        cdef double wy[4]
+        cdef Py_ssize_t i, j, k, l, r, c
+        norm_lat_lon_c(&lat, &lon)
+        v = lat - self._lat0
+        u = fmod(lon - self._lon0, 360)
+        if u < 0:
+            u += 360
+        if v < 0 or v > self._lat_span or u > self._lon_span:
+            return NAN
+        v /= self._dlat
+        u /= self._dlon
+        i = <Py_ssize_t>v
+        j = <Py_ssize_t>u
+        if i > self._nlat - 2:
+            i = self._nlat - 2
+        if j > self._nlon - 2:
+            j = self._nlon - 2
+        ty = v - i
+        tx = u - j
+        x = 0
+        y = 0
+        if self.cubic:
+            #Catmull-Rom weights of points -1, 0, 1, 2
+            wx[0] = ((2 - tx)*tx - 1)*tx/2
+            wx[1] = ((3*tx - 5)*tx*tx + 2)/2
+            wx[2] = ((4 - 3*tx)*tx + 1)*tx/2
+            wx[3] = (tx - 1)*tx*tx/2
+            wy[0] = ((2 - ty)*ty - 1)*ty/2
+            wy[1] = ((3*ty - 5)*ty*ty + 2)/2
+            wy[2] = ((4 - 3*ty)*ty + 1)*ty/2
+            wy[3] = (ty - 1)*ty*ty/2
+            for k in range(4):
+                r = self._row(i + k - 1)
+                for l in range(4):
+                    c = self._col(j + l - 1)
+                    w = wy[k]*wx[l]
+                    x += w*self._xv[r, c]
+                    y += w*self._yv[r, c]
+        else:
+            x = (1 - ty)*((1 - tx)*self._xv[i, j] + tx*self._xv[i, j + 1]) + ty*((1 - tx)*self._xv[i + 1, j] + tx*self._xv[i + 1, j + 1])
+            y = (1 - ty)*((1 - tx)*self._yv[i, j] + tx*self._yv[i, j + 1]) + ty*((1 - tx)*self._yv[i + 1, j] + tx*self._yv[i + 1, j + 1])
+        return r2d(atan2(y, x))
+
+    @cython.boundscheck(False)
+    @cython.wraparound(False)
+    def declination(self, lat, lon):
+        """declination(lat, lon)
+            Declination (deg) at the date of the raster, interpolated from the grid.
+            Parameters:
+                lat, lon - position in degrees, array_like, broadcast against each other
+            Returns a float, or an array of the broadcast shape. Points outside the raster give NaN.
+        """
+        cdef const double[::1] la, lo
+        cdef double[::1] out
+        cdef Py_ssize_t i, n
+        b = np.broadcast_arrays(np.asarray(lat, dtype=np.float64), np.asarray(lon, dtype=np.float64))
+        shape = b[0].shape
+        la, lo = [np.ascontiguousarray(a).ravel() for a in b]
+        n = la.shape[0]
+        result = np.empty(n)
+        out = result
+        with nogil:
+            for i in range(n):
+                out[i] = self.declination_c(la[i], lo[i])
+        return result.reshape(shape)[()]
+
+    def interpolation_error(self, int npoints = 10000, seed = 0):
+        """interpolation_error(npoints=10000, seed=0)
+            Compare the raster with declination computed by the model at npoints random points of its area.
+            Returns (max, rms) of the absolute difference, in degrees. The largest errors are found within a
+            fraction of a degree of the geographic poles, and close to the magnetic poles, where the horizontal
+            field vanishes and declination changes quickly.
+        """
+        rng = np.random.default_rng(seed)
+        lat = self._lat0 + self._lat_span*rng.random(npoints)
+        lon = self._lon0 + self._lon_span*rng.random(npoints)
+        direct = self._gm.compute_field_array(lat, lon, self.height, self.year, self.geodetic)['Decl']
+        err = np.abs((self.declination(lat, lon) - direct + 180) % 360 - 180)
+        return float(err.max()), float(np.sqrt(np.mean(err**2)))
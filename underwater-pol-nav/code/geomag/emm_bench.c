@@ -0,0 +1,482 @@
+
+/*Enhanced Magnetic Model (EMM) benchmark program. The program writes a
+synthetic coefficient file pair of the given degree and evaluates a
+synthetic mesh, so that it runs without the model files, then times
+
+    MAG_robustReadMagneticModel_Large   model load time
+    MAG_Geomag                          per point latency, and throughput
+                                        against the number of threads
+    MAG_Grid                            grid throughput
+    EMM_mesh_generate, EMM_mesh_read    mesh generation and load time
+    EMM_PointCalcFromMesh               per point latency and throughput
+                                        against the number of threads
+    EMM_Grid                            grid throughput
+
+and the resident memory after each stage. The results are printed as JSON,
+to be kept and compared across commits.
+
+Usage:
+    emm_bench [-n nmax] [-s nmaxsv] [-p points] [-m mesh_nmax] [-l nlat]
+              [-r repeats] [-t max_threads] [-label text] [-o results.json]
+
+nmax (default 120) and nmaxsv (16) are the degrees of the synthetic model,
+points (20000) the number of random points per timing, mesh_nmax (12) and
+nlat (90) the degree of the model the mesh is generated from and its rows
+in latitude. Each timing is repeated (3 times) and the best is reported.
+Threads are counted up in powers of two to max_threads (all by default):
+
+gcc -O2 -fopenmp emm_bench.c Mesh_SubLibrary.c GeomagnetismLibrary.c -lm -o emm_bench
+
+ */
+/****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+#include <math.h>               /* for gcc */
+#include "GeomagnetismHeader.h"
+#include "MeshHeader.h"
+#include "EGM9615.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define BENCH_PATH 256
+#define BENCH_MAXTHREADS 1024
+
+typedef struct {
+    int nMax, nMaxSV, npoints, meshnMax, nlat, repeats, maxthreads;
+    char *label;
+    double *lat, *lon, *alt, *year; /* random points */
+} BENCH_config;
+
+static FILE *json;
+static int json_first = 1;
+
+static double bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static double bench_random(unsigned long *state)
+/* Uniform in [0,1), the same sequence on every platform */
+{
+    *state = *state * 6364136223846793005UL + 1442695040888963407UL;
+    return (double) ((*state >> 11) & ((1UL << 53) - 1)) / 9007199254740992.0;
+}
+
+static long bench_rss_kb(void)
+/* Resident memory in kB, from /proc where available, otherwise the peak from getrusage */
+{
+    FILE *status;
+    char line[256];
+    long kb = -1;
+    struct rusage usage;
+
+    status = fopen("/proc/self/status", "r");
+    if(status != NULL)
+    {
+        while(fgets(line, sizeof (line), status) != NULL)
+            if(sscanf(line, "VmRSS: %ld", &kb) == 1)
+                break;
+        fclose(status);
+    }
+    if(kb < 0 && getrusage(RUSAGE_SELF, &usage) == 0)
+        kb = usage.ru_maxrss;
+    return kb;
+}
+
+static void bench_result(const char *name, const char *metric, double value, int threads)
+/* One entry of the results array */
+{
+    fprintf(json, "%s\n    {\"name\": \"%s\", \"metric\": \"%s\", \"value\": %.6g", json_first ? "" : ",", name, metric, value);
+    if(threads > 0)
+        fprintf(json, ", \"threads\": %d", threads);
+    fprintf(json, "}");
+    json_first = 0;
+}
+
+static int bench_write_model(const char *fname, const char *fnameSV, int nMax, int nMaxSV)
+/* Coefficient files in the EMM format, a header line in the static file only, then n m g h from n = 1:
+   power spectrum falling off with degree, pseudo-random signs */
+{
+    FILE *cof, *sv;
+    unsigned long state = 4711;
+    double amp;
+    int n, m;
+
+    cof = fopen(fname, "w");
+    sv = fopen(fnameSV, "w");
+    if(cof == NULL || sv == NULL)
+    {
+        if(cof != NULL) fclose(cof);
+        if(sv != NULL) fclose(sv);
+        return FALSE;
+    }
+    fprintf(cof, "    2015.0            SYNTH\n");
+    for(n = 1; n <= nMax; n++)
+        for(m = 0; m <= n; m++)
+        {
+            amp = 30000.0 * pow(n, -2.5);
+            fprintf(cof, "%3d %3d %14.6f %14.6f\n", n, m, amp * (2 * bench_random(&state) - 1),
+                    (m == 0) ? 0.0 : amp * (2 * bench_random(&state) - 1));
+            if(n <= nMaxSV)
+                fprintf(sv, "%3d %3d %14.6f %14.6f\n", n, m, 0.01 * amp * (2 * bench_random(&state) - 1),
+                    (m == 0) ? 0.0 : 0.01 * amp * (2 * bench_random(&state) - 1));
+        }
+    fprintf(cof, "9999999999999999999999999999999999999999999999999999\n");
+    fprintf(sv, "9999999999999999999999999999999999999999999999999999\n");
+    fclose(sv);
+    return fclose(cof) == 0;
+}
+
+static void bench_point(BENCH_config *cfg, MAGtype_Ellipsoid Ellip, int i, MAGtype_CoordGeodetic *CoordGeodetic,
+        MAGtype_CoordSpherical *CoordSpherical, MAGtype_Date *UserDate)
+{
+    CoordGeodetic->phi = cfg->lat[i];
+    CoordGeodetic->lambda = cfg->lon[i];
+    CoordGeodetic->HeightAboveEllipsoid = CoordGeodetic->HeightAboveGeoid = cfg->alt[i];
+    CoordGeodetic->UseGeoid = 0;
+    UserDate->DecimalYear = cfg->year[i];
+    MAG_GeodeticToSpherical(Ellip, *CoordGeodetic, CoordSpherical);
+}
+
+static double bench_geomag(BENCH_config *cfg, MAGtype_Ellipsoid Ellip, MAGtype_MagneticModel *TimedMagneticModel, int threads)
+/* Best time of MAG_Geomag over all points */
+{
+    MAGtype_CoordGeodetic CoordGeodetic;
+    MAGtype_CoordSpherical CoordSpherical;
+    MAGtype_Date UserDate;
+    MAGtype_GeoMagneticElements GeoMagneticElements;
+    double best = HUGE_VAL, t;
+    int rep, i;
+
+    (void) threads; /* only read by the OpenMP pragma */
+    for(rep = 0; rep < cfg->repeats; rep++)
+    {
+        t = bench_now();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16) num_threads(threads) private(CoordGeodetic, CoordSpherical, UserDate, GeoMagneticElements)
+#endif
+        for(i = 0; i < cfg->npoints; i++)
+        {
+            bench_point(cfg, Ellip, i, &CoordGeodetic, &CoordSpherical, &UserDate);
+            MAG_Geomag(Ellip, CoordSpherical, CoordGeodetic, TimedMagneticModel, &GeoMagneticElements);
+        }
+        t = bench_now() - t;
+        if(t < best)
+            best = t;
+    }
+    return best;
+}
+
+static double bench_mesh(BENCH_config *cfg, MAGtype_Ellipsoid Ellip, EMM_tmesh mesh, EMM_tmesh mesh_SV, int threads)
+/* Best time of EMM_PointCalcFromMesh over all points */
+{
+    MAGtype_CoordGeodetic CoordGeodetic;
+    MAGtype_CoordSpherical CoordSpherical;
+    MAGtype_Date UserDate;
+    MAGtype_MagneticResults MagneticResults;
+    double best = HUGE_VAL, t;
+    int rep, i;
+
+    (void) threads; /* only read by the OpenMP pragma */
+    for(rep = 0; rep < cfg->repeats; rep++)
+    {
+        t = bench_now();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(threads) private(CoordGeodetic, CoordSpherical, UserDate, MagneticResults)
+#endif
+        for(i = 0; i < cfg->npoints; i++)
+        {
+            bench_point(cfg, Ellip, i, &CoordGeodetic, &CoordSpherical, &UserDate);
+            EMM_PointCalcFromMesh(CoordGeodetic, CoordSpherical, UserDate, &MagneticResults, mesh, mesh_SV);
+        }
+        t = bench_now() - t;
+        if(t < best)
+            best = t;
+    }
+    return best;
+}
+
+int main(int argc, char **argv)
+{
+    BENCH_config cfg;
+    MAGtype_MagneticModel *MagneticModel = NULL, *MeshModel = NULL, *TimedMagneticModel;
+    MAGtype_Ellipsoid Ellip;
+    MAGtype_Geoid Geoid;
+    MAGtype_CoordGeodetic minimum, maximum;
+    MAGtype_Date StartDate, EndDate;
+    EMM_tmesh mesh, mesh_SV, loaded, loaded_SV;
+    char dir[] = "/tmp/emm_bench.XXXXXX", cof[BENCH_PATH], cofSV[BENCH_PATH], mcof[BENCH_PATH], mcofSV[BENCH_PATH];
+    char meshfname[BENCH_PATH], meshSVfname[BENCH_PATH], gridfname[BENCH_PATH], *outfname = NULL;
+    double alt[3] = {0.0, 100.0, 400.0}, t, best, single;
+    int nlat[3], i, threads, rep, status = 0, npoints_grid, nrows;
+    unsigned long state = 1;
+
+    cfg.nMax = 120;
+    cfg.nMaxSV = 16;
+    cfg.npoints = 20000;
+    cfg.meshnMax = 12;
+    cfg.nlat = 90;
+    cfg.repeats = 3;
+    cfg.maxthreads = 1;
+    cfg.label = "";
+#ifdef _OPENMP
+    cfg.maxthreads = omp_get_max_threads();
+#endif
+    for(i = 1; i < argc; i++)
+    {
+        if(i + 1 < argc && strcmp(argv[i], "-n") == 0) cfg.nMax = atoi(argv[++i]);
+        else if(i + 1 < argc && strcmp(argv[i], "-s") == 0) cfg.nMaxSV = atoi(argv[++i]);
+        else if(i + 1 < argc && strcmp(argv[i], "-p") == 0) cfg.npoints = atoi(argv[++i]);
+        else if(i + 1 < argc && strcmp(argv[i], "-m") == 0) cfg.meshnMax = atoi(argv[++i]);
+        else if(i + 1 < argc && strcmp(argv[i], "-l") == 0) cfg.nlat = atoi(argv[++i]);
+        else if(i + 1 < argc && strcmp(argv[i], "-r") == 0) cfg.repeats = atoi(argv[++i]);
+        else if(i + 1 < argc && strcmp(argv[i], "-t") == 0) cfg.maxthreads = atoi(argv[++i]);
+        else if(i + 1 < argc && strcmp(argv[i], "-label") == 0) cfg.label = argv[++i];
+        else if(i + 1 < argc && strcmp(argv[i], "-o") == 0) outfname = argv[++i];
+        else
+        {
+            printf("Usage: %s [-n nmax] [-s nmaxsv] [-p points] [-m mesh_nmax] [-l nlat] [-r repeats] [-t max_threads] [-label text] [-o results.json]\n", argv[0]);
+            return 1;
+        }
+    }
+    if(cfg.nMax < 1 || cfg.nMaxSV < 1 || cfg.nMaxSV > cfg.nMax || cfg.npoints < 1 || cfg.meshnMax < 1 ||
+            cfg.nlat < 2 || cfg.nlat > MESH_MAXLAT || cfg.repeats < 1 || cfg.maxthreads < 1 || cfg.maxthreads > BENCH_MAXTHREADS)
+    {
+        printf("Error - Parameter out of range\n");
+        return 1;
+    }
+    for(i = 0; i < 3; i++)
+        nlat[i] = cfg.nlat;
+
+    json = stdout;
+    if(outfname != NULL && (json = fopen(outfname, "w")) == NULL)
+    {
+        printf("Error - Could not open %s\n", outfname);
+        return 1;
+    }
+    if(mkdtemp(dir) == NULL)
+    {
+        printf("Error - Could not create a directory for the synthetic files\n");
+        return 1;
+    }
+    sprintf(cof, "%s/SYNTH.COF", dir);
+    sprintf(cofSV, "%s/SYNTHSV.COF", dir);
+    sprintf(mcof, "%s/MESH.COF", dir);
+    sprintf(mcofSV, "%s/MESHSV.COF", dir);
+    sprintf(meshfname, "%s/static.bin", dir);
+    sprintf(meshSVfname, "%s/secvar.bin", dir);
+    sprintf(gridfname, "%s/grid.bin", dir);
+
+    /* Random points over the globe, below 1000 km, within the five years of the model */
+    cfg.lat = malloc(4 * cfg.npoints * sizeof (double));
+    if(cfg.lat == NULL)
+    {
+        MAG_Error(2);
+        return 1;
+    }
+    cfg.lon = cfg.lat + cfg.npoints;
+    cfg.alt = cfg.lon + cfg.npoints;
+    cfg.year = cfg.alt + cfg.npoints;
+    for(i = 0; i < cfg.npoints; i++)
+    {
+        cfg.lat[i] = asin(2 * bench_random(&state) - 1) * 180.0 / M_PI;
+        cfg.lon[i] = 360 * bench_random(&state) - 180;
+        cfg.alt[i] = 600 * bench_random(&state);
+        cfg.year[i] = 2015.0 + 5 * bench_random(&state);
+    }
+    MAG_SetDefaults(&Ellip, &Geoid);
+    Geoid.GeoidHeightBuffer = GeoidHeightBuffer;
+    Geoid.Geoid_Initialized = 1;
+    Geoid.UseGeoid = 0;
+
+    fprintf(json, "{\n  \"benchmark\": \"emm_bench\",\n  \"format\": 1,\n  \"label\": \"%s\",\n  \"timestamp\": %ld,\n", cfg.label, (long) time(NULL));
+#ifdef __VERSION__
+    fprintf(json, "  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+    fprintf(json, "  \"config\": {\"nmax\": %d, \"nmaxsv\": %d, \"points\": %d, \"mesh_nmax\": %d, \"nlat\": %d, \"repeats\": %d, \"max_threads\": %d},\n",
+            cfg.nMax, cfg.nMaxSV, cfg.npoints, cfg.meshnMax, cfg.nlat, cfg.repeats, cfg.maxthreads);
+    fprintf(json, "  \"results\": [");
+    bench_result("process", "rss_kb", bench_rss_kb(), 0);
+
+    /* Spherical harmonic model */
+    if(!bench_write_model(cof, cofSV, cfg.nMax, cfg.nMaxSV) || !bench_write_model(mcof, mcofSV, cfg.meshnMax, (cfg.nMaxSV < cfg.meshnMax) ? cfg.nMaxSV : cfg.meshnMax))
+    {
+        printf("Error - Could not write the synthetic coefficient files to %s\n", dir);
+        status = 1;
+        goto cleanup;
+    }
+    best = HUGE_VAL;
+    for(rep = 0; rep < cfg.repeats; rep++)
+    {
+        if(MagneticModel != NULL)
+            MAG_FreeMagneticModelMemory(MagneticModel);
+        t = bench_now();
+        if(!MAG_robustReadMagneticModel_Large(cof, cofSV, &MagneticModel))
+        {
+            printf("Error - Could not read %s\n", cof);
+            status = 1;
+            goto cleanup;
+        }
+        t = bench_now() - t;
+        if(t < best)
+            best = t;
+    }
+    bench_result("MAG_robustReadMagneticModel_Large", "seconds", best, 0);
+    bench_result("model", "rss_kb", bench_rss_kb(), 0);
+
+    TimedMagneticModel = MAG_AllocateModelMemory(CALCULATE_NUMTERMS(MagneticModel->nMax));
+    StartDate.DecimalYear = 2017.5;
+    MAG_TimelyModifyMagneticModel(StartDate, MagneticModel, TimedMagneticModel);
+
+    {
+        MAGtype_CoordSpherical CoordSpherical;
+        MAGtype_GeoMagneticElements GeoMagneticElements;
+
+        bench_point(&cfg, Ellip, 0, &minimum, &CoordSpherical, &EndDate);
+        best = HUGE_VAL;
+        for(rep = 0; rep < cfg.repeats; rep++)
+        {
+            t = bench_now();
+            MAG_Geomag(Ellip, CoordSpherical, minimum, TimedMagneticModel, &GeoMagneticElements);
+            t = bench_now() - t;
+            if(t < best)
+                best = t;
+        }
+        bench_result("MAG_Geomag", "seconds_first_point", best, 1);
+    }
+    single = bench_geomag(&cfg, Ellip, TimedMagneticModel, 1);
+    bench_result("MAG_Geomag", "ns_per_point", 1e9 * single / cfg.npoints, 1);
+    for(threads = 1; ; threads = (2 * threads < cfg.maxthreads) ? 2 * threads : cfg.maxthreads)
+    {
+        t = (threads == 1) ? single : bench_geomag(&cfg, Ellip, TimedMagneticModel, threads);
+        bench_result("MAG_Geomag", "points_per_second", cfg.npoints / t, threads);
+        if(threads == cfg.maxthreads)
+            break;
+    }
+
+    /* MAG_Grid over a regional grid of about as many points, written as binary columns */
+    nrows = (int) sqrt(cfg.npoints / 2.0) + 1;
+    minimum.phi = -10;
+    maximum.phi = minimum.phi + 0.1 * (nrows - 1) + 0.05;
+    minimum.lambda = 0;
+    maximum.lambda = minimum.lambda + 0.1 * (2 * nrows - 1) + 0.05;
+    minimum.HeightAboveGeoid = maximum.HeightAboveGeoid = 0;
+    minimum.UseGeoid = maximum.UseGeoid = 0;
+    StartDate.DecimalYear = EndDate.DecimalYear = 2017.5;
+    npoints_grid = nrows * 2 * nrows;
+    best = HUGE_VAL;
+    for(rep = 0; rep < cfg.repeats; rep++)
+    {
+        t = bench_now();
+        MAG_Grid(minimum, maximum, 0.1, 0, 0, MagneticModel, &Geoid, Ellip, StartDate, EndDate, 3, 0, 3, gridfname);
+        t = bench_now() - t;
+        if(t < best)
+            best = t;
+    }
+    bench_result("MAG_Grid", "points_per_second", npoints_grid / best, 1);
+    MAG_FreeMagneticModelMemory(TimedMagneticModel);
+
+    /* Mesh */
+    if(!MAG_robustReadMagneticModel_Large(mcof, mcofSV, &MeshModel))
+    {
+        printf("Error - Could not read %s\n", mcof);
+        status = 1;
+        goto cleanup;
+    }
+    t = bench_now();
+    status = EMM_mesh_generate(0, MeshModel, Ellip, FALSE, 3, alt, nlat, &mesh);
+    if(!status)
+        status = EMM_mesh_generate(0, MeshModel, Ellip, TRUE, 3, alt, nlat, &mesh_SV);
+    t = bench_now() - t;
+    if(!status)
+        status = EMM_mesh_write(0, mesh, meshfname);
+    if(!status)
+        status = EMM_mesh_write(0, mesh_SV, meshSVfname);
+    if(status)
+    {
+        printf("Error %d - Could not generate the synthetic mesh\n", status);
+        goto cleanup;
+    }
+    bench_result("EMM_mesh_generate", "seconds", t, 0);
+    EMM_mesh_free(&mesh);
+    EMM_mesh_free(&mesh_SV);
+    bench_result("before_mesh_read", "rss_kb", bench_rss_kb(), 0);
+
+    best = HUGE_VAL;
+    for(rep = 0; rep < cfg.repeats && !status; rep++)
+    {
+        if(rep > 0)
+        {
+            EMM_mesh_free(&loaded);
+            EMM_mesh_free(&loaded_SV);
+        }
+        t = bench_now();
+        status = EMM_mesh_read(0, meshfname, &loaded);
+        if(!status)
+            status = EMM_mesh_read(0, meshSVfname, &loaded_SV);
+        t = bench_now() - t;
+        if(t < best)
+            best = t;
+    }
+    if(status)
+    {
+        printf("Error %d - Could not read the synthetic mesh\n", status);
+        goto cleanup;
+    }
+    bench_result("EMM_mesh_read", "seconds", best, 0);
+    bench_result("mesh", "rss_kb", bench_rss_kb(), 0);
+
+    single = bench_mesh(&cfg, Ellip, loaded, loaded_SV, 1);
+    bench_result("EMM_PointCalcFromMesh", "ns_per_point", 1e9 * single / cfg.npoints, 1);
+    for(threads = 1; ; threads = (2 * threads < cfg.maxthreads) ? 2 * threads : cfg.maxthreads)
+    {
+        t = (threads == 1) ? single : bench_mesh(&cfg, Ellip, loaded, loaded_SV, threads);
+        bench_result("EMM_PointCalcFromMesh", "points_per_second", cfg.npoints / t, threads);
+        if(threads == cfg.maxthreads)
+            break;
+    }
+
+    best = HUGE_VAL;
+    for(rep = 0; rep < cfg.repeats; rep++)
+    {
+        t = bench_now();
+        EMM_Grid(minimum, maximum, 0.1, 0, 0, &Geoid, Ellip, StartDate, EndDate, 3, 3, gridfname, loaded, loaded_SV);
+        t = bench_now() - t;
+        if(t < best)
+            best = t;
+    }
+    bench_result("EMM_Grid", "points_per_second", npoints_grid / best, 1);
+    EMM_mesh_free(&loaded);
+    EMM_mesh_free(&loaded_SV);
+
+cleanup:
+    fprintf(json, "\n  ]\n}\n");
+    if(json != stdout)
+        fclose(json);
+    if(MagneticModel != NULL)
+        MAG_FreeMagneticModelMemory(MagneticModel);
+    if(MeshModel != NULL)
+        MAG_FreeMagneticModelMemory(MeshModel);
+    free(cfg.lat);
+    remove(cof);
+    remove(cofSV);
+    remove(mcof);
+    remove(mcofSV);
+    remove(meshfname);
+    remove(meshSVfname);
+    remove(gridfname);
+    rmdir(dir);
+    return status;
+}
@@ -0,0 +1,478 @@
+
+/*Enhanced Magnetic Model (EMM) query daemon. The program loads the coefficient
+files EMM2000.COF ... EMM2015SV.COF from the current directory, like
+emm_sph_file, and optionally a pair of static and secular variation meshes,
+then answers batched queries on a Unix domain socket until it receives SIGINT
+or SIGTERM. Short-lived jobs thus skip loading the models. The protocol is
+described in DaemonHeader.h; emm_query.c and geomag/daemon.py are clients.
+
+Usage:
+    emm_daemon socket_path [static.bin secvar.bin]
+
+Connected clients are served in turn, a whole request at a time; a client that
+stalls for DAEMON_TIMEOUT seconds within a request is disconnected. The points
+of large requests are evaluated in parallel when compiled with -fopenmp:
+
+gcc -O2 -fopenmp emm_daemon.c Daemon_SubLibrary.c Mesh_SubLibrary.c GeomagnetismLibrary.c -lm -o emm_daemon
+
+ */
+/****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+#include <math.h>               /* for gcc */
+#include "GeomagnetismHeader.h"
+#include "MeshHeader.h"
+#include "DaemonHeader.h"
+#include "EGM9615.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define NaN log(-1.0)
+#define DAEMON_MAXCLIENTS 64    /* Connections served at the same time */
+#define DAEMON_PARALLEL 256     /* Fewest points of a request evaluated in parallel */
+#define DAEMON_TIMEOUT 5        /* Seconds a read or write of a client may block */
+#define DAEMON_MIN_HEIGHT -10   /* Range of the heights (km) evaluated, as in emm_sph_file */
+#define DAEMON_MAX_HEIGHT 1000
+#define DAEMON_MAX_YEAR 10000   /* Dates must be positive and below, to keep the epoch index defined */
+
+typedef struct {
+    MAGtype_MagneticModel *MagneticModel; /* the full model with the main field of LoadedEpoch */
+    MAGtype_MagneticModel *TimedMagneticModel; /* MagneticModel at TimedYear */
+    MAGtype_LegendreFunction *LegendreFunction;
+    MAGtype_SphericalHarmonicVariables *SphVariables;
+    MAGtype_Geoid Geoid;
+    int LoadedEpoch;
+    double TimedYear; /* NaN if TimedMagneticModel is not up to date */
+} DAEMON_workspace; /* per thread memory */
+
+typedef struct {
+    MAGtype_MagneticModel *MagneticModels[17];
+    int epochs;
+    MAGtype_Ellipsoid Ellip;
+    int have_mesh;
+    EMM_tmesh mesh, mesh_SV;
+    DAEMON_workspace *workspaces;
+    double *in, *out; /* request and response arrays */
+    int capacity; /* points the arrays hold */
+} DAEMON_state;
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void daemon_stop(int sig)
+{
+    (void) sig;
+    stop_requested = 1;
+}
+
+int main(int argc, char **argv)
+{
+    DAEMON_state state;
+    MAGtype_Geoid Geoid;
+    struct sockaddr_un addr;
+    struct sigaction action;
+    struct pollfd fds[DAEMON_MAXCLIENTS + 1];
+    struct timeval timeout;
+    char filename[32];
+    char filenameSV[32];
+    int Epoch, NumTerms, nMax, nthreads = 1, ithread, nfds, i, fd, status = 0;
+
+    int daemon_workspace_init(DAEMON_workspace *ws, MAGtype_MagneticModel *MagneticModel, MAGtype_Geoid Geoid);
+    void daemon_workspace_free(DAEMON_workspace *ws);
+    int daemon_serve(int fd, DAEMON_state *state);
+
+    if(argc != 2 && argc != 4)
+    {
+        printf("Usage: %s socket_path [static.bin secvar.bin]\n", argv[0]);
+        return 1;
+    }
+    if(strlen(argv[1]) >= sizeof (addr.sun_path))
+    {
+        printf("Error - Socket path %s is too long\n", argv[1]);
+        return 1;
+    }
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+
+    /* Models, as in emm_sph_file */
+    memset(&state, 0, sizeof (state));
+    state.epochs = 16;
+    for(Epoch = 0; Epoch < state.epochs; Epoch++)
+    {
+        snprintf(filename, sizeof (filename), "EMM%d.COF", Epoch + 2000);
+        snprintf(filenameSV, sizeof (filenameSV), "EMM%dSV.COF", Epoch + 2000);
+        if(Epoch == state.epochs - 1)
+            Epoch++;
+        if(!MAG_robustReadMagneticModel_Large(filename, filenameSV, &state.MagneticModels[Epoch]))
+        {
+            printf("\n EMM%d.COF or EMM%dSV.COF not found.\n", Epoch + 2000, Epoch + 2000);
+            return 1;
+        }
+    }
+    nMax = state.MagneticModels[0]->nMax;
+    NumTerms = ((nMax + 1) * (nMax + 2) / 2);
+    state.MagneticModels[state.epochs - 1] = MAG_AllocateModelMemory(NumTerms);
+    state.MagneticModels[state.epochs - 1]->nMax = state.MagneticModels[0]->nMax;
+    state.MagneticModels[state.epochs - 1]->nMaxSecVar = state.MagneticModels[0]->nMaxSecVar;
+    state.MagneticModels[state.epochs - 1]->epoch = state.MagneticModels[0]->epoch + state.epochs - 1;
+    MAG_AssignMagneticModelCoeffs(state.MagneticModels[state.epochs - 1], state.MagneticModels[state.epochs],
+            state.MagneticModels[state.epochs - 1]->nMax, state.MagneticModels[state.epochs - 1]->nMaxSecVar);
+
+    MAG_SetDefaults(&state.Ellip, &Geoid);
+    Geoid.GeoidHeightBuffer = GeoidHeightBuffer;
+    Geoid.Geoid_Initialized = 1;
+
+    if(argc == 4)
+    {
+        status = EMM_mesh_read(0, argv[2], &state.mesh);
+        if(!status)
+            status = EMM_mesh_read(0, argv[3], &state.mesh_SV);
+        if(status)
+        {
+            printf("Error %d - Could not read the meshes %s and %s\n", status, argv[2], argv[3]);
+            return 1;
+        }
+        state.have_mesh = 1;
+    }
+
+    state.workspaces = calloc(nthreads, sizeof (DAEMON_workspace));
+    for(ithread = 0; state.workspaces != NULL && ithread < nthreads && !status; ithread++)
+        if(!daemon_workspace_init(&state.workspaces[ithread], state.MagneticModels[state.epochs], Geoid))
+            status = 1;
+    if(state.workspaces == NULL || status)
+    {
+        MAG_Error(2);
+        return 1;
+    }
+
+    /* Socket, replacing one left by an earlier daemon */
+    memset(&addr, 0, sizeof (addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, argv[1]);
+    unlink(argv[1]);
+    fds[0].fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fds[0].fd < 0 || bind(fds[0].fd, (struct sockaddr *) &addr, sizeof (addr)) != 0 || listen(fds[0].fd, 16) != 0)
+    {
+        printf("Error - Could not listen on %s: %s\n", argv[1], strerror(errno));
+        return 1;
+    }
+    fds[0].events = POLLIN;
+    nfds = 1;
+
+    memset(&action, 0, sizeof (action));
+    action.sa_handler = daemon_stop; /* without SA_RESTART, so that poll returns */
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+    timeout.tv_sec = DAEMON_TIMEOUT; /* a request is read and answered whole, so a stalled client would hold up the others */
+    timeout.tv_usec = 0;
+
+    printf("emm_daemon: listening on %s with %s, %d threads\n", argv[1], state.have_mesh ? "models and meshes" : "models", nthreads);
+    fflush(stdout);
+
+    while(!stop_requested)
+    {
+        if(poll(fds, nfds, -1) < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            printf("Error - poll: %s\n", strerror(errno));
+            status = 1;
+            break;
+        }
+        for(i = nfds - 1; i >= 1; i--) /* backwards, a closed client is replaced by the last one */
+        {
+            if(fds[i].revents == 0)
+                continue;
+            if((fds[i].revents & POLLIN) == 0 || !daemon_serve(fds[i].fd, &state))
+            {
+                close(fds[i].fd);
+                fds[i] = fds[--nfds];
+            }
+        }
+        if(fds[0].revents & POLLIN)
+        {
+            fd = accept(fds[0].fd, NULL, NULL);
+            if(fd >= 0 && nfds <= DAEMON_MAXCLIENTS)
+            {
+                setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof (timeout));
+                setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof (timeout));
+                fds[nfds].fd = fd;
+                fds[nfds].events = POLLIN;
+                fds[nfds++].revents = 0;
+            } else if(fd >= 0)
+                close(fd); /* too many clients */
+        }
+    }
+
+    for(i = 0; i < nfds; i++)
+        close(fds[i].fd);
+    unlink(argv[1]);
+    for(ithread = 0; ithread < nthreads; ithread++)
+        daemon_workspace_free(&state.workspaces[ithread]);
+    free(state.workspaces);
+    free(state.in);
+    free(state.out);
+    if(state.have_mesh)
+    {
+        EMM_mesh_free(&state.mesh);
+        EMM_mesh_free(&state.mesh_SV);
+    }
+    for(Epoch = 0; Epoch <= state.epochs; Epoch++)
+        MAG_FreeMagneticModelMemory(state.MagneticModels[Epoch]);
+    return status;
+}
+
+int daemon_serve(int fd, DAEMON_state *state)
+/* Reads a request from a client and sends the response; FALSE if the connection is to be closed */
+{
+    EMM_daemon_request request;
+    EMM_daemon_response response;
+    double *grown;
+    int n, i, ithread;
+
+    void daemon_point_sph(DAEMON_workspace *ws, DAEMON_state *state, int flags, int n, int i);
+    void daemon_point_mesh(DAEMON_workspace *ws, DAEMON_state *state, int flags, int n, int i);
+
+    if(!EMM_daemon_read(fd, &request, sizeof (request)))
+        return FALSE; /* closed by the client */
+    memcpy(response.magic, EMM_DAEMON_RESPONSE_MAGIC, 4);
+    response.status = EMM_DAEMON_OK;
+    response.n = n = request.n;
+    response.nelements = EMM_DAEMON_NELEMENTS;
+    if(memcmp(request.magic, EMM_DAEMON_REQUEST_MAGIC, 4) != 0 || n < 0 ||
+            (request.method != EMM_DAEMON_SPH && request.method != EMM_DAEMON_MESH))
+        response.status = EMM_DAEMON_PROTOCOL_ERROR;
+    else if(n > EMM_DAEMON_MAXPOINTS)
+        response.status = EMM_DAEMON_TOO_MANY_POINTS;
+    else if(n > state->capacity)
+    {
+        grown = realloc(state->in, 4 * (size_t) n * sizeof (double));
+        if(grown != NULL)
+            state->in = grown;
+        grown = (grown == NULL) ? NULL : realloc(state->out, EMM_DAEMON_NELEMENTS * (size_t) n * sizeof (double));
+        if(grown != NULL)
+        {
+            state->out = grown;
+            state->capacity = n;
+        } else
+            response.status = EMM_DAEMON_MEM_ALLOC_ERROR;
+    }
+    if(response.status != EMM_DAEMON_OK) /* the points cannot be skipped, so the connection ends */
+    {
+        EMM_daemon_write(fd, &response, sizeof (response));
+        return FALSE;
+    }
+
+    if(!EMM_daemon_read(fd, state->in, 4 * (size_t) n * sizeof (double)))
+        return FALSE;
+    if(request.method == EMM_DAEMON_MESH && !state->have_mesh)
+    {
+        response.status = EMM_DAEMON_NO_MESH;
+        return EMM_daemon_write(fd, &response, sizeof (response));
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) private(ithread) if(n >= DAEMON_PARALLEL)
+#endif
+    for(i = 0; i < n; i++)
+    {
+        ithread = 0;
+#ifdef _OPENMP
+        ithread = omp_get_thread_num();
+#endif
+        if(request.method == EMM_DAEMON_MESH)
+            daemon_point_mesh(&state->workspaces[ithread], state, request.flags, n, i);
+        else
+            daemon_point_sph(&state->workspaces[ithread], state, request.flags, n, i);
+    }
+
+    return EMM_daemon_write(fd, &response, sizeof (response)) &&
+            EMM_daemon_write(fd, state->out, EMM_DAEMON_NELEMENTS * (size_t) n * sizeof (double));
+} /* daemon_serve */
+
+static void daemon_store(DAEMON_state *state, int n, int i, MAGtype_GeoMagneticElements *Elements)
+/* Element arrays of the response, in the order of MAGtype_GeoMagneticElements */
+{
+    double *out = state->out + i;
+
+    out[0 * n] = Elements->Decl;
+    out[1 * n] = Elements->Incl;
+    out[2 * n] = Elements->F;
+    out[3 * n] = Elements->H;
+    out[4 * n] = Elements->X;
+    out[5 * n] = Elements->Y;
+    out[6 * n] = Elements->Z;
+    out[7 * n] = Elements->GV;
+    out[8 * n] = Elements->Decldot;
+    out[9 * n] = Elements->Incldot;
+    out[10 * n] = Elements->Fdot;
+    out[11 * n] = Elements->Hdot;
+    out[12 * n] = Elements->Xdot;
+    out[13 * n] = Elements->Ydot;
+    out[14 * n] = Elements->Zdot;
+    out[15 * n] = Elements->GVdot;
+}
+
+static void daemon_store_nan(DAEMON_state *state, int n, int i)
+/* Response of a point that is not evaluated */
+{
+    int k;
+
+    for(k = 0; k < EMM_DAEMON_NELEMENTS; k++)
+        state->out[k * n + i] = NaN;
+}
+
+static int daemon_position(DAEMON_workspace *ws, DAEMON_state *state, int flags, int n, int i,
+        MAGtype_CoordGeodetic *CoordGeodetic, MAGtype_CoordSpherical *CoordSpherical, MAGtype_Date *UserDate)
+/* Point i of the request, with latitude and longitude wrapped into range as EMMBase.norm_lat_lon;
+   FALSE for a point that is not finite or outside the height and date ranges, which is not to be evaluated */
+{
+    double lat = state->in[i], lon = state->in[n + i], x, y, z;
+
+    CoordGeodetic->HeightAboveGeoid = state->in[2 * n + i];
+    UserDate->DecimalYear = state->in[3 * n + i];
+    if(!isfinite(lat) || !isfinite(lon) || !(CoordGeodetic->HeightAboveGeoid >= DAEMON_MIN_HEIGHT) ||
+            !(CoordGeodetic->HeightAboveGeoid <= DAEMON_MAX_HEIGHT) || !(UserDate->DecimalYear > 0) ||
+            !(UserDate->DecimalYear < DAEMON_MAX_YEAR))
+        return FALSE;
+    if(lat < -90 || lat > 90) /* over a pole: through cartesian coordinates */
+    {
+        x = cos(DEG2RAD(lon)) * cos(DEG2RAD(lat));
+        y = sin(DEG2RAD(lon)) * cos(DEG2RAD(lat));
+        z = sin(DEG2RAD(lat));
+        lon = RAD2DEG(atan2(y, x));
+        lat = RAD2DEG(asin(z / sqrt(x * x + y * y + z * z)));
+    }
+    lon = fmod(lon, 360);
+    if(lon < 0)
+        lon += 360;
+    CoordGeodetic->phi = lat;
+    CoordGeodetic->lambda = lon;
+    CoordGeodetic->UseGeoid = ws->Geoid.UseGeoid = (flags & EMM_DAEMON_GEOID) != 0;
+    MAG_ConvertGeoidToEllipsoidHeight(CoordGeodetic, &ws->Geoid);
+    MAG_GeodeticToSpherical(state->Ellip, *CoordGeodetic, CoordSpherical);
+    return TRUE;
+}
+
+void daemon_point_sph(DAEMON_workspace *ws, DAEMON_state *state, int flags, int n, int i)
+/* The computation of emm_sph_file for point i, with the memory of a workspace */
+{
+    MAGtype_CoordSpherical CoordSpherical;
+    MAGtype_CoordGeodetic CoordGeodetic;
+    MAGtype_Date UserDate;
+    MAGtype_MagneticResults MagneticResultsSph, MagneticResultsGeo, MagneticResultsSphVar, MagneticResultsGeoVar;
+    MAGtype_GeoMagneticElements GeoMagneticElements;
+    MAGtype_MagneticModel **MagneticModels = state->MagneticModels;
+    int Epoch, nMax;
+
+    if(!daemon_position(ws, state, flags, n, i, &CoordGeodetic, &CoordSpherical, &UserDate))
+    {
+        daemon_store_nan(state, n, i);
+        return;
+    }
+
+    Epoch = ((int) UserDate.DecimalYear - MagneticModels[0]->epoch);
+    if(Epoch < 0) Epoch = 0;
+    if(Epoch > state->epochs - 1) Epoch = state->epochs - 1;
+    if(ws->LoadedEpoch != Epoch)
+    {
+        ws->MagneticModel->epoch = MagneticModels[Epoch]->epoch;
+        MAG_AssignMagneticModelCoeffs(ws->MagneticModel, MagneticModels[Epoch], MagneticModels[Epoch]->nMax, MagneticModels[Epoch]->nMaxSecVar);
+        ws->LoadedEpoch = Epoch;
+        ws->TimedYear = NaN;
+    }
+    if(UserDate.DecimalYear != ws->TimedYear)
+    {
+        MAG_TimelyModifyMagneticModel(UserDate, ws->MagneticModel, ws->TimedMagneticModel);
+        ws->TimedYear = UserDate.DecimalYear;
+    }
+
+    nMax = ws->TimedMagneticModel->nMax;
+    MAG_ComputeSphericalHarmonicVariables(state->Ellip, CoordSpherical, nMax, ws->SphVariables);
+    MAG_AssociatedLegendreFunction(CoordSpherical, nMax, ws->LegendreFunction);
+    MAG_Summation(ws->LegendreFunction, ws->TimedMagneticModel, *ws->SphVariables, CoordSpherical, &MagneticResultsSph);
+    MAG_SecVarSummation(ws->LegendreFunction, ws->TimedMagneticModel, *ws->SphVariables, CoordSpherical, &MagneticResultsSphVar);
+    MAG_RotateMagneticVector(CoordSpherical, CoordGeodetic, MagneticResultsSph, &MagneticResultsGeo);
+    MAG_RotateMagneticVector(CoordSpherical, CoordGeodetic, MagneticResultsSphVar, &MagneticResultsGeoVar);
+    MAG_CalculateGeoMagneticElements(&MagneticResultsGeo, &GeoMagneticElements);
+    MAG_CalculateSecularVariationElements(MagneticResultsGeoVar, &GeoMagneticElements);
+    MAG_CalculateGridVariation(CoordGeodetic, &GeoMagneticElements);
+    daemon_store(state, n, i, &GeoMagneticElements);
+} /* daemon_point_sph */
+
+void daemon_point_mesh(DAEMON_workspace *ws, DAEMON_state *state, int flags, int n, int i)
+/* The computation of EMMMesh.compute_field with compute_change for point i */
+{
+    MAGtype_CoordSpherical CoordSpherical;
+    MAGtype_CoordGeodetic CoordGeodetic;
+    MAGtype_Date UserDate;
+    MAGtype_MagneticResults MagneticResults, MagneticVariation;
+    MAGtype_GeoMagneticElements GeoMagneticElements;
+
+    if(!daemon_position(ws, state, flags, n, i, &CoordGeodetic, &CoordSpherical, &UserDate))
+    {
+        daemon_store_nan(state, n, i);
+        return;
+    }
+    EMM_PointCalcFromMesh(CoordGeodetic, CoordSpherical, UserDate, &MagneticResults, state->mesh, state->mesh_SV);
+    MAG_CalculateGeoMagneticElements(&MagneticResults, &GeoMagneticElements);
+    UserDate.DecimalYear += 1;
+    EMM_PointCalcFromMesh(CoordGeodetic, CoordSpherical, UserDate, &MagneticVariation, state->mesh, state->mesh_SV);
+    MagneticVariation.Bx -= MagneticResults.Bx;
+    MagneticVariation.By -= MagneticResults.By;
+    MagneticVariation.Bz -= MagneticResults.Bz;
+    MAG_CalculateSecularVariationElements(MagneticVariation, &GeoMagneticElements);
+    MAG_CalculateGridVariation(CoordGeodetic, &GeoMagneticElements);
+    daemon_store(state, n, i, &GeoMagneticElements);
+} /* daemon_point_mesh */
+
+int daemon_workspace_init(DAEMON_workspace *ws, MAGtype_MagneticModel *MagneticModel, MAGtype_Geoid Geoid)
+/* Copy of the full model, and memory for evaluating it, for one thread */
+{
+    int NumTerms;
+
+    NumTerms = ((MagneticModel->nMax + 1) * (MagneticModel->nMax + 2) / 2);
+    ws->MagneticModel = MAG_AllocateModelMemory(NumTerms);
+    ws->TimedMagneticModel = MAG_AllocateModelMemory(NumTerms);
+    ws->LegendreFunction = MAG_AllocateLegendreFunctionMemory(NumTerms);
+    ws->SphVariables = MAG_AllocateSphVarMemory(MagneticModel->nMax);
+    if(ws->MagneticModel == NULL || ws->TimedMagneticModel == NULL || ws->LegendreFunction == NULL || ws->SphVariables == NULL)
+        return FALSE;
+
+    ws->MagneticModel->epoch = MagneticModel->epoch;
+    ws->MagneticModel->nMax = MagneticModel->nMax;
+    ws->MagneticModel->nMaxSecVar = MagneticModel->nMaxSecVar;
+    ws->MagneticModel->SecularVariationUsed = MagneticModel->SecularVariationUsed;
+    MAG_AssignMagneticModelCoeffs(ws->MagneticModel, MagneticModel, MagneticModel->nMax, MagneticModel->nMaxSecVar);
+    ws->Geoid = Geoid;
+    ws->LoadedEpoch = -1;
+    ws->TimedYear = NaN;
+    return TRUE;
+} /* daemon_workspace_init */
+
+void daemon_workspace_free(DAEMON_workspace *ws)
+{
+    if(ws->MagneticModel != NULL)
+        MAG_FreeMagneticModelMemory(ws->MagneticModel);
+    if(ws->TimedMagneticModel != NULL)
+        MAG_FreeMagneticModelMemory(ws->TimedMagneticModel);
+    if(ws->LegendreFunction != NULL)
+        MAG_FreeLegendreMemory(ws->LegendreFunction);
+    if(ws->SphVariables != NULL)
+        MAG_FreeSphVarMemory(ws->SphVariables);
+} /* daemon_workspace_free */
@@ -0,0 +1,82 @@
+
+/*Enhanced Magnetic Model (EMM) mesh generation program. The program reads
+a pair of coefficient files, evaluates the spherical harmonic model on a mesh
+of the given latitude resolution and altitude layers, and writes the main
+field and secular variation meshes in the binary format of Mesh_SubLibrary.c.
+
+Usage:
+    emm_mesh_gen EMM2015.COF EMM2015SV.COF nlat alt0,alt1,... static.bin secvar.bin
+
+nlat is the number of rows in latitude of every layer (180 for one degree
+rows) and the altitudes are in km above the WGS84 ellipsoid, in increasing
+order. The rows are evaluated in parallel when compiled with -fopenmp:
+
+gcc -O2 -fopenmp emm_mesh_gen.c Mesh_SubLibrary.c GeomagnetismLibrary.c -lm -o emm_mesh_gen
+
+ */
+/****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <math.h>               /* for gcc */
+#include "GeomagnetismHeader.h"
+#include "MeshHeader.h"
+
+#define MAXLAYERS 1000
+
+
+int main(int argc, char **argv)
+{
+    MAGtype_MagneticModel *MagneticModel;
+    MAGtype_Ellipsoid Ellip;
+    MAGtype_Geoid Geoid;
+    EMM_tmesh mesh;
+    double alt[MAXLAYERS];
+    int nlat[MAXLAYERS];
+    int nalt, ilat, status;
+    char *p, *end;
+
+    if(argc != 7)
+    {
+        printf("Usage: %s model.COF modelSV.COF nlat alt0,alt1,... static.bin secvar.bin\n", argv[0]);
+        return 1;
+    }
+
+    ilat = atoi(argv[3]);
+    nalt = 0;
+    for(p = argv[4]; *p != '\0' && nalt < MAXLAYERS; p = (*end == ',') ? end + 1 : end)
+    {
+        alt[nalt] = strtod(p, &end);
+        if(end == p)
+        {
+            printf("Error - Could not read the altitude list %s\n", argv[4]);
+            return 1;
+        }
+        nlat[nalt++] = ilat;
+    }
+
+    if(!MAG_robustReadMagneticModel_Large(argv[1], argv[2], &MagneticModel))
+    {
+        printf("\n %s or %s not found.\n", argv[1], argv[2]);
+        return 1;
+    }
+    MAG_SetDefaults(&Ellip, &Geoid);
+
+    status = EMM_mesh_generate(1, MagneticModel, Ellip, FALSE, nalt, alt, nlat, &mesh);
+    if(!status)
+        status = EMM_mesh_write(1, mesh, argv[5]);
+    EMM_mesh_free(&mesh);
+
+    if(!status)
+        status = EMM_mesh_generate(1, MagneticModel, Ellip, TRUE, nalt, alt, nlat, &mesh);
+    if(!status)
+        status = EMM_mesh_write(1, mesh, argv[6]);
+    EMM_mesh_free(&mesh);
+
+    MAG_FreeMagneticModelMemory(MagneticModel);
+    return status;
+}
@@ -0,0 +1,111 @@
+
+/*Enhanced Magnetic Model (EMM) query client. Reads points from standard input,
+one "latitude longitude height year" line each (degrees, km, decimal year),
+evaluates them with one request to a running emm_daemon and prints the
+geomagnetic elements of every point.
+
+Usage:
+    emm_query socket_path [m][g] < points.txt
+
+m uses the daemon's meshes instead of the spherical harmonic models and g
+takes the heights above MSL instead of the WGS-84 ellipsoid.
+
+gcc -O2 emm_query.c Daemon_SubLibrary.c -o emm_query
+
+ */
+/****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "DaemonHeader.h"
+
+
+int main(int argc, char **argv)
+{
+    double *points = NULL, *grown, *elements, lat, lon, alt, year;
+    int n = 0, capacity = 0, i, k, fd, status, method = EMM_DAEMON_SPH, flags = 0;
+    char line[256];
+
+    if(argc != 2 && (argc != 3 || strspn(argv[2], "mg") != strlen(argv[2])))
+    {
+        printf("Usage: %s socket_path [m][g] < points.txt\n", argv[0]);
+        return 1;
+    }
+    if(argc == 3 && strchr(argv[2], 'm') != NULL)
+        method = EMM_DAEMON_MESH;
+    if(argc == 3 && strchr(argv[2], 'g') != NULL)
+        flags |= EMM_DAEMON_GEOID;
+
+    while(fgets(line, sizeof (line), stdin) != NULL)
+    {
+        if(sscanf(line, "%lf %lf %lf %lf", &lat, &lon, &alt, &year) != 4)
+            continue;
+        if(n == capacity)
+        {
+            capacity = 2 * capacity + 1024;
+            grown = realloc(points, 4 * (size_t) capacity * sizeof (double));
+            if(grown == NULL)
+            {
+                printf("Error - Out of memory after %d points\n", n);
+                return 1;
+            }
+            points = grown;
+        }
+        points[4 * n] = lat;
+        points[4 * n + 1] = lon;
+        points[4 * n + 2] = alt;
+        points[4 * n + 3] = year;
+        n++;
+    }
+    if(n == 0)
+        return 0;
+    if(n > EMM_DAEMON_MAXPOINTS)
+    {
+        printf("Error - At most %d points per request\n", EMM_DAEMON_MAXPOINTS);
+        return 1;
+    }
+
+    /* The request holds each coordinate as an array of its own */
+    grown = malloc(4 * (size_t) n * sizeof (double));
+    elements = malloc(EMM_DAEMON_NELEMENTS * (size_t) n * sizeof (double));
+    if(grown == NULL || elements == NULL)
+    {
+        printf("Error - Out of memory\n");
+        return 1;
+    }
+    for(i = 0; i < n; i++)
+        for(k = 0; k < 4; k++)
+            grown[k * n + i] = points[4 * i + k];
+    free(points);
+    points = grown;
+
+    fd = EMM_daemon_connect(argv[1]);
+    if(fd < 0)
+    {
+        printf("Error - Could not connect to emm_daemon at %s\n", argv[1]);
+        return 1;
+    }
+    status = EMM_daemon_query(fd, method, flags, n, points, points + n, points + 2 * n, points + 3 * n, elements);
+    EMM_daemon_close(fd);
+    if(status != EMM_DAEMON_OK)
+    {
+        printf("Error %d - Query failed\n", status);
+        return 1;
+    }
+
+    printf("Latitude Longitude Height Year Decl Incl F H X Y Z GV Decldot Incldot Fdot Hdot Xdot Ydot Zdot GVdot\n");
+    for(i = 0; i < n; i++)
+    {
+        printf("%.6f %.6f %.4f %.4f", points[i], points[n + i], points[2 * n + i], points[3 * n + i]);
+        for(k = 0; k < EMM_DAEMON_NELEMENTS; k++)
+            printf(" %.6f", elements[k * n + i]);
+        printf("\n");
+    }
+    free(points);
+    free(elements);
+    return 0;
+}
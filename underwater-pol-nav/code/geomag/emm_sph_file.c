@@ -33,6 +33,9 @@ November 15, 2009
 #include <math.h>               /* for gcc */
 #include "GeomagnetismHeader.h"
 #include "EGM9615.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #define NaN log(-1.0)
 /* constants */
@@ -48,6 +51,29 @@ November 15, 2009
 
 #define PATH MAXREAD
 
+#define BATCH_BUFFER (16 << 20)     /* Bytes of coordinate file read at once by the 'b' switch */
+#define BATCH_OUTBUFFER (1 << 20)   /* Output buffer of the 'b' switch */
+#define BATCH_POINTS 16384          /* Points evaluated together by the 'b' switch */
+
+typedef struct {
+    MAGtype_MagneticModel *MagneticModel; /* the full model with the main field of LoadedEpoch, as MagneticModels[epochs] in main */
+    MAGtype_MagneticModel *TimedMagneticModel; /* MagneticModel at TimedYear */
+    MAGtype_LegendreFunction *LegendreFunction;
+    MAGtype_SphericalHarmonicVariables *SphVariables;
+    MAGtype_Geoid Geoid;
+    int LoadedEpoch;
+    double TimedYear; /* NaN if TimedMagneticModel is not up to date */
+} BATCH_workspace; /* per thread memory of the 'b' switch */
+
+typedef struct {
+    char *field[5]; /* date, coordinate system, altitude, latitude and longitude as in the input line, NULL for binary input */
+    double sdate, alt, latitude, longitude; /* alt in km */
+    double HeightAboveEllipsoid; /* km, set by batch_compute */
+    int igdgc;
+    MAGtype_GeoMagneticElements GeoMagneticElements;
+    MAGtype_Gradient Gradient;
+} BATCH_point;
+
 
 
 
@@ -172,6 +198,8 @@ int main(int argv, char**argc)
     double degrees_to_decimal();
     double julday();
     int getshc();
+    int process_batch_file(char *coord_fname, char *out_fname, int use_gradient, int out_columns, MAGtype_MagneticModel *MagneticModels[], int epochs,
+            MAGtype_Ellipsoid Ellip, MAGtype_Geoid Geoid, double minyr, double maxyr);
 
 
     /* Initializations. */
@@ -233,6 +261,8 @@ int main(int argv, char**argc)
     {
         printf("\n\nEnhanced World Magnetic Model - File Processing Utility: C-Program\n            --- Model Release Year: %d ---\n           --- Software Release Date: %s ---\nUSAGE:\n", (int)MagneticModels[epochs-1]->epoch, VersionDate);
         printf("coordinate file: emm_sph_file f input_file output_file\n");
+        printf("batch, parallel: emm_sph_file b input_file output_file [g][d|s]\n");
+        printf("   g appends the gradients, d (s) writes float64 (float32) binary columns\n");
         printf("or for help:     emm_sph_file h \n");
         printf("\n");
         printf("The input file may have any number of entries but they must follow\n");
@@ -260,6 +290,17 @@ int main(int argv, char**argc)
         exit(2);
     } /* help */
 
+    if((argv == 4 || (argv == 5 && strspn(args[4], "gds") == strlen(args[4]))) && (*(args[1]) == 'b'))
+    {
+        iarg = process_batch_file(args[2], args[3], argv == 5 && strchr(args[4], 'g') != NULL,
+                (argv == 5 && strchr(args[4], 'd') != NULL) ? 8 : (argv == 5 && strchr(args[4], 's') != NULL) ? 4 : 0,
+                MagneticModels, epochs, Ellip, Geoid, minyr, maxyr);
+        for(Epoch = 0; Epoch < epochs; Epoch++) MAG_FreeMagneticModelMemory(MagneticModels[Epoch]);
+        MAG_FreeMagneticModelMemory(MagneticModels[epochs]);
+        MAG_FreeMagneticModelMemory(TimedMagneticModel);
+        return iarg;
+    } /* batch option */
+
     if((argv == 4) && (*(args[1]) == 'f'))
     {
         printf("\n\n 'f' switch: converting file with multiple locations.\n");
@@ -757,6 +798,567 @@ void print_result_file_gradient(FILE *outf, MAGtype_GeoMagneticElements Output,
     return;
 } /* print_result_file */
 
+/****************************************************************************/
+/*                                                                          */
+/*                       Subroutine process_batch_file                      */
+/*                                                                          */
+/****************************************************************************/
+/*                                                                          */
+/*     Non-interactive 'b' switch: the 'f' switch for large coordinate      */
+/*     files. The input is read in blocks of BATCH_BUFFER bytes and split   */
+/*     into points in place. The points of a block are evaluated in         */
+/*     parallel when compiled with OpenMP, each thread with its own copy    */
+/*     of the model and its own workspace. The results are then written in  */
+/*     input order through a BATCH_OUTBUFFER byte stdio buffer, in the      */
+/*     same format as the 'f' switch.                                       */
+/*                                                                          */
+/*     Both files may instead be columnar binary files (see                 */
+/*     MAG_ColumnFileCreate). A binary coordinate file is recognized by     */
+/*     its magic and needs the columns DecimalYear, Latitude, Longitude     */
+/*     and HeightAboveEllipsoid or HeightAboveGeoid, in km. A binary        */
+/*     output file has the columns DecimalYear, Latitude, Longitude and     */
+/*     HeightAboveEllipsoid, then the elements named as in the text header. */
+/*                                                                          */
+/*     Input:                                                               */
+/*           coord_fname, out_fname - coordinate and output files           */
+/*           use_gradient - nonzero to append the gradients                 */
+/*           out_columns - 8 (4) for float64 (float32) binary output,       */
+/*                         0 for text                                       */
+/*           MagneticModels, epochs - models as loaded by main              */
+/*                                                                          */
+/*     Output:                                                              */
+/*           0 on success, 1 on file or memory errors, 2 on input errors    */
+/*                                                                          */
+
+/****************************************************************************/
+
+int process_batch_file(char *coord_fname, char *out_fname, int use_gradient, int out_columns, MAGtype_MagneticModel *MagneticModels[], int epochs,
+        MAGtype_Ellipsoid Ellip, MAGtype_Geoid Geoid, double minyr, double maxyr)
+{
+    BATCH_workspace *workspaces;
+    BATCH_point *points;
+    FILE *coordfile, *outfile = NULL;
+    MAGtype_ColumnFile incolumns, outcolumns;
+    char *buffer, *end, magic[8];
+    char *outnames[] = {"DecimalYear", "Latitude", "Longitude", "HeightAboveEllipsoid",
+        "Decl_deg", "Incl_deg", "H_nT", "X_nT", "Y_nT", "Z_nT", "F_nT",
+        "dD/dt_min", "dI/dt_min", "dH/dt_nT", "dX/dt_nT", "dY/dt_nT", "dZ/dt_nT", "dF/dt_nT",
+        "dX/dx_nt", "dY/dx_nt", "dZ/dx_nt", "dX/dy_nt", "dY/dy_nt", "dZ/dy_nt", "dX/dz_nt", "dY/dz_nt", "dZ/dz_nt"};
+    double values[27], *inrow = NULL;
+    long len = 0, pos = 0, iline = 0, nprocessed = 0, nwarn = 0;
+    int nthreads = 1, ithread, npoints, ipoint, at_eof = 0, parse = 0, status = 0;
+    int incol[4]; /* DecimalYear, Latitude, Longitude and height columns of a binary coordinate file */
+
+    int batch_workspace_init(BATCH_workspace *ws, MAGtype_MagneticModel *MagneticModel, MAGtype_Geoid Geoid);
+    void batch_workspace_free(BATCH_workspace *ws);
+    int batch_parse_line(char *line, long iline, BATCH_point *p);
+    int batch_read_columns(int incol[4], double *values, long iline, BATCH_point *p);
+    void batch_compute(BATCH_workspace *ws, BATCH_point *p, MAGtype_MagneticModel *MagneticModels[], int epochs, MAGtype_Ellipsoid Ellip, int use_gradient);
+    void batch_write_point(FILE *outfile, MAGtype_ColumnFile *outcolumns, double *values, BATCH_point *p, int use_gradient);
+
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+
+    coordfile = fopen(coord_fname, "rb");
+    if(coordfile == NULL)
+    {
+        printf("\nError: could not open coordinate file %s\n\n", coord_fname);
+        return 1;
+    }
+    memset(&incolumns, 0, sizeof (incolumns));
+    if(fread(magic, 1, 8, coordfile) == 8 && memcmp(magic, MAG_COLUMN_MAGIC, 8) == 0)
+    {
+        fclose(coordfile);
+        coordfile = NULL;
+        if(!MAG_ColumnFileOpen(coord_fname, &incolumns))
+        {
+            printf("\nError: could not read the binary coordinate file %s\n\n", coord_fname);
+            return 1;
+        }
+        incol[0] = MAG_ColumnFileFind(&incolumns, "DecimalYear");
+        incol[1] = MAG_ColumnFileFind(&incolumns, "Latitude");
+        incol[2] = MAG_ColumnFileFind(&incolumns, "Longitude");
+        incol[3] = MAG_ColumnFileFind(&incolumns, "HeightAboveEllipsoid");
+        if(incol[3] < 0)
+            incol[3] = -2 - MAG_ColumnFileFind(&incolumns, "HeightAboveGeoid"); /* -2 - index for heights above the geoid */
+        inrow = malloc(incolumns.NumColumns * sizeof (double));
+        if(incol[0] < 0 || incol[1] < 0 || incol[2] < 0 || incol[3] == -1 || inrow == NULL)
+        {
+            printf("\nError: the binary coordinate file %s needs the columns DecimalYear, Latitude, Longitude and HeightAboveEllipsoid or HeightAboveGeoid\n\n", coord_fname);
+            MAG_ColumnFileClose(&incolumns);
+            free(inrow);
+            return 1;
+        }
+    } else
+        rewind(coordfile);
+
+    memset(&outcolumns, 0, sizeof (outcolumns));
+    if(out_columns)
+        status = !MAG_ColumnFileCreate(out_fname, use_gradient ? 27 : 18, outnames, out_columns, &outcolumns);
+    else
+    {
+        outfile = fopen(out_fname, "w");
+        if(outfile != NULL)
+            setvbuf(outfile, NULL, _IOFBF, BATCH_OUTBUFFER);
+        status = (outfile == NULL);
+    }
+    if(status)
+    {
+        printf("\nError: could not open output file %s\n\n", out_fname);
+        if(coordfile != NULL)
+            fclose(coordfile);
+        MAG_ColumnFileClose(&incolumns);
+        free(inrow);
+        return 1;
+    }
+
+    buffer = malloc(BATCH_BUFFER + 1); /* one spare byte to terminate a last line without newline */
+    points = malloc(BATCH_POINTS * sizeof (BATCH_point));
+    workspaces = calloc(nthreads, sizeof (BATCH_workspace));
+    if(buffer == NULL || points == NULL || workspaces == NULL)
+        status = 1;
+    for(ithread = 0; ithread < nthreads && !status; ithread++)
+        if(!batch_workspace_init(&workspaces[ithread], MagneticModels[epochs], Geoid))
+            status = 1;
+    if(status)
+        MAG_Error(2);
+
+    printf("\n\n 'b' switch: converting file with multiple locations on %d threads.\n", nthreads);
+    if(out_columns)
+        ;
+    else if(use_gradient)
+        fprintf(outfile, "Date Coord-System Altitude Latitude Longitude D_deg D_min I_deg I_min H_nT X_nT Y_nT Z_nT F_nT dD/dt_min dI/dt_min dH/dt_nT dX/dt_nT dY/dt_nT dZ/dt_nT dF/dt_nT dX/dx_nt dY/dx_nt dZ/dx_nt dX/dy_nt dY/dy_nt dZ/dy_nt dX/dz_nt dY/dz_nt dZ/dz_nt\n");
+    else
+        fprintf(outfile, "Date Coord-System Altitude Latitude Longitude D_deg D_min I_deg I_min H_nT X_nT Y_nT Z_nT F_nT dD/dt_min dI/dt_min dH/dt_nT dX/dt_nT dY/dt_nT dZ/dt_nT dF/dt_nT\n");
+
+    while(!status && incolumns.File != NULL)
+    {
+        /* Binary coordinates, a block of rows at a time */
+        npoints = 0;
+        while(npoints < BATCH_POINTS && MAG_ColumnFileReadRow(&incolumns, inrow))
+        {
+            iline++;
+            parse = batch_read_columns(incol, inrow, iline, &points[npoints]);
+            if(parse > 0)
+            {
+                status = 2;
+                break;
+            }
+            if(points[npoints].sdate < minyr || points[npoints].sdate > maxyr)
+                nwarn++;
+            npoints++;
+        }
+        if(npoints < BATCH_POINTS && !status && incolumns.RowsRead < incolumns.NumRows)
+        {
+            printf("\nError: could not read row %1ld of the binary coordinate file\n\n", iline + 1);
+            status = 1;
+        }
+        if(npoints == 0)
+            break;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64) private(ithread)
+#endif
+        for(ipoint = 0; ipoint < npoints; ipoint++)
+        {
+            ithread = 0;
+#ifdef _OPENMP
+            ithread = omp_get_thread_num();
+#endif
+            batch_compute(&workspaces[ithread], &points[ipoint], MagneticModels, epochs, Ellip, use_gradient);
+        }
+        for(ipoint = 0; ipoint < npoints; ipoint++)
+            batch_write_point(outfile, &outcolumns, values, &points[ipoint], use_gradient);
+        nprocessed += npoints;
+    }
+
+    while(!status && coordfile != NULL)
+    {
+        /* Keep the incomplete last line and refill the buffer behind it */
+        memmove(buffer, buffer + pos, len - pos);
+        len -= pos;
+        pos = 0;
+        if(!at_eof)
+        {
+            len += fread(buffer + len, 1, BATCH_BUFFER - len, coordfile);
+            at_eof = len < BATCH_BUFFER;
+        }
+
+        /* Split complete lines into points */
+        npoints = 0;
+        while(npoints < BATCH_POINTS && pos < len)
+        {
+            end = memchr(buffer + pos, '\n', len - pos);
+            if(end == NULL && !at_eof)
+            {
+                if(pos == 0)
+                {
+                    printf("\nError: line %1ld of the coordinate file is too long\n\n", iline + 1);
+                    status = 2;
+                }
+                break;
+            }
+            if(end == NULL)
+                end = buffer + len;
+            *end = '\0';
+            iline++;
+            parse = batch_parse_line(buffer + pos, iline, &points[npoints]);
+            pos = end - buffer + 1;
+            if(pos > len)
+                pos = len;
+            if(parse < 0)
+                continue; /* blank line */
+            if(parse > 0)
+            {
+                status = 2;
+                break;
+            }
+            if(points[npoints].sdate < minyr || points[npoints].sdate > maxyr)
+                nwarn++;
+            npoints++;
+        }
+
+        /* Evaluate the points, each thread with its own workspace */
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64) private(ithread)
+#endif
+        for(ipoint = 0; ipoint < npoints; ipoint++)
+        {
+            ithread = 0;
+#ifdef _OPENMP
+            ithread = omp_get_thread_num();
+#endif
+            batch_compute(&workspaces[ithread], &points[ipoint], MagneticModels, epochs, Ellip, use_gradient);
+        }
+
+        /* Write them in input order */
+        for(ipoint = 0; ipoint < npoints; ipoint++)
+            batch_write_point(outfile, &outcolumns, values, &points[ipoint], use_gradient);
+        nprocessed += npoints;
+
+        if(parse > 0 && outfile != NULL) /* echo the offending line like the 'f' switch */
+            fprintf(outfile, "%s %s %s %s %s ", points[npoints].field[0], points[npoints].field[1], points[npoints].field[2],
+                points[npoints].field[3], points[npoints].field[4]);
+
+        if(at_eof && pos >= len)
+            break;
+    }
+
+    if(nwarn > 0)
+    {
+        printf("\nWarning:  %1ld dates out of range in coordinate file\n", nwarn);
+        printf("\nExpected range = %6.1lf - %6.1lf\n", minyr, maxyr);
+    }
+    printf("\n Processed %1ld lines\n\n", nprocessed);
+    if(status == 2)
+        printf("Terminated prematurely due to argument error in coordinate file\n\n");
+
+    if(coordfile != NULL)
+        fclose(coordfile);
+    MAG_ColumnFileClose(&incolumns);
+    if(((outfile != NULL) ? (fclose(outfile) != 0) : !MAG_ColumnFileClose(&outcolumns)) && !status)
+    {
+        printf("\nError: could not write output file %s\n\n", out_fname);
+        status = 1;
+    }
+    if(workspaces != NULL)
+        for(ithread = 0; ithread < nthreads; ithread++)
+            batch_workspace_free(&workspaces[ithread]);
+    free(workspaces);
+    free(points);
+    free(buffer);
+    free(inrow);
+    return status;
+} /* process_batch_file */
+
+int batch_workspace_init(BATCH_workspace *ws, MAGtype_MagneticModel *MagneticModel, MAGtype_Geoid Geoid)
+/* Copy of the full model, and memory for evaluating it, for one thread */
+{
+    int NumTerms;
+
+    NumTerms = ((MagneticModel->nMax + 1) * (MagneticModel->nMax + 2) / 2);
+    ws->MagneticModel = MAG_AllocateModelMemory(NumTerms);
+    ws->TimedMagneticModel = MAG_AllocateModelMemory(NumTerms);
+    ws->LegendreFunction = MAG_AllocateLegendreFunctionMemory(NumTerms);
+    ws->SphVariables = MAG_AllocateSphVarMemory(MagneticModel->nMax);
+    if(ws->MagneticModel == NULL || ws->TimedMagneticModel == NULL || ws->LegendreFunction == NULL || ws->SphVariables == NULL)
+        return FALSE;
+
+    ws->MagneticModel->EditionDate = MagneticModel->EditionDate;
+    ws->MagneticModel->epoch = MagneticModel->epoch;
+    strcpy(ws->MagneticModel->ModelName, MagneticModel->ModelName);
+    ws->MagneticModel->nMax = MagneticModel->nMax;
+    ws->MagneticModel->nMaxSecVar = MagneticModel->nMaxSecVar;
+    ws->MagneticModel->SecularVariationUsed = MagneticModel->SecularVariationUsed;
+    ws->MagneticModel->CoefficientFileEndDate = MagneticModel->CoefficientFileEndDate;
+    MAG_AssignMagneticModelCoeffs(ws->MagneticModel, MagneticModel, MagneticModel->nMax, MagneticModel->nMaxSecVar);
+
+    ws->Geoid = Geoid;
+    ws->LoadedEpoch = -1;
+    ws->TimedYear = NaN;
+    return TRUE;
+} /* batch_workspace_init */
+
+void batch_workspace_free(BATCH_workspace *ws)
+{
+    if(ws->MagneticModel != NULL)
+        MAG_FreeMagneticModelMemory(ws->MagneticModel);
+    if(ws->TimedMagneticModel != NULL)
+        MAG_FreeMagneticModelMemory(ws->TimedMagneticModel);
+    if(ws->LegendreFunction != NULL)
+        MAG_FreeLegendreMemory(ws->LegendreFunction);
+    if(ws->SphVariables != NULL)
+        MAG_FreeSphVarMemory(ws->SphVariables);
+} /* batch_workspace_free */
+
+int batch_parse_line(char *line, long iline, BATCH_point *p)
+/* Splits a line of the coordinate file in place into its five entries and reads them; */
+/* -1 for a blank line, 0 on success, 1 (after printing the error) for a bad line */
+{
+    int nfield = 0, units, year, month, day;
+    double minalt = -10, maxalt = 1000; /* km, as in main */
+    char *s = line, *end;
+
+    double julday();
+
+    while(nfield < 5)
+    {
+        while(isspace((unsigned char) *s))
+            s++;
+        if(*s == '\0')
+            break;
+        p->field[nfield++] = s;
+        while(*s != '\0' && !isspace((unsigned char) *s))
+            s++;
+        if(*s != '\0')
+            *s++ = '\0';
+    }
+    if(nfield == 0)
+        return -1;
+    while(nfield < 5)
+        p->field[nfield++] = "";
+    if(*(p->field[4]) == '\0')
+    {
+        printf("\nError: expected date, coordinate system, altitude, latitude and longitude in coordinate file line %1ld\n\n", iline);
+        return 1;
+    }
+
+    /* Date, decimal or year,month,day */
+    if(strchr(p->field[0], '-'))
+    {
+        printf("Error in line %1ld, date = %s: date ranges not allowed for file option\n\n", iline, p->field[0]);
+        return 1;
+    }
+    if(strchr(p->field[0], ','))
+    {
+        month = day = 0;
+        if(sscanf(p->field[0], "%d,%d,%d", &year, &month, &day) < 2 || month < 1 || month > 12 || day < 0 || day > 31)
+        {
+            printf("\nError: unrecognized date %s in coordinate file line %1ld\n\n", p->field[0], iline);
+            return 1;
+        }
+        p->sdate = julday(month, day, year);
+    } else
+    {
+        p->sdate = strtod(p->field[0], &end);
+        if(*end != '\0' || p->sdate == 0)
+        {
+            printf("\nError: unrecognized date %s in coordinate file line %1ld\n\n", p->field[0], iline);
+            return 1;
+        }
+    }
+
+    /* Height reference */
+    if(toupper(*(p->field[1])) == 'M')
+        p->igdgc = 1; /* height is above  mean sea level*/
+    else if(toupper(*(p->field[1])) == 'E')
+        p->igdgc = 2; /* height is above  WGS 84 ellepsoid */
+    else
+    {
+        printf("\nError: Unrecognized height reference %s in coordinate file line %1ld\n\n", p->field[1], iline);
+        return 1;
+    }
+
+    /* Altitude, converted to km */
+    units = toupper(*(p->field[2]));
+    p->alt = strtod(p->field[2] + 1, &end);
+    if(units == 'M')
+    {
+        minalt *= 1000.0;
+        maxalt *= 1000.0;
+    } else if(units == 'F')
+    {
+        minalt *= 3280.0839895;
+        maxalt *= 3280.0839895;
+    }
+    if((units != 'K' && units != 'M' && units != 'F') || end == p->field[2] + 1 || *end != '\0' ||
+            p->alt < minalt || p->alt > maxalt)
+    {
+        printf("\nError: unrecognized altitude %s in coordinate file line %1ld\n\n", p->field[2], iline);
+        return 1;
+    }
+    if(units == 'M')
+        p->alt *= 0.001;
+    else if(units == 'F')
+        p->alt /= 3280.0839895;
+
+    /* Decimal latitude and longitude */
+    p->latitude = strtod(p->field[3], &end);
+    if(end == p->field[3] || *end != '\0')
+        end = NULL;
+    else
+    {
+        p->longitude = strtod(p->field[4], &end);
+        if(end == p->field[4] || *end != '\0')
+            end = NULL;
+    }
+    if(end == NULL)
+    {
+        printf("\nError: unrecognized lat %s or lon %s in coordinate file line %1ld\n\n", p->field[3], p->field[4], iline);
+        return 1;
+    }
+    return 0;
+} /* batch_parse_line */
+
+int batch_read_columns(int incol[4], double *values, long iline, BATCH_point *p)
+/* Reads a row of a binary coordinate file into a point; 0 on success, 1 (after printing the error) for a bad row */
+{
+    p->field[0] = NULL;
+    p->sdate = values[incol[0]];
+    p->latitude = values[incol[1]];
+    p->longitude = values[incol[2]];
+    p->igdgc = (incol[3] >= 0) ? 2 : 1;
+    p->alt = values[(incol[3] >= 0) ? incol[3] : -2 - incol[3]];
+    if(!(p->sdate > 0) || !(p->alt >= -10 && p->alt <= 1000) || !(p->latitude >= -90 && p->latitude <= 90) ||
+            !(p->longitude >= -360 && p->longitude <= 360))
+    {
+        printf("\nError: date %g, altitude %g km, lat %g or lon %g out of range in coordinate file row %1ld\n\n",
+                p->sdate, p->alt, p->latitude, p->longitude, iline);
+        return 1;
+    }
+    return 0;
+} /* batch_read_columns */
+
+void batch_write_point(FILE *outfile, MAGtype_ColumnFile *outcolumns, double *values, BATCH_point *p, int use_gradient)
+/* Writes the results of a point as a text line, or as a row of binary columns if outfile is NULL */
+{
+    void print_result_file(FILE *outf, double d, double i, double h, double x, double y, double z, double f,
+            double ddot, double idot, double hdot, double xdot, double ydot, double zdot, double fdot);
+    void print_result_file_gradient(FILE *outf, MAGtype_GeoMagneticElements Output, MAGtype_Gradient OutputGradient);
+
+    if(outfile == NULL)
+    {
+        values[0] = p->sdate;
+        values[1] = p->latitude;
+        values[2] = p->longitude;
+        values[3] = p->HeightAboveEllipsoid;
+        values[4] = p->GeoMagneticElements.Decl;
+        values[5] = p->GeoMagneticElements.Incl;
+        values[6] = p->GeoMagneticElements.H;
+        values[7] = p->GeoMagneticElements.X;
+        values[8] = p->GeoMagneticElements.Y;
+        values[9] = p->GeoMagneticElements.Z;
+        values[10] = p->GeoMagneticElements.F;
+        values[11] = 60 * p->GeoMagneticElements.Decldot;
+        values[12] = 60 * p->GeoMagneticElements.Incldot;
+        values[13] = p->GeoMagneticElements.Hdot;
+        values[14] = p->GeoMagneticElements.Xdot;
+        values[15] = p->GeoMagneticElements.Ydot;
+        values[16] = p->GeoMagneticElements.Zdot;
+        values[17] = p->GeoMagneticElements.Fdot;
+        if(use_gradient)
+        {
+            values[18] = p->Gradient.GradPhi.X;
+            values[19] = p->Gradient.GradPhi.Y;
+            values[20] = p->Gradient.GradPhi.Z;
+            values[21] = p->Gradient.GradLambda.X;
+            values[22] = p->Gradient.GradLambda.Y;
+            values[23] = p->Gradient.GradLambda.Z;
+            values[24] = p->Gradient.GradZ.X;
+            values[25] = p->Gradient.GradZ.Y;
+            values[26] = p->Gradient.GradZ.Z;
+        }
+        MAG_ColumnFileWriteRow(outcolumns, values);
+        return;
+    }
+
+    if(p->field[0] != NULL)
+        fprintf(outfile, "%s %s %s %s %s ", p->field[0], p->field[1], p->field[2], p->field[3], p->field[4]);
+    else
+        fprintf(outfile, "%.4lf %c K%.4lf %.6lf %.6lf ", p->sdate, (p->igdgc == 1) ? 'M' : 'E', p->alt, p->latitude, p->longitude);
+    if(use_gradient)
+        print_result_file_gradient(outfile, p->GeoMagneticElements, p->Gradient);
+    else
+        print_result_file(outfile,
+            p->GeoMagneticElements.Decl,
+            p->GeoMagneticElements.Incl,
+            p->GeoMagneticElements.H,
+            p->GeoMagneticElements.X,
+            p->GeoMagneticElements.Y,
+            p->GeoMagneticElements.Z,
+            p->GeoMagneticElements.F,
+            60 * p->GeoMagneticElements.Decldot,
+            60 * p->GeoMagneticElements.Incldot,
+            p->GeoMagneticElements.Hdot,
+            p->GeoMagneticElements.Xdot,
+            p->GeoMagneticElements.Ydot,
+            p->GeoMagneticElements.Zdot,
+            p->GeoMagneticElements.Fdot);
+} /* batch_write_point */
+
+void batch_compute(BATCH_workspace *ws, BATCH_point *p, MAGtype_MagneticModel *MagneticModels[], int epochs, MAGtype_Ellipsoid Ellip, int use_gradient)
+/* The computation of main for one point, with the models and memory of a workspace */
+{
+    MAGtype_CoordSpherical CoordSpherical;
+    MAGtype_CoordGeodetic CoordGeodetic;
+    MAGtype_Date UserDate;
+    MAGtype_MagneticResults MagneticResultsSph, MagneticResultsGeo, MagneticResultsSphVar, MagneticResultsGeoVar;
+    int Epoch, nMax;
+
+    CoordGeodetic.lambda = p->longitude;
+    CoordGeodetic.phi = p->latitude;
+    CoordGeodetic.HeightAboveGeoid = p->alt;
+    CoordGeodetic.UseGeoid = ws->Geoid.UseGeoid = (p->igdgc == 1);
+    UserDate.DecimalYear = p->sdate;
+
+    Epoch = ((int) UserDate.DecimalYear - MagneticModels[0]->epoch);
+    if(Epoch < 0) Epoch = 0;
+    if(Epoch > epochs - 1) Epoch = epochs - 1;
+    if(ws->LoadedEpoch != Epoch)
+    {
+        ws->MagneticModel->epoch = MagneticModels[Epoch]->epoch;
+        MAG_AssignMagneticModelCoeffs(ws->MagneticModel, MagneticModels[Epoch], MagneticModels[Epoch]->nMax, MagneticModels[Epoch]->nMaxSecVar);
+        ws->LoadedEpoch = Epoch;
+        ws->TimedYear = NaN;
+    }
+    MAG_ConvertGeoidToEllipsoidHeight(&CoordGeodetic, &ws->Geoid);
+    p->HeightAboveEllipsoid = CoordGeodetic.HeightAboveEllipsoid;
+    MAG_GeodeticToSpherical(Ellip, CoordGeodetic, &CoordSpherical);
+
+    /* Logged coordinates often share a date, so the time adjusted model is kept */
+    if(UserDate.DecimalYear != ws->TimedYear)
+    {
+        MAG_TimelyModifyMagneticModel(UserDate, ws->MagneticModel, ws->TimedMagneticModel);
+        ws->TimedYear = UserDate.DecimalYear;
+    }
+
+    /* MAG_Geomag without allocating the Legendre functions for every point */
+    nMax = ws->TimedMagneticModel->nMax;
+    MAG_ComputeSphericalHarmonicVariables(Ellip, CoordSpherical, nMax, ws->SphVariables);
+    MAG_AssociatedLegendreFunction(CoordSpherical, nMax, ws->LegendreFunction);
+    MAG_Summation(ws->LegendreFunction, ws->TimedMagneticModel, *ws->SphVariables, CoordSpherical, &MagneticResultsSph);
+    MAG_SecVarSummation(ws->LegendreFunction, ws->TimedMagneticModel, *ws->SphVariables, CoordSpherical, &MagneticResultsSphVar);
+    MAG_RotateMagneticVector(CoordSpherical, CoordGeodetic, MagneticResultsSph, &MagneticResultsGeo);
+    MAG_RotateMagneticVector(CoordSpherical, CoordGeodetic, MagneticResultsSphVar, &MagneticResultsGeoVar);
+    MAG_CalculateGeoMagneticElements(&MagneticResultsGeo, &p->GeoMagneticElements);
+    MAG_CalculateSecularVariationElements(MagneticResultsGeoVar, &p->GeoMagneticElements);
+    MAG_CalculateGridVariation(CoordGeodetic, &p->GeoMagneticElements);
+
+    if(use_gradient)
+        MAG_Gradient(Ellip, CoordGeodetic, ws->TimedMagneticModel, &p->Gradient);
+} /* batch_compute */
+
 /****************************************************************************/
 /*                                                                          */
 /*                       Subroutine degrees_to_decimal                      */
@@ -3,9 +3,13 @@
 #include <string.h>
 #include <math.h>
 #include <stdlib.h>
+#include <ctype.h>
 
 #include "GeomagnetismHeader.h"
 #include "EGM9615.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /*
  *
@@ -17,8 +21,37 @@
  */
 
 
+#define NaN log(-1.0)
+#define GRID_LINE 1024              /* Longest line of a jobs file */
+#define GRID_OUTBUFFER (1 << 20)    /* Output buffer of a text shard */
+#define GRID_MAX_SHARDS 1000        /* Shards of a job, named with a three digit suffix */
 
-int main()
+typedef struct {
+    MAGtype_CoordGeodetic minimum, maximum;
+    double cord_step_size, altitude_step_size, time_step_size;
+    MAGtype_Date startdate, enddate;
+    int UseGeoid; /* 1 for heights above MSL, 0 above the WGS-84 ellipsoid */
+    int ElementOption; /* as returned by MAG_GetUserGrid, or 26 for all gradients */
+    int PrintOption; /* 1 text, 3 float64 or 4 float32 columns, as in MAG_GetUserGrid */
+    int shards; /* number of output files, each with a band of latitude rows */
+    int nrows; /* latitude rows of the grid */
+    int line; /* line of the jobs file */
+    long npoints; /* points written */
+    int status; /* FALSE if a shard failed */
+    char *OutputFilename;
+} GRID_job; /* a grid of the jobs file */
+
+typedef struct {
+    MAGtype_MagneticModel *MagneticModel; /* the full model with the main field of LoadedEpoch, as MagneticModels[epochs] in main */
+    MAGtype_MagneticModel *TimedMagneticModel; /* MagneticModel at TimedYear */
+    MAGtype_LegendreFunction *LegendreFunction;
+    MAGtype_SphericalHarmonicVariables *SphVariables;
+    int LoadedEpoch;
+    double TimedYear; /* NaN if TimedMagneticModel is not up to date */
+} GRID_workspace; /* per thread memory of the jobs runner */
+
+
+int main(int argc, char **argv)
 {
     MAGtype_MagneticModel * MagneticModels[17], *TimedMagneticModel;
     MAGtype_Ellipsoid Ellip;
@@ -31,7 +64,7 @@ int main()
     MAGtype_MagneticResults MagneticResultsSph, MagneticResultsSphVar, MagneticResultsGeo, MagneticResultsGeoVar;
     MAGtype_GeoMagneticElements GeoMagneticElements;
     int ElementOption, PrintOption, i, Epoch, nMaxEMM, NumTerms, LoadedEpoch = -1, nMax, index;
-    int PrintFullGradient = 0;
+    int PrintFullGradient = 0, status;
     const int epochs = 16;
     double cord_step_size, altitude_step_size, time_step_size, a, b, c, d, PrintElement = 1;
     char filename[] = "EMM2015.COF";
@@ -42,6 +75,11 @@ int main()
     char ans[20];
     FILE *fileout;
     MAGtype_Gradient Gradient;
+    MAGtype_ColumnFile ColumnFile;
+    int process_grid_jobs(char *jobs_fname, MAGtype_MagneticModel *MagneticModels[], int epochs, MAGtype_Ellipsoid Ellip, MAGtype_Geoid Geoid);
+    char *ColumnNames[13] = {"Latitude", "Longitude", "HeightAboveGeoid", "DecimalYear",
+        "dX/dphi", "dY/dphi", "dZ/dphi", "dX/dlambda", "dY/dlambda", "dZ/dlambda", "dX/dz", "dY/dz", "dZ/dz"};
+    double ColumnValues[13];
 
     strncpy(VersionDate, VersionDate_Large + 39, 11);
     VersionDate[11] = '\0';
@@ -78,6 +116,16 @@ int main()
     Geoid.Geoid_Initialized = 1;
     /* Set EGM96 Geoid parameters END */
 
+    if(argc == 2) /* emm_sph_grid jobs_file: run the grids of a file without prompts */
+    {
+        status = process_grid_jobs(argv[1], MagneticModels, epochs, Ellip, Geoid);
+        for(i = 0; i < epochs + 1; i++) MAG_FreeMagneticModelMemory(MagneticModels[i]);
+        MAG_FreeMagneticModelMemory(TimedMagneticModel);
+        MAG_FreeLegendreMemory(LegendreFunction);
+        MAG_FreeSphVarMemory(SphVariables);
+        return status;
+    }
+
     printf("\n\n Welcome to the Enhanced Magnetic Model (EMM) C-Program\n");
     printf("of the US National Geophysical Data Center\n");
     printf("\t\t--- Grid Calculation Program ----\n\t     --- Model Release Year: %d ---\n\t     --- Software Release Date: %s ---\n", (int)MagneticModels[epochs-1]->epoch, VersionDate);
@@ -99,6 +147,17 @@ int main()
             printf("Error opening %s to write", OutputFilename);
             return FALSE;
         }
+    } else if(PrintOption == 3 || PrintOption == 4) /* binary columns, float64 or float32 */
+    {
+        if(Geoid.UseGeoid != 1)
+            ColumnNames[2] = "HeightAboveEllipsoid";
+        if(ElementOption != 26)
+            ColumnNames[4] = MAG_GridElementName(ElementOption);
+        if(!MAG_ColumnFileCreate(OutputFilename, (ElementOption == 26) ? 13 : 5, ColumnNames, (PrintOption == 3) ? 8 : 4, &ColumnFile))
+        {
+            printf("Error opening %s to write", OutputFilename);
+            return FALSE;
+        }
     }
 
     if(fabs(cord_step_size) < 1.0e-10) cord_step_size = 99999.0; //checks to make sure that the step_size is not too small
@@ -239,7 +298,27 @@ int main()
                     }
 
 
-                    if(PrintFullGradient == 1)
+                    if(PrintOption == 3 || PrintOption == 4)
+                    {
+                        ColumnValues[0] = minimum.phi;
+                        ColumnValues[1] = minimum.lambda;
+                        ColumnValues[2] = (Geoid.UseGeoid == 1) ? minimum.HeightAboveGeoid : minimum.HeightAboveEllipsoid;
+                        ColumnValues[3] = startdate.DecimalYear;
+                        ColumnValues[4] = PrintElement;
+                        if(ElementOption == 26)
+                        {
+                            ColumnValues[4] = Gradient.GradPhi.X;
+                            ColumnValues[5] = Gradient.GradPhi.Y;
+                            ColumnValues[6] = Gradient.GradPhi.Z;
+                            ColumnValues[7] = Gradient.GradLambda.X;
+                            ColumnValues[8] = Gradient.GradLambda.Y;
+                            ColumnValues[9] = Gradient.GradLambda.Z;
+                            ColumnValues[10] = Gradient.GradZ.X;
+                            ColumnValues[11] = Gradient.GradZ.Y;
+                            ColumnValues[12] = Gradient.GradZ.Z;
+                        }
+                        MAG_ColumnFileWriteRow(&ColumnFile, ColumnValues);
+                    } else if(PrintFullGradient == 1)
                     {
                         if(Geoid.UseGeoid == 1)
                         {
@@ -279,6 +358,8 @@ int main()
 
     } /* Altitude Loop */
     if(PrintOption == 1) fclose(fileout);
+    if((PrintOption == 3 || PrintOption == 4) && !MAG_ColumnFileClose(&ColumnFile))
+        printf("Error writing %s\n", OutputFilename);
 
     for(i = 0; i < epochs + 1; i++) MAG_FreeMagneticModelMemory(MagneticModels[i]);
     MAG_FreeMagneticModelMemory(TimedMagneticModel);
@@ -293,3 +374,391 @@ int main()
     return 0;
 }
 
+/****************************************************************************/
+/*                                                                          */
+/*                       Subroutine process_grid_jobs                       */
+/*                                                                          */
+/****************************************************************************/
+/*                                                                          */
+/*     Non-interactive grids: emm_sph_grid jobs_file runs every grid of     */
+/*     the jobs file ("-" for standard input) with the models loaded once.  */
+/*     Each line holds the answers to the MAG_GetUserGrid prompts:          */
+/*                                                                          */
+/*     minlat maxlat minlon maxlon step M|E minalt maxalt altstep           */
+/*         startyear endyear yearstep element output [format] [shards]      */
+/*                                                                          */
+/*     with M for heights above MSL and E above the WGS-84 ellipsoid (km),  */
+/*     element 1 to 16 as prompted, 17 to 25 for the gradients dX/dphi to   */
+/*     dZ/dz or 26 for all nine, format txt (default), f64 or f32, and      */
+/*     shards the number of output files the grid is split into along      */
+/*     latitude (default 1, at most 1000), named output.000, output.001,    */
+/*     ... Blank lines and lines starting with # are skipped.               */
+/*                                                                          */
+/*     The shards of all jobs are run in parallel when compiled with        */
+/*     OpenMP, each thread with its own copy of the model.                  */
+/*                                                                          */
+/*     Output:                                                              */
+/*           0 on success, 1 on file or memory errors, 2 on input errors    */
+/*                                                                          */
+
+/****************************************************************************/
+
+int process_grid_jobs(char *jobs_fname, MAGtype_MagneticModel *MagneticModels[], int epochs, MAGtype_Ellipsoid Ellip, MAGtype_Geoid Geoid)
+{
+    GRID_job *jobs = NULL, *grown;
+    GRID_workspace *workspaces;
+    FILE *jobsfile;
+    char line[GRID_LINE], height[2], OutputFilename[GRID_LINE], format[GRID_LINE];
+    int njobs = 0, maxjobs = 0, iline = 0, nfields, ijob, nunits, iunit, ithread, nthreads = 1, status = 0;
+    int *unitjob, *unitshard;
+    double phi;
+    GRID_job job;
+
+    int grid_workspace_init(GRID_workspace *ws, MAGtype_MagneticModel *MagneticModel);
+    void grid_workspace_free(GRID_workspace *ws);
+    int grid_job_shard(GRID_workspace *ws, GRID_job *job, int shard, MAGtype_MagneticModel *MagneticModels[], int epochs,
+            MAGtype_Ellipsoid Ellip, MAGtype_Geoid Geoid);
+
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+
+    jobsfile = (strcmp(jobs_fname, "-") == 0) ? stdin : fopen(jobs_fname, "r");
+    if(jobsfile == NULL)
+    {
+        printf("\nError: could not open jobs file %s\n\n", jobs_fname);
+        return 1;
+    }
+
+    /* Read and check all jobs before running any */
+    while(fgets(line, GRID_LINE, jobsfile) != NULL)
+    {
+        iline++;
+        memset(&job, 0, sizeof (job));
+        strcpy(format, "txt");
+        job.shards = 1;
+        nfields = sscanf(line, "%lf %lf %lf %lf %lf %1s %lf %lf %lf %lf %lf %lf %d %s %s %d",
+                &job.minimum.phi, &job.maximum.phi, &job.minimum.lambda, &job.maximum.lambda, &job.cord_step_size, height,
+                &job.minimum.HeightAboveGeoid, &job.maximum.HeightAboveGeoid, &job.altitude_step_size,
+                &job.startdate.DecimalYear, &job.enddate.DecimalYear, &job.time_step_size,
+                &job.ElementOption, OutputFilename, format, &job.shards);
+        if(nfields <= 0 || line[strspn(line, " \t")] == '#')
+            continue;
+        job.line = iline;
+        job.status = TRUE;
+        job.PrintOption = (strcmp(format, "f64") == 0) ? 3 : (strcmp(format, "f32") == 0) ? 4 : (strcmp(format, "txt") == 0) ? 1 : 0;
+        if(nfields < 14 || (toupper(height[0]) != 'M' && toupper(height[0]) != 'E') || job.PrintOption == 0 ||
+                job.shards < 1 || job.shards > GRID_MAX_SHARDS ||
+                job.ElementOption < 1 || job.ElementOption > 26 || job.minimum.phi < -90 || job.maximum.phi > 90 ||
+                job.minimum.phi > job.maximum.phi || job.minimum.lambda > job.maximum.lambda ||
+                job.minimum.HeightAboveGeoid > job.maximum.HeightAboveGeoid || job.startdate.DecimalYear > job.enddate.DecimalYear ||
+                job.cord_step_size < 0 || job.altitude_step_size < 0 || job.time_step_size < 0)
+        {
+            printf("\nError: could not read the grid in line %d of the jobs file:\n%s\n", iline, line);
+            status = 2;
+            break;
+        }
+        job.UseGeoid = (toupper(height[0]) == 'M');
+        if(fabs(job.cord_step_size) < 1.0e-10) job.cord_step_size = 99999.0; /* as in main */
+        if(fabs(job.altitude_step_size) < 1.0e-10) job.altitude_step_size = 99999.0;
+        if(fabs(job.time_step_size) < 1.0e-10) job.time_step_size = 99999.0;
+        for(phi = job.minimum.phi; phi <= job.maximum.phi; phi += job.cord_step_size)
+            job.nrows++;
+        if(job.shards > job.nrows)
+            job.shards = job.nrows;
+        job.OutputFilename = malloc(strlen(OutputFilename) + 5);
+        if(njobs == maxjobs)
+        {
+            maxjobs = 2 * maxjobs + 16;
+            grown = realloc(jobs, maxjobs * sizeof (GRID_job));
+            if(grown == NULL)
+                free(job.OutputFilename);
+            else
+                jobs = grown;
+        }
+        if(job.OutputFilename == NULL || njobs == maxjobs || jobs == NULL)
+        {
+            status = 1;
+            break;
+        }
+        strcpy(job.OutputFilename, OutputFilename);
+        jobs[njobs++] = job;
+    }
+    if(jobsfile != stdin)
+        fclose(jobsfile);
+
+    /* One unit of work per shard, shards of the same job next to each other */
+    nunits = 0;
+    for(ijob = 0; ijob < njobs; ijob++)
+        nunits += jobs[ijob].shards;
+    unitjob = malloc((nunits + 1) * sizeof (int));
+    unitshard = malloc((nunits + 1) * sizeof (int));
+    workspaces = calloc(nthreads, sizeof (GRID_workspace));
+    if(unitjob == NULL || unitshard == NULL || workspaces == NULL)
+        status = 1;
+    for(ithread = 0; ithread < nthreads && !status; ithread++)
+        if(!grid_workspace_init(&workspaces[ithread], MagneticModels[epochs]))
+            status = 1;
+    if(status == 1)
+        MAG_Error(2);
+
+    if(!status)
+    {
+        nunits = 0;
+        for(ijob = 0; ijob < njobs; ijob++)
+            for(iunit = 0; iunit < jobs[ijob].shards; iunit++)
+            {
+                unitjob[nunits] = ijob;
+                unitshard[nunits++] = iunit;
+            }
+        printf("\n Running %d grids in %d files on %d threads\n", njobs, nunits, nthreads);
+        fflush(stdout);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) private(ithread)
+#endif
+        for(iunit = 0; iunit < nunits; iunit++)
+        {
+            ithread = 0;
+#ifdef _OPENMP
+            ithread = omp_get_thread_num();
+#endif
+            grid_job_shard(&workspaces[ithread], &jobs[unitjob[iunit]], unitshard[iunit], MagneticModels, epochs, Ellip, Geoid);
+        }
+
+        for(ijob = 0; ijob < njobs; ijob++)
+        {
+            if(jobs[ijob].status)
+                printf(" line %d: %ld points to %s%s\n", jobs[ijob].line, jobs[ijob].npoints, jobs[ijob].OutputFilename,
+                    (jobs[ijob].shards > 1) ? ".000 ..." : "");
+            else
+            {
+                printf(" line %d: Error writing %s\n", jobs[ijob].line, jobs[ijob].OutputFilename);
+                status = 1;
+            }
+        }
+    }
+
+    if(workspaces != NULL)
+        for(ithread = 0; ithread < nthreads; ithread++)
+            grid_workspace_free(&workspaces[ithread]);
+    free(workspaces);
+    free(unitjob);
+    free(unitshard);
+    for(ijob = 0; ijob < njobs; ijob++)
+        free(jobs[ijob].OutputFilename);
+    free(jobs);
+    return status;
+} /* process_grid_jobs */
+
+int grid_workspace_init(GRID_workspace *ws, MAGtype_MagneticModel *MagneticModel)
+/* Copy of the full model, and memory for evaluating it, for one thread */
+{
+    int NumTerms;
+
+    NumTerms = ((MagneticModel->nMax + 1) * (MagneticModel->nMax + 2) / 2);
+    ws->MagneticModel = MAG_AllocateModelMemory(NumTerms);
+    ws->TimedMagneticModel = MAG_AllocateModelMemory(NumTerms);
+    ws->LegendreFunction = MAG_AllocateLegendreFunctionMemory(NumTerms);
+    ws->SphVariables = MAG_AllocateSphVarMemory(MagneticModel->nMax);
+    if(ws->MagneticModel == NULL || ws->TimedMagneticModel == NULL || ws->LegendreFunction == NULL || ws->SphVariables == NULL)
+        return FALSE;
+
+    ws->MagneticModel->epoch = MagneticModel->epoch;
+    ws->MagneticModel->nMax = MagneticModel->nMax;
+    ws->MagneticModel->nMaxSecVar = MagneticModel->nMaxSecVar;
+    ws->MagneticModel->SecularVariationUsed = MagneticModel->SecularVariationUsed;
+    MAG_AssignMagneticModelCoeffs(ws->MagneticModel, MagneticModel, MagneticModel->nMax, MagneticModel->nMaxSecVar);
+    ws->LoadedEpoch = -1;
+    ws->TimedYear = NaN;
+    return TRUE;
+} /* grid_workspace_init */
+
+void grid_workspace_free(GRID_workspace *ws)
+{
+    if(ws->MagneticModel != NULL)
+        MAG_FreeMagneticModelMemory(ws->MagneticModel);
+    if(ws->TimedMagneticModel != NULL)
+        MAG_FreeMagneticModelMemory(ws->TimedMagneticModel);
+    if(ws->LegendreFunction != NULL)
+        MAG_FreeLegendreMemory(ws->LegendreFunction);
+    if(ws->SphVariables != NULL)
+        MAG_FreeSphVarMemory(ws->SphVariables);
+} /* grid_workspace_free */
+
+int grid_job_shard(GRID_workspace *ws, GRID_job *job, int shard, MAGtype_MagneticModel *MagneticModels[], int epochs,
+        MAGtype_Ellipsoid Ellip, MAGtype_Geoid Geoid)
+/* The grid loops of main over one band of latitude rows of a job, written to its own file */
+{
+    MAGtype_CoordGeodetic minimum = job->minimum, maximum = job->maximum;
+    MAGtype_CoordSpherical CoordSpherical;
+    MAGtype_Date startdate = job->startdate;
+    MAGtype_MagneticResults MagneticResultsSph, MagneticResultsSphVar, MagneticResultsGeo, MagneticResultsGeoVar;
+    MAGtype_GeoMagneticElements GeoMagneticElements;
+    MAGtype_Gradient Gradient;
+    MAGtype_ColumnFile ColumnFile;
+    FILE *fileout = NULL;
+    char *fname, *ColumnNames[13] = {"Latitude", "Longitude", "HeightAboveGeoid", "DecimalYear",
+        "dX/dphi", "dY/dphi", "dZ/dphi", "dX/dlambda", "dY/dlambda", "dZ/dlambda", "dX/dz", "dY/dz", "dZ/dz"};
+    double ColumnValues[13], PrintElement;
+    int Epoch, nMax = ws->MagneticModel->nMax, i, index, row, row0, row1, ok = TRUE;
+    long npoints = 0;
+
+    row0 = (int) ((long) job->nrows * shard / job->shards);
+    row1 = (int) ((long) job->nrows * (shard + 1) / job->shards);
+    fname = malloc(strlen(job->OutputFilename) + 5);
+    if(fname == NULL)
+        ok = FALSE;
+    else if(job->shards > 1)
+        sprintf(fname, "%s.%03d", job->OutputFilename, shard); /* shard < GRID_MAX_SHARDS, fits the 5 extra bytes */
+    else
+        strcpy(fname, job->OutputFilename);
+
+    Geoid.UseGeoid = job->UseGeoid;
+    if(!job->UseGeoid)
+        ColumnNames[2] = "HeightAboveEllipsoid";
+    if(job->ElementOption != 26)
+        ColumnNames[4] = MAG_GridElementName(job->ElementOption);
+    if(!ok)
+        ;
+    else if(job->PrintOption == 1)
+    {
+        fileout = fopen(fname, "w");
+        if(fileout == NULL)
+            ok = FALSE;
+        else
+            setvbuf(fileout, NULL, _IOFBF, GRID_OUTBUFFER);
+    } else if(!MAG_ColumnFileCreate(fname, (job->ElementOption == 26) ? 13 : 5, ColumnNames, (job->PrintOption == 3) ? 8 : 4, &ColumnFile))
+        ok = FALSE;
+
+    for(minimum.HeightAboveGeoid = job->minimum.HeightAboveGeoid; ok && minimum.HeightAboveGeoid <= maximum.HeightAboveGeoid; minimum.HeightAboveGeoid += job->altitude_step_size) /* Altitude loop*/
+    {
+        for(row = 0, minimum.phi = job->minimum.phi; minimum.phi <= maximum.phi; minimum.phi += job->cord_step_size, row++) /*Latitude loop*/
+        {
+            if(row < row0 || row >= row1)
+                continue; /* another shard */
+            for(minimum.lambda = job->minimum.lambda; minimum.lambda <= maximum.lambda; minimum.lambda += job->cord_step_size) /*Longitude loop*/
+            {
+                if(Geoid.UseGeoid == 1)
+                    MAG_ConvertGeoidToEllipsoidHeight(&minimum, &Geoid);
+                else
+                    minimum.HeightAboveEllipsoid = minimum.HeightAboveGeoid;
+                MAG_GeodeticToSpherical(Ellip, minimum, &CoordSpherical);
+                MAG_ComputeSphericalHarmonicVariables(Ellip, CoordSpherical, nMax, ws->SphVariables);
+                MAG_AssociatedLegendreFunction(CoordSpherical, nMax, ws->LegendreFunction);
+
+                for(startdate.DecimalYear = job->startdate.DecimalYear; startdate.DecimalYear <= job->enddate.DecimalYear; startdate.DecimalYear += job->time_step_size) /*Year loop*/
+                {
+                    Epoch = ((int) startdate.DecimalYear - MagneticModels[0]->epoch);
+                    if(Epoch < 0) Epoch = 0;
+                    if(Epoch > epochs - 1) Epoch = epochs - 1;
+                    if(ws->LoadedEpoch != Epoch)
+                    {
+                        ws->MagneticModel->epoch = MagneticModels[Epoch]->epoch;
+                        MAG_AssignMagneticModelCoeffs(ws->MagneticModel, MagneticModels[Epoch], MagneticModels[Epoch]->nMax, MagneticModels[Epoch]->nMaxSecVar);
+                        if(Epoch < epochs - 1)
+                        {
+                            for(i = 0; i < 16; i++)
+                            {
+                                index = 16 * 17 / 2 + i;
+                                ws->MagneticModel->Secular_Var_Coeff_G[index] = 0;
+                                ws->MagneticModel->Secular_Var_Coeff_H[index] = 0;
+                            }
+                        }
+                        ws->LoadedEpoch = Epoch;
+                        ws->TimedYear = NaN;
+                    }
+                    /* The rows of a grid share their dates, so the time adjusted model is kept */
+                    if(startdate.DecimalYear != ws->TimedYear)
+                    {
+                        MAG_TimelyModifyMagneticModel(startdate, ws->MagneticModel, ws->TimedMagneticModel);
+                        ws->TimedYear = startdate.DecimalYear;
+                    }
+                    MAG_Summation(ws->LegendreFunction, ws->TimedMagneticModel, *ws->SphVariables, CoordSpherical, &MagneticResultsSph);
+                    MAG_SecVarSummation(ws->LegendreFunction, ws->TimedMagneticModel, *ws->SphVariables, CoordSpherical, &MagneticResultsSphVar);
+                    MAG_RotateMagneticVector(CoordSpherical, minimum, MagneticResultsSph, &MagneticResultsGeo);
+                    MAG_RotateMagneticVector(CoordSpherical, minimum, MagneticResultsSphVar, &MagneticResultsGeoVar);
+                    MAG_CalculateGeoMagneticElements(&MagneticResultsGeo, &GeoMagneticElements);
+                    MAG_CalculateSecularVariationElements(MagneticResultsGeoVar, &GeoMagneticElements);
+
+                    if(job->ElementOption >= 17)
+                        MAG_Gradient(Ellip, minimum, ws->TimedMagneticModel, &Gradient);
+
+                    switch(job->ElementOption) {
+                        case 2: PrintElement = GeoMagneticElements.Incl; break;
+                        case 3: PrintElement = GeoMagneticElements.F; break;
+                        case 4: PrintElement = GeoMagneticElements.H; break;
+                        case 5: PrintElement = GeoMagneticElements.X; break;
+                        case 6: PrintElement = GeoMagneticElements.Y; break;
+                        case 7: PrintElement = GeoMagneticElements.Z; break;
+                        case 8: PrintElement = GeoMagneticElements.GV; break;
+                        case 9: PrintElement = GeoMagneticElements.Decldot; break;
+                        case 10: PrintElement = GeoMagneticElements.Incldot; break;
+                        case 11: PrintElement = GeoMagneticElements.Fdot; break;
+                        case 12: PrintElement = GeoMagneticElements.Hdot; break;
+                        case 13: PrintElement = GeoMagneticElements.Xdot; break;
+                        case 14: PrintElement = GeoMagneticElements.Ydot; break;
+                        case 15: PrintElement = GeoMagneticElements.Zdot; break;
+                        case 16: PrintElement = GeoMagneticElements.GVdot; break;
+                        case 17: PrintElement = Gradient.GradPhi.X; break;
+                        case 18: PrintElement = Gradient.GradPhi.Y; break;
+                        case 19: PrintElement = Gradient.GradPhi.Z; break;
+                        case 20: PrintElement = Gradient.GradLambda.X; break;
+                        case 21: PrintElement = Gradient.GradLambda.Y; break;
+                        case 22: PrintElement = Gradient.GradLambda.Z; break;
+                        case 23: PrintElement = Gradient.GradZ.X; break;
+                        case 24: PrintElement = Gradient.GradZ.Y; break;
+                        case 25: PrintElement = Gradient.GradZ.Z; break;
+                        default: PrintElement = GeoMagneticElements.Decl;
+                    }
+
+                    ColumnValues[0] = minimum.phi;
+                    ColumnValues[1] = minimum.lambda;
+                    ColumnValues[2] = (Geoid.UseGeoid == 1) ? minimum.HeightAboveGeoid : minimum.HeightAboveEllipsoid;
+                    ColumnValues[3] = startdate.DecimalYear;
+                    ColumnValues[4] = PrintElement;
+                    if(job->ElementOption == 26)
+                    {
+                        ColumnValues[4] = Gradient.GradPhi.X;
+                        ColumnValues[5] = Gradient.GradPhi.Y;
+                        ColumnValues[6] = Gradient.GradPhi.Z;
+                        ColumnValues[7] = Gradient.GradLambda.X;
+                        ColumnValues[8] = Gradient.GradLambda.Y;
+                        ColumnValues[9] = Gradient.GradLambda.Z;
+                        ColumnValues[10] = Gradient.GradZ.X;
+                        ColumnValues[11] = Gradient.GradZ.Y;
+                        ColumnValues[12] = Gradient.GradZ.Z;
+                    }
+                    if(fileout == NULL)
+                        MAG_ColumnFileWriteRow(&ColumnFile, ColumnValues);
+                    else if(job->ElementOption == 26)
+                        fprintf(fileout, "%5.2lf %6.2lf %8.4lf %7.2lf %10.2lf %10.2lf %10.2lf %10.2lf %10.2lf %10.2lf %10.2lf %10.2lf %10.2lf\n",
+                            ColumnValues[0], ColumnValues[1], ColumnValues[2], ColumnValues[3], ColumnValues[4], ColumnValues[5], ColumnValues[6],
+                            ColumnValues[7], ColumnValues[8], ColumnValues[9], ColumnValues[10], ColumnValues[11], ColumnValues[12]);
+                    else
+                        fprintf(fileout, "%5.2lf %6.2lf %8.4lf %7.2lf %10.2lf\n", ColumnValues[0], ColumnValues[1], ColumnValues[2], ColumnValues[3], PrintElement);
+                    npoints++;
+                } /* year loop */
+
+            } /*Longitude Loop */
+
+        } /* Latitude Loop */
+
+    } /* Altitude Loop */
+
+    if(fileout != NULL && fclose(fileout) != 0)
+        ok = FALSE;
+    else if(fileout == NULL && ok && !MAG_ColumnFileClose(&ColumnFile))
+        ok = FALSE;
+    free(fname);
+
+#ifdef _OPENMP
+#pragma omp critical (grid_job_status)
+#endif
+    {
+        job->npoints += npoints;
+        if(!ok)
+            job->status = FALSE;
+    }
+    return ok;
+} /* grid_job_shard */
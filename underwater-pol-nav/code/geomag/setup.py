@@ -3,10 +3,27 @@ from distutils.extension import Extension
 from Cython.Build import cythonize
 import numpy as np
 import os
+import sys
 
 sources = ['emm.pyx','GeomagnetismLibrary.c','Mesh_SubLibrary.c']
 cd = os.getcwd()
+libraries = ['rt'] if sys.platform.startswith('linux') else [] # shm_open, part of libc since glibc 2.34
+# OpenMP for EMMMesh.compute_field_array. Apple's clang has none, so the module runs on one thread there
+# unless EMM_OPENMP names flags that work (e.g. '-Xpreprocessor -fopenmp -lomp')
+if 'EMM_OPENMP' in os.environ:
+    openmp_compile = openmp_link = os.environ['EMM_OPENMP'].split()
+elif sys.platform == 'win32':
+    openmp_compile, openmp_link = ['/openmp'], []
+elif sys.platform == 'darwin':
+    openmp_compile = openmp_link = []
+else:
+    openmp_compile = openmp_link = ['-fopenmp']
+# the vector mesh kernels of Mesh_SubLibrary.c need AVX, which EMM_SIMD may enable (e.g. '-mavx2 -mfma' or '-march=native');
+# without it the scalar kernels are built
+simd_compile = os.environ.get('EMM_SIMD', '').split()
 
 setup(
-    ext_modules = cythonize([Extension('geomag.emm',sources,include_dirs=[cd],define_macros=[('_CRT_SECURE_NO_WARNINGS',None)])])
+    ext_modules = cythonize([Extension('geomag.emm',sources,include_dirs=[cd],define_macros=[('_CRT_SECURE_NO_WARNINGS',None)],libraries=libraries,
+                              extra_compile_args=openmp_compile+simd_compile,extra_link_args=openmp_link)],
+                            include_path=[os.path.dirname(cd)]) # sunpos/csunpos.pxd, for the datetime64 conversions
 )
\ No newline at end of file
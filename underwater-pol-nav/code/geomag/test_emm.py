@@ -0,0 +1,29 @@
+"""Checks of geomag.emm against the mesh files in geomag/data: python -m unittest geomag.test_emm"""
+import unittest
+from os import path
+import numpy as np
+
+from geomag.emm import EMMMesh
+
+data = path.join(path.dirname(path.abspath(__file__)), 'data')
+static = path.join(data, 'EMM-720_V3p1_static.bin')
+secvar = path.join(data, 'EMM-720_V3p1_secvar.bin')
+
+@unittest.skipUnless(path.exists(static) and path.exists(secvar), 'needs the EMM-720 meshes in geomag/data')
+class DeclinationSeriesTest(unittest.TestCase):
+    def setUp(self):
+        self.gm = EMMMesh(static, secvar)
+
+    def tearDown(self):
+        self.gm.close()
+
+    def test_nat_in_series(self):
+        #a NaT gives NaN at its own date only
+        t = np.array(['2016-01-01', 'NaT', '2016-07-01', '2017-01-01'], dtype='M8[s]')
+        series = self.gm.declination_series(30, 40, 0, t)
+        direct = self.gm.compute_field_array(30, 40, 0, t)['Decl']
+        self.assertTrue(np.isnan(series[1]))
+        np.testing.assert_allclose(series[[0, 2, 3]], direct[[0, 2, 3]], atol=1e-9)
+
+if __name__ == '__main__':
+    unittest.main()
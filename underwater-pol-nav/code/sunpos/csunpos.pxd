@@ -0,0 +1,65 @@
+#Time conversions of csunpos, shared with geomag.emm (from sunpos.csunpos cimport ...)
+#They are inline, so modules that cimport them do not import csunpos at run time
+
+cimport cython
+from libc.math cimport NAN, floor
+from libc.stdint cimport INT64_MIN
+
+cdef inline double posix_julian_day(double t) noexcept nogil:
+    """Calculate the Julian Day from a POSIX timestamp (UTC seconds since 1970-01-01)"""
+    return t/86400.0 + 2440587.5
+
+cdef inline double posix_julian_day2(double t, double* jdf) noexcept nogil:
+    """posix_julian_day split in two: returns the Julian Day at the preceding midnight (a whole day + 0.5) and stores
+    the fraction of the day in jdf, which keeps the resolution of t"""
+    cdef double days = floor(t/86400.0)
+    jdf[0] = (t - days*86400.0)/86400.0
+    return days + 2440587.5
+
+@cython.cdivision(True)
+cdef inline long long floor_div(long long v, long long d) noexcept nogil:
+    #v // d, rounding towards -inf, for d > 0
+    cdef long long q = v / d
+    if v - q*d < 0:
+        q -= 1
+    return q
+
+cdef inline double ticks_julian_day(long long v, long long per_day) noexcept nogil:
+    """Calculate the Julian Day from a count of ticks since 1970-01-01 (a datetime64 value), with per_day ticks per day.
+    Whole days and the remainder are split with integers, so only the final sum is rounded. NaT gives NaN"""
+    cdef long long days
+    if v == INT64_MIN:
+        return NAN
+    days = floor_div(v, per_day)
+    return (days + 2440587.5) + <double>(v - days*per_day)/per_day
+
+cdef inline double ticks_julian_day2(long long v, long long per_day, double* jdf) noexcept nogil:
+    """ticks_julian_day split in two, as posix_julian_day2. NaT gives NaN and a zero fraction"""
+    cdef long long days
+    if v == INT64_MIN:
+        jdf[0] = 0
+        return NAN
+    days = floor_div(v, per_day)
+    jdf[0] = <double>(v - days*per_day)/per_day
+    return days + 2440587.5
+
+cdef inline double ticks_posix(long long v, long long per_day) noexcept nogil:
+    """POSIX timestamp (seconds) of a count of ticks since 1970-01-01, as ticks_julian_day"""
+    cdef long long days
+    if v == INT64_MIN:
+        return NAN
+    days = floor_div(v, per_day)
+    return days*86400.0 + (v - days*per_day)*(86400.0/per_day)
+
+cdef inline tuple datetime64_ticks(t):
+    """Ticks since 1970-01-01 (an int64 array, NaT is INT64_MIN) and ticks per day of the datetime64 array t.
+    Units that do not divide a day (months, years...) are converted to microseconds first"""
+    t = t.astype(t.dtype.newbyteorder('='), copy=False) #the int64 view reads native byte order
+    unit = t.dtype.str.partition('[')[2].rstrip(']')
+    count = int(''.join([c for c in unit if c.isdigit()]) or 1)
+    unit = ''.join([c for c in unit if not c.isdigit()])
+    per_day = {'D': 1, 'h': 24, 'm': 1440, 's': 86400, 'ms': 86400000, 'us': 86400000000, 'ns': 86400000000000}.get(unit, 0)
+    if per_day == 0 or per_day % count:
+        t = t.astype('M8[us]')
+        per_day, count = 86400000000, 1
+    return t.view('i8'), per_day // count
@@ -6,9 +6,13 @@ import os
 
 #run setup.py build_ext --inplace
 
-sources = ['csunpos.pyx']
+sources = ['csunpos.pyx','spa_periodic.c']
 cd = os.getcwd()
+# spa_periodic.c sums two times per vector with the baseline SSE2 or NEON, more with wider registers
+# that SUNPOS_SIMD may enable (e.g. '-mavx2 -mfma' for four, '-march=native'); MSVC builds the scalar loops
+simd_compile = os.environ.get('SUNPOS_SIMD', '').split()
 
 setup(
-    ext_modules = cythonize([Extension('sunpos.csunpos',sources,include_dirs=[cd,np.get_include()],define_macros=[('_CRT_SECURE_NO_WARNINGS',None)])])
+    ext_modules = cythonize([Extension('sunpos.csunpos',sources,include_dirs=[cd,np.get_include()],define_macros=[('_CRT_SECURE_NO_WARNINGS',None)],
+                                       extra_compile_args=simd_compile)])
 )
\ No newline at end of file
@@ -0,0 +1,483 @@
+#include <math.h>
+#include <string.h>
+
+#include "spa_periodic.h"
+
+#ifndef M_PI /* not in strict C99, nor in MSVC without _USE_MATH_DEFINES */
+#define M_PI 3.14159265358979323846
+#endif
+
+/* The sums run across time samples: every lane of a vector holds one time, and the terms are broadcast */
+#if USE_SIMD && (defined(__GNUC__) || defined(__clang__)) && (defined(__SSE2__) || defined(__ARM_NEON)) /* gcc -mavx2 or -march=native for wider registers */
+#define SPA_VECTOR 1
+#define SPA_VINLINE static inline __attribute__ ((always_inline))
+#if defined(__AVX512F__)
+#define SPA_LANES 8
+#elif defined(__AVX__)
+#define SPA_LANES 4
+#else
+#define SPA_LANES 2
+#endif
+typedef double SPA_vd __attribute__ ((vector_size (SPA_LANES * sizeof (double))));
+typedef unsigned long long SPA_vu __attribute__ ((vector_size (SPA_LANES * sizeof (unsigned long long))));
+#else
+#define SPA_VECTOR 0
+#define SPA_LANES 1
+#endif
+
+#if defined(_MSC_VER)
+#define SPA_ALIGNED __declspec(align(64))
+#elif defined(__GNUC__) || defined(__clang__)
+#define SPA_ALIGNED __attribute__ ((aligned (64)))
+#else
+#define SPA_ALIGNED
+#endif
+
+typedef struct {
+    int n; /* number of terms */
+    const double *A; /* amplitudes */
+    const double *B; /* phases, in radians */
+    const double *C; /* frequencies, in radians per Julian millennium */
+} SPA_series;
+
+#define SPA_SERIES(t) {(int) (sizeof (t##A) / sizeof (double)), t##A, t##B, t##C}
+
+/* Earth heliocentric longitude (L0 to L5 in the paper) */
+static const SPA_ALIGNED double L0A[] = {
+    175347046, 3341656, 34894, 3497, 3418, 3136, 2676, 2343, 1324, 1273,
+    1199, 990, 902, 857, 780, 753, 505, 492, 357, 317,
+    284, 271, 243, 206, 205, 202, 156, 132, 126, 115,
+    103, 102, 102, 99, 98, 86, 85, 85, 80, 79,
+    71, 74, 74, 70, 62, 61, 57, 56, 56, 52,
+    52, 51, 49, 41, 41, 39, 37, 37, 36, 36,
+    33, 30, 30, 25
+};
+static const SPA_ALIGNED double L0B[] = {
+    0.0, 4.6692568, 4.6261, 2.7441, 2.8289, 3.6277, 4.4181, 6.1352, 0.7425, 2.0371,
+    1.1096, 5.233, 2.045, 3.508, 1.179, 2.533, 4.583, 4.205, 2.92, 5.849,
+    1.899, 0.315, 0.345, 4.806, 1.869, 2.4458, 0.833, 3.411, 1.083, 0.645,
+    0.636, 0.976, 4.267, 6.21, 0.68, 5.98, 1.3, 3.67, 1.81, 3.04,
+    1.76, 3.5, 4.68, 0.83, 3.98, 1.82, 2.78, 4.39, 3.47, 0.19,
+    1.33, 0.28, 0.49, 5.37, 2.4, 6.17, 6.04, 2.57, 1.71, 1.78,
+    0.59, 0.44, 2.74, 3.16
+};
+static const SPA_ALIGNED double L0C[] = {
+    0.0, 6283.07585, 12566.1517, 5753.3849, 3.5231, 77713.7715, 7860.4194, 3930.2097, 11506.7698, 529.691,
+    1577.3435, 5884.927, 26.298, 398.149, 5223.694, 5507.553, 18849.228, 775.523, 0.067, 11790.629,
+    796.298, 10977.079, 5486.778, 2544.314, 5573.143, 6069.777, 213.299, 2942.463, 20.775, 0.98,
+    4694.003, 15720.839, 7.114, 2146.17, 155.42, 161000.69, 6275.96, 71430.7, 17260.15, 12036.46,
+    5088.63, 3154.69, 801.82, 9437.76, 8827.39, 7084.9, 6286.6, 14143.5, 6279.55, 12139.55,
+    1748.02, 5856.48, 1194.45, 8429.24, 19651.05, 10447.39, 10213.29, 1059.38, 2352.87, 6812.77,
+    17789.85, 83996.85, 1349.87, 4690.48
+};
+static const SPA_ALIGNED double L1A[] = {
+    628331966747, 206059, 4303, 425, 119, 109, 93, 72, 68, 67,
+    59, 56, 45, 36, 29, 21, 19, 19, 17, 16,
+    16, 15, 12, 12, 12, 12, 11, 10, 10, 9,
+    9, 8, 6, 6
+};
+static const SPA_ALIGNED double L1B[] = {
+    0.0, 2.678235, 2.6351, 1.59, 5.796, 2.966, 2.59, 1.14, 1.87, 4.41,
+    2.89, 2.17, 0.4, 0.47, 2.65, 5.34, 1.85, 4.97, 2.99, 0.03,
+    1.43, 1.21, 2.83, 3.26, 5.27, 2.08, 0.77, 1.3, 4.24, 2.7,
+    5.64, 5.3, 2.65, 4.67
+};
+static const SPA_ALIGNED double L1C[] = {
+    0.0, 6283.07585, 12566.1517, 3.523, 26.298, 1577.344, 18849.23, 529.69, 398.15, 5507.55,
+    5223.69, 155.42, 796.3, 775.52, 7.11, 0.98, 5486.78, 213.3, 6275.96, 2544.31,
+    2146.17, 10977.08, 1748.02, 5088.63, 1194.45, 4694, 553.57, 3286.6, 1349.87, 242.73,
+    951.72, 2352.87, 9437.76, 4690.48
+};
+static const SPA_ALIGNED double L2A[] = {
+    52919, 8720, 309, 27, 16, 16, 10, 9, 7, 5,
+    4, 4, 3, 3, 3, 3, 3, 3, 2, 2
+};
+static const SPA_ALIGNED double L2B[] = {
+    0.0, 1.0721, 0.867, 0.05, 5.19, 3.68, 0.76, 2.06, 0.83, 4.66,
+    1.03, 3.44, 5.14, 6.05, 1.19, 6.12, 0.31, 2.28, 4.38, 3.75
+};
+static const SPA_ALIGNED double L2C[] = {
+    0.0, 6283.0758, 12566.152, 3.52, 26.3, 155.42, 18849.23, 77713.77, 775.52, 1577.34,
+    7.11, 5573.14, 796.3, 5507.55, 242.73, 529.69, 398.15, 553.57, 5223.69, 0.98
+};
+static const SPA_ALIGNED double L3A[] = {
+    289, 35, 17, 3, 1, 1, 1
+};
+static const SPA_ALIGNED double L3B[] = {
+    5.844, 0.0, 5.49, 5.2, 4.72, 5.3, 5.97
+};
+static const SPA_ALIGNED double L3C[] = {
+    6283.076, 0.0, 12566.15, 155.42, 3.52, 18849.23, 242.73
+};
+static const SPA_ALIGNED double L4A[] = {
+    114, 8, 1
+};
+static const SPA_ALIGNED double L4B[] = {
+    3.142, 4.13, 3.84
+};
+static const SPA_ALIGNED double L4C[] = {
+    0.0, 6283.08, 12566.15
+};
+static const SPA_ALIGNED double L5A[] = {
+    1
+};
+static const SPA_ALIGNED double L5B[] = {
+    3.14
+};
+static const SPA_ALIGNED double L5C[] = {
+    0.0
+};
+
+/* Earth heliocentric latitude (B0 and B1) */
+static const SPA_ALIGNED double B0A[] = {
+    280, 102, 80, 44, 32
+};
+static const SPA_ALIGNED double B0B[] = {
+    3.199, 5.422, 3.88, 3.7, 4.0
+};
+static const SPA_ALIGNED double B0C[] = {
+    84334.662, 5507.553, 5223.69, 2352.87, 1577.34
+};
+static const SPA_ALIGNED double B1A[] = {
+    9, 6
+};
+static const SPA_ALIGNED double B1B[] = {
+    3.9, 1.73
+};
+static const SPA_ALIGNED double B1C[] = {
+    5507.55, 5223.69
+};
+
+/* Earth heliocentric radius (R0 to R4) */
+static const SPA_ALIGNED double R0A[] = {
+    100013989, 1670700, 13956, 3084, 1628, 1576, 925, 542, 472, 346,
+    329, 307, 243, 212, 186, 175, 110, 98, 86, 86,
+    85, 63, 57, 56, 49, 47, 45, 43, 39, 38,
+    37, 37, 36, 35, 33, 32, 32, 28, 28, 26
+};
+static const SPA_ALIGNED double R0B[] = {
+    0.0, 3.0984635, 3.05525, 5.1985, 1.1739, 2.8469, 5.453, 4.564, 3.661, 0.964,
+    5.9, 0.299, 4.273, 5.847, 5.022, 3.012, 5.055, 0.89, 5.69, 1.27,
+    0.27, 0.92, 2.01, 5.24, 3.25, 2.58, 5.54, 6.01, 5.36, 2.39,
+    0.83, 4.9, 1.67, 1.84, 0.24, 0.18, 1.78, 1.21, 1.9, 4.59
+};
+static const SPA_ALIGNED double R0C[] = {
+    0.0, 6283.07585, 12566.1517, 77713.7715, 5753.3849, 7860.4194, 11506.77, 3930.21, 5884.927, 5507.553,
+    5223.694, 5573.143, 11790.629, 1577.344, 10977.079, 18849.228, 5486.778, 6069.78, 15720.84, 161000.69,
+    17260.15, 529.69, 83996.85, 71430.7, 2544.31, 775.52, 9437.76, 6275.96, 4694, 8827.39,
+    19651.05, 12139.55, 12036.46, 2942.46, 7084.9, 5088.63, 398.15, 6286.6, 6279.55, 10447.39
+};
+static const SPA_ALIGNED double R1A[] = {
+    103019, 1721, 702, 32, 31, 25, 18, 10, 9, 9
+};
+static const SPA_ALIGNED double R1B[] = {
+    1.10749, 1.0644, 3.142, 1.02, 2.84, 1.32, 1.42, 5.91, 1.42, 0.27
+};
+static const SPA_ALIGNED double R1C[] = {
+    6283.07585, 12566.1517, 0.0, 18849.23, 5507.55, 5223.69, 1577.34, 10977.08, 6275.96, 5486.78
+};
+static const SPA_ALIGNED double R2A[] = {
+    4359, 124, 12, 9, 6, 3
+};
+static const SPA_ALIGNED double R2B[] = {
+    5.7846, 5.579, 3.14, 3.63, 1.87, 5.47
+};
+static const SPA_ALIGNED double R2C[] = {
+    6283.0758, 12566.152, 0.0, 77713.77, 5573.14, 18849
+};
+static const SPA_ALIGNED double R3A[] = {
+    145, 7
+};
+static const SPA_ALIGNED double R3B[] = {
+    4.273, 3.92
+};
+static const SPA_ALIGNED double R3C[] = {
+    6283.076, 12566.15
+};
+static const SPA_ALIGNED double R4A[] = {
+    4
+};
+static const SPA_ALIGNED double R4B[] = {
+    2.56
+};
+static const SPA_ALIGNED double R4C[] = {
+    6283.08
+};
+
+/* nutation in longitude and obliquity (a, b, c, d and the columns of Y in the paper); c and d are zero after the SPA_NUT_OBL_TERMS of the paper */
+static const SPA_ALIGNED double NUTA[SPA_NUT_TERMS] = {
+    -171996, -13187, -2274, 2062, 1426, 712, -517, -386, -301, 217,
+    -158, 129, 123, 63, 63, -59, -58, -51, 48, 46,
+    -38, -31, 29, 29, 26, -22, 21, 17, 16, -16,
+    -15, -13, -12, 11, -10, -8, 7, -7, -7, -7,
+    6, 6, 6, -6, -6, 5, -5, -5, -5, 4,
+    4, 4, -4, -4, -4, 3, -3, -3, -3, -3,
+    -3, -3, -3
+};
+static const SPA_ALIGNED double NUTB[SPA_NUT_TERMS] = {
+    -174.2, -1.6, -0.2, 0.2, -3.4, 0.1, 1.2, -0.4, 0, -0.5,
+    0, 0.1, 0, 0, 0.1, 0, -0.1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -0.1, 0, 0.1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0
+};
+static const SPA_ALIGNED double NUTC[SPA_NUT_TERMS] = {
+    92025, 5736, 977, -895, 54, -7, 224, 200, 129, -95,
+    0, -70, -53, 0, -33, 26, 32, 27, 0, -24,
+    16, 13, 0, -12, 0, 0, -10, 0, -8, 7,
+    9, 7, 6, 0, 5, 3, -3, 0, 3, 3,
+    0, -3, -3, 3, 3, 0, 3, 3, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0
+};
+static const SPA_ALIGNED double NUTD[SPA_NUT_TERMS] = {
+    8.9, -3.1, -0.5, 0.5, -0.1, 0, -0.6, 0, -0.1, 0.3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0
+};
+static const SPA_ALIGNED double NUTY0[SPA_NUT_TERMS] = {
+    0, -2, 0, 0, 0, 0, -2, 0, 0, -2, -2, -2, 0, 2, 0, 2, 0, 0, -2, 0, 2,
+    0, 0, -2, 0, -2, 0, 0, 2, -2, 0, -2, 0, 0, 2, 2, 0, -2, 0, 2, 2, -2,
+    -2, 2, 2, 0, -2, -2, 0, -2, -2, 0, -1, -2, 1, 0, 0, -1, 0, 0, 2, 0, 2
+};
+static const SPA_ALIGNED double NUTY1[SPA_NUT_TERMS] = {
+    0, 0, 0, 0, 1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 2, 1, 0, -1, 0, 0, 0, 1, 1, -1, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, -1, 1, -1, -1, 0, -1
+};
+static const SPA_ALIGNED double NUTY2[SPA_NUT_TERMS] = {
+    0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, -1, 0, 1, -1, -1, 1, 2, -2, 0,
+    2, 2, 1, 0, 0, -1, 0, -1, 0, 0, 1, 0, 2, -1, 1, 0, 1, 0, 0, 1, 2,
+    1, -2, 0, 1, 0, 0, 2, 2, 0, 1, 1, 0, 0, 1, -2, 1, 1, 1, -1, 3, 0
+};
+static const SPA_ALIGNED double NUTY3[SPA_NUT_TERMS] = {
+    0, 2, 2, 0, 0, 0, 2, 2, 2, 2, 0, 2, 2, 0, 0, 2, 0, 2, 0, 2, 2,
+    2, 0, 2, 2, 2, 2, 0, 0, 2, 0, 0, 0, -2, 2, 2, 2, 0, 2, 2, 0, 2,
+    2, 0, 0, 0, 2, 0, 2, 0, 2, -2, 0, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2
+};
+static const SPA_ALIGNED double NUTY4[SPA_NUT_TERMS] = {
+    1, 2, 2, 2, 0, 0, 2, 1, 2, 2, 0, 1, 2, 0, 1, 2, 1, 1, 0, 1, 2,
+    2, 0, 2, 0, 0, 1, 0, 1, 2, 1, 1, 1, 0, 1, 2, 2, 0, 2, 1, 0, 2,
+    1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 2, 2
+};
+
+static const SPA_series L_SERIES[6] = {SPA_SERIES(L0), SPA_SERIES(L1), SPA_SERIES(L2), SPA_SERIES(L3), SPA_SERIES(L4), SPA_SERIES(L5)};
+static const SPA_series B_SERIES[2] = {SPA_SERIES(B0), SPA_SERIES(B1)};
+static const SPA_series R_SERIES[5] = {SPA_SERIES(R0), SPA_SERIES(R1), SPA_SERIES(R2), SPA_SERIES(R3), SPA_SERIES(R4)};
+
+/* polynomials of the nutation arguments x0 to x4 in degrees, highest power of the Julian ephemeris century first */
+static const double NUTX[5][4] = {
+    {1. / 189474, -0.0019142, 445267.111480, 297.85036}, /* mean elongation of the moon from the sun */
+    {-1 / 3e5, -0.0001603, 35999.050340, 357.52772}, /* mean anomaly of the sun (Earth) */
+    {1. / 56250, 0.0086972, 477198.867398, 134.96298}, /* mean anomaly of the moon */
+    {1. / 327270, -0.0036825, 483202.017538, 93.27191}, /* moon's argument of latitude */
+    {1. / 45e4, 0.0020708, -1934.136261, 125.04452} /* longitude of the ascending node of the moon's mean orbit */
+};
+
+/* sums of the series in radians (L, B) or 1e-8 AU (R), and of the nutation in 0.0001 arc seconds */
+typedef struct {
+    double L, B, R, delta_psi, delta_epsilon;
+} SPA_sums;
+
+static void spa_finish(const SPA_sums *s, double *L, double *B, double *R, double *delta_psi, double *delta_epsilon);
+#if SPA_VECTOR
+SPA_VINLINE SPA_vd spa_load_v(const double *p);
+SPA_VINLINE void spa_sincos_v(SPA_vd x, SPA_vd *s, SPA_vd *c);
+SPA_VINLINE SPA_vd spa_series_v(const SPA_series *series, SPA_vd jme);
+static void spa_periodic_v(const double *jme, const double *jce, SPA_sums *s);
+#else
+static double spa_series(const SPA_series *series, double jme);
+static void spa_periodic(double jme, double jce, SPA_sums *s);
+#endif
+
+void spa_periodic_terms(ptrdiff_t n, const double *jme, const double *jce, double *L, double *B, double *R, double *delta_psi, double *delta_epsilon)
+
+/* The Earth heliocentric longitude L and latitude B in degrees, in [0, 360), the radius R in AU, and the nutation
+   in longitude delta_psi and obliquity delta_epsilon in degrees, of n times given by their Julian ephemeris
+   millennium jme and century jce. */
+{
+    ptrdiff_t i;
+    SPA_sums s[SPA_LANES];
+#if SPA_VECTOR
+    double SPA_ALIGNED me[SPA_LANES], ce[SPA_LANES];
+    ptrdiff_t k, m;
+
+    for(i = 0; i < n; i += SPA_LANES) {
+        /* the last block repeats its last time in the unused lanes */
+        m = n - i < SPA_LANES ? n - i : SPA_LANES;
+        for(k = 0; k < SPA_LANES; k++) {
+            me[k] = jme[i + (k < m ? k : m - 1)];
+            ce[k] = jce[i + (k < m ? k : m - 1)];
+        }
+        spa_periodic_v(me, ce, s);
+        for(k = 0; k < m; k++)
+            spa_finish(&s[k], &L[i + k], &B[i + k], &R[i + k], &delta_psi[i + k], &delta_epsilon[i + k]);
+    }
+#else
+    for(i = 0; i < n; i++) {
+        spa_periodic(jme[i], jce[i], s);
+        spa_finish(s, &L[i], &B[i], &R[i], &delta_psi[i], &delta_epsilon[i]);
+    }
+#endif
+} /* spa_periodic_terms */
+
+static double spa_mod360(double x) /* x % 360 with Python semantics, in [0, 360) */
+{
+    x = fmod(x, 360);
+    if(x < 0)
+        x += 360;
+    return x;
+} /* spa_mod360 */
+
+static void spa_finish(const SPA_sums *s, double *L, double *B, double *R, double *delta_psi, double *delta_epsilon)
+{
+    *L = spa_mod360(s->L * 180.0 / M_PI);
+    *B = spa_mod360(s->B * 180.0 / M_PI);
+    *R = s->R;
+    *delta_psi = s->delta_psi * 180.0 / M_PI / 36e6;
+    *delta_epsilon = s->delta_epsilon * 180.0 / M_PI / 36e6;
+} /* spa_finish */
+
+#if SPA_VECTOR
+
+/* Cody and Waite reduction by pi/2 in three parts, exact for |x| < 2^20 pi/2 (jme within 6 millennia of J2000),
+   and the minimax polynomials of fdlibm's __kernel_sin and __kernel_cos on [-pi/4, pi/4] */
+#define SPA_SHIFT 6755399441055744.0 /* 1.5 * 2^52: adding it rounds to an integer kept in the low mantissa bits */
+#define SPA_INVPIO2 6.36619772367581382433e-01
+#define SPA_PIO2_1 1.57079632673412561417e+00 /* first 33 bits of pi/2 */
+#define SPA_PIO2_2 6.07710050630396597660e-11 /* next 33 bits */
+#define SPA_PIO2_3 2.02226624871116645580e-21
+#define SPA_S1 -1.66666666666666324348e-01
+#define SPA_S2 8.33333333332248946124e-03
+#define SPA_S3 -1.98412698298579493134e-04
+#define SPA_S4 2.75573137070700676789e-06
+#define SPA_S5 -2.50507602534068634195e-08
+#define SPA_S6 1.58969099521155010221e-10
+#define SPA_C1 4.16666666666666019037e-02
+#define SPA_C2 -1.38888888888741095749e-03
+#define SPA_C3 2.48015872894767294178e-05
+#define SPA_C4 -2.75573143513906633035e-07
+#define SPA_C5 2.08757232129817482790e-09
+#define SPA_C6 -1.13596475577881948265e-11
+
+SPA_VINLINE SPA_vd spa_load_v(const double *p) /* unaligned load of SPA_LANES doubles */
+{
+    SPA_vd v;
+
+    memcpy(&v, p, sizeof (SPA_vd));
+    return v;
+} /* spa_load_v */
+
+SPA_VINLINE void spa_sincos_v(SPA_vd x, SPA_vd *s, SPA_vd *c)
+{
+    SPA_vd t, q, r, z, sr, cr;
+    SPA_vu n, swap, sneg, cneg;
+
+    t = x * SPA_INVPIO2 + SPA_SHIFT;
+    n = (SPA_vu) t; /* quadrant in the two lowest bits, also for negative x */
+    q = t - SPA_SHIFT;
+    r = ((x - q * SPA_PIO2_1) - q * SPA_PIO2_2) - q * SPA_PIO2_3;
+    z = r * r;
+    sr = r + r * z * (SPA_S1 + z * (SPA_S2 + z * (SPA_S3 + z * (SPA_S4 + z * (SPA_S5 + z * SPA_S6)))));
+    cr = 1.0 - 0.5 * z + z * z * (SPA_C1 + z * (SPA_C2 + z * (SPA_C3 + z * (SPA_C4 + z * (SPA_C5 + z * SPA_C6)))));
+    swap = -(n & 1); /* odd quadrants exchange sine and cosine */
+    sneg = (n & 2) << 62; /* sign bit of the sine, negative in quadrants 2 and 3 */
+    cneg = ((n + 1) & 2) << 62; /* of the cosine, negative in quadrants 1 and 2 */
+    *s = (SPA_vd) (((swap & (SPA_vu) cr) | (~swap & (SPA_vu) sr)) ^ sneg);
+    *c = (SPA_vd) (((swap & (SPA_vu) sr) | (~swap & (SPA_vu) cr)) ^ cneg);
+} /* spa_sincos_v */
+
+SPA_VINLINE SPA_vd spa_series_v(const SPA_series *series, SPA_vd jme) /* sum of A cos(B + C jme) */
+{
+    SPA_vd sum = jme * 0.0, s, c;
+    int i;
+
+    for(i = 0; i < series->n; i++) {
+        spa_sincos_v(series->B[i] + series->C[i] * jme, &s, &c);
+        sum += series->A[i] * c;
+    }
+    return sum;
+} /* spa_series_v */
+
+static void spa_periodic_v(const double *jme, const double *jce, SPA_sums *out)
+{
+    SPA_vd me = spa_load_v(jme), ce = spa_load_v(jce);
+    SPA_vd L, B, R, x[5], arg, s, c, dp, de;
+    int i, k;
+
+    L = me * 0.0;
+    for(i = 5; i >= 0; i--)
+        L = L * me + spa_series_v(&L_SERIES[i], me);
+    B = spa_series_v(&B_SERIES[1], me) * me + spa_series_v(&B_SERIES[0], me);
+    R = me * 0.0;
+    for(i = 4; i >= 0; i--)
+        R = R * me + spa_series_v(&R_SERIES[i], me);
+
+    for(k = 0; k < 5; k++)
+        x[k] = (((NUTX[k][0] * ce + NUTX[k][1]) * ce + NUTX[k][2]) * ce + NUTX[k][3]) * M_PI / 180.0;
+    dp = de = ce * 0.0;
+    for(i = 0; i < SPA_NUT_TERMS; i++) {
+        arg = NUTY0[i] * x[0] + NUTY1[i] * x[1] + NUTY2[i] * x[2] + NUTY3[i] * x[3] + NUTY4[i] * x[4];
+        spa_sincos_v(arg, &s, &c);
+        dp += (NUTA[i] + NUTB[i] * ce) * s;
+        de += (NUTC[i] + NUTD[i] * ce) * c;
+    }
+
+    for(k = 0; k < SPA_LANES; k++) {
+        out[k].L = L[k] / 1e8;
+        out[k].B = B[k] / 1e8;
+        out[k].R = R[k] / 1e8;
+        out[k].delta_psi = dp[k];
+        out[k].delta_epsilon = de[k];
+    }
+} /* spa_periodic_v */
+
+#else
+
+static double spa_series(const SPA_series *series, double jme) /* sum of A cos(B + C jme) */
+{
+    double sum = 0.0;
+    int i;
+
+    for(i = 0; i < series->n; i++)
+        sum += series->A[i] * cos(series->B[i] + series->C[i] * jme);
+    return sum;
+} /* spa_series */
+
+static void spa_periodic(double jme, double jce, SPA_sums *out)
+{
+    double L, B, R, x[5], arg, dp, de;
+    int i, k;
+
+    L = 0.0;
+    for(i = 5; i >= 0; i--)
+        L = L * jme + spa_series(&L_SERIES[i], jme);
+    B = spa_series(&B_SERIES[1], jme) * jme + spa_series(&B_SERIES[0], jme);
+    R = 0.0;
+    for(i = 4; i >= 0; i--)
+        R = R * jme + spa_series(&R_SERIES[i], jme);
+
+    for(k = 0; k < 5; k++)
+        x[k] = (((NUTX[k][0] * jce + NUTX[k][1]) * jce + NUTX[k][2]) * jce + NUTX[k][3]) * M_PI / 180.0;
+    dp = de = 0.0;
+    for(i = 0; i < SPA_NUT_TERMS; i++) {
+        arg = NUTY0[i] * x[0] + NUTY1[i] * x[1] + NUTY2[i] * x[2] + NUTY3[i] * x[3] + NUTY4[i] * x[4];
+        dp += (NUTA[i] + NUTB[i] * jce) * sin(arg);
+        if(i < SPA_NUT_OBL_TERMS)
+            de += (NUTC[i] + NUTD[i] * jce) * cos(arg);
+    }
+
+    out->L = L / 1e8;
+    out->B = B / 1e8;
+    out->R = R / 1e8;
+    out->delta_psi = dp;
+    out->delta_epsilon = de;
+} /* spa_periodic */
+
+#endif
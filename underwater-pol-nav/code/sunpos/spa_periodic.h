@@ -0,0 +1,17 @@
+#ifndef SPA_PERIODIC_H
+#define SPA_PERIODIC_H
+
+#include <stddef.h>
+
+/* Periodic terms of the solar position algorithm (I. Reda and A. Andreas, Solar Energy 76(5), 2004):
+   the Earth heliocentric position of the VSOP87 tables and the nutation, for many times at once */
+
+#ifndef USE_SIMD
+#define USE_SIMD 1              /* Turn off only for testing; the vector cosine is within about 1 ulp of libm */
+#endif
+#define SPA_NUT_TERMS 63        /* terms of the nutation in longitude */
+#define SPA_NUT_OBL_TERMS 49    /* leading terms that also have a nutation in obliquity */
+
+void spa_periodic_terms(ptrdiff_t n, const double *jme, const double *jce, double *L, double *B, double *R, double *delta_psi, double *delta_epsilon);
+
+#endif /*SPA_PERIODIC_H*/